@@ -0,0 +1,51 @@
+import argparse
+import sys
+
+
+def main(args):
+  parser = argparse.ArgumentParser(description="Generate the particle files of mpm_dfgMovingGrid_benchmark.xml "
+                                   "by splitting the particles of mpm_dfgMovingGrid.xml.")
+  parser.add_argument('-r', '--refinement', type=int, default=32,
+                      help="refinement of the background grid in x and y (nx = ny = 6 * refinement in the deck)")
+  parser.add_argument('-i', '--input', default="mpmParticleFile_dfgMovingGrid")
+  parser.add_argument('-o', '--output', default="mpmParticleFile_dfgMovingGrid_benchmark")
+  parser.add_argument('--header', default="mpmHeaderFile_dfgMovingGrid_benchmark")
+  args = parser.parse_args(args)
+
+  # The original particles fill one cell each, they are split into 2 x 2 particles per refined cell
+  split = 2 * args.refinement
+
+  with open(args.input) as f:
+    particles = [ [ float(v) for v in line.split() ] for line in f if line.strip() ]
+
+  numParticles = 0
+  with open(args.output, 'w') as f:
+    for p in particles:
+      # Columns: id, center (3), velocity (3), material direction (3), material, group, surface flag, damage,
+      # strength scale, r-vectors (3 x 3)
+      r1 = p[15:18]
+      r2 = p[18:21]
+      for i in range(split):
+        for j in range(split):
+          # Offsets of the sub-particle center, in units of the original r-vectors (which span [-1, 1])
+          a = ( 2 * i + 1 ) / split - 1
+          b = ( 2 * j + 1 ) / split - 1
+          q = list(p)
+          numParticles += 1
+          for d in range(3):
+            q[1 + d] = p[1 + d] + a * r1[d] + b * r2[d]
+            q[15 + d] = r1[d] / split
+            q[18 + d] = r2[d] / split
+          f.write(f"{numParticles} " + "\t".join(f"{v:.10g}" for v in q[1:]) + "\n")
+
+  with open(args.header, 'w') as f:
+    f.write("2\t1\n")
+    f.write("stiff\t0\n")
+    f.write("compliant\t1\n")
+    f.write(f"CPDI\t{numParticles}\n")
+
+  print(f"Wrote {numParticles} particles to {args.output}")
+
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
@@ -337,6 +337,44 @@ public:
                          int * displacements,
                          MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoall.
+   * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] sendcount The number of values to send to each process.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] recvcount The number of values to receive from each process.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoall().
+   */
+  template< typename T >
+  static int allToAll( T const * sendbuf,
+                       int sendcount,
+                       T * recvbuf,
+                       int recvcount,
+                       MPI_Comm comm );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoallv.
+   * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] sendcounts The number of values to send to each process.
+   * @param[in] senddispls The displacement of the values sent to each process in @p sendbuf.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] recvcounts The number of values to receive from each process.
+   * @param[in] recvdispls The displacement of the values received from each process in @p recvbuf.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoallv().
+   */
+  template< typename T >
+  static int allToAllv( T const * sendbuf,
+                        int const * sendcounts,
+                        int const * senddispls,
+                        T * recvbuf,
+                        int const * recvcounts,
+                        int const * recvdispls,
+                        MPI_Comm comm );
+
   /**
    * @brief Convenience function for MPI_Allgather.
    * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
@@ -718,6 +756,44 @@ int MpiWrapper::allgatherv( T_SEND const * const sendbuf,
 }
 
 
+template< typename T >
+int MpiWrapper::allToAll( T const * const sendbuf,
+                          int sendcount,
+                          T * const recvbuf,
+                          int recvcount,
+                          MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOS_USE_MPI
+  return MPI_Alltoall( sendbuf, sendcount, internal::getMpiType< T >(),
+                       recvbuf, recvcount, internal::getMpiType< T >(),
+                       comm );
+#else
+  GEOS_ERROR_IF_NE_MSG( sendcount, recvcount, "sendcount is not equal to recvcount." );
+  std::copy( sendbuf, sendbuf + sendcount, recvbuf );
+  return 0;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::allToAllv( T const * const sendbuf,
+                           int const * const sendcounts,
+                           int const * const senddispls,
+                           T * const recvbuf,
+                           int const * const recvcounts,
+                           int const * const recvdispls,
+                           MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOS_USE_MPI
+  return MPI_Alltoallv( sendbuf, sendcounts, senddispls, internal::getMpiType< T >(),
+                        recvbuf, recvcounts, recvdispls, internal::getMpiType< T >(),
+                        comm );
+#else
+  GEOS_ERROR_IF_NE_MSG( sendcounts[0], recvcounts[0], "sendcount is not equal to recvcount." );
+  std::copy( sendbuf + senddispls[0], sendbuf + senddispls[0] + sendcounts[0], recvbuf + recvdispls[0] );
+  return 0;
+#endif
+}
+
 template< typename T >
 void MpiWrapper::allGather( T const myValue, array1d< T > & allValues, MPI_Comm MPI_PARAM( comm ) )
 {
@@ -96,6 +96,13 @@ public:
   // Bring in base implementations to prevent hiding warnings
   using ElasticIsotropicUpdates::smallStrainUpdate;
 
+  GEOS_HOST_DEVICE
+  virtual void smallStrainUpdate_StressOnly( localIndex const k,
+                                             localIndex const q,
+                                             real64 const & timeIncrement,
+                                             real64 const ( &strainIncrement )[6],
+                                             real64 ( &stress )[6] ) const override;
+
   GEOS_HOST_DEVICE
   void smallStrainUpdate( localIndex const k,
                           localIndex const q,
@@ -112,6 +119,14 @@ public:
                                   real64 ( &stress )[6],
                                   DiscretizationOps & stiffness ) const;
 
+  template< int NUM_POINTS >
+  GEOS_HOST_DEVICE
+  void smallStrainUpdateBatch_StressOnly( localIndex const k,
+                                          localIndex const q0,
+                                          real64 const & timeIncrement,
+                                          real64 const ( &strainIncrement )[6][NUM_POINTS],
+                                          real64 ( &stress )[6][NUM_POINTS] ) const;
+
   GEOS_HOST_DEVICE
   virtual void smallStrainUpdate_ElasticOnly( localIndex const k,
                                               localIndex const q,
@@ -139,6 +154,39 @@ public:
   }
 
 private:
+
+  /**
+   * @brief Plastic correction of a trial stress, without the tangent stiffness.
+   * @param[in] k Element index.
+   * @param[in] q Quadrature point index.
+   * @param[inout] stress The trial stress, replaced by the stress returned to the yield surface if it yields
+   *
+   * Saves the new stress and cohesion of the quadrature point if it yields.
+   */
+  GEOS_HOST_DEVICE
+  void plasticCorrection_StressOnly( localIndex const k,
+                                     localIndex const q,
+                                     real64 ( &stress )[6] ) const;
+
+  /**
+   * @brief Return mapping of a trial stress lying outside of the yield surface.
+   * @param[in] k Element index.
+   * @param[in] q Quadrature point index.
+   * @param[in] trialP Mean stress invariant of the trial stress
+   * @param[in] trialQ Von Mises stress invariant of the trial stress
+   * @param[out] solution The new mean and von Mises stress invariants, and the plastic multiplier
+   * @param[out] jacobianInv The inverse of the Jacobian of the last Newton iteration
+   *
+   * Also updates the cohesion of the quadrature point.
+   */
+  GEOS_HOST_DEVICE
+  void returnMapping( localIndex const k,
+                      localIndex const q,
+                      real64 const trialP,
+                      real64 const trialQ,
+                      real64 ( &solution )[3],
+                      real64 ( &jacobianInv )[3][3] ) const;
+
   /// A reference to the ArrayView holding the friction angle for each element.
   arrayView1d< real64 const > const m_friction;
 
@@ -159,50 +207,20 @@ private:
 
 GEOS_HOST_DEVICE
 inline
-void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
-                                              localIndex const q,
-                                              real64 const & timeIncrement,
-                                              real64 const ( &strainIncrement )[6],
-                                              real64 ( & stress )[6],
-                                              real64 ( & stiffness )[6][6] ) const
+void DruckerPragerUpdates::returnMapping( localIndex const k,
+                                          localIndex const q,
+                                          real64 const trialP,
+                                          real64 const trialQ,
+                                          real64 ( & solution )[3],
+                                          real64 ( & jacobianInv )[3][3] ) const
 {
-  // elastic predictor (assume strainIncrement is all elastic)
-  ElasticIsotropicUpdates::smallStrainUpdate( k, q, timeIncrement, strainIncrement, stress, stiffness );
-
-  if( m_disableInelasticity )
-  {
-    return;
-  }
-
-  // decompose into mean (P) and von Mises (Q) stress invariants
-
-  real64 trialP;
-  real64 trialQ;
-  real64 deviator[6];
-
-  twoInvariant::stressDecomposition( stress,
-                                     trialP,
-                                     trialQ,
-                                     deviator );
-
-  // check yield function F <= 0, using old hardening variable state
-
-  real64 yield = trialQ + m_friction[k] * trialP - m_oldCohesion[k][q];
-
-  if( yield < 1e-9 ) // elasticity
-  {
-    return;
-  }
-
-  // else, plasticity (trial stress point lies outside yield surface)
-
   // the return mapping can in general be written as a newton iteration.
   // here we have a linear problem, so the algorithm will converge in one
   // iteration, but this is a template for more general models with either
   // nonlinear hardening or yield surfaces.
 
-  real64 solution[3] = {}, residual[3] = {}, delta[3] = {};
-  real64 jacobian[3][3] = {{}}, jacobianInv[3][3] = {{}};
+  real64 residual[3] = {}, delta[3] = {};
+  real64 jacobian[3][3] = {{}};
 
   solution[0] = trialP; // initial guess for newP
   solution[1] = trialQ; // initial guess for newQ
@@ -267,6 +285,51 @@ void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
       solution[i] -= delta[i];
     }
   }
+}
+
+
+GEOS_HOST_DEVICE
+inline
+void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
+                                              localIndex const q,
+                                              real64 const & timeIncrement,
+                                              real64 const ( &strainIncrement )[6],
+                                              real64 ( & stress )[6],
+                                              real64 ( & stiffness )[6][6] ) const
+{
+  // elastic predictor (assume strainIncrement is all elastic)
+  ElasticIsotropicUpdates::smallStrainUpdate( k, q, timeIncrement, strainIncrement, stress, stiffness );
+
+  if( m_disableInelasticity )
+  {
+    return;
+  }
+
+  // decompose into mean (P) and von Mises (Q) stress invariants
+
+  real64 trialP;
+  real64 trialQ;
+  real64 deviator[6];
+
+  twoInvariant::stressDecomposition( stress,
+                                     trialP,
+                                     trialQ,
+                                     deviator );
+
+  // check yield function F <= 0, using old hardening variable state
+
+  real64 yield = trialQ + m_friction[k] * trialP - m_oldCohesion[k][q];
+
+  if( yield < 1e-9 ) // elasticity
+  {
+    return;
+  }
+
+  // else, plasticity (trial stress point lies outside yield surface)
+
+  real64 solution[3] = {};
+  real64 jacobianInv[3][3] = {{}};
+  returnMapping( k, q, trialP, trialQ, solution, jacobianInv );
 
   // re-construct stress = P*eye + sqrt(2/3)*Q*nhat
 
@@ -313,6 +376,127 @@ void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
   return;
 }
 
+GEOS_HOST_DEVICE
+inline
+void DruckerPragerUpdates::plasticCorrection_StressOnly( localIndex const k,
+                                                         localIndex const q,
+                                                         real64 ( & stress )[6] ) const
+{
+  // decompose into mean (P) and von Mises (Q) stress invariants
+
+  real64 trialP;
+  real64 trialQ;
+  real64 deviator[6];
+
+  twoInvariant::stressDecomposition( stress,
+                                     trialP,
+                                     trialQ,
+                                     deviator );
+
+  // check yield function F <= 0, using old hardening variable state
+
+  real64 const yield = trialQ + m_friction[k] * trialP - m_oldCohesion[k][q];
+
+  if( yield < 1e-9 ) // elasticity
+  {
+    return;
+  }
+
+  // else, plasticity (trial stress point lies outside yield surface)
+
+  real64 solution[3] = {};
+  real64 jacobianInv[3][3] = {{}};
+  returnMapping( k, q, trialP, trialQ, solution, jacobianInv );
+
+  // re-construct stress = P*eye + sqrt(2/3)*Q*nhat
+
+  twoInvariant::stressRecomposition( solution[0],
+                                     solution[1],
+                                     deviator,
+                                     stress );
+
+  saveStress( k, q, stress );
+}
+
+GEOS_HOST_DEVICE
+inline
+void DruckerPragerUpdates::smallStrainUpdate_StressOnly( localIndex const k,
+                                                         localIndex const q,
+                                                         real64 const & timeIncrement,
+                                                         real64 const ( &strainIncrement )[6],
+                                                         real64 ( & stress )[6] ) const
+{
+  // elastic predictor (assume strainIncrement is all elastic)
+  ElasticIsotropicUpdates::smallStrainUpdate_StressOnly( k, q, timeIncrement, strainIncrement, stress );
+
+  if( m_disableInelasticity )
+  {
+    return;
+  }
+
+  plasticCorrection_StressOnly( k, q, stress );
+}
+
+template< int NUM_POINTS >
+GEOS_HOST_DEVICE
+inline
+void DruckerPragerUpdates::smallStrainUpdateBatch_StressOnly( localIndex const k,
+                                                              localIndex const q0,
+                                                              real64 const & timeIncrement,
+                                                              real64 const ( &strainIncrement )[6][NUM_POINTS],
+                                                              real64 ( & stress )[6][NUM_POINTS] ) const
+{
+  // elastic predictor (assume strainIncrement is all elastic)
+  ElasticIsotropicUpdates::smallStrainUpdateBatch_StressOnly< NUM_POINTS >( k, q0, timeIncrement, strainIncrement, stress );
+
+  if( m_disableInelasticity )
+  {
+    return;
+  }
+
+  // check yield function F <= 0 for the whole batch, using old hardening variable state
+  // (same invariants as twoInvariant::stressDecomposition)
+
+  real64 yield[NUM_POINTS];
+  for( int p = 0; p < NUM_POINTS; ++p )
+  {
+    real64 const trialP = ( stress[0][p] + stress[1][p] + stress[2][p] ) / 3;
+    real64 devNormSquared = 0;
+    for( int i = 0; i < 3; ++i )
+    {
+      devNormSquared += ( stress[i][p] - trialP ) * ( stress[i][p] - trialP );
+      devNormSquared += 2 * stress[i+3][p] * stress[i+3][p];
+    }
+    real64 const trialQ = std::sqrt( devNormSquared ) * sqrt( 3./2. );
+    yield[p] = trialQ + m_friction[k] * trialP - m_oldCohesion[k][q0 + p];
+  }
+
+  // plasticity is handled point by point, only for the points close to or outside of the yield surface.
+  // The pointwise correction takes the final decision with the same tolerance as smallStrainUpdate_StressOnly,
+  // the margin covers the round-off differences between the two computations of the invariants.
+
+  for( int p = 0; p < NUM_POINTS; ++p )
+  {
+    if( yield[p] < 0.0 ) // elasticity
+    {
+      continue;
+    }
+
+    real64 pointStress[6];
+    for( int i = 0; i < 6; ++i )
+    {
+      pointStress[i] = stress[i][p];
+    }
+
+    plasticCorrection_StressOnly( k, q0 + p, pointStress );
+
+    for( int i = 0; i < 6; ++i )
+    {
+      stress[i][p] = pointStress[i];
+    }
+  }
+}
+
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void DruckerPragerUpdates::smallStrainUpdate_ElasticOnly( localIndex const k,
@@ -341,6 +525,11 @@ void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
 
 
 
+/// DruckerPragerUpdates implements the batched small strain updates
+template<>
+struct hasBatchedSmallStrainUpdate< DruckerPragerUpdates > : std::true_type
+{};
+
 /**
  * @class DruckerPrager
  *
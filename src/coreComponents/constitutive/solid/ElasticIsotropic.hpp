@@ -117,6 +117,14 @@ public:
                           real64 ( &stress )[6],
                           real64 ( &stiffness )[6][6] ) const;
 
+  template< int NUM_POINTS >
+  GEOS_HOST_DEVICE
+  void smallStrainUpdateBatch_StressOnly( localIndex const k,
+                                          localIndex const q0,
+                                          real64 const & timeIncrement,
+                                          real64 const ( &strainIncrement )[6][NUM_POINTS],
+                                          real64 ( &stress )[6][NUM_POINTS] ) const;
+
   GEOS_HOST_DEVICE
   virtual void smallStrainUpdate( localIndex const k,
                                   localIndex const q,
@@ -294,6 +302,48 @@ void ElasticIsotropicUpdates::smallStrainUpdate_StressOnly( localIndex const k,
 }
 
 
+template< int NUM_POINTS >
+GEOS_HOST_DEVICE
+inline
+void ElasticIsotropicUpdates::smallStrainUpdateBatch_StressOnly( localIndex const k,
+                                                                 localIndex const q0,
+                                                                 real64 const & timeIncrement,
+                                                                 real64 const ( &strainIncrement )[6][NUM_POINTS],
+                                                                 real64 ( & stress )[6][NUM_POINTS] ) const
+{
+  GEOS_UNUSED_VAR( timeIncrement );
+
+  // the moduli are per element, so they are loaded once for the whole batch
+  real64 const G = m_shearModulus[k];
+  real64 const twoG = 2 * G;
+  real64 const lambda = conversions::bulkModAndShearMod::toFirstLame( m_bulkModulus[k], G );
+
+  for( int p = 0; p < NUM_POINTS; ++p )
+  {
+    real64 const vol = lambda * ( strainIncrement[0][p] + strainIncrement[1][p] + strainIncrement[2][p] );
+    stress[0][p] = vol + twoG * strainIncrement[0][p];
+    stress[1][p] = vol + twoG * strainIncrement[1][p];
+    stress[2][p] = vol + twoG * strainIncrement[2][p];
+  }
+  for( int i = 3; i < 6; ++i )
+  {
+    for( int p = 0; p < NUM_POINTS; ++p )
+    {
+      stress[i][p] = G * strainIncrement[i][p];
+    }
+  }
+
+  for( int i = 0; i < 6; ++i )
+  {
+    for( int p = 0; p < NUM_POINTS; ++p )
+    {
+      stress[i][p] += m_oldStress( k, q0 + p, i );
+      m_newStress( k, q0 + p, i ) = stress[i][p];
+    }
+  }
+}
+
+
 GEOS_HOST_DEVICE
 inline
 void ElasticIsotropicUpdates::smallStrainUpdate( localIndex const k,
@@ -386,6 +436,11 @@ void ElasticIsotropicUpdates::viscousStateUpdate( localIndex const k,
  */
 
 
+/// ElasticIsotropicUpdates implements the batched small strain updates
+template<>
+struct hasBatchedSmallStrainUpdate< ElasticIsotropicUpdates > : std::true_type
+{};
+
 /**
  * @class ElasticIsotropic
  *
@@ -287,6 +287,38 @@ public:
     GEOS_ERROR( "smallStrainNoStateUpdate_StressOnly() not implemented for this model" );
   }
 
+  /**
+   * @brief Small strain update of a batch of quadrature points, returning only stress.
+   *
+   * The strain increments and stresses of the quadrature points [q0, q0+NUM_POINTS) of element k
+   * are stored in structure-of-arrays form (component first), so that models can vectorize the
+   * update over the quadrature points. The stresses and state updates are the same as the ones of
+   * smallStrainUpdate() on each point. Only the models for which hasBatchedSmallStrainUpdate is true
+   * implement it.
+   *
+   * @tparam NUM_POINTS Number of quadrature points of the batch.
+   * @param[in] k Element index.
+   * @param[in] q0 Index of the first quadrature point of the batch.
+   * @param[in] timeIncrement time increment for rate-dependent models.
+   * @param[in] strainIncrement Strain increments in Voight notation, indexed by [component][point]
+   * @param[out] stress New stress values (Cauchy stress), indexed by [component][point]
+   */
+  template< int NUM_POINTS >
+  GEOS_HOST_DEVICE
+  void smallStrainUpdateBatch_StressOnly( localIndex const k,
+                                          localIndex const q0,
+                                          real64 const & timeIncrement,
+                                          real64 const ( &strainIncrement )[6][NUM_POINTS],
+                                          real64 ( & stress )[6][NUM_POINTS] ) const
+  {
+    GEOS_UNUSED_VAR( k );
+    GEOS_UNUSED_VAR( q0 );
+    GEOS_UNUSED_VAR( timeIncrement );
+    GEOS_UNUSED_VAR( strainIncrement );
+    GEOS_UNUSED_VAR( stress );
+    GEOS_ERROR( "smallStrainUpdateBatch_StressOnly() not implemented for this model" );
+  }
+
   /**
    * @brief Helper to save point stress back to m_newStress array
    *
@@ -529,6 +561,18 @@ public:
 };
 
 
+/**
+ * @brief Trait telling whether a solid model update class provides the batched small strain updates.
+ * @tparam UPDATE the update class (KernelWrapper) of the model
+ *
+ * The trait is specialized for each update class implementing smallStrainUpdateBatch_StressOnly().
+ * It is not inherited by derived update classes, which must re-implement the batched update (and
+ * specialize the trait) when they change the pointwise update.
+ */
+template< typename UPDATE >
+struct hasBatchedSmallStrainUpdate : std::false_type
+{};
+
 /**
  * @class SolidBase
  * This class serves as the base class for solid constitutive models.
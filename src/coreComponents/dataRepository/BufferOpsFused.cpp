@@ -0,0 +1,203 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BufferOpsFused.cpp
+ */
+
+#include "BufferOpsFused.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/TimingMacros.hpp"
+
+#include <cstdint>
+
+namespace geos
+{
+
+namespace bufferOps
+{
+
+namespace
+{
+
+/// Alignment of the segments in the buffers
+constexpr localIndex segmentAlignment = 8;
+
+/**
+ * @brief Copy a slice of a segment to or from the buffer.
+ * @tparam PACK whether to copy the slice to the buffer or the buffer to the slice
+ * @param segment the segment
+ * @param ii the position of the slice in the segment
+ */
+template< bool PACK >
+GEOS_HOST_DEVICE
+inline void copySlice( FusedPackSegment const & segment, localIndex const ii )
+{
+  FusedPackLayout const & layout = segment.layout;
+  localIndex const numWords = layout.elementSize / sizeof( std::uint32_t );
+  std::uint32_t * bufferWords = reinterpret_cast< std::uint32_t * >( segment.buffer ) + ii * segment.sliceSize * numWords;
+  localIndex const sliceOffset = segment.indices[ ii ] * layout.strides[ 0 ];
+
+  for( localIndex v = 0; v < segment.sliceSize; ++v )
+  {
+    // position of the v-th value of the slice, the last dimension being the fastest
+    localIndex offset = sliceOffset;
+    localIndex remainder = v;
+    for( int dim = layout.numDims - 1; dim > 0; --dim )
+    {
+      offset += ( remainder % layout.dims[ dim ] ) * layout.strides[ dim ];
+      remainder /= layout.dims[ dim ];
+    }
+
+    std::uint32_t * const valueWords = reinterpret_cast< std::uint32_t * >( segment.data + offset * layout.elementSize );
+    for( localIndex w = 0; w < numWords; ++w )
+    {
+      if( PACK )
+      {
+        bufferWords[ w ] = valueWords[ w ];
+      }
+      else
+      {
+        valueWords[ w ] = bufferWords[ w ];
+      }
+    }
+    bufferWords += numWords;
+  }
+}
+
+}
+
+FusedPackTable::FusedPackTable()
+{
+  m_segmentOffsets.emplace_back( 0 );
+}
+
+localIndex FusedPackTable::segmentSize( FusedPackLayout const & layout, localIndex const numIndices )
+{
+  localIndex sliceSize = 1;
+  for( int dim = 1; dim < layout.numDims; ++dim )
+  {
+    sliceSize *= layout.dims[ dim ];
+  }
+  localIndex const size = numIndices * sliceSize * layout.elementSize;
+  return ( size + segmentAlignment - 1 ) / segmentAlignment * segmentAlignment;
+}
+
+localIndex FusedPackTable::addSegment( FusedPackSegment segment, localIndex const numIndices )
+{
+  GEOS_ERROR_IF( segment.layout.elementSize % sizeof( std::uint32_t ) != 0,
+                 "Fused packing requires values with a size multiple of 4 bytes" );
+  GEOS_ERROR_IF( segment.layout.numDims < 1 || segment.layout.numDims > FusedPackLayout::maxNumDims,
+                 "Fused packing requires arrays with 1 to " << FusedPackLayout::maxNumDims << " dimensions" );
+
+  segment.sliceSize = 1;
+  for( int dim = 1; dim < segment.layout.numDims; ++dim )
+  {
+    segment.sliceSize *= segment.layout.dims[ dim ];
+  }
+
+  m_segments.emplace_back( segment );
+  m_segmentOffsets.emplace_back( m_segmentOffsets.back() + numIndices );
+  return segmentSize( segment.layout, numIndices );
+}
+
+localIndex FusedPackTable::addPackSegment( void const * data,
+                                           FusedPackLayout const & layout,
+                                           arrayView1d< localIndex const > const & indices,
+                                           buffer_unit_type * & buffer )
+{
+  indices.move( parallelDeviceMemorySpace, false );
+
+  FusedPackSegment segment{};
+  // the data is only read by pack()
+  segment.data = reinterpret_cast< buffer_unit_type * >( const_cast< void * >( data ) );
+  segment.buffer = buffer;
+  segment.indices = indices.data();
+  segment.layout = layout;
+
+  localIndex const size = addSegment( segment, indices.size() );
+  buffer += size;
+  return size;
+}
+
+localIndex FusedPackTable::addUnpackSegment( void * data,
+                                             FusedPackLayout const & layout,
+                                             arrayView1d< localIndex const > const & indices,
+                                             buffer_unit_type const * & buffer )
+{
+  indices.move( parallelDeviceMemorySpace, false );
+
+  FusedPackSegment segment{};
+  segment.data = reinterpret_cast< buffer_unit_type * >( data );
+  // the buffer is only read by unpack()
+  segment.buffer = const_cast< buffer_unit_type * >( buffer );
+  segment.indices = indices.data();
+  segment.layout = layout;
+
+  localIndex const size = addSegment( segment, indices.size() );
+  buffer += size;
+  return size;
+}
+
+template< bool PACK >
+void FusedPackTable::launch() const
+{
+  localIndex const numSegments = m_segments.size();
+  localIndex const numSlices = m_segmentOffsets.back();
+  if( numSlices == 0 )
+  {
+    return;
+  }
+
+  arrayView1d< FusedPackSegment const > const segments = m_segments.toViewConst();
+  arrayView1d< localIndex const > const segmentOffsets = m_segmentOffsets.toViewConst();
+
+  forAll< parallelDevicePolicy<> >( numSlices, [=] GEOS_HOST_DEVICE ( localIndex const slice )
+  {
+    // find the (non-empty) segment holding the slice: segmentOffsets[first] <= slice < segmentOffsets[last]
+    localIndex first = 0;
+    localIndex last = numSegments;
+    while( last - first > 1 )
+    {
+      localIndex const middle = ( first + last ) / 2;
+      if( segmentOffsets[ middle ] <= slice )
+      {
+        first = middle;
+      }
+      else
+      {
+        last = middle;
+      }
+    }
+    copySlice< PACK >( segments[ first ], slice - segmentOffsets[ first ] );
+  } );
+}
+
+void FusedPackTable::pack() const
+{
+  GEOS_MARK_FUNCTION;
+  launch< true >();
+}
+
+void FusedPackTable::unpack() const
+{
+  GEOS_MARK_FUNCTION;
+  launch< false >();
+}
+
+} // namespace bufferOps
+
+} // namespace geos
@@ -0,0 +1,178 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BufferOpsFused.hpp
+ */
+
+#ifndef GEOS_DATAREPOSITORY_BUFFEROPSFUSED_HPP_
+#define GEOS_DATAREPOSITORY_BUFFEROPSFUSED_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+namespace bufferOps
+{
+
+/**
+ * @struct FusedPackLayout
+ * @brief Memory layout of an array that can be packed by a FusedPackTable.
+ */
+struct FusedPackLayout
+{
+  /// The maximum number of dimensions of the array
+  static constexpr int maxNumDims = 4;
+
+  /// The size of a value in bytes (a multiple of 4)
+  int elementSize = 0;
+
+  /// The number of dimensions
+  int numDims = 0;
+
+  /// The size of each dimension
+  localIndex dims[ maxNumDims ] = {};
+
+  /// The stride of each dimension, in number of values
+  localIndex strides[ maxNumDims ] = {};
+};
+
+/**
+ * @struct FusedPackSegment
+ * @brief Packing of the slices of an array at a list of indices, into a contiguous part of a buffer.
+ */
+struct FusedPackSegment
+{
+  /// The first value of the array
+  buffer_unit_type * data;
+
+  /// The start of the segment in the buffer
+  buffer_unit_type * buffer;
+
+  /// The indices (along the first dimension) of the slices to pack
+  localIndex const * indices;
+
+  /// The number of values in a slice
+  localIndex sliceSize;
+
+  /// The layout of the array
+  FusedPackLayout layout;
+};
+
+/**
+ * @class FusedPackTable
+ * @brief Table of the segments packed (or unpacked) by a single kernel.
+ *
+ * The device packing of a wrapper launches one kernel per wrapper (and per neighbor). When
+ * many fields are synchronized, these small kernels are dominated by their launch cost. The
+ * table collects the segments of all the wrappers and neighbors, and packs (or unpacks) them
+ * all with one kernel, where each thread copies one slice.
+ *
+ * The data of each segment is packed without metadata, in the logical order of the slice.
+ * Segments are padded to a multiple of 8 bytes, so that the packed size only depends on the
+ * layout and on the number of indices, and is the same on the sending and receiving sides.
+ *
+ * A table is used either for packing or for unpacking. The arrays and the indices are moved to
+ * the device when their segment is added, and must not be reallocated before the kernel runs.
+ */
+class FusedPackTable
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  FusedPackTable();
+
+  /**
+   * @brief Get the size of a packed segment.
+   * @param layout the layout of the array
+   * @param numIndices the number of slices
+   * @return the size of the segment in the buffer, padding included
+   */
+  static localIndex segmentSize( FusedPackLayout const & layout, localIndex const numIndices );
+
+  /**
+   * @brief Add a segment to pack.
+   * @param data the first value of the array, in the device memory space
+   * @param layout the layout of the array
+   * @param indices the indices of the slices to pack
+   * @param buffer the start of the segment, advanced past the segment
+   * @return the size of the segment in the buffer
+   */
+  localIndex addPackSegment( void const * data,
+                             FusedPackLayout const & layout,
+                             arrayView1d< localIndex const > const & indices,
+                             buffer_unit_type * & buffer );
+
+  /**
+   * @brief Add a segment to unpack.
+   * @param data the first value of the array, in the device memory space
+   * @param layout the layout of the array
+   * @param indices the indices of the slices to unpack
+   * @param buffer the start of the segment, advanced past the segment
+   * @return the size of the segment in the buffer
+   */
+  localIndex addUnpackSegment( void * data,
+                               FusedPackLayout const & layout,
+                               arrayView1d< localIndex const > const & indices,
+                               buffer_unit_type const * & buffer );
+
+  /**
+   * @brief Copy the slices of all the segments to the buffers.
+   */
+  void pack() const;
+
+  /**
+   * @brief Copy the buffers to the slices of all the segments.
+   */
+  void unpack() const;
+
+  /**
+   * @brief @return the number of segments
+   */
+  localIndex numSegments() const
+  { return m_segments.size(); }
+
+private:
+
+  /**
+   * @brief Add a segment.
+   * @param segment the segment, without its slice size
+   * @param numIndices the number of slices
+   * @return the size of the segment in the buffer
+   */
+  localIndex addSegment( FusedPackSegment segment, localIndex const numIndices );
+
+  /**
+   * @brief Launch the copy kernel.
+   * @tparam PACK whether to copy the slices to the buffers or the buffers to the slices
+   */
+  template< bool PACK >
+  void launch() const;
+
+  /// The segments
+  array1d< FusedPackSegment > m_segments;
+
+  /// The index of the first slice of each segment among all the slices of the table
+  array1d< localIndex > m_segmentOffsets;
+};
+
+} // namespace bufferOps
+
+} // namespace geos
+
+#endif // GEOS_DATAREPOSITORY_BUFFEROPSFUSED_HPP_
@@ -20,6 +20,9 @@
 #include "codingUtilities/Utilities.hpp"
 #include "common/TimingMacros.hpp"
 #include "GroupContext.hpp"
+
+#include <atomic>
+
 #if defined(GEOS_USE_PYGEOSX)
 #include "python/PyGroupType.hpp"
 #endif
@@ -42,6 +45,7 @@ Group::Group( string const & name,
   m_parent( nullptr ),
   m_sizedFromParent( 0 ),
   m_wrappers(),
+  m_wrappersRevision( nextWrappersRevision() ),
   m_subGroups(),
   m_size( 0 ),
   m_capacity( 0 ),
@@ -69,7 +73,9 @@ WrapperBase & Group::registerWrapper( std::unique_ptr< WrapperBase > wrapper )
 {
   // Extract `wrapperName` first to prevent from UB call order in the `insert` call.
   string const wrapperName = wrapper->getName();
-  return *m_wrappers.insert( wrapperName, wrapper.release(), true );
+  WrapperBase * const rval = m_wrappers.insert( wrapperName, wrapper.release(), true );
+  m_wrappersRevision = nextWrappersRevision();
+  return *rval;
 }
 
 void Group::deregisterWrapper( string const & name )
@@ -77,9 +83,16 @@ void Group::deregisterWrapper( string const & name )
   GEOS_ERROR_IF( !hasWrapper( name ),
                  "Wrapper " << name << " doesn't exist in Group" << getDataContext() << '.' );
   m_wrappers.erase( name );
+  m_wrappersRevision = nextWrappersRevision();
   m_conduitNode.remove( name );
 }
 
+std::uint64_t Group::nextWrappersRevision()
+{
+  static std::atomic< std::uint64_t > revision{ 0 };
+  return ++revision;
+}
+
 
 void Group::resize( indexType const newSize )
 {
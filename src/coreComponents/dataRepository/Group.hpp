@@ -1140,6 +1140,16 @@ public:
   indexType getWrapperIndex( string const & name ) const
   { return m_wrappers.getIndex( name ); }
 
+  /**
+   * @brief Get the revision of the wrappers of the group.
+   * @return a value that changes whenever a wrapper is registered or deregistered
+   *
+   * The revisions are unique over all the groups of the process, so that the revision of a group
+   * identifies its current set of wrappers even if another group is later allocated at the same address.
+   */
+  std::uint64_t wrappersRevision() const
+  { return m_wrappersRevision; }
+
   /**
    * @brief Get access to the internal wrapper storage.
    * @return a reference to wrapper map
@@ -1555,6 +1565,13 @@ protected:
   ///@}
 
 private:
+
+  /**
+   * @brief Get a new revision for the wrappers of a group.
+   * @return a value never returned before in the process
+   */
+  static std::uint64_t nextWrappersRevision();
+
   /**
    * @brief Read values from the input file and put them into the
    *   wrapped values for this group.
@@ -1599,6 +1616,9 @@ private:
   /// The container for the collection of all wrappers continued in "this" Group.
   wrapperMap m_wrappers;
 
+  /// The revision of m_wrappers, updated on each registration or deregistration of a wrapper
+  std::uint64_t m_wrappersRevision;
+
   /// The container for the collection of all sub-groups contained in "this" Group.
   subGroupMap m_subGroups;
 
@@ -1652,6 +1672,7 @@ Wrapper< TBASE > & Group::registerWrapper( string const & name,
   m_wrappers.insert( name,
                      new Wrapper< TBASE >( name, *this, std::move( newObj ) ),
                      true );
+  m_wrappersRevision = nextWrappersRevision();
 
   if( rkey != nullptr )
   {
@@ -1686,6 +1707,7 @@ Wrapper< T > & Group::registerWrapper( string const & name,
   m_wrappers.insert( name,
                      new Wrapper< T >( name, *this, std::move( newObject ) ),
                      true );
+  m_wrappersRevision = nextWrappersRevision();
 
   Wrapper< T > & rval = getWrapper< T >( name );
   if( rval.sizedFromParent() == 1 )
@@ -1703,6 +1725,7 @@ Wrapper< T > & Group::registerWrapper( string const & name,
   m_wrappers.insert( name,
                      new Wrapper< T >( name, *this, newObject ),
                      true );
+  m_wrappersRevision = nextWrappersRevision();
 
   Wrapper< T > & rval = getWrapper< T >( name );
   if( rval.sizedFromParent() == 1 )
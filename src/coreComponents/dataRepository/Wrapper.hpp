@@ -291,6 +291,12 @@ public:
     }
   }
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @copydoc WrapperBase::getFusedPackLayout
+  virtual
+  bool getFusedPackLayout( bufferOps::FusedPackLayout & layout ) const override
+  { return wrapperHelpers::getFusedPackLayout( *m_data, layout ); }
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   /// @copydoc WrapperBase::unpack
   virtual
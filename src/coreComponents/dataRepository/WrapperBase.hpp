@@ -26,6 +26,7 @@
 #include "RestartFlags.hpp"
 #include "HistoryDataSpec.hpp"
 #include "DataContext.hpp"
+#include "BufferOpsFused.hpp"
 
 #if defined(GEOS_USE_PYGEOSX)
 #include "LvArray/src/python/python.hpp"
@@ -287,6 +288,13 @@ public:
    */
   virtual bool isPackable( bool onDevice ) const = 0;
 
+  /**
+   * @brief Get the memory layout of the wrapped array, for the fused device packing.
+   * @param[out] layout the layout of the array
+   * @return @p true if the wrapped type can be packed by a bufferOps::FusedPackTable, @p false otherwise
+   */
+  virtual bool getFusedPackLayout( bufferOps::FusedPackLayout & layout ) const = 0;
+
   /**
    * @brief Concrete implementation of the packing method.
    * @tparam DO_PACKING A template parameter to discriminate between actually packing or only computing the packing size.
@@ -0,0 +1,218 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WrapperHandle.hpp
+ */
+
+#ifndef GEOS_DATAREPOSITORY_WRAPPERHANDLE_HPP_
+#define GEOS_DATAREPOSITORY_WRAPPERHANDLE_HPP_
+
+#include "Group.hpp"
+
+#include <array>
+
+namespace geos
+{
+namespace dataRepository
+{
+
+/**
+ * @class WrapperHandle
+ * @brief Typed handle on the wrappers of a given name, resolved once per group.
+ * @tparam T the type of the wrapped object
+ *
+ * A lookup by name through Group::getWrapper goes through the hash map of the wrappers and a
+ * dynamic cast. The handle performs this lookup the first time it is used with a group, and
+ * keeps the position of the wrapper along with the revision of the wrappers of the group
+ * (see Group::wrappersRevision). The following accesses to the same group only compare the
+ * address and the revision of the group, and the handle is resolved again when a wrapper has
+ * been registered or deregistered since. The revisions are unique over all the groups, so an
+ * entry is never matched by another group allocated at the same address.
+ *
+ * The wrapper is found at each access rather than kept, so that the returned reference is valid
+ * after a reallocation of the object (e.g. when the group is resized).
+ *
+ * The handle keeps the positions for at most maxCachedGroups groups, and replaces the oldest
+ * entry beyond that. A handle is meant to be declared once (as a member or a function-local
+ * static) and used on every call, for all the groups a solver loops over. It is not thread-safe.
+ */
+template< typename T >
+class WrapperHandle
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param key the name of the wrapper
+   */
+  explicit WrapperHandle( string key ):
+    m_key( std::move( key ) )
+  {}
+
+  /**
+   * @brief Get the wrapper of a group.
+   * @param group the group holding the wrapper
+   * @return the wrapper
+   * @throw std::domain_error if the wrapper doesn't exist.
+   */
+  Wrapper< T > & getWrapper( Group & group ) const
+  {
+    return static_cast< Wrapper< T > & >( *group.wrappers()[ resolve( group ) ] );
+  }
+
+  /**
+   * @copydoc getWrapper(Group &) const
+   */
+  Wrapper< T > const & getWrapper( Group const & group ) const
+  {
+    return static_cast< Wrapper< T > const & >( *group.wrappers()[ resolve( group ) ] );
+  }
+
+  /**
+   * @brief Get the object wrapped in a group.
+   * @param group the group holding the wrapper
+   * @return reference to the wrapped object
+   */
+  T & reference( Group & group ) const
+  { return getWrapper( group ).reference(); }
+
+  /**
+   * @brief Get the object wrapped in a group.
+   * @param group the group holding the wrapper
+   * @return reference to the wrapped object, or in the case of an Array, a view with constant values
+   */
+  GEOS_DECLTYPE_AUTO_RETURN reference( Group const & group ) const
+  { return getWrapper( group ).reference(); }
+
+  /**
+   * @brief @return the name of the wrapper
+   */
+  string const & key() const
+  { return m_key; }
+
+  /// The maximum number of groups whose wrapper position is kept by the handle
+  static constexpr integer maxCachedGroups = 8;
+
+private:
+
+  /// Position of the wrapper in a group
+  struct Entry
+  {
+    /// The group
+    Group const * group = nullptr;
+    /// The revision of the wrappers of the group when the position was found
+    std::uint64_t revision = 0;
+    /// The position of the wrapper in the group
+    indexType index = -1;
+  };
+
+  /**
+   * @brief Find the position of the wrapper in a group.
+   * @param group the group holding the wrapper
+   * @return the position of the wrapper in the group
+   */
+  indexType resolve( Group const & group ) const
+  {
+    std::uint64_t const revision = group.wrappersRevision();
+    for( Entry const & entry : m_entries )
+    {
+      if( entry.group == &group && entry.revision == revision )
+      {
+        return entry.index;
+      }
+    }
+
+    // the type of the wrapper is checked only once per revision
+    group.getWrapper< T >( m_key );
+    Entry & entry = m_entries[ m_nextEntry ];
+    entry.group = &group;
+    entry.revision = revision;
+    entry.index = group.getWrapperIndex( m_key );
+    m_nextEntry = ( m_nextEntry + 1 ) % maxCachedGroups;
+    return entry.index;
+  }
+
+  /// The name of the wrapper
+  string const m_key;
+
+  /// The positions of the wrapper in the groups the handle has been used with most recently
+  mutable std::array< Entry, maxCachedGroups > m_entries{};
+
+  /// The entry replaced by the next resolution
+  mutable integer m_nextEntry = 0;
+};
+
+/**
+ * @class FieldHandle
+ * @brief WrapperHandle on the wrapper of a field trait.
+ * @tparam FIELD_TRAIT the trait that holds the type and key of the field
+ *
+ * @code
+ *   static FieldHandle< fields::flow::pressure > const pressureHandle;
+ *   arrayView1d< real64 const > const pres = pressureHandle( subRegion );
+ * @endcode
+ */
+template< typename FIELD_TRAIT >
+class FieldHandle : public WrapperHandle< typename FIELD_TRAIT::type >
+{
+public:
+
+  /// Alias for the base type
+  using Base = WrapperHandle< typename FIELD_TRAIT::type >;
+
+  /**
+   * @brief Constructor.
+   */
+  FieldHandle():
+    Base( FIELD_TRAIT::key() )
+  {}
+
+  /**
+   * @brief Get the field of a group, same as ObjectManagerBase::getField.
+   * @param group the group holding the field
+   * @return reference to the field
+   */
+  typename FIELD_TRAIT::type & operator()( Group & group ) const
+  { return this->reference( group ); }
+
+  /**
+   * @copydoc operator()(Group &) const
+   */
+  GEOS_DECLTYPE_AUTO_RETURN operator()( Group const & group ) const
+  { return this->reference( group ); }
+};
+
+/**
+ * @brief Get a field of a group through a handle shared by all the callers of the same trait.
+ * @tparam FIELD_TRAIT the trait that holds the type and key of the field
+ * @tparam GROUP the type of the group (possibly const)
+ * @param group the group holding the field
+ * @return reference to the field, as returned by ObjectManagerBase::getField
+ *
+ * The shared handle holds a fixed number of entries, each identified by the address and the
+ * wrapper revision of a group, so it does not grow with the number of groups it is used with.
+ */
+template< typename FIELD_TRAIT, typename GROUP >
+GEOS_DECLTYPE_AUTO_RETURN getCachedField( GROUP & group )
+{
+  static FieldHandle< FIELD_TRAIT > const handle;
+  return handle( group );
+}
+
+} // namespace dataRepository
+} // namespace geos
+
+#endif // GEOS_DATAREPOSITORY_WRAPPERHANDLE_HPP_
@@ -0,0 +1,171 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "dataRepository/BufferOpsFused.hpp"
+#include "dataRepository/Group.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+#include <conduit.hpp>
+
+using namespace geos;
+using namespace dataRepository;
+
+namespace
+{
+
+void packAndUnpack( Group const & source,
+                    Group & target,
+                    std::vector< string > const & names,
+                    arrayView1d< localIndex const > const & packList,
+                    arrayView1d< localIndex const > const & unpackList )
+{
+  localIndex bufferSize = 0;
+  for( string const & name : names )
+  {
+    bufferOps::FusedPackLayout layout;
+    ASSERT_TRUE( source.getWrapperBase( name ).getFusedPackLayout( layout ) );
+    bufferSize += bufferOps::FusedPackTable::segmentSize( layout, packList.size() );
+  }
+  buffer_type buffer( bufferSize );
+
+  bufferOps::FusedPackTable packTable;
+  buffer_unit_type * packPtr = buffer.data();
+  localIndex packedSize = 0;
+  for( string const & name : names )
+  {
+    WrapperBase const & wrapper = source.getWrapperBase( name );
+    wrapper.move( parallelDeviceMemorySpace, false );
+    bufferOps::FusedPackLayout layout;
+    wrapper.getFusedPackLayout( layout );
+    packedSize += packTable.addPackSegment( wrapper.voidPointer(), layout, packList, packPtr );
+  }
+  EXPECT_EQ( packedSize, bufferSize );
+  EXPECT_EQ( packTable.numSegments(), localIndex( names.size() ) );
+  packTable.pack();
+
+  bufferOps::FusedPackTable unpackTable;
+  buffer_unit_type const * unpackPtr = buffer.data();
+  localIndex unpackedSize = 0;
+  for( string const & name : names )
+  {
+    WrapperBase & wrapper = target.getWrapperBase( name );
+    wrapper.move( parallelDeviceMemorySpace, true );
+    bufferOps::FusedPackLayout layout;
+    wrapper.getFusedPackLayout( layout );
+    unpackedSize += unpackTable.addUnpackSegment( const_cast< void * >( wrapper.voidPointer() ), layout, unpackList, unpackPtr );
+  }
+  EXPECT_EQ( unpackedSize, bufferSize );
+  unpackTable.unpack();
+
+  for( string const & name : names )
+  {
+    target.getWrapperBase( name ).move( hostMemorySpace, false );
+  }
+}
+
+void registerFields( Group & group, localIndex const size )
+{
+  group.registerWrapper< array1d< real64 > >( "scalar" ).setSizedFromParent( 1 );
+  group.registerWrapper< array2d< real64, RAJA::PERM_JI > >( "vector" ).setSizedFromParent( 1 ).reference().resizeDimension< 1 >( 3 );
+  group.registerWrapper< array3d< int > >( "tensor" ).setSizedFromParent( 1 ).reference().resizeDimension< 1, 2 >( 2, 3 );
+  group.resize( size );
+}
+
+}
+
+TEST( FusedPacking, layout )
+{
+  conduit::Node node;
+  Group group( "group", node );
+  registerFields( group, 4 );
+  group.registerWrapper< string >( "name" );
+
+  bufferOps::FusedPackLayout layout;
+  EXPECT_TRUE( group.getWrapperBase( "vector" ).getFusedPackLayout( layout ) );
+  EXPECT_EQ( layout.elementSize, int( sizeof( real64 ) ) );
+  EXPECT_EQ( layout.numDims, 2 );
+  EXPECT_EQ( layout.dims[ 0 ], 4 );
+  EXPECT_EQ( layout.dims[ 1 ], 3 );
+  EXPECT_EQ( layout.strides[ 0 ], 1 );
+  EXPECT_EQ( layout.strides[ 1 ], 4 );
+
+  // 3 slices of 6 integers, padded to 8 bytes
+  EXPECT_TRUE( group.getWrapperBase( "tensor" ).getFusedPackLayout( layout ) );
+  EXPECT_EQ( bufferOps::FusedPackTable::segmentSize( layout, 3 ), 72 );
+  EXPECT_EQ( bufferOps::FusedPackTable::segmentSize( layout, 1 ), 24 );
+
+  EXPECT_FALSE( group.getWrapperBase( "name" ).getFusedPackLayout( layout ) );
+}
+
+TEST( FusedPacking, packUnpack )
+{
+  conduit::Node sourceNode;
+  conduit::Node targetNode;
+  Group source( "source", sourceNode );
+  Group target( "target", targetNode );
+  registerFields( source, 10 );
+  registerFields( target, 6 );
+
+  arrayView1d< real64 > const sourceScalar = source.getReference< array1d< real64 > >( "scalar" );
+  arrayView2d< real64, 0 > const sourceVector = source.getReference< array2d< real64, RAJA::PERM_JI > >( "vector" );
+  arrayView3d< int > const sourceTensor = source.getReference< array3d< int > >( "tensor" );
+  for( localIndex i = 0; i < 10; ++i )
+  {
+    sourceScalar[i] = 1.5 * i;
+    for( localIndex j = 0; j < 3; ++j )
+    {
+      sourceVector( i, j ) = 10.0 * i + j;
+      for( localIndex k = 0; k < 2; ++k )
+      {
+        sourceTensor( i, k, j ) = 100 * i + 10 * k + j;
+      }
+    }
+  }
+
+  array1d< localIndex > packList;
+  packList.emplace_back( 7 );
+  packList.emplace_back( 2 );
+  packList.emplace_back( 9 );
+  array1d< localIndex > unpackList;
+  unpackList.emplace_back( 0 );
+  unpackList.emplace_back( 5 );
+  unpackList.emplace_back( 3 );
+
+  packAndUnpack( source, target, { "scalar", "tensor", "vector" }, packList.toViewConst(), unpackList.toViewConst() );
+
+  arrayView1d< real64 const > const targetScalar = target.getReference< array1d< real64 > >( "scalar" );
+  arrayView2d< real64 const, 0 > const targetVector = target.getReference< array2d< real64, RAJA::PERM_JI > >( "vector" );
+  arrayView3d< int const > const targetTensor = target.getReference< array3d< int > >( "tensor" );
+  for( localIndex ii = 0; ii < packList.size(); ++ii )
+  {
+    localIndex const i = packList[ii];
+    localIndex const t = unpackList[ii];
+    EXPECT_EQ( targetScalar[t], 1.5 * i );
+    for( localIndex j = 0; j < 3; ++j )
+    {
+      EXPECT_EQ( targetVector( t, j ), 10.0 * i + j );
+      for( localIndex k = 0; k < 2; ++k )
+      {
+        EXPECT_EQ( targetTensor( t, k, j ), 100 * i + 10 * k + j );
+      }
+    }
+  }
+
+  // the values that were not unpacked are untouched
+  EXPECT_EQ( targetScalar[1], 0.0 );
+  EXPECT_EQ( targetVector( 4, 2 ), 0.0 );
+}
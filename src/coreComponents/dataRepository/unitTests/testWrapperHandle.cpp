@@ -0,0 +1,140 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "dataRepository/Group.hpp"
+#include "dataRepository/WrapperHandle.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+#include <conduit.hpp>
+
+using namespace geos;
+using namespace dataRepository;
+
+TEST( WrapperHandle, sameAsGetWrapper )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  group.registerWrapper< array1d< real64 > >( "a" ).setSizedFromParent( 1 );
+  group.registerWrapper< array1d< real64 > >( "b" ).setSizedFromParent( 1 );
+  group.resize( 10 );
+
+  WrapperHandle< array1d< real64 > > const handle( "b" );
+  EXPECT_EQ( &handle.getWrapper( group ), &group.getWrapper< array1d< real64 > >( "b" ) );
+  EXPECT_EQ( &handle.reference( group ), &group.getReference< array1d< real64 > >( "b" ) );
+
+  // the reference follows the reallocation of the wrapped object
+  group.resize( 1000 );
+  EXPECT_EQ( handle.reference( group ).size(), 1000 );
+  EXPECT_EQ( handle.reference( group ).data(), group.getReference< array1d< real64 > >( "b" ).data() );
+
+  Group const & constGroup = group;
+  EXPECT_EQ( handle.reference( constGroup ).data(), group.getReference< array1d< real64 > >( "b" ).data() );
+}
+
+TEST( WrapperHandle, deregisteredWrapper )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  group.registerWrapper< integer >( "a" );
+  group.registerWrapper< integer >( "b" ).reference() = 1;
+
+  WrapperHandle< integer > const handle( "b" );
+  EXPECT_EQ( handle.reference( group ), 1 );
+
+  // "b" moves to the position of "a"
+  group.deregisterWrapper( "a" );
+  EXPECT_EQ( handle.reference( group ), 1 );
+  EXPECT_EQ( &handle.getWrapper( group ), &group.getWrapper< integer >( "b" ) );
+
+  // "b" is replaced by a new wrapper
+  group.deregisterWrapper( "b" );
+  group.registerWrapper< integer >( "c" );
+  group.registerWrapper< integer >( "b" ).reference() = 2;
+  EXPECT_EQ( handle.reference( group ), 2 );
+  EXPECT_EQ( &handle.getWrapper( group ), &group.getWrapper< integer >( "b" ) );
+
+  group.deregisterWrapper( "b" );
+  EXPECT_THROW( handle.reference( group ), std::domain_error );
+}
+
+TEST( WrapperHandle, severalGroups )
+{
+  conduit::Node node;
+  Group root( "root", node );
+  Group & first = root.registerGroup( "first" );
+  Group & second = root.registerGroup( "second" );
+  first.registerWrapper< integer >( "value" ).reference() = 1;
+  second.registerWrapper< integer >( "other" );
+  second.registerWrapper< integer >( "value" ).reference() = 2;
+
+  WrapperHandle< integer > const handle( "value" );
+  for( int i = 0; i < 2; ++i )
+  {
+    EXPECT_EQ( handle.reference( first ), 1 );
+    EXPECT_EQ( handle.reference( second ), 2 );
+  }
+  EXPECT_THROW( handle.reference( root ), std::domain_error );
+}
+
+TEST( WrapperHandle, moreGroupsThanCached )
+{
+  conduit::Node node;
+  Group root( "root", node );
+  integer const numGroups = 3 * WrapperHandle< integer >::maxCachedGroups;
+  std::vector< Group * > groups;
+  for( integer i = 0; i < numGroups; ++i )
+  {
+    Group & group = root.registerGroup( "group" + std::to_string( i ) );
+    // the wrapper is at a different position in each group
+    for( integer j = 0; j < i % 3; ++j )
+    {
+      group.registerWrapper< integer >( "other" + std::to_string( j ) );
+    }
+    group.registerWrapper< integer >( "value" ).reference() = i;
+    groups.emplace_back( &group );
+  }
+
+  WrapperHandle< integer > const handle( "value" );
+  for( int k = 0; k < 2; ++k )
+  {
+    for( integer i = 0; i < numGroups; ++i )
+    {
+      EXPECT_EQ( handle.reference( *groups[i] ), i );
+    }
+  }
+}
+
+TEST( WrapperHandle, replacedGroup )
+{
+  conduit::Node node;
+  Group root( "root", node );
+  WrapperHandle< integer > const handle( "value" );
+
+  // the groups may be allocated at the same address, but the handle must not reuse the position of the previous one
+  for( integer i = 0; i < 4; ++i )
+  {
+    Group & group = root.registerGroup( "group" );
+    for( integer j = 0; j < 3 - i; ++j )
+    {
+      group.registerWrapper< integer >( "other" + std::to_string( j ) );
+    }
+    group.registerWrapper< integer >( "value" ).reference() = i;
+    EXPECT_EQ( handle.reference( group ), i );
+    EXPECT_EQ( &handle.getWrapper( group ), &group.getWrapper< integer >( "value" ) );
+    root.deregisterGroup( "group" );
+  }
+}
@@ -27,6 +27,7 @@
 // Source includes
 #include "BufferOps.hpp"
 #include "BufferOpsDevice.hpp"
+#include "BufferOpsFused.hpp"
 #include "DefaultValue.hpp"
 #include "ConduitRestart.hpp"
 #include "common/DataTypes.hpp"
@@ -42,6 +43,7 @@
 #include <conduit.hpp>
 
 // System includes
+#include <cstdint>
 #include <cstring>
 
 #if RESTART_TYPE_LOGGING
@@ -728,6 +730,28 @@ UnpackByIndex( buffer_unit_type const * &, T &, IDX & )
 }
 
 
+template< typename T, int NDIM, typename PERMUTATION >
+inline std::enable_if_t< bufferOps::can_memcpy< T > &&
+                         ( NDIM <= bufferOps::FusedPackLayout::maxNumDims ) &&
+                         ( sizeof( T ) % sizeof( std::uint32_t ) == 0 ), bool >
+getFusedPackLayout( Array< T, NDIM, PERMUTATION > const & var, bufferOps::FusedPackLayout & layout )
+{
+  layout.elementSize = sizeof( T );
+  layout.numDims = NDIM;
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    layout.dims[ dim ] = var.size( dim );
+    layout.strides[ dim ] = var.strides()[ dim ];
+  }
+  return true;
+}
+
+template< typename T >
+inline bool
+getFusedPackLayout( T const &, bufferOps::FusedPackLayout & )
+{ return false; }
+
+
 template< bool DO_PACKING, typename T >
 inline std::enable_if_t< bufferOps::is_container< T > || bufferOps::can_memcpy< T >, localIndex >
 PackDevice( buffer_unit_type * & buffer, T const & var, parallelDeviceEvents & events )
@@ -0,0 +1,191 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkDenseLAFactorizations.cpp
+ *
+ * Solution of many small independent systems, as done per cell or per element in the kernels:
+ *  - inverse of the matrix (3x3 only) followed by a product;
+ *  - Gaussian elimination of denseLASolvers.hpp;
+ *  - LU factorization and solve, one system at a time;
+ *  - LU factorization and solve of batches of interleaved systems.
+ */
+
+#include "denseLinearAlgebra/denseLAFactorizations.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace geos
+{
+namespace denseLinearAlgebra
+{
+namespace benchmarking
+{
+
+constexpr localIndex numSystems = 4096;
+
+constexpr integer batchSize = 8;
+
+/**
+ * @brief Independent random systems of size N, stored contiguously.
+ * @tparam N the size of the systems
+ */
+template< integer N >
+struct Systems
+{
+  Systems():
+    matrices( numSystems * N * N ),
+    rhs( numSystems * N )
+  {
+    std::mt19937 generator( 2024 );
+    std::uniform_real_distribution< real64 > distribution( -1.0, 1.0 );
+    for( localIndex k = 0; k < numSystems; ++k )
+    {
+      for( integer i = 0; i < N; ++i )
+      {
+        rhs[k * N + i] = distribution( generator );
+        for( integer j = 0; j < N; ++j )
+        {
+          matrices[( k * N + i ) * N + j] = distribution( generator ) + ( i == j ? N : 0.0 );
+        }
+      }
+    }
+  }
+
+  /// Copy the system k into A and b
+  template< typename MATRIX_TYPE, typename VECTOR_TYPE >
+  void load( localIndex const k, MATRIX_TYPE && A, VECTOR_TYPE && b ) const
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      b[i] = rhs[k * N + i];
+      for( integer j = 0; j < N; ++j )
+      {
+        A[i][j] = matrices[( k * N + i ) * N + j];
+      }
+    }
+  }
+
+  std::vector< real64 > matrices;
+  std::vector< real64 > rhs;
+};
+
+void inverse3( benchmark::State & state )
+{
+  Systems< 3 > const systems;
+  for( auto _ : state )
+  {
+    for( localIndex k = 0; k < numSystems; ++k )
+    {
+      real64 A[3][3], b[3], x[3];
+      systems.load( k, A, b );
+      LvArray::tensorOps::invert< 3 >( A );
+      LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( x, A, b );
+      benchmark::DoNotOptimize( x );
+    }
+  }
+  state.SetItemsProcessed( state.iterations() * numSystems );
+}
+
+template< integer N >
+void gaussianElimination( benchmark::State & state )
+{
+  Systems< N > const systems;
+  for( auto _ : state )
+  {
+    for( localIndex k = 0; k < numSystems; ++k )
+    {
+      real64 A[N][N], b[N], x[N];
+      systems.load( k, A, b );
+      denseLinearAlgebra::solve< N >( A, b, x );
+      benchmark::DoNotOptimize( x );
+    }
+  }
+  state.SetItemsProcessed( state.iterations() * numSystems );
+}
+
+template< integer N >
+void lu( benchmark::State & state )
+{
+  Systems< N > const systems;
+  for( auto _ : state )
+  {
+    for( localIndex k = 0; k < numSystems; ++k )
+    {
+      real64 A[N][N], x[N];
+      integer pivots[N];
+      systems.load( k, A, x );
+      denseLinearAlgebra::luFactorize< N >( A, pivots );
+      denseLinearAlgebra::luSolve< N >( A, pivots, x );
+      benchmark::DoNotOptimize( x );
+    }
+  }
+  state.SetItemsProcessed( state.iterations() * numSystems );
+}
+
+template< integer N >
+void batchedLu( benchmark::State & state )
+{
+  Systems< N > const systems;
+  for( auto _ : state )
+  {
+    for( localIndex k0 = 0; k0 < numSystems; k0 += batchSize )
+    {
+      real64 A[N][N][batchSize], x[N][batchSize];
+      integer pivots[N][batchSize];
+      for( integer b = 0; b < batchSize; ++b )
+      {
+        for( integer i = 0; i < N; ++i )
+        {
+          x[i][b] = systems.rhs[( k0 + b ) * N + i];
+          for( integer j = 0; j < N; ++j )
+          {
+            A[i][j][b] = systems.matrices[( ( k0 + b ) * N + i ) * N + j];
+          }
+        }
+      }
+      denseLinearAlgebra::batched::luFactorize< N, batchSize >( A, pivots );
+      denseLinearAlgebra::batched::luSolve< N, batchSize >( A, pivots, x );
+      benchmark::DoNotOptimize( x );
+    }
+  }
+  state.SetItemsProcessed( state.iterations() * numSystems );
+}
+
+BENCHMARK( inverse3 );
+BENCHMARK_TEMPLATE( gaussianElimination, 3 );
+BENCHMARK_TEMPLATE( gaussianElimination, 6 );
+BENCHMARK_TEMPLATE( gaussianElimination, 9 );
+BENCHMARK_TEMPLATE( lu, 3 );
+BENCHMARK_TEMPLATE( lu, 6 );
+BENCHMARK_TEMPLATE( lu, 9 );
+BENCHMARK_TEMPLATE( lu, 16 );
+BENCHMARK_TEMPLATE( batchedLu, 3 );
+BENCHMARK_TEMPLATE( batchedLu, 6 );
+BENCHMARK_TEMPLATE( batchedLu, 9 );
+BENCHMARK_TEMPLATE( batchedLu, 16 );
+
+} // namespace benchmarking
+
+} // namespace denseLinearAlgebra
+
+} // namespace geos
+
+BENCHMARK_MAIN();
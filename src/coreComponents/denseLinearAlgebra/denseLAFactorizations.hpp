@@ -0,0 +1,650 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file denseLAFactorizations.hpp
+ *
+ * LU and Cholesky factorizations of small dense systems with compile-time sizes, for the local
+ * systems solved in the kernels (one system per cell or per element).
+ *
+ * Two layouts are provided:
+ *  - a single system, stored in any type indexable as A[i][j] (stack arrays, slices);
+ *  - a batch of BATCH_SIZE systems of the same size, interleaved as A[i][j][b], in the
+ *    batched namespace. All the operations are done on the whole batch in the innermost loop,
+ *    which the compiler can vectorize across the systems. This is used by the host loops on
+ *    the cells that handle several cells per iteration (e.g. the BdVLM transmissibility cache).
+ *
+ * The factorizations are done in place. They return false if a zero pivot is found (LU), or if
+ * the matrix is not positive definite (Cholesky), in which case the factors must not be used.
+ */
+#ifndef GEOS_DENSELINEARALGEBRA_DENSELAFACTORIZATIONS_HPP_
+#define GEOS_DENSELINEARALGEBRA_DENSELAFACTORIZATIONS_HPP_
+
+#include "common/DataTypes.hpp"
+#include "LvArray/src/math.hpp"
+
+namespace geos
+{
+
+namespace denseLinearAlgebra
+{
+
+/// Maximum size of the systems handled by the fixed-size factorizations
+static constexpr integer maxFactorizationSize = 16;
+
+/**
+ * @brief Compute the LU factorization with partial pivoting of a matrix, P A = L U.
+ * @tparam N the size of the matrix
+ * @tparam MATRIX_TYPE the type of the matrix
+ * @param[in,out] A the matrix, overwritten by the factors (unit diagonal of L not stored)
+ * @param[out] pivots the row interchanged with row i at step i
+ * @return true if the factorization succeeded
+ */
+template< integer N, typename MATRIX_TYPE >
+GEOS_HOST_DEVICE
+inline
+bool luFactorize( MATRIX_TYPE && A, integer ( & pivots )[N] )
+{
+  static_assert( N > 0 && N <= maxFactorizationSize, "Unsupported size" );
+
+  bool success = true;
+  for( integer k = 0; k < N; ++k )
+  {
+    integer p = k;
+    for( integer i = k + 1; i < N; ++i )
+    {
+      if( LvArray::math::abs( A[i][k] ) > LvArray::math::abs( A[p][k] ) )
+      {
+        p = i;
+      }
+    }
+    pivots[k] = p;
+    for( integer j = 0; j < N; ++j )
+    {
+      real64 const temp = A[k][j];
+      A[k][j] = A[p][j];
+      A[p][j] = temp;
+    }
+
+    if( A[k][k] == 0.0 )
+    {
+      success = false;
+      continue;
+    }
+    real64 const pivotInv = 1.0 / A[k][k];
+    for( integer i = k + 1; i < N; ++i )
+    {
+      A[i][k] *= pivotInv;
+      for( integer j = k + 1; j < N; ++j )
+      {
+        A[i][j] -= A[i][k] * A[k][j];
+      }
+    }
+  }
+  return success;
+}
+
+/**
+ * @brief Solve A x = b using the LU factorization of A.
+ * @tparam N the size of the system
+ * @tparam MATRIX_TYPE the type of the factors
+ * @tparam VECTOR_TYPE the type of the right-hand side
+ * @param[in] LU the factors computed by luFactorize
+ * @param[in] pivots the pivots computed by luFactorize
+ * @param[in,out] b the right-hand side, overwritten by the solution
+ */
+template< integer N, typename MATRIX_TYPE, typename VECTOR_TYPE >
+GEOS_HOST_DEVICE
+inline
+void luSolve( MATRIX_TYPE const & LU, integer const ( &pivots )[N], VECTOR_TYPE && b )
+{
+  for( integer k = 0; k < N; ++k )
+  {
+    real64 const temp = b[k];
+    b[k] = b[pivots[k]];
+    b[pivots[k]] = temp;
+  }
+  for( integer i = 1; i < N; ++i )
+  {
+    for( integer j = 0; j < i; ++j )
+    {
+      b[i] -= LU[i][j] * b[j];
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer j = i + 1; j < N; ++j )
+    {
+      b[i] -= LU[i][j] * b[j];
+    }
+    b[i] /= LU[i][i];
+  }
+}
+
+/**
+ * @brief Solve A X = B for several right-hand sides using the LU factorization of A.
+ * @tparam N the size of the system
+ * @tparam NRHS the number of right-hand sides
+ * @tparam MATRIX_TYPE the type of the factors
+ * @tparam RHS_TYPE the type of the right-hand sides
+ * @param[in] LU the factors computed by luFactorize
+ * @param[in] pivots the pivots computed by luFactorize
+ * @param[in,out] B the N x NRHS right-hand sides, overwritten by the solutions
+ */
+template< integer N, integer NRHS, typename MATRIX_TYPE, typename RHS_TYPE >
+GEOS_HOST_DEVICE
+inline
+void luSolveMultiple( MATRIX_TYPE const & LU, integer const ( &pivots )[N], RHS_TYPE && B )
+{
+  for( integer k = 0; k < N; ++k )
+  {
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      real64 const temp = B[k][r];
+      B[k][r] = B[pivots[k]][r];
+      B[pivots[k]][r] = temp;
+    }
+  }
+  for( integer i = 1; i < N; ++i )
+  {
+    for( integer j = 0; j < i; ++j )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        B[i][r] -= LU[i][j] * B[j][r];
+      }
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer j = i + 1; j < N; ++j )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        B[i][r] -= LU[i][j] * B[j][r];
+      }
+    }
+    real64 const diagInv = 1.0 / LU[i][i];
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      B[i][r] *= diagInv;
+    }
+  }
+}
+
+/**
+ * @brief Compute the Cholesky factorization of a symmetric positive definite matrix, A = L L^T.
+ * @tparam N the size of the matrix
+ * @tparam MATRIX_TYPE the type of the matrix
+ * @param[in,out] A the matrix, whose lower triangle is overwritten by L (only the lower triangle is read)
+ * @return true if the factorization succeeded
+ */
+template< integer N, typename MATRIX_TYPE >
+GEOS_HOST_DEVICE
+inline
+bool choleskyFactorize( MATRIX_TYPE && A )
+{
+  static_assert( N > 0 && N <= maxFactorizationSize, "Unsupported size" );
+
+  for( integer j = 0; j < N; ++j )
+  {
+    real64 diag = A[j][j];
+    for( integer k = 0; k < j; ++k )
+    {
+      diag -= A[j][k] * A[j][k];
+    }
+    if( !( diag > 0.0 ) )
+    {
+      return false;
+    }
+    A[j][j] = LvArray::math::sqrt( diag );
+    real64 const diagInv = 1.0 / A[j][j];
+    for( integer i = j + 1; i < N; ++i )
+    {
+      real64 value = A[i][j];
+      for( integer k = 0; k < j; ++k )
+      {
+        value -= A[i][k] * A[j][k];
+      }
+      A[i][j] = value * diagInv;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve A x = b using the Cholesky factorization of A.
+ * @tparam N the size of the system
+ * @tparam MATRIX_TYPE the type of the factor
+ * @tparam VECTOR_TYPE the type of the right-hand side
+ * @param[in] L the factor computed by choleskyFactorize
+ * @param[in,out] b the right-hand side, overwritten by the solution
+ */
+template< integer N, typename MATRIX_TYPE, typename VECTOR_TYPE >
+GEOS_HOST_DEVICE
+inline
+void choleskySolve( MATRIX_TYPE const & L, VECTOR_TYPE && b )
+{
+  for( integer i = 0; i < N; ++i )
+  {
+    for( integer k = 0; k < i; ++k )
+    {
+      b[i] -= L[i][k] * b[k];
+    }
+    b[i] /= L[i][i];
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer k = i + 1; k < N; ++k )
+    {
+      b[i] -= L[k][i] * b[k];
+    }
+    b[i] /= L[i][i];
+  }
+}
+
+/**
+ * @brief Solve A X = B for several right-hand sides using the Cholesky factorization of A.
+ * @tparam N the size of the system
+ * @tparam NRHS the number of right-hand sides
+ * @tparam MATRIX_TYPE the type of the factor
+ * @tparam RHS_TYPE the type of the right-hand sides
+ * @param[in] L the factor computed by choleskyFactorize
+ * @param[in,out] B the N x NRHS right-hand sides, overwritten by the solutions
+ */
+template< integer N, integer NRHS, typename MATRIX_TYPE, typename RHS_TYPE >
+GEOS_HOST_DEVICE
+inline
+void choleskySolveMultiple( MATRIX_TYPE const & L, RHS_TYPE && B )
+{
+  for( integer i = 0; i < N; ++i )
+  {
+    for( integer k = 0; k < i; ++k )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        B[i][r] -= L[i][k] * B[k][r];
+      }
+    }
+    real64 const diagInv = 1.0 / L[i][i];
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      B[i][r] *= diagInv;
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer k = i + 1; k < N; ++k )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        B[i][r] -= L[k][i] * B[k][r];
+      }
+    }
+    real64 const diagInv = 1.0 / L[i][i];
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      B[i][r] *= diagInv;
+    }
+  }
+}
+
+namespace batched
+{
+
+/**
+ * @brief Compute the LU factorizations with partial pivoting of a batch of matrices.
+ * @tparam N the size of the matrices
+ * @tparam BATCH_SIZE the number of matrices
+ * @param[in,out] A the interleaved matrices, A[i][j][b] being the entry (i,j) of matrix b, overwritten by the factors
+ * @param[out] pivots the interleaved pivots of each matrix
+ * @return true if all the factorizations succeeded
+ */
+template< integer N, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline
+bool luFactorize( real64 ( & A )[N][N][BATCH_SIZE],
+                  integer ( & pivots )[N][BATCH_SIZE] )
+{
+  static_assert( N > 0 && N <= maxFactorizationSize, "Unsupported size" );
+
+  bool success = true;
+  for( integer k = 0; k < N; ++k )
+  {
+    // search the pivots of all the matrices at once
+    real64 pivotAbs[BATCH_SIZE];
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      pivots[k][b] = k;
+      pivotAbs[b] = LvArray::math::abs( A[k][k][b] );
+    }
+    for( integer i = k + 1; i < N; ++i )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        real64 const value = LvArray::math::abs( A[i][k][b] );
+        bool const isLarger = value > pivotAbs[b];
+        pivots[k][b] = isLarger ? i : pivots[k][b];
+        pivotAbs[b] = isLarger ? value : pivotAbs[b];
+      }
+    }
+
+    for( integer j = 0; j < N; ++j )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        integer const p = pivots[k][b];
+        real64 const temp = A[k][j][b];
+        A[k][j][b] = A[p][j][b];
+        A[p][j][b] = temp;
+      }
+    }
+
+    real64 pivotInv[BATCH_SIZE];
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      // a singular matrix does not stop the factorization of the others
+      success = success && pivotAbs[b] > 0.0;
+      pivotInv[b] = pivotAbs[b] > 0.0 ? 1.0 / A[k][k][b] : 0.0;
+    }
+    for( integer i = k + 1; i < N; ++i )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        A[i][k][b] *= pivotInv[b];
+      }
+      for( integer j = k + 1; j < N; ++j )
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          A[i][j][b] -= A[i][k][b] * A[k][j][b];
+        }
+      }
+    }
+  }
+  return success;
+}
+
+/**
+ * @brief Solve a batch of systems A x = b using the LU factorizations of the matrices.
+ * @tparam N the size of the systems
+ * @tparam BATCH_SIZE the number of systems
+ * @param[in] LU the interleaved factors computed by luFactorize
+ * @param[in] pivots the interleaved pivots computed by luFactorize
+ * @param[in,out] x the interleaved right-hand sides, overwritten by the solutions
+ */
+template< integer N, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline
+void luSolve( real64 const ( &LU )[N][N][BATCH_SIZE],
+              integer const ( &pivots )[N][BATCH_SIZE],
+              real64 ( & x )[N][BATCH_SIZE] )
+{
+  for( integer k = 0; k < N; ++k )
+  {
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      integer const p = pivots[k][b];
+      real64 const temp = x[k][b];
+      x[k][b] = x[p][b];
+      x[p][b] = temp;
+    }
+  }
+  for( integer i = 1; i < N; ++i )
+  {
+    for( integer j = 0; j < i; ++j )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        x[i][b] -= LU[i][j][b] * x[j][b];
+      }
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer j = i + 1; j < N; ++j )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        x[i][b] -= LU[i][j][b] * x[j][b];
+      }
+    }
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      x[i][b] /= LU[i][i][b];
+    }
+  }
+}
+
+/**
+ * @brief Solve a batch of systems A X = B for several right-hand sides using the LU factorizations of the matrices.
+ * @tparam N the size of the systems
+ * @tparam NRHS the number of right-hand sides
+ * @tparam BATCH_SIZE the number of systems
+ * @param[in] LU the interleaved factors computed by luFactorize
+ * @param[in] pivots the interleaved pivots computed by luFactorize
+ * @param[in,out] B the interleaved right-hand sides, B[i][r][b] being the entry i of the right-hand side r
+ *                  of system b, overwritten by the solutions
+ */
+template< integer N, integer NRHS, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline
+void luSolveMultiple( real64 const ( &LU )[N][N][BATCH_SIZE],
+                      integer const ( &pivots )[N][BATCH_SIZE],
+                      real64 ( & B )[N][NRHS][BATCH_SIZE] )
+{
+  for( integer k = 0; k < N; ++k )
+  {
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        integer const p = pivots[k][b];
+        real64 const temp = B[k][r][b];
+        B[k][r][b] = B[p][r][b];
+        B[p][r][b] = temp;
+      }
+    }
+  }
+  for( integer i = 1; i < N; ++i )
+  {
+    for( integer j = 0; j < i; ++j )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          B[i][r][b] -= LU[i][j][b] * B[j][r][b];
+        }
+      }
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer j = i + 1; j < N; ++j )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          B[i][r][b] -= LU[i][j][b] * B[j][r][b];
+        }
+      }
+    }
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        B[i][r][b] /= LU[i][i][b];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Compute the Cholesky factorizations of a batch of symmetric positive definite matrices.
+ * @tparam N the size of the matrices
+ * @tparam BATCH_SIZE the number of matrices
+ * @param[in,out] A the interleaved matrices, whose lower triangles are overwritten by the factors
+ * @return true if all the factorizations succeeded
+ */
+template< integer N, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline
+bool choleskyFactorize( real64 ( & A )[N][N][BATCH_SIZE] )
+{
+  static_assert( N > 0 && N <= maxFactorizationSize, "Unsupported size" );
+
+  bool success = true;
+  for( integer j = 0; j < N; ++j )
+  {
+    real64 diagInv[BATCH_SIZE];
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      real64 diag = A[j][j][b];
+      for( integer k = 0; k < j; ++k )
+      {
+        diag -= A[j][k][b] * A[j][k][b];
+      }
+      // a matrix that is not positive definite does not stop the factorization of the others
+      success = success && diag > 0.0;
+      A[j][j][b] = diag > 0.0 ? LvArray::math::sqrt( diag ) : 0.0;
+      diagInv[b] = diag > 0.0 ? 1.0 / A[j][j][b] : 0.0;
+    }
+    for( integer i = j + 1; i < N; ++i )
+    {
+      for( integer k = 0; k < j; ++k )
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          A[i][j][b] -= A[i][k][b] * A[j][k][b];
+        }
+      }
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        A[i][j][b] *= diagInv[b];
+      }
+    }
+  }
+  return success;
+}
+
+/**
+ * @brief Solve a batch of systems A x = b using the Cholesky factorizations of the matrices.
+ * @tparam N the size of the systems
+ * @tparam BATCH_SIZE the number of systems
+ * @param[in] L the interleaved factors computed by choleskyFactorize
+ * @param[in,out] x the interleaved right-hand sides, overwritten by the solutions
+ */
+template< integer N, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline
+void choleskySolve( real64 const ( &L )[N][N][BATCH_SIZE],
+                    real64 ( & x )[N][BATCH_SIZE] )
+{
+  for( integer i = 0; i < N; ++i )
+  {
+    for( integer k = 0; k < i; ++k )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        x[i][b] -= L[i][k][b] * x[k][b];
+      }
+    }
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      x[i][b] /= L[i][i][b];
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer k = i + 1; k < N; ++k )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        x[i][b] -= L[k][i][b] * x[k][b];
+      }
+    }
+    for( integer b = 0; b < BATCH_SIZE; ++b )
+    {
+      x[i][b] /= L[i][i][b];
+    }
+  }
+}
+
+/**
+ * @brief Solve a batch of systems A X = B for several right-hand sides using the Cholesky factorizations of the matrices.
+ * @tparam N the size of the systems
+ * @tparam NRHS the number of right-hand sides
+ * @tparam BATCH_SIZE the number of systems
+ * @param[in] L the interleaved factors computed by choleskyFactorize
+ * @param[in,out] B the interleaved right-hand sides, B[i][r][b] being the entry i of the right-hand side r
+ *                  of system b, overwritten by the solutions
+ */
+template< integer N, integer NRHS, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline
+void choleskySolveMultiple( real64 const ( &L )[N][N][BATCH_SIZE],
+                            real64 ( & B )[N][NRHS][BATCH_SIZE] )
+{
+  for( integer i = 0; i < N; ++i )
+  {
+    for( integer k = 0; k < i; ++k )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          B[i][r][b] -= L[i][k][b] * B[k][r][b];
+        }
+      }
+    }
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        B[i][r][b] /= L[i][i][b];
+      }
+    }
+  }
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    for( integer k = i + 1; k < N; ++k )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          B[i][r][b] -= L[k][i][b] * B[k][r][b];
+        }
+      }
+    }
+    for( integer r = 0; r < NRHS; ++r )
+    {
+      for( integer b = 0; b < BATCH_SIZE; ++b )
+      {
+        B[i][r][b] /= L[i][i][b];
+      }
+    }
+  }
+}
+
+} // namespace batched
+
+} // namespace denseLinearAlgebra
+
+} // namespace geos
+
+#endif /* GEOS_DENSELINEARALGEBRA_DENSELAFACTORIZATIONS_HPP_ */
@@ -0,0 +1,317 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "denseLinearAlgebra/denseLAFactorizations.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace geos
+{
+namespace denseLinearAlgebra
+{
+namespace testing
+{
+
+constexpr real64 tolerance = 1.0e-10;
+
+constexpr integer batchSize = 4;
+
+/**
+ * @brief Random systems with known solutions.
+ * @tparam N the size of the systems
+ * @tparam NRHS the number of right-hand sides
+ */
+template< integer N, integer NRHS >
+struct RandomSystem
+{
+  real64 matrix[N][N]{};
+  real64 solution[N][NRHS]{};
+  real64 rhs[N][NRHS]{};
+
+  /**
+   * @brief Generate a system.
+   * @param seed the seed of the generator
+   * @param symmetricPositiveDefinite whether the matrix is made symmetric positive definite
+   */
+  RandomSystem( integer const seed, bool const symmetricPositiveDefinite )
+  {
+    std::mt19937 generator( seed );
+    std::uniform_real_distribution< real64 > distribution( -10.0, 10.0 );
+    real64 B[N][N]{};
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        B[i][j] = distribution( generator );
+      }
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        solution[i][r] = distribution( generator );
+      }
+    }
+
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        if( symmetricPositiveDefinite )
+        {
+          // B^T B + N I
+          for( integer k = 0; k < N; ++k )
+          {
+            matrix[i][j] += B[k][i] * B[k][j];
+          }
+        }
+        else
+        {
+          matrix[i][j] = B[i][j];
+        }
+      }
+      matrix[i][i] += N;
+    }
+
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer r = 0; r < NRHS; ++r )
+      {
+        for( integer j = 0; j < N; ++j )
+        {
+          rhs[i][r] += matrix[i][j] * solution[j][r];
+        }
+      }
+    }
+  }
+};
+
+template< typename N >
+class DenseLAFactorizationsTest : public ::testing::Test
+{
+public:
+
+  static constexpr integer size = N::value;
+
+  static constexpr integer numRhs = 2;
+
+  void test_lu()
+  {
+    RandomSystem< size, numRhs > const LS( 2024, false );
+
+    forAll< parallelDevicePolicy<> >( 1, [=] GEOS_HOST_DEVICE ( int )
+    {
+      real64 LU[size][size];
+      real64 x[size];
+      real64 X[size][numRhs];
+      for( integer i = 0; i < size; ++i )
+      {
+        x[i] = LS.rhs[i][0];
+        for( integer j = 0; j < size; ++j )
+        {
+          LU[i][j] = LS.matrix[i][j];
+        }
+        for( integer r = 0; r < numRhs; ++r )
+        {
+          X[i][r] = LS.rhs[i][r];
+        }
+      }
+
+      integer pivots[size];
+      bool const success = denseLinearAlgebra::luFactorize< size >( LU, pivots );
+      PORTABLE_EXPECT_TRUE( success );
+
+      denseLinearAlgebra::luSolve< size >( LU, pivots, x );
+      denseLinearAlgebra::luSolveMultiple< size, numRhs >( LU, pivots, X );
+      for( integer i = 0; i < size; ++i )
+      {
+        PORTABLE_EXPECT_NEAR( x[i], LS.solution[i][0], tolerance );
+        for( integer r = 0; r < numRhs; ++r )
+        {
+          PORTABLE_EXPECT_NEAR( X[i][r], LS.solution[i][r], tolerance );
+        }
+      }
+    } );
+  }
+
+  void test_cholesky()
+  {
+    RandomSystem< size, numRhs > const LS( 2024, true );
+
+    forAll< parallelDevicePolicy<> >( 1, [=] GEOS_HOST_DEVICE ( int )
+    {
+      real64 L[size][size];
+      real64 x[size];
+      real64 X[size][numRhs];
+      for( integer i = 0; i < size; ++i )
+      {
+        x[i] = LS.rhs[i][0];
+        for( integer j = 0; j < size; ++j )
+        {
+          L[i][j] = LS.matrix[i][j];
+        }
+        for( integer r = 0; r < numRhs; ++r )
+        {
+          X[i][r] = LS.rhs[i][r];
+        }
+      }
+
+      bool const success = denseLinearAlgebra::choleskyFactorize< size >( L );
+      PORTABLE_EXPECT_TRUE( success );
+
+      denseLinearAlgebra::choleskySolve< size >( L, x );
+      denseLinearAlgebra::choleskySolveMultiple< size, numRhs >( L, X );
+      for( integer i = 0; i < size; ++i )
+      {
+        PORTABLE_EXPECT_NEAR( x[i], LS.solution[i][0], tolerance );
+        for( integer r = 0; r < numRhs; ++r )
+        {
+          PORTABLE_EXPECT_NEAR( X[i][r], LS.solution[i][r], tolerance );
+        }
+      }
+    } );
+  }
+
+  void test_batched()
+  {
+    RandomSystem< size, numRhs > const general[batchSize] = { { 1, false }, { 2, false }, { 3, false }, { 4, false } };
+    RandomSystem< size, numRhs > const spd[batchSize] = { { 1, true }, { 2, true }, { 3, true }, { 4, true } };
+
+    forAll< parallelDevicePolicy<> >( 1, [=] GEOS_HOST_DEVICE ( int )
+    {
+      real64 LU[size][size][batchSize];
+      real64 L[size][size][batchSize];
+      real64 xLU[size][batchSize];
+      real64 xL[size][batchSize];
+      real64 XLU[size][numRhs][batchSize];
+      real64 XL[size][numRhs][batchSize];
+      for( integer b = 0; b < batchSize; ++b )
+      {
+        for( integer i = 0; i < size; ++i )
+        {
+          xLU[i][b] = general[b].rhs[i][0];
+          xL[i][b] = spd[b].rhs[i][0];
+          for( integer j = 0; j < size; ++j )
+          {
+            LU[i][j][b] = general[b].matrix[i][j];
+            L[i][j][b] = spd[b].matrix[i][j];
+          }
+          for( integer r = 0; r < numRhs; ++r )
+          {
+            XLU[i][r][b] = general[b].rhs[i][r];
+            XL[i][r][b] = spd[b].rhs[i][r];
+          }
+        }
+      }
+
+      integer pivots[size][batchSize];
+      bool const successLU = denseLinearAlgebra::batched::luFactorize< size, batchSize >( LU, pivots );
+      PORTABLE_EXPECT_TRUE( successLU );
+      bool const successCholesky = denseLinearAlgebra::batched::choleskyFactorize< size, batchSize >( L );
+      PORTABLE_EXPECT_TRUE( successCholesky );
+
+      denseLinearAlgebra::batched::luSolve< size, batchSize >( LU, pivots, xLU );
+      denseLinearAlgebra::batched::choleskySolve< size, batchSize >( L, xL );
+      denseLinearAlgebra::batched::luSolveMultiple< size, numRhs, batchSize >( LU, pivots, XLU );
+      denseLinearAlgebra::batched::choleskySolveMultiple< size, numRhs, batchSize >( L, XL );
+      for( integer b = 0; b < batchSize; ++b )
+      {
+        for( integer i = 0; i < size; ++i )
+        {
+          PORTABLE_EXPECT_NEAR( xLU[i][b], general[b].solution[i][0], tolerance );
+          PORTABLE_EXPECT_NEAR( xL[i][b], spd[b].solution[i][0], tolerance );
+          for( integer r = 0; r < numRhs; ++r )
+          {
+            PORTABLE_EXPECT_NEAR( XLU[i][r][b], general[b].solution[i][r], tolerance );
+            PORTABLE_EXPECT_NEAR( XL[i][r][b], spd[b].solution[i][r], tolerance );
+          }
+        }
+      }
+    } );
+  }
+
+  void test_failures()
+  {
+    RandomSystem< size, 1 > const LS( 2024, false );
+
+    forAll< parallelDevicePolicy<> >( 1, [=] GEOS_HOST_DEVICE ( int )
+    {
+      // singular matrix: the last row is zero
+      real64 singular[size][size];
+      // not positive definite matrix: the first diagonal entry is negative
+      real64 indefinite[size][size];
+      for( integer i = 0; i < size; ++i )
+      {
+        for( integer j = 0; j < size; ++j )
+        {
+          singular[i][j] = ( i == size - 1 ) ? 0.0 : LS.matrix[i][j];
+          indefinite[i][j] = ( i == j ) ? 1.0 : 0.0;
+        }
+      }
+      indefinite[0][0] = -1.0;
+
+      integer pivots[size];
+      bool const successLU = denseLinearAlgebra::luFactorize< size >( singular, pivots );
+      PORTABLE_EXPECT_FALSE( successLU );
+      bool const successCholesky = denseLinearAlgebra::choleskyFactorize< size >( indefinite );
+      PORTABLE_EXPECT_FALSE( successCholesky );
+    } );
+  }
+
+};
+
+using Sizes = ::testing::Types< std::integral_constant< integer, 1 >,
+                                std::integral_constant< integer, 2 >,
+                                std::integral_constant< integer, 3 >,
+                                std::integral_constant< integer, 5 >,
+                                std::integral_constant< integer, 9 >,
+                                std::integral_constant< integer, 16 > >;
+
+TYPED_TEST_SUITE( DenseLAFactorizationsTest, Sizes, );
+
+TYPED_TEST( DenseLAFactorizationsTest, lu )
+{
+  this->test_lu();
+}
+
+TYPED_TEST( DenseLAFactorizationsTest, cholesky )
+{
+  this->test_cholesky();
+}
+
+TYPED_TEST( DenseLAFactorizationsTest, batched )
+{
+  this->test_batched();
+}
+
+TYPED_TEST( DenseLAFactorizationsTest, failures )
+{
+  this->test_failures();
+}
+
+} // testing
+
+} // denseLinearAlgebra
+
+} // namespace geos
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+  return result;
+}
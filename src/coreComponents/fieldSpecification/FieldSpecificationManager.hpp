@@ -21,6 +21,7 @@
 #define GEOS_FIELDSPECIFICATION_FIELDSPECIFICATIONMANAGER_HPP_
 
 #include "FieldSpecificationBase.hpp"
+#include "FieldSpecificationPlan.hpp"
 
 #include "common/format/StringUtilities.hpp"
 #include "common/DataTypes.hpp"
@@ -128,6 +129,9 @@ public:
    * and calls FieldSpecificationBase::applyFieldValue(), and calls the lambda function
    * to apply any operations required for completing the application of the value to the field in addition to
    * setting the target field.
+   *
+   * The values that do not depend on time are only evaluated once (see FieldSpecificationPlan), and
+   * the lambda is called after the scatter of all the cached values of the same array.
    */
   template< typename POLICY=parallelHostPolicy, typename LAMBDA=void >
   void applyFieldValue( real64 const time,
@@ -163,6 +167,9 @@ public:
    * FieldSpecificationBase::applyFieldValue(), and calls the postLambda function to apply any
    * operations required for completing the application of the value to the field in addition to
    * setting the target field.
+   *
+   * The applications are done one after the other, so that the lambdas see the field as modified
+   * by the previous applications only.
    */
   template< typename POLICY=parallelHostPolicy, typename PRELAMBDA=void, typename POSTLAMBDA=void >
   void applyFieldValue( real64 const time,
@@ -171,6 +178,34 @@ public:
                         PRELAMBDA && preLambda,
                         POSTLAMBDA && postLambda ) const;
 
+  /**
+   * @brief Function to apply the value of the field specifications of a field to another field, and
+   *        applies a lambda for any post operations that are needed.
+   * @tparam OBJECT_TYPE the type of object that the application targets
+   * @tparam POLICY The execution policy for kernels launched in this function.
+   * @tparam LAMBDA The type of the lambda function
+   * @param time The time at which the field will be evaluated.
+   * @param mesh The MeshLevel object.
+   * @param fieldName The name of the field given in the field specifications.
+   * @param targetFieldName The name of the field the values are applied to (e.g. a boundary value field).
+   * @param lambda A lambda function called after the application of the values, with the same arguments
+   *               as the lambda of apply().
+   *
+   * This is equivalent to calling FieldSpecificationBase::applyFieldValue() with targetFieldName in the
+   * lambda of apply(), with the values cached as in applyFieldValue().
+   */
+  template< typename OBJECT_TYPE=dataRepository::Group, typename POLICY=parallelHostPolicy, typename LAMBDA=void >
+  void applyFieldValueToField( real64 const time,
+                               MeshLevel & mesh,
+                               string const & fieldName,
+                               string const & targetFieldName,
+                               LAMBDA && lambda ) const
+  {
+    GEOS_MARK_FUNCTION;
+
+    getPlan( mesh, fieldName ).apply< POLICY, OBJECT_TYPE >( time, targetFieldName, std::forward< LAMBDA >( lambda ) );
+  }
+
 
   /**
    * @brief function to apply initial conditions
@@ -203,6 +238,9 @@ public:
    * should be applied, and applies them. More specifically, this function simply checks
    * values of fieldPath,fieldName, against each FieldSpecificationBase object contained in the
    * FieldSpecificationManager and decides on whether or not to call the user defined lambda.
+   *
+   * The mesh objects and target sets of the field specifications are cached in a FieldSpecificationPlan
+   * per mesh and field, rebuilt when the mesh, the field specifications or the target sets change.
    */
   template< typename OBJECT_TYPE=dataRepository::Group,
             typename BCTYPE = FieldSpecificationBase,
@@ -214,24 +252,33 @@ public:
   {
     GEOS_MARK_FUNCTION;
 
-    string const meshBodyName = mesh.getParent().getParent().getName();
-    string const meshLevelName = mesh.getName();
+    getPlan( mesh, fieldName ).forActiveApplications< OBJECT_TYPE, BCTYPE >( time, std::forward< LAMBDA >( lambda ) );
+  }
 
-    // loop over all FieldSpecificationBase objects
-    this->forSubGroups< BCTYPE >( [&] ( BCTYPE const & fs )
+private:
+
+  /**
+   * @brief Get the plan of the applications of a field, (re)built if needed.
+   * @param mesh The MeshLevel object.
+   * @param fieldName The name of the field.
+   * @return the plan
+   */
+  FieldSpecificationPlan & getPlan( MeshLevel & mesh,
+                                    string const & fieldName ) const
+  {
+    FieldSpecificationPlan & plan = m_plans[ { &mesh, fieldName } ];
+    if( plan.needsRebuild( *this, mesh ) )
     {
-      integer const isInitialCondition = fs.initialCondition();
-      if( ( isInitialCondition && fieldName=="") || // this only use case for this line is in the unit test for field specification
-          ( !isInitialCondition && time >= fs.getStartTime() && time < fs.getEndTime() && fieldName == fs.getFieldName() ) )
-      {
-        fs.template apply< OBJECT_TYPE, BCTYPE, LAMBDA >( mesh, std::forward< LAMBDA >( lambda ) );
-      }
-    } );
+      plan.build( *this, mesh, fieldName );
+    }
+    return plan;
   }
 
-private:
   static FieldSpecificationManager * m_instance;
 
+  /// The cached applications of the field specifications, for each mesh and field
+  mutable std::map< std::pair< MeshLevel const *, string >, FieldSpecificationPlan > m_plans;
+
 };
 
 template< typename POLICY, typename LAMBDA >
@@ -244,14 +291,13 @@ FieldSpecificationManager::
 {
   GEOS_MARK_FUNCTION;
 
-  apply( time, mesh, fieldName,
-         [&]( FieldSpecificationBase const & fs,
-              string const &,
-              SortedArrayView< localIndex const > const & targetSet,
-              Group & targetGroup,
-              string const & targetField )
+  getPlan( mesh, fieldName ).apply< POLICY, dataRepository::Group >( time, "",
+                                                                    [&]( FieldSpecificationBase const & fs,
+                                                                         string const &,
+                                                                         SortedArrayView< localIndex const > const & targetSet,
+                                                                         dataRepository::Group &,
+                                                                         string const & )
   {
-    fs.applyFieldValue< FieldSpecificationEqual, POLICY >( targetSet, time, targetGroup, targetField );
     lambda( fs, targetSet );
   } );
 }
@@ -267,17 +313,9 @@ FieldSpecificationManager::
 {
   GEOS_MARK_FUNCTION;
 
-  apply( time, mesh, fieldName,
-         [&]( FieldSpecificationBase const & fs,
-              string const &,
-              SortedArrayView< localIndex const > const & targetSet,
-              Group & targetGroup,
-              string const & targetField )
-  {
-    preLambda( fs, targetSet );
-    fs.applyFieldValue< FieldSpecificationEqual, POLICY >( targetSet, time, targetGroup, targetField );
-    postLambda( fs, targetSet );
-  } );
+  getPlan( mesh, fieldName ).applyInOrder< POLICY >( time,
+                                                    std::forward< PRELAMBDA >( preLambda ),
+                                                    std::forward< POSTLAMBDA >( postLambda ) );
 }
 
 } /* namespace geos */
@@ -0,0 +1,243 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FieldSpecificationPlan.cpp
+ */
+
+#include "FieldSpecificationPlan.hpp"
+
+#include "mesh/MeshLevel.hpp"
+
+#include <algorithm>
+
+namespace geos
+{
+
+using namespace dataRepository;
+
+bool FieldSpecificationPlan::needsRebuild( Group const & fsManager,
+                                           MeshLevel const & mesh ) const
+{
+  if( m_mesh != &mesh ||
+      m_meshTimestamp != mesh.getModificationTimestamp() ||
+      m_numFieldSpecifications != fsManager.numSubGroups() )
+  {
+    return true;
+  }
+  for( Application const & application : m_applications )
+  {
+    FieldSpecificationBase const & fs = *application.fs;
+    if( fs.getFunctionName() != application.functionName ||
+        fs.getComponent() != application.component )
+    {
+      return true;
+    }
+
+    Group const & setGroup = application.targetGroup->getGroup( ObjectManagerBase::groupKeyStruct::setsString() );
+    if( !setGroup.hasWrapper( application.setName ) )
+    {
+      return true;
+    }
+
+    // the targets of the batches are copies of the sets, which may be modified in place
+    if( application.kind == ValueKind::Uniform )
+    {
+      SortedArrayView< localIndex const > const targetSet = getTargetSet( application );
+      if( targetSet.size() != LvArray::integerConversion< localIndex >( application.targets.size() ) )
+      {
+        return true;
+      }
+      targetSet.move( hostMemorySpace, false );
+      if( !std::equal( application.targets.begin(), application.targets.end(), targetSet.data() ) )
+      {
+        return true;
+      }
+    }
+  }
+  // some sets (e.g. of fractures) are only created during the simulation
+  for( std::pair< Group const *, string > const & missingSet : m_missingSets )
+  {
+    if( missingSet.first->getGroup( ObjectManagerBase::groupKeyStruct::setsString() ).hasWrapper( missingSet.second ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FieldSpecificationPlan::build( Group const & fsManager,
+                                    MeshLevel & mesh,
+                                    string const & fieldName )
+{
+  GEOS_MARK_FUNCTION;
+
+  m_mesh = &mesh;
+  m_meshTimestamp = mesh.getModificationTimestamp();
+  m_numFieldSpecifications = fsManager.numSubGroups();
+  m_applications.clear();
+  m_missingSets.clear();
+  m_batches.clear();
+  m_batchesBuilt = false;
+
+  FunctionManager & functionManager = FunctionManager::getInstance();
+
+  fsManager.forSubGroups< FieldSpecificationBase >( [&] ( FieldSpecificationBase const & fs )
+  {
+    // same selection as FieldSpecificationManager::apply
+    if( fs.initialCondition() ? !fieldName.empty() : fs.getFieldName() != fieldName )
+    {
+      return;
+    }
+
+    // a missing function is reported when the values are evaluated
+    ValueKind kind = ValueKind::Uniform;
+    if( !fs.getFunctionName().empty() )
+    {
+      FunctionBase const * const function = functionManager.getGroupPointer< FunctionBase >( fs.getFunctionName() );
+      kind = ( function != nullptr && function->isFunctionOfTime() == 2 ) ? ValueKind::Uniform : ValueKind::Evaluated;
+    }
+
+    // same traversal as FieldSpecificationBase::apply
+    fs.getMeshObjectPaths().forObjectsInPath< Group >( mesh, [&] ( Group & targetGroup )
+    {
+      Group const & setGroup = targetGroup.getGroup( ObjectManagerBase::groupKeyStruct::setsString() );
+      for( string const & setName : fs.getSetNames() )
+      {
+        if( setGroup.hasWrapper( setName ) )
+        {
+          Application & application =
+            m_applications.emplace_back( Application{ &fs, &targetGroup, setName, fs.getFunctionName(), fs.getComponent(), {}, kind, -1 } );
+          if( kind == ValueKind::Uniform )
+          {
+            SortedArrayView< localIndex const > const targetSet = getTargetSet( application );
+            targetSet.move( hostMemorySpace, false );
+            application.targets.assign( targetSet.data(), targetSet.data() + targetSet.size() );
+          }
+        }
+        else
+        {
+          m_missingSets.emplace_back( &targetGroup, setName );
+        }
+      }
+    } );
+  } );
+
+  localIndex const numApplications = LvArray::integerConversion< localIndex >( m_applications.size() );
+  m_applicationValues.resize( numApplications );
+  m_applicationActive.resize( numApplications );
+}
+
+void FieldSpecificationPlan::buildBatches()
+{
+  GEOS_MARK_FUNCTION;
+
+  localIndex const numApplications = LvArray::integerConversion< localIndex >( m_applications.size() );
+
+  // merge the consecutive applications with uniform values on the same array and component
+  m_batches.clear();
+  localIndex first = 0;
+  while( first < numApplications )
+  {
+    Application const & firstApplication = m_applications[first];
+    if( firstApplication.kind == ValueKind::Evaluated )
+    {
+      ++first;
+      continue;
+    }
+
+    localIndex last = first + 1;
+    while( last < numApplications &&
+           m_applications[last].kind != ValueKind::Evaluated &&
+           m_applications[last].targetGroup == firstApplication.targetGroup &&
+           m_applications[last].fs->getFieldName() == firstApplication.fs->getFieldName() &&
+           m_applications[last].fs->getComponent() == firstApplication.fs->getComponent() )
+    {
+      ++last;
+    }
+
+    // entries (target, application), sorted by target and then by application
+    std::vector< std::pair< localIndex, localIndex > > entries;
+    for( localIndex i = first; i < last; ++i )
+    {
+      m_applications[i].batch = LvArray::integerConversion< localIndex >( m_batches.size() );
+      for( localIndex const target : m_applications[i].targets )
+      {
+        entries.emplace_back( target, i );
+      }
+    }
+    std::sort( entries.begin(), entries.end() );
+
+    Batch & batch = m_batches.emplace_back();
+    batch.targetGroup = firstApplication.targetGroup;
+    batch.targetField = firstApplication.fs->getFieldName();
+    batch.component = firstApplication.fs->getComponent();
+    batch.firstApplication = first;
+    localIndex const numEntries = LvArray::integerConversion< localIndex >( entries.size() );
+    batch.entryApplications.resize( numEntries );
+    batch.entryOffsets.emplace_back( 0 );
+    for( localIndex e = 0; e < numEntries; ++e )
+    {
+      if( e == 0 || entries[e].first != entries[e-1].first )
+      {
+        if( e > 0 )
+        {
+          batch.entryOffsets.emplace_back( e );
+        }
+        batch.targets.emplace_back( entries[e].first );
+      }
+      batch.entryApplications[e] = entries[e].second;
+    }
+    batch.entryOffsets.emplace_back( numEntries );
+
+    first = last;
+  }
+
+  m_batchesBuilt = true;
+}
+
+void FieldSpecificationPlan::updateValues( real64 const time )
+{
+  FunctionManager & functionManager = FunctionManager::getInstance();
+
+  // the scale and the function of time are evaluated at each application, as in FieldSpecificationBase::applyFieldValue
+  arrayView1d< real64 > const values = m_applicationValues.toView();
+  arrayView1d< integer > const active = m_applicationActive.toView();
+  values.move( hostMemorySpace, true );
+  active.move( hostMemorySpace, true );
+  for( localIndex i = 0; i < LvArray::integerConversion< localIndex >( m_applications.size() ); ++i )
+  {
+    FieldSpecificationBase const & fs = *m_applications[i].fs;
+    active[i] = isActive( fs, time );
+    if( m_applications[i].kind == ValueKind::Uniform && active[i] )
+    {
+      values[i] = fs.getScale();
+      if( !fs.getFunctionName().empty() )
+      {
+        values[i] *= functionManager.getGroup< FunctionBase >( fs.getFunctionName() ).evaluate( &time );
+      }
+    }
+  }
+}
+
+localIndex FieldSpecificationPlan::numEvaluatedApplications() const
+{
+  return std::count_if( m_applications.begin(), m_applications.end(), []( Application const & application )
+  {
+    return application.kind == ValueKind::Evaluated;
+  } );
+}
+
+} // namespace geos
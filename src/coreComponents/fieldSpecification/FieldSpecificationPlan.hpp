@@ -0,0 +1,407 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FieldSpecificationPlan.hpp
+ */
+
+#ifndef GEOS_FIELDSPECIFICATION_FIELDSPECIFICATIONPLAN_HPP_
+#define GEOS_FIELDSPECIFICATION_FIELDSPECIFICATIONPLAN_HPP_
+
+#include "FieldSpecificationBase.hpp"
+
+#include "common/TimingMacros.hpp"
+
+namespace geos
+{
+
+class MeshLevel;
+
+/**
+ * @class FieldSpecificationPlan
+ * @brief Cached application of the field specifications of a field to a mesh.
+ *
+ * The plan collects once the (field specification, target set) applications of a field, so that
+ * the mesh object paths and the target sets are not resolved again at each application. This is
+ * used by all the application functions of the FieldSpecificationManager.
+ *
+ * When values are applied to a field, the plan also classifies them:
+ *  - values without function, and values given by a function of time only, are the same at all the
+ *    targets: the scale, times the function of time, is evaluated once per application;
+ *  - the other values (e.g. given by a spatial function) are evaluated at every application, as in
+ *    FieldSpecificationBase::applyFieldValue.
+ *
+ * The consecutive applications with uniform values on the same array and component are merged into
+ * a batch, applied by a single scatter kernel. The targets of a batch are unique, and hold the list
+ * of their applications in order, so that the last active application wins as when the applications
+ * are done one after the other. Only the targets are cached: no value is evaluated when building the
+ * plan.
+ *
+ * The plan must be rebuilt when the mesh, the field specifications or their target sets change
+ * (see needsRebuild).
+ */
+class FieldSpecificationPlan
+{
+public:
+
+  /**
+   * @brief Check whether the plan must be (re)built.
+   * @param[in] fsManager the group holding the field specifications
+   * @param[in] mesh the mesh level the specifications are applied to
+   * @return true if the plan was built for another mesh state, if the function or the component of a
+   *         field specification has changed, or if a target set has been created, removed or modified
+   */
+  bool needsRebuild( dataRepository::Group const & fsManager,
+                     MeshLevel const & mesh ) const;
+
+  /**
+   * @brief Collect the applications of the field specifications of a field.
+   * @param[in] fsManager the group holding the field specifications
+   * @param[in] mesh the mesh level the specifications are applied to
+   * @param[in] fieldName the name of the field
+   */
+  void build( dataRepository::Group const & fsManager,
+              MeshLevel & mesh,
+              string const & fieldName );
+
+  /**
+   * @brief Call a lambda on each application active at a given time, in order.
+   * @tparam OBJECT_TYPE the type of the objects holding the target sets
+   * @tparam BCTYPE the type of the field specifications
+   * @tparam LAMBDA the type of the lambda
+   * @param[in] time the time of the application
+   * @param[in] lambda the lambda, called with the field specification, the name of the target set,
+   *                   the target set, the object holding it and the name of the field
+   *
+   * The applications on objects that are not of type OBJECT_TYPE, and the field specifications that
+   * are not of type BCTYPE, are skipped.
+   */
+  template< typename OBJECT_TYPE, typename BCTYPE, typename LAMBDA >
+  void forActiveApplications( real64 const time,
+                              LAMBDA && lambda ) const;
+
+  /**
+   * @brief Apply the field specifications at a given time.
+   * @tparam POLICY the execution policy of the kernels
+   * @tparam OBJECT_TYPE the type of the objects holding the target sets
+   * @tparam LAMBDA the type of the lambda called after each application
+   * @param[in] time the time at which the values are evaluated
+   * @param[in] targetField the name of the field the values are applied to, or an empty string
+   *                        for the field of each field specification
+   * @param[in] lambda the lambda called as in forActiveApplications for each active application,
+   *                   in order (after the scatter of the batch for the applications of a batch)
+   */
+  template< typename POLICY, typename OBJECT_TYPE, typename LAMBDA >
+  void apply( real64 const time,
+              string const & targetField,
+              LAMBDA && lambda );
+
+  /**
+   * @brief Apply the field specifications at a given time, one application after the other.
+   * @tparam POLICY the execution policy of the kernels
+   * @tparam PRELAMBDA the type of the lambda called before each application
+   * @tparam POSTLAMBDA the type of the lambda called after each application
+   * @param[in] time the time at which the values are evaluated
+   * @param[in] preLambda the lambda called with the field specification and the target set
+   *                      before each active application
+   * @param[in] postLambda the lambda called with the field specification and the target set
+   *                       after each active application
+   *
+   * The cached values are used, but the applications of a batch are scattered separately, so that
+   * the lambdas see the field as if the applications were done one after the other.
+   */
+  template< typename POLICY, typename PRELAMBDA, typename POSTLAMBDA >
+  void applyInOrder( real64 const time,
+                     PRELAMBDA && preLambda,
+                     POSTLAMBDA && postLambda );
+
+  /**
+   * @brief @return the number of applications with values evaluated at every application
+   */
+  localIndex numEvaluatedApplications() const;
+
+  /**
+   * @brief @return the number of batches
+   */
+  localIndex numBatches() const
+  { return LvArray::integerConversion< localIndex >( m_batches.size() ); }
+
+private:
+
+  /// Kind of the values of an application
+  enum class ValueKind : integer
+  {
+    Uniform,      ///< the same at all the targets, possibly a function of time
+    Evaluated     ///< evaluated at every application
+  };
+
+  /// A field specification applied on a target set
+  struct Application
+  {
+    /// the field specification
+    FieldSpecificationBase const * fs;
+    /// the object holding the target set and the field
+    dataRepository::Group * targetGroup;
+    /// the name of the target set
+    string setName;
+    /// the function of the field specification when the plan was built
+    string functionName;
+    /// the component of the field specification when the plan was built
+    integer component;
+    /// the target set when the plan was built, for the applications of a batch
+    std::vector< localIndex > targets;
+    /// the kind of values
+    ValueKind kind;
+    /// the batch of the application, or -1 for the evaluated applications
+    localIndex batch;
+  };
+
+  /// Applications with cached values merged in a single scatter
+  struct Batch
+  {
+    /// the object holding the field
+    dataRepository::Group * targetGroup;
+    /// the name of the field
+    string targetField;
+    /// the component of the field
+    integer component;
+    /// the index of the first application of the batch
+    localIndex firstApplication;
+    /// the unique targets
+    array1d< localIndex > targets;
+    /// the range of the entries of each target
+    array1d< localIndex > entryOffsets;
+    /// the application of each entry
+    array1d< localIndex > entryApplications;
+  };
+
+  /**
+   * @brief Check whether a field specification is applied at a given time.
+   * @param[in] fs the field specification
+   * @param[in] time the time
+   * @return true if the field specification is an initial condition or if time is in its time interval
+   */
+  static bool isActive( FieldSpecificationBase const & fs,
+                        real64 const time )
+  {
+    return fs.initialCondition() || ( time >= fs.getStartTime() && time < fs.getEndTime() );
+  }
+
+  /**
+   * @brief Get the target set of an application.
+   * @param[in] application the application
+   * @return the target set
+   */
+  static SortedArrayView< localIndex const > getTargetSet( Application const & application )
+  {
+    dataRepository::Group const & setGroup = application.targetGroup->getGroup( ObjectManagerBase::groupKeyStruct::setsString() );
+    return setGroup.getReference< SortedArray< localIndex > >( application.setName ).toViewConst();
+  }
+
+  /**
+   * @brief Merge the applications with uniform values in batches.
+   */
+  void buildBatches();
+
+  /**
+   * @brief Update the activity and the values of the applications with uniform values at a given time.
+   * @param[in] time the time
+   */
+  void updateValues( real64 const time );
+
+  /**
+   * @brief Apply a batch.
+   * @tparam POLICY the execution policy of the kernel
+   * @param[in] batch the batch
+   * @param[in] targetField the name of the field the values are applied to, or an empty string
+   *                        for the field of the batch
+   * @param[in] application the only application of the batch to scatter, or -1 for all of them
+   */
+  template< typename POLICY >
+  void applyBatch( Batch const & batch,
+                   string const & targetField,
+                   localIndex const application ) const;
+
+  /// The applications, in the order of the field specification manager
+  std::vector< Application > m_applications;
+
+  /// The sets of the field specifications missing from their objects when the plan was built
+  std::vector< std::pair< dataRepository::Group const *, string > > m_missingSets;
+
+  /// Whether the batches have been built
+  bool m_batchesBuilt = false;
+
+  /// The batches
+  std::vector< Batch > m_batches;
+
+  /// The value of each application with uniform values, updated at each application of the plan
+  array1d< real64 > m_applicationValues;
+
+  /// Whether each application is active, updated at each application of the plan
+  array1d< integer > m_applicationActive;
+
+  /// The mesh the plan was built for
+  MeshLevel const * m_mesh = nullptr;
+
+  /// The modification timestamp of the mesh the plan was built for
+  Timestamp m_meshTimestamp = 0;
+
+  /// The number of field specifications the plan was built for
+  localIndex m_numFieldSpecifications = -1;
+};
+
+template< typename OBJECT_TYPE, typename BCTYPE, typename LAMBDA >
+void FieldSpecificationPlan::forActiveApplications( real64 const time,
+                                                    LAMBDA && lambda ) const
+{
+  static_assert( !std::is_base_of< ElementRegionBase, OBJECT_TYPE >::value,
+                 "The applications on element regions are collected by subregion" );
+
+  for( Application const & application : m_applications )
+  {
+    BCTYPE const * const fs = dynamic_cast< BCTYPE const * >( application.fs );
+    OBJECT_TYPE * const targetGroup = dynamic_cast< OBJECT_TYPE * >( application.targetGroup );
+    if( fs == nullptr || targetGroup == nullptr || !isActive( *application.fs, time ) )
+    {
+      continue;
+    }
+    lambda( *fs, application.setName, getTargetSet( application ), *targetGroup, application.fs->getFieldName() );
+  }
+}
+
+template< typename POLICY, typename OBJECT_TYPE, typename LAMBDA >
+void FieldSpecificationPlan::apply( real64 const time,
+                                    string const & targetField,
+                                    LAMBDA && lambda )
+{
+  GEOS_MARK_FUNCTION;
+
+  if( !m_batchesBuilt )
+  {
+    buildBatches();
+  }
+  updateValues( time );
+  arrayView1d< integer const > const active = m_applicationActive.toViewConst();
+
+  for( Application const & application : m_applications )
+  {
+    localIndex const i = &application - m_applications.data();
+    OBJECT_TYPE * const targetGroup = dynamic_cast< OBJECT_TYPE * >( application.targetGroup );
+    if( targetGroup == nullptr )
+    {
+      continue;
+    }
+    if( application.batch >= 0 && m_batches[application.batch].firstApplication == i )
+    {
+      applyBatch< POLICY >( m_batches[application.batch], targetField, -1 );
+    }
+    if( !active[i] )
+    {
+      continue;
+    }
+
+    FieldSpecificationBase const & fs = *application.fs;
+    string const & fieldName = targetField.empty() ? fs.getFieldName() : targetField;
+    SortedArrayView< localIndex const > const targetSet = getTargetSet( application );
+    if( application.kind == ValueKind::Evaluated )
+    {
+      fs.applyFieldValue< FieldSpecificationEqual, POLICY >( targetSet, time, *targetGroup, fieldName );
+    }
+    lambda( fs, application.setName, targetSet, *targetGroup, fieldName );
+  }
+}
+
+template< typename POLICY, typename PRELAMBDA, typename POSTLAMBDA >
+void FieldSpecificationPlan::applyInOrder( real64 const time,
+                                           PRELAMBDA && preLambda,
+                                           POSTLAMBDA && postLambda )
+{
+  GEOS_MARK_FUNCTION;
+
+  if( !m_batchesBuilt )
+  {
+    buildBatches();
+  }
+  updateValues( time );
+  arrayView1d< integer const > const active = m_applicationActive.toViewConst();
+
+  for( Application const & application : m_applications )
+  {
+    localIndex const i = &application - m_applications.data();
+    if( !active[i] )
+    {
+      continue;
+    }
+
+    FieldSpecificationBase const & fs = *application.fs;
+    SortedArrayView< localIndex const > const targetSet = getTargetSet( application );
+    preLambda( fs, targetSet );
+    if( application.kind == ValueKind::Evaluated )
+    {
+      fs.applyFieldValue< FieldSpecificationEqual, POLICY >( targetSet, time, *application.targetGroup, fs.getFieldName() );
+    }
+    else
+    {
+      applyBatch< POLICY >( m_batches[application.batch], "", i );
+    }
+    postLambda( fs, targetSet );
+  }
+}
+
+template< typename POLICY >
+void FieldSpecificationPlan::applyBatch( Batch const & batch,
+                                         string const & targetField,
+                                         localIndex const application ) const
+{
+  dataRepository::WrapperBase & wrapper = batch.targetGroup->getWrapperBase( targetField.empty() ? batch.targetField : targetField );
+
+  arrayView1d< localIndex const > const targets = batch.targets.toViewConst();
+  arrayView1d< localIndex const > const entryOffsets = batch.entryOffsets.toViewConst();
+  arrayView1d< localIndex const > const entryApplications = batch.entryApplications.toViewConst();
+  arrayView1d< real64 const > const values = m_applicationValues.toViewConst();
+  arrayView1d< integer const > const active = m_applicationActive.toViewConst();
+  integer const component = batch.component;
+
+  // same field types as FieldSpecificationBase::applyFieldValue
+  using FieldTypes = types::ListofTypeList< types::Join< types::ArrayTypes< types::RealTypes, types::DimsUpTo< 3 > >,
+                                                         types::ArrayTypes< types::TypeList< integer >, types::DimsSingle< 1 > > > >;
+  types::dispatch( FieldTypes{}, [&]( auto tupleOfTypes )
+  {
+    using ArrayType = camp::first< decltype( tupleOfTypes ) >;
+    auto const field = dataRepository::Wrapper< ArrayType >::cast( wrapper ).reference().toView();
+
+    forAll< POLICY >( targets.size(), [=] GEOS_HOST_DEVICE ( localIndex const t )
+    {
+      // the last active application wins
+      localIndex last = -1;
+      for( localIndex e = entryOffsets[t]; e < entryOffsets[t+1]; ++e )
+      {
+        if( active[entryApplications[e]] && ( application < 0 || entryApplications[e] == application ) )
+        {
+          last = e;
+        }
+      }
+      if( last >= 0 )
+      {
+        FieldSpecificationEqual::SpecifyFieldValue( field, targets[t], component,
+                                                    values[entryApplications[last]] );
+      }
+    } );
+  }, wrapper );
+}
+
+} // namespace geos
+
+#endif // GEOS_FIELDSPECIFICATION_FIELDSPECIFICATIONPLAN_HPP_
@@ -32,6 +32,12 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
+  m_chunkRecords( 1 ),
+  m_chunkIndices( 0 ),
+  m_compressionLevel( 0 ),
+  m_shuffle( 0 ),
+  m_flushBufferSize( 0 ),
+  m_bufferCapacity( 0 ),
   m_io( )
 {
   enableLogLevelInput();
@@ -57,6 +63,35 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::chunkRecordsString(), &m_chunkRecords ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The number of time history records stored in each chunk of the datasets. "
+                    "Larger chunks reduce the number of small I/O operations and improve the compression." );
+
+  registerWrapper( viewKeys::chunkIndicesString(), &m_chunkIndices ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The number of indices (e.g. elements or nodes) stored in each chunk of the datasets. "
+                    "The default (0) uses the smallest nonzero number of indices collected by a rank." );
+
+  registerWrapper( viewKeys::compressionLevelString(), &m_compressionLevel ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The gzip compression level of the datasets, from 1 (fastest) to 9 (smallest), or 0 to disable the compression." );
+
+  registerWrapper( viewKeys::shuffleString(), &m_shuffle ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to apply the byte shuffle filter to the datasets, which usually improves the compression of floating-point data." );
+
+  registerWrapper( viewKeys::flushBufferSizeString(), &m_flushBufferSize ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The amount of buffered data (in bytes) above which the time history is written to file. "
+                    "The default (0) writes the buffered data on every output event. "
+                    "Note that the records still buffered when a restart file is written are not recovered on restart." );
+
 }
 
 void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector )
@@ -66,6 +101,25 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
   string const outputDirectory = getOutputDirectory();
   string const outputFile = joinPath( outputDirectory, m_filename );
 
+  GEOS_THROW_IF_LT_MSG( m_chunkRecords, 1,
+                        GEOS_FMT( "{}: the number of records per chunk must be positive.",
+                                  getWrapperDataContext( viewKeys::chunkRecordsString() ) ),
+                        InputError );
+  GEOS_THROW_IF_LT_MSG( m_chunkIndices, 0,
+                        GEOS_FMT( "{}: the number of indices per chunk must be positive or zero.",
+                                  getWrapperDataContext( viewKeys::chunkIndicesString() ) ),
+                        InputError );
+  GEOS_THROW_IF( m_compressionLevel < 0 || m_compressionLevel > 9,
+                 GEOS_FMT( "{}: the compression level must be between 0 and 9.",
+                           getWrapperDataContext( viewKeys::compressionLevelString() ) ),
+                 InputError );
+
+  HDFHistoryStorage storage;
+  storage.chunkRecords = LvArray::integerConversion< hsize_t >( m_chunkRecords );
+  storage.chunkIndices = LvArray::integerConversion< hsize_t >( m_chunkIndices );
+  storage.compressionLevel = m_compressionLevel;
+  storage.shuffle = ( m_shuffle != 0 );
+
   auto registerBufferCalls = [&]( HistoryCollection & hc, string prefix = "" )
   {
     for( localIndex collectorIdx = 0; collectorIdx < hc.numCollectors(); ++collectorIdx )
@@ -77,7 +131,10 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
         metadata.setName( prefix + metadata.getName() );
       }
 
-      m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount ) );
+      auto io = std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount );
+      io->setStorage( storage );
+      io->setRingCapacity( m_bufferCapacity );
+      m_io.emplace_back( std::move( io ) );
       m_io.back()->setLogLevel( this->getLogLevel() );
       hc.registerBufferProvider( collectorIdx, [this, idx = m_io.size() - 1]( localIndex count )
       {
@@ -104,7 +161,10 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
   if( MpiWrapper::commRank() == 0 )
   {
     HistoryMetadata timeMetadata = collector.getTimeMetaData();
-    m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, timeMetadata, m_recordCount, 1, 2, MPI_COMM_SELF ) );
+    auto io = std::make_unique< HDFHistoryIO >( outputFile, timeMetadata, m_recordCount, 1, 2, MPI_COMM_SELF );
+    io->setStorage( storage );
+    io->setRingCapacity( m_bufferCapacity );
+    m_io.emplace_back( std::move( io ) );
     m_io.back()->setLogLevel( this->getLogLevel() );
     // We copy the back `idx` not to rely on possible future appends to `m_io`.
     collector.registerTimeBufferProvider( [this, idx = m_io.size() - 1]() { return m_io[idx]->getBufferHead(); } );
@@ -151,6 +211,15 @@ void TimeHistoryOutput::setFileName( string const & root )
   m_filename = root;
 }
 
+void TimeHistoryOutput::setBufferCapacity( localIndex const capacity )
+{
+  m_bufferCapacity = capacity;
+  for( auto & th_io : m_io )
+  {
+    th_io->setRingCapacity( capacity );
+  }
+}
+
 void TimeHistoryOutput::reinit()
 {
   m_recordCount = 0;
@@ -166,13 +235,32 @@ bool TimeHistoryOutput::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
                                  DomainPartition & GEOS_UNUSED_PARAM( domain ) )
 {
   GEOS_MARK_FUNCTION;
+  writeBuffered( false );
+  return false;
+}
+
+void TimeHistoryOutput::writeBuffered( bool const force )
+{
+  if( !force && m_flushBufferSize > 0 )
+  {
+    size_t bufferedBytes = 0;
+    for( auto & th_io : m_io )
+    {
+      bufferedBytes += th_io->getBufferedBytes();
+    }
+    // all the ranks must take the same decision since the writes are collective
+    if( MpiWrapper::max( LvArray::integerConversion< globalIndex >( bufferedBytes ) ) < m_flushBufferSize )
+    {
+      return;
+    }
+  }
+
   localIndex newBuffered = m_io.front()->getBufferedCount( );
   for( auto & th_io : m_io )
   {
     th_io->write( );
   }
   m_recordCount += newBuffered;
-  return false;
 }
 
 void TimeHistoryOutput::cleanup( real64 const time_n,
@@ -181,7 +269,8 @@ void TimeHistoryOutput::cleanup( real64 const time_n,
                                  real64 const eventProgress,
                                  DomainPartition & domain )
 {
-  execute( time_n, 0.0, cycleNumber, eventCounter, eventProgress, domain );
+  GEOS_UNUSED_VAR( time_n, cycleNumber, eventCounter, eventProgress, domain );
+  writeBuffered( true );
   MpiWrapper::barrier( MPI_COMM_GEOS );
   // remove any unused trailing space reserved to write additional histories
   for( auto & th_io : m_io )
@@ -71,6 +71,21 @@ public:
    */
   void setFileName( string const & root );
 
+  /**
+   * @brief Limit the number of history states buffered between two writes (This is usefull for pygeosx user)
+   * @param capacity The maximum number of buffered states, or 0 for no limit.
+   * @note Once the limit is reached, each collection overwrites the oldest buffered state,
+   *       so the buffered states can be accessed in-place without growing the buffers.
+   */
+  void setBufferCapacity( localIndex const capacity );
+
+  /**
+   * @brief Get the buffered history output objects, one for each collected quantity.
+   * @return The buffered history output objects.
+   */
+  std::vector< std::unique_ptr< BufferedHistoryIO > > const & getBufferedHistoryIO() const
+  { return m_io; }
+
   /**
    * @brief Writes out a time history file.
    * @copydoc EventBase::execute()
@@ -98,6 +113,11 @@ public:
     static constexpr char const * timeHistoryOutputFilenameString() { return "filename"; }
     static constexpr char const * timeHistoryOutputFormatString() { return "format"; }
     static constexpr char const * timeHistoryRestartString() { return "restart"; }
+    static constexpr char const * chunkRecordsString() { return "chunkRecords"; }
+    static constexpr char const * chunkIndicesString() { return "chunkIndices"; }
+    static constexpr char const * compressionLevelString() { return "compressionLevel"; }
+    static constexpr char const * shuffleString() { return "shuffle"; }
+    static constexpr char const * flushBufferSizeString() { return "flushBufferSize"; }
 
     dataRepository::ViewKey timeHistoryOutputTarget = { "sources" };
     dataRepository::ViewKey timeHistoryOutputFilename = { "filename" };
@@ -123,6 +143,13 @@ private:
    */
   void initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector );
 
+  /**
+   * @brief Write the buffered history states to file.
+   * @param force Whether to write regardless of the amount of buffered data.
+   * @note This is collective on the GEOSX comm.
+   */
+  void writeBuffered( bool const force );
+
   /// The paths of the collectors to collect history from.
   string_array m_collectorPaths;
   /// The file format of the time history file.
@@ -131,6 +158,18 @@ private:
   string m_filename;
   /// The discrete number of time history states expected to be written to the file
   integer m_recordCount;
+  /// The number of time history records per dataset chunk
+  integer m_chunkRecords;
+  /// The number of indices per dataset chunk (0 to size the chunks from the collected data)
+  integer m_chunkIndices;
+  /// The gzip compression level of the datasets (0 to disable the compression)
+  integer m_compressionLevel;
+  /// Whether the shuffle filter is applied to the datasets
+  integer m_shuffle;
+  /// The amount of buffered data (in bytes, on any rank) triggering a write to file
+  globalIndex m_flushBufferSize;
+  /// The maximum number of history states buffered between two writes (0 for no limit)
+  localIndex m_bufferCapacity;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
 };
@@ -38,6 +38,9 @@ VTKOutput::VTKOutput( string const & name,
   m_onlyPlotSpecifiedFieldNames(),
   m_fieldNames(),
   m_levelNames(),
+  m_regionOfInterest(),
+  m_decimationStride(),
+  m_writeSinglePrecision(),
   m_writer( getOutputDirectory() + '/' + m_plotFileRoot )
 {
   enableLogLevelInput();
@@ -81,6 +84,23 @@ VTKOutput::VTKOutput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Names of mesh levels to output." );
 
+  registerWrapper( viewKeysStruct::regionOfInterest, &m_regionOfInterest ).
+    setRTTypeName( rtTypes::CustomTypes::groupNameRefArray ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Names of the geometric objects (e.g. ``Box``) delimiting the region of interest. "
+                    "If this attribute is specified, only the cells of the CellElementRegions whose center is inside one of the objects are output." );
+
+  registerWrapper( viewKeysStruct::decimationStride, &m_decimationStride ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Stride of the output of the meshes generated by ``InternalMesh``: only one cell out of `decimationStride` "
+                    "is output in each direction. Other meshes are not decimated." );
+
+  registerWrapper( viewKeysStruct::writeSinglePrecision, &m_writeSinglePrecision ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Should the double precision fields and the cell coordinates be converted to single precision in the vtk files or not." );
+
   registerWrapper( viewKeysStruct::binaryString, &m_writeBinaryData ).
     setApplyDefaultValue( m_writeBinaryData ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -101,6 +121,14 @@ void VTKOutput::postInputInitialization()
   m_writer.setFieldNames( m_fieldNames.toViewConst() );
   m_writer.setLevelNames( m_levelNames.toViewConst() );
   m_writer.setOnlyPlotSpecifiedFieldNamesFlag( m_onlyPlotSpecifiedFieldNames );
+  m_writer.setRegionOfInterest( m_regionOfInterest.toViewConst() );
+  m_writer.setDecimationStride( m_decimationStride );
+  m_writer.setWriteSinglePrecision( m_writeSinglePrecision );
+
+  GEOS_THROW_IF_LT_MSG( m_decimationStride, 1,
+                        GEOS_FMT( "{} `{}`: the decimation stride must be positive.",
+                                  catalogName(), getDataContext() ),
+                        InputError );
 
   string const fieldNamesString = viewKeysStruct::fieldNames;
   string const onlyPlotSpecifiedFieldNamesString = viewKeysStruct::onlyPlotSpecifiedFieldNames;
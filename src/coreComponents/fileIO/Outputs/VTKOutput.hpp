@@ -97,6 +97,9 @@ public:
     static constexpr auto onlyPlotSpecifiedFieldNames = "onlyPlotSpecifiedFieldNames";
     static constexpr auto fieldNames = "fieldNames";
     static constexpr auto levelNames = "levelNames";
+    static constexpr auto regionOfInterest = "regionOfInterest";
+    static constexpr auto decimationStride = "decimationStride";
+    static constexpr auto writeSinglePrecision = "writeSinglePrecision";
   } vtkOutputViewKeys;
   /// @endcond
 
@@ -129,6 +132,15 @@ private:
   /// array of names of the mesh levels to output (an empty array means all levels are saved)
   array1d< string > m_levelNames;
 
+  /// array of names of the geometric objects delimiting the cells to output (an empty array means all cells are saved)
+  array1d< string > m_regionOfInterest;
+
+  /// one cell out of m_decimationStride is output in each direction of the InternalMesh meshes
+  integer m_decimationStride;
+
+  /// Should the double precision fields and coordinates be written in single precision or not.
+  integer m_writeSinglePrecision;
+
   /// VTK output mode
   vtk::VTKOutputMode m_writeBinaryData = vtk::VTKOutputMode::BINARY;
 
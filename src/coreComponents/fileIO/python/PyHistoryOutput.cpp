@@ -22,6 +22,8 @@
 #include "PyHistoryOutputType.hpp"
 #include "dataRepository/python/PyGroupType.hpp"
 
+#include "LvArray/src/python/numpyConversion.hpp"
+
 
 #define VERIFY_NON_NULL_SELF( self ) \
   PYTHON_ERROR_IF( self == nullptr, PyExc_RuntimeError, "Passed a nullptr as self.", nullptr )
@@ -155,10 +157,108 @@ static PyObject * reinit( PyHistoryOutput * self, PyObject *args )
 }
 
 
+static PyObject * setBufferCapacity( PyHistoryOutput * self, PyObject * args )
+{
+  VERIFY_NON_NULL_SELF( self );
+  VERIFY_INITIALIZED( self );
+
+  long long capacity;
+  if( !PyArg_ParseTuple( args, "L", &capacity ) )
+  {
+    return nullptr;
+  }
+  PYTHON_ERROR_IF( capacity < 0, PyExc_ValueError, "The buffer capacity must be positive or zero.", nullptr );
+
+  self->group->setBufferCapacity( LvArray::integerConversion< localIndex >( capacity ) );
+
+  Py_RETURN_NONE;
+}
+
+/**
+ * @brief Create a numpy array sharing the buffered history states.
+ * @param data The buffered states.
+ * @param metadata The description of the buffered states.
+ * @return The numpy array, or nullptr with a Python exception set if the type is not supported.
+ */
+static PyObject * createBufferedStatesArray( buffer_unit_type const * const data, HistoryMetadata const & metadata )
+{
+  std::vector< localIndex > const & dims = metadata.getDims();
+  int const ndim = LvArray::integerConversion< int >( dims.size() );
+  std::vector< localIndex > strides( dims.size(), 1 );
+  for( int i = ndim - 1; i > 0; --i )
+  {
+    strides[i-1] = strides[i] * dims[i];
+  }
+
+  PyObject * ret = nullptr;
+  auto createIfType = [&]( auto const typeTag )
+  {
+    using T = decltype( typeTag );
+    if( metadata.getType() != std::type_index( typeid( T ) ) )
+    {
+      return false;
+    }
+    ret = LvArray::python::createNumPyArray( reinterpret_cast< T const * >( data ), false, ndim, dims.data(), strides.data() );
+    return true;
+  };
+
+  bool const supported = createIfType( real64{} ) || createIfType( real32{} ) ||
+                         createIfType( integer{} ) || createIfType( localIndex{} ) || createIfType( globalIndex{} );
+  PYTHON_ERROR_IF( !supported, PyExc_TypeError,
+                   "Unsupported type for the history '" << metadata.getName() << "'.", nullptr );
+  return ret;
+}
+
+static constexpr char const * bufferedStatesDocString =
+  "bufferedStates(self)\n"
+  "--\n\n"
+  "Return the history states collected since the last output, without copying them.\n"
+  "\n"
+  "Returns\n"
+  "_______\n"
+  "dict of str to numpy.ndarray\n"
+  "    For each collected history, a read-only array whose first dimension is the number of buffered states, "
+  "from the oldest to the newest. The arrays share the memory of the history buffers: they are only valid "
+  "until the next collection or output. Histories with no buffered state, or whose collected size changed "
+  "since the last output, are not included.";
+static PyObject * bufferedStates( PyHistoryOutput * self, PyObject * args )
+{
+  VERIFY_NON_NULL_SELF( self );
+  VERIFY_INITIALIZED( self );
+  GEOS_UNUSED_VAR( args );
+
+  LvArray::python::PyObjectRef<> dict { PyDict_New() };
+  if( dict == nullptr )
+  {
+    return nullptr;
+  }
+
+  for( std::unique_ptr< BufferedHistoryIO > const & io : self->group->getBufferedHistoryIO() )
+  {
+    HistoryMetadata metadata;
+    buffer_unit_type const * const data = io->getBufferedStates( metadata );
+    if( data == nullptr )
+    {
+      continue;
+    }
+
+    LvArray::python::PyObjectRef<> array { createBufferedStatesArray( data, metadata ) };
+    if( array == nullptr || PyDict_SetItemString( dict, metadata.getName().c_str(), array ) != 0 )
+    {
+      return nullptr;
+    }
+  }
+
+  return dict.release();
+}
+
+
 static PyMethodDef PyHistoryOutput_methods[] = {
   { "output", (PyCFunction) output, METH_VARARGS, "wrapper to routine TimeHistoryOutput::execute"},
   { "setOutputName", (PyCFunction) setOutputName, METH_VARARGS, "wrapper to routine TimeHistoryOutput::setFileName()"},
   { "reinit", (PyCFunction) reinit, METH_VARARGS, "reinitialization function"},
+  { "setBufferCapacity", (PyCFunction) setBufferCapacity, METH_VARARGS, "wrapper to routine TimeHistoryOutput::setBufferCapacity()"},
+  { "bufferedStates", (PyCFunction) bufferedStates, METH_VARARGS, bufferedStatesDocString},
   { nullptr, nullptr, 0, nullptr }      /* Sentinel */
 };
 
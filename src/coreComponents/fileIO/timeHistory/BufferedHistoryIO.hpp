@@ -17,6 +17,7 @@
 #define GEOS_FILEIO_TIMEHISTORY_BUFFEREDHISTORYIO_HPP_
 
 #include "common/DataTypes.hpp"
+#include "dataRepository/HistoryDataSpec.hpp"
 
 namespace geos
 {
@@ -74,6 +75,30 @@ public:
    */
   virtual localIndex getBufferedCount() = 0;
 
+  /**
+   * @brief Query the size of the history states currently stored in the internal buffer.
+   * @return The number of bytes buffered to be written.
+   */
+  virtual size_t getBufferedBytes() = 0;
+
+  /**
+   * @brief Access the history states currently stored in the internal buffer, without copying them.
+   * @param[out] metadata The name and type of the buffered data, the first dimension being the number of buffered states.
+   * @return The buffered states, from the oldest to the newest, or nullptr if nothing is buffered or if
+   *         the size of the collected data changed between the buffered states.
+   * @note The returned data is only valid until the next collection or write.
+   */
+  virtual buffer_unit_type const * getBufferedStates( HistoryMetadata & metadata ) = 0;
+
+  /**
+   * @brief Limit the number of history states stored in the internal buffer.
+   * @param[in] capacity The maximum number of buffered states, or 0 for no limit.
+   * @note When the limit is reached, the next collection overwrites the oldest buffered state in place.
+   *       The overwritten states are never written to the output target, and the size of the collected
+   *       data must not change while states are buffered.
+   */
+  virtual void setRingCapacity( localIndex capacity ) = 0;
+
   /**
    * @brief Get the log-level for BufferedHistoryIO classes
    * @return the current log-level
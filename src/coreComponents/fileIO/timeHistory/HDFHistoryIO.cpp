@@ -19,6 +19,8 @@
 
 #include "common/MpiWrapper.hpp"
 
+#include <algorithm>
+
 namespace geos
 {
 
@@ -108,6 +110,8 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_bufferedCount( 0 ),
   m_bufferHead( nullptr ),
   m_dataBuffer( 0 ),
+  m_ringCapacity( 0 ),
+  m_ringStart( 0 ),
   m_filename( filename ),
   m_overallocMultiple( overallocMultiple ),
   m_globalIdxOffset( 0 ),
@@ -118,6 +122,7 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_writeHead( writeHead ),
   m_hdfType( GetHDFDataType( typeId )),
   m_typeSize( H5Tget_size( m_hdfType )),
+  m_typeId( typeId ),
   m_typeCount( 1 ),
   m_rank( LvArray::integerConversion< hsize_t >( rank )),
   m_dims( rank ),
@@ -125,7 +130,8 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_name( name ),
   m_comm( comm ),
   m_subcomm( MPI_COMM_NULL ),
-  m_sizeChanged( true )
+  m_sizeChanged( true ),
+  m_storage()
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
   {
@@ -193,6 +199,13 @@ void HDFHistoryIO::setupPartition( globalIndex localIdxCount )
 
 buffer_unit_type * HDFHistoryIO::getBufferHead()
 {
+  if( m_ringCapacity > 0 && m_bufferedCount == m_ringCapacity )
+  {
+    // the buffer is full, overwrite the oldest record (all the buffered records have the same size)
+    buffer_unit_type * const oldestRecord = &m_dataBuffer[0] + m_ringStart * getRowBytes();
+    m_ringStart = ( m_ringStart + 1 ) % m_ringCapacity;
+    return oldestRecord;
+  }
   resizeBuffer();
   m_bufferedCount++;
   buffer_unit_type * const currentBufferHead = m_bufferHead;
@@ -221,19 +234,29 @@ void HDFHistoryIO::init( bool existsOkay )
       std::vector< hsize_t > historyFileDims( m_rank+1 );
       historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
       std::vector< hsize_t > dimChunks( m_rank+1 );
-      dimChunks[0] = 1;
+      dimChunks[0] = std::max( m_storage.chunkRecords, hsize_t( 1 ) );
       for( hsize_t dd = 1; dd < m_rank+1; ++dd )
       {
         // hdf5 doesn't like chunk size 0, hence the subcomm
         dimChunks[dd] = m_dims[dd-1];
         historyFileDims[dd] = m_dims[dd-1];
       }
-      dimChunks[1] = m_chunkSize;
+      dimChunks[1] = m_storage.chunkIndices > 0 ? m_storage.chunkIndices : m_chunkSize;
       historyFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
       std::vector< hsize_t > maxFileDims( historyFileDims );
       // chunking is required to create an extensible dataset
       hid_t dcplId = H5Pcreate( H5P_DATASET_CREATE );
       H5Pset_chunk( dcplId, m_rank + 1, &dimChunks[0] );
+      // every written value is provided by the history, no need to initialize the chunks
+      H5Pset_fill_time( dcplId, H5D_FILL_TIME_NEVER );
+      if( m_storage.shuffle )
+      {
+        H5Pset_shuffle( dcplId );
+      }
+      if( m_storage.compressionLevel > 0 )
+      {
+        H5Pset_deflate( dcplId, LvArray::integerConversion< unsigned >( m_storage.compressionLevel ) );
+      }
       maxFileDims[0] = H5S_UNLIMITED;
       maxFileDims[1] = H5S_UNLIMITED;
       hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
@@ -255,6 +278,78 @@ void HDFHistoryIO::init( bool existsOkay )
   }
 }
 
+void HDFHistoryIO::setStorage( HDFHistoryStorage const & storage )
+{
+  GEOS_ERROR_IF( storage.compressionLevel < 0 || storage.compressionLevel > 9,
+                 GEOS_FMT( "TimeHistory: invalid compression level {} for dataset '{}', it must be between 0 and 9.",
+                           storage.compressionLevel, m_name ) );
+  m_storage = storage;
+  if( m_storage.compressionLevel > 0 || m_storage.shuffle )
+  {
+#if !H5_VERSION_GE( 1, 10, 2 )
+    // writing filtered datasets in parallel requires HDF5 1.10.2 or newer
+    if( MpiWrapper::commSize( m_comm ) > 1 )
+    {
+      GEOS_WARNING( GEOS_FMT( "TimeHistory: filters are not supported with parallel output by this HDF5 version, "
+                              "dataset '{}' will not be compressed.", m_name ) );
+      m_storage.compressionLevel = 0;
+      m_storage.shuffle = false;
+    }
+#endif
+    if( m_storage.compressionLevel > 0 && H5Zfilter_avail( H5Z_FILTER_DEFLATE ) <= 0 )
+    {
+      GEOS_WARNING( GEOS_FMT( "TimeHistory: the deflate filter is not available, dataset '{}' will not be compressed.", m_name ) );
+      m_storage.compressionLevel = 0;
+    }
+  }
+}
+
+void HDFHistoryIO::writeRows( hsize_t const numRows,
+                              globalIndex const localIdxCount,
+                              buffer_unit_type const * const dataBuffer )
+{
+  GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: opening file {}.", m_filename ) );
+  HDFFile target( m_filename, false, true, m_subcomm );
+  GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: opened file {}.", m_filename ) );
+
+  if( !target.hasDataset( m_name ) )
+  {
+    GEOS_ERROR( "Attempted to write to a non-existent dataset: " + m_name );
+  }
+
+  hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+  hid_t filespace = H5Dget_space( dataset );
+
+  std::vector< hsize_t > fileOffset( m_rank+1 );
+  fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
+  // the m_globalIdxOffset will be updated for each row during the partition setup if the size has changed during buffered collection
+  fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
+
+  std::vector< hsize_t > bufferedCounts( m_rank+1 );
+  bufferedCounts[0] = numRows;
+  bufferedCounts[1] = LvArray::integerConversion< hsize_t >( localIdxCount );
+  for( hsize_t dd = 2; dd < m_rank+1; ++dd )
+  {
+    bufferedCounts[dd] = m_dims[dd-1];
+  }
+  hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
+
+  hid_t fileHyperslab = filespace;
+  H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
+
+  hid_t dxplId = H5Pcreate( H5P_DATASET_XFER );
+  // collective transfers are also required to write filtered (compressed) datasets in parallel
+  H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
+  H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, dxplId, dataBuffer );
+  GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: wrote rows {} to {} of dataset '{}'.", m_writeHead, m_writeHead + numRows - 1, m_name ) );
+  H5Pclose( dxplId );
+
+  H5Sclose( memspace );
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+  GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: closing file {}.", m_filename ) );
+}
+
 void HDFHistoryIO::write()
 {
   // check if the size has changed on any process in the primary comm
@@ -262,9 +357,23 @@ void HDFHistoryIO::write()
   MpiWrapper::allReduce( &m_sizeChanged, &anyChanged, 1, MPI_LOR, m_comm );
   m_sizeChanged = anyChanged;
 
+  unwrapRing();
+
   // this will set the first dim large enough to hold all the rows we're about to write
   resizeFileIfNeeded( m_bufferedCount );
-  if( m_bufferedCount > 0 )
+  if( m_bufferedCount > 0 && !m_sizeChanged )
+  {
+    // the partitioning is the same for all the buffered rows, which are contiguous in the buffer:
+    //  write them at once rather than one collective write per row
+    if( m_subcomm != MPI_COMM_NULL )
+    {
+      writeRows( LvArray::integerConversion< hsize_t >( m_bufferedCount ),
+                 m_localIdxCounts_buffered.front(),
+                 m_dataBuffer.size() > 0 ? &m_dataBuffer[0] : nullptr );
+    }
+    m_writeHead += m_bufferedCount;
+  }
+  else if( m_bufferedCount > 0 )
   {
     buffer_unit_type * dataBuffer = nullptr;
     if( m_dataBuffer.size() > 0 )
@@ -285,57 +394,14 @@ void HDFHistoryIO::write()
 
       if( m_subcomm != MPI_COMM_NULL )
       {
-        GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: opening file {}.", m_filename ) );
-        HDFFile target( m_filename, false, true, m_subcomm );
-        GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: opened file {}.", m_filename ) );
-
-        if( !target.hasDataset( m_name ) )
-        {
-          GEOS_ERROR( "Attempted to write to a non-existent dataset: " + m_name );
-        }
-
-        hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-        hid_t filespace = H5Dget_space( dataset );
-
-        std::vector< hsize_t > fileOffset( m_rank+1 );
-        fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
-        // the m_globalIdxOffset will be updated for each row during the partition setup if the size has changed during buffered collection
-        fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
-
-        std::vector< hsize_t > bufferedCounts( m_rank+1 );
-        bufferedCounts[0] = LvArray::integerConversion< hsize_t >( 1 );
-        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_buffered[ row ] );
-        for( hsize_t dd = 2; dd < m_rank+1; ++dd )
-        {
-          bufferedCounts[dd] = m_dims[dd-1];
-        }
-        hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
-
-        hid_t fileHyperslab = filespace;
-        H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
-
-        hid_t dxplId = H5Pcreate( H5P_DATASET_XFER );
-        H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
-        H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, dxplId, dataBuffer );
-        GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: wrote row {} of dataset '{}'.", m_writeHead, m_name ) );
-        H5Pclose( dxplId );
+        // unfortunately have to close/open the file for each row since the accessing mpi ranks and extents can change over time
+        writeRows( 1, m_localIdxCounts_buffered[ row ], dataBuffer );
 
         // forward the data buffer pointer to the start of the next row
         if( dataBuffer )
         {
-          hsize_t rowsize = m_localIdxCounts_buffered[ row ] * m_typeSize;
-          for( hsize_t ii = 1; ii < m_rank; ++ii )
-          {
-            rowsize *= m_dims[ii];
-          }
-          dataBuffer += rowsize;
+          dataBuffer += getBufferedRowBytes( m_localIdxCounts_buffered[ row ] );
         }
-
-        // unfortunately have to close/open the file for each row since the accessing mpi ranks and extents can change over time
-        H5Sclose( memspace );
-        H5Sclose( filespace );
-        H5Dclose( dataset );
-        GEOS_LOG_LEVEL_BY_RANK( 3, GEOS_FMT( "TimeHistory: closing file {}.", m_filename ) );
       }
       m_writeHead++;
     }
@@ -389,9 +455,74 @@ size_t HDFHistoryIO::getRowBytes()
   return m_typeCount * m_typeSize;
 }
 
+hsize_t HDFHistoryIO::getBufferedRowBytes( globalIndex const localIdxCount ) const
+{
+  hsize_t rowsize = localIdxCount * m_typeSize;
+  for( hsize_t ii = 1; ii < m_rank; ++ii )
+  {
+    rowsize *= m_dims[ii];
+  }
+  return rowsize;
+}
+
+size_t HDFHistoryIO::getBufferedBytes()
+{
+  return m_dataBuffer.size() > 0 ? LvArray::integerConversion< size_t >( m_bufferHead - &m_dataBuffer[0] ) : 0;
+}
+
+buffer_unit_type const * HDFHistoryIO::getBufferedStates( HistoryMetadata & metadata )
+{
+  unwrapRing();
+
+  std::vector< localIndex > dims( m_rank + 1 );
+  dims[0] = m_bufferedCount;
+  for( hsize_t dd = 0; dd < m_rank; ++dd )
+  {
+    dims[dd+1] = LvArray::integerConversion< localIndex >( m_dims[dd] );
+  }
+  metadata = HistoryMetadata( m_name, LvArray::integerConversion< localIndex >( m_rank + 1 ), dims.data(), m_typeId );
+
+  bool const sameSize = std::all_of( m_localIdxCounts_buffered.begin(),
+                                     m_localIdxCounts_buffered.end(),
+                                     [&]( globalIndex const count ) { return count == LvArray::integerConversion< globalIndex >( m_dims[0] ); } );
+  if( m_bufferedCount == 0 || !sameSize )
+  {
+    return nullptr;
+  }
+  return &m_dataBuffer[0];
+}
+
+void HDFHistoryIO::setRingCapacity( localIndex const capacity )
+{
+  GEOS_ERROR_IF_LT_MSG( capacity, 0, GEOS_FMT( "TimeHistory: invalid buffer capacity for dataset '{}'.", m_name ) );
+  // keep the most recent records if the buffer is shrinking
+  unwrapRing();
+  if( capacity > 0 && m_bufferedCount > capacity )
+  {
+    size_t const rowBytes = getRowBytes();
+    std::copy( m_bufferHead - capacity * rowBytes, m_bufferHead, &m_dataBuffer[0] );
+    m_localIdxCounts_buffered.erase( m_localIdxCounts_buffered.begin(),
+                                     m_localIdxCounts_buffered.end() - capacity );
+    m_bufferedCount = capacity;
+    m_bufferHead = &m_dataBuffer[0] + capacity * rowBytes;
+  }
+  m_ringCapacity = capacity;
+}
+
+void HDFHistoryIO::unwrapRing()
+{
+  if( m_ringStart > 0 )
+  {
+    buffer_unit_type * const begin = &m_dataBuffer[0];
+    std::rotate( begin, begin + m_ringStart * getRowBytes(), m_bufferHead );
+    m_ringStart = 0;
+  }
+}
+
 void HDFHistoryIO::emptyBuffer()
 {
   m_bufferedCount = 0;
+  m_ringStart = 0;
   m_bufferHead = &m_dataBuffer[0];
 }
 
@@ -418,6 +549,10 @@ void HDFHistoryIO::updateCollectingCount( localIndex count )
 {
   if( LvArray::integerConversion< hsize_t >( count ) != m_dims[0] )
   {
+    // the records of a full buffer are overwritten in place, which requires them to have the same size
+    GEOS_ERROR_IF( m_ringCapacity > 0 && m_bufferedCount > 0,
+                   GEOS_FMT( "TimeHistory: the collected size of dataset '{}' cannot change while records are buffered "
+                             "with a limited buffer capacity.", m_name ) );
     m_sizeChanged = true;
     m_dims[0] = count;
     m_typeCount = count;
@@ -27,6 +27,22 @@
 namespace geos
 {
 
+/**
+ * @struct HDFHistoryStorage
+ * @brief Layout and filters of the datasets created by HDFHistoryIO.
+ */
+struct HDFHistoryStorage
+{
+  /// Number of time history records per chunk (first dimension of the chunks)
+  hsize_t chunkRecords = 1;
+  /// Number of indices per chunk (second dimension of the chunks), 0 to use the smallest nonzero rank-local count
+  hsize_t chunkIndices = 0;
+  /// Level of the gzip (deflate) compression, from 1 to 9, or 0 to disable the compression
+  integer compressionLevel = 0;
+  /// Whether the shuffle filter is applied before the compression
+  bool shuffle = false;
+};
+
 /**
  * @class HDFHistoryIO
  * @brief Perform buffered history I/O for a single type(really just output) on using HDF5.
@@ -87,6 +103,13 @@ public:
 
   virtual buffer_unit_type * getBufferHead() override;
 
+  /**
+   * @brief Set the layout and the filters of the dataset.
+   * @param[in] storage The storage options.
+   * @note This must be called before init(), and has no effect on datasets that already exist in the file.
+   */
+  void setStorage( HDFHistoryStorage const & storage );
+
   /// @copydoc geos::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
 
@@ -102,6 +125,15 @@ public:
   localIndex getBufferedCount() override
   { return m_bufferedCount; }
 
+  /// @copydoc geos::BufferedHistoryIO::getBufferedBytes
+  virtual size_t getBufferedBytes() override;
+
+  /// @copydoc geos::BufferedHistoryIO::getBufferedStates
+  virtual buffer_unit_type const * getBufferedStates( HistoryMetadata & metadata ) override;
+
+  /// @copydoc geos::BufferedHistoryIO::setRingCapacity
+  virtual void setRingCapacity( localIndex capacity ) override;
+
 private:
 
   /**
@@ -113,6 +145,9 @@ private:
   /// @brief Empty the history collection buffer
   void emptyBuffer();
 
+  /// @brief Reorder the buffered rows from the oldest to the newest after the ring buffer wrapped around.
+  void unwrapRing();
+
   /**
    * @brief Setup the parallel 'partitioning' of the data to allow dynamically sized output over time
    * @param[in] localIdxCount The number of pieces of data associated with the local rank
@@ -137,12 +172,32 @@ private:
   /// @brief Resize the buffer to accomodate additional history collection.
   void resizeBuffer();
 
+  /**
+   * @brief Collectively write consecutive buffered rows sharing the same local index count.
+   * @param[in] numRows The number of rows to write, starting at the write head.
+   * @param[in] localIdxCount The local index count of each of the rows.
+   * @param[in] dataBuffer The start of the rows in the buffer.
+   * @note This is collective over the partition sub-communicator, which must not be null.
+   */
+  void writeRows( hsize_t numRows, globalIndex localIdxCount, buffer_unit_type const * dataBuffer );
+
+  /**
+   * @brief Get the size in bytes of a buffered row.
+   * @param[in] localIdxCount The local index count of the row.
+   * @return The size in bytes.
+   */
+  hsize_t getBufferedRowBytes( globalIndex localIdxCount ) const;
+
   /// The current number of records in the buffer
   localIndex m_bufferedCount;
   /// The write head of the buffer
   buffer_unit_type * m_bufferHead;
   /// The data buffer containing the history info
   buffer_type m_dataBuffer;
+  /// The maximum number of records in the buffer (0 for no limit)
+  localIndex m_ringCapacity;
+  /// The position in the buffer of the oldest record once the buffer is full (with a limited capacity)
+  localIndex m_ringStart;
 
   // file io params
   /// The filename to write to
@@ -169,6 +224,8 @@ private:
   hsize_t m_hdfType;
   /// The size in byte of the data type
   size_t m_typeSize;
+  /// The type of the collected data
+  std::type_index m_typeId;
   /// The number of variables of data type in this data set
   hsize_t m_typeCount;   // prod(dims[0:n])
   /// The rank of the data set
@@ -186,6 +243,8 @@ private:
   MPI_Comm m_subcomm;
   /// Whether the size of the collected data has changed between writes to file
   int m_sizeChanged;
+  /// Layout and filters of the dataset
+  HDFHistoryStorage m_storage;
 };
 
 }
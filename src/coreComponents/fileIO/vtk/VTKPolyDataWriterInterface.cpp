@@ -20,6 +20,8 @@
 #include "common/TypeDispatch.hpp"
 #include "dataRepository/Group.hpp"
 #include "mesh/DomainPartition.hpp"
+#include "mesh/generators/InternalMeshGenerator.hpp"
+#include "mesh/simpleGeometricObjects/GeometricObjectManager.hpp"
 #include "fileIO/Outputs/OutputUtilities.hpp"
 
 // TPL includes
@@ -56,7 +58,10 @@ VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string name ):
   m_previousCycle( -1 ),
   m_outputMode( VTKOutputMode::BINARY ),
   m_outputRegionType( VTKRegionTypes::ALL ),
-  m_writeFaceElementsAs3D( false )
+  m_writeFaceElementsAs3D( false ),
+  m_regionOfInterest(),
+  m_decimationStride( 1 ),
+  m_writeSinglePrecision( false )
 {}
 
 static int
@@ -235,14 +240,21 @@ static std::vector< int > getVtkConnectivity( ElementType const elementType, loc
 /**
  * @brief Gets the vertices coordinates as a VTK Object for @p nodeManager
  * @param[in] nodeManager the NodeManager associated with the domain being written
+ * @param[in] nodeIndices list of local node indices to write
+ * @param[in] singlePrecision whether the coordinates are stored in single precision
  * @return a VTK object storing all nodes of the mesh
  */
 static vtkSmartPointer< vtkPoints >
 getVtkPoints( NodeManager const & nodeManager,
-              arrayView1d< localIndex const > const & nodeIndices )
+              arrayView1d< localIndex const > const & nodeIndices,
+              bool const singlePrecision )
 {
   localIndex const numNodes = LvArray::integerConversion< localIndex >( nodeIndices.size() );
   auto points = vtkSmartPointer< vtkPoints >::New();
+  if( singlePrecision )
+  {
+    points->SetDataTypeToFloat();
+  }
   points->SetNumberOfPoints( numNodes );
   auto const coord = nodeManager.referencePosition().toViewConst();
   forAll< parallelHostPolicy >( numNodes, [=, pts = points.GetPointer()]( localIndex const k )
@@ -462,6 +474,45 @@ getEmbeddedSurface( EmbeddedSurfaceSubRegion const & subRegion,
   return { cellTypes, cellsArray, points };
 }
 
+/**
+ * @brief The elements of a sub-region to write: either all of them, or a list of them.
+ */
+struct SubRegionSelection
+{
+  /// The number of selected elements
+  localIndex size;
+  /// The indices of the selected elements, unused when all the elements are selected
+  arrayView1d< localIndex const > indices;
+  /// Whether all the elements are selected
+  bool all;
+
+  /**
+   * @brief Get the index of a selected element in the sub-region.
+   * @param i the index of the element in the selection
+   * @return the index of the element in the sub-region
+   */
+  localIndex operator[]( localIndex const i ) const
+  { return all ? i : indices[i]; }
+};
+
+/**
+ * @brief Get the elements of a sub-region to write.
+ * @param[in] subRegion the sub-region (or the group holding data for the sub-region, with the same name and size)
+ * @param[in] selection the selected elements of each sub-region (all the elements if null)
+ * @return the selection for the sub-region
+ */
+static SubRegionSelection
+getSubRegionSelection( Group const & subRegion,
+                       ElementSelection const * const selection )
+{
+  if( selection == nullptr )
+  {
+    return { subRegion.size(), {}, true };
+  }
+  arrayView1d< localIndex const > const indices = selection->at( subRegion.getName() ).toViewConst();
+  return { indices.size(), indices, false };
+}
+
 struct CellData
 {
   std::vector< int > cellTypes;
@@ -473,6 +524,7 @@ struct CellData
  * @brief Gets the cell connectivities as a VTK object for the CellElementRegion @p region
  * @param[in] region the CellElementRegion to be written
  * @param[in] numNodes number of local nodes
+ * @param[in] selection the elements to write in each sub-region (all the elements if null)
  * @return a struct consisting of:
  *         - a list of types for each cell,
  *         - a VTK object containing the connectivity information
@@ -480,9 +532,14 @@ struct CellData
  */
 static CellData
 getVtkCells( CellElementRegion const & region,
-             localIndex const numNodes )
+             localIndex const numNodes,
+             ElementSelection const * const selection )
 {
-  localIndex const numElems = region.getNumberOfElements< CellElementSubRegion >();
+  localIndex numElems = 0;
+  region.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numElems += getSubRegionSelection( subRegion, selection ).size;
+  } );
   if( numElems == 0 )
   {
     return { {}, vtkSmartPointer< vtkCellArray >::New(), {} };
@@ -493,9 +550,10 @@ getVtkCells( CellElementRegion const & region,
   region.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
   {
     auto const nodeList = subRegion.nodeList().toViewConst();
-    forAll< parallelHostPolicy >( subRegion.size(), [&, nodeList]( localIndex const cellIdx )
+    SubRegionSelection const elems = getSubRegionSelection( subRegion, selection );
+    forAll< parallelHostPolicy >( elems.size, [&, nodeList, elems]( localIndex const c )
     {
-      auto const nodes = nodeList[cellIdx];
+      auto const nodes = nodeList[elems[c]];
       for( localIndex i = 0; i < nodes.size(); ++i )
       {
         // use atomic write to avoid technical UB
@@ -523,7 +581,8 @@ getVtkCells( CellElementRegion const & region,
     localIndex numConn = 0;
     region.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
     {
-      numConn += subRegion.size() * getVtkConnectivity( subRegion.getElementType(), subRegion.nodeList().size( 1 ) ).size();
+      numConn += getSubRegionSelection( subRegion, selection ).size *
+                 getVtkConnectivity( subRegion.getElementType(), subRegion.nodeList().size( 1 ) ).size();
     } );
     return numConn;
   }();
@@ -544,7 +603,8 @@ getVtkCells( CellElementRegion const & region,
   {
     auto const nodeList = subRegion.nodeList().toViewConst();
     auto subRegionNumNodes = nodeList.size( 1 );
-    cellTypes.insert( cellTypes.end(), subRegion.size(), toVTKCellType( subRegion.getElementType(), subRegionNumNodes ) );
+    SubRegionSelection const elems = getSubRegionSelection( subRegion, selection );
+    cellTypes.insert( cellTypes.end(), elems.size, toVTKCellType( subRegion.getElementType(), subRegionNumNodes ) );
     std::vector< int > const vtkOrdering = getVtkConnectivity( subRegion.getElementType(), subRegionNumNodes );
     localIndex const numVtkData = vtkOrdering.size();
 
@@ -555,10 +615,10 @@ getVtkCells( CellElementRegion const & region,
     // Here we privilege code simplicity. This can be more efficient (less tests) if the code is
     // specialized for each type of subregion.
     // This is not a time sensitive part of the code. Can be optimized later if needed.
-    forAll< parallelHostPolicy >( subRegion.size(), [&]( localIndex const c )
+    forAll< parallelHostPolicy >( elems.size, [&]( localIndex const c )
     {
       localIndex const elemConnOffset = connOffset + c * numVtkData;
-      auto const nodes = nodeList[c];
+      auto const nodes = nodeList[elems[c]];
       for( localIndex i = 0; i < numVtkData; ++i )
       {
         if( vtkOrdering[i] < 0 )
@@ -573,8 +633,8 @@ getVtkCells( CellElementRegion const & region,
       offsets->SetTypedComponent( elemOffset + c, 0, elemConnOffset );
     } );
 
-    elemOffset += subRegion.size();
-    connOffset += subRegion.size() * numVtkData;
+    elemOffset += elems.size;
+    connOffset += elems.size * numVtkData;
   } );
   offsets->SetTypedComponent( elemOffset, 0, connOffset );
 
@@ -638,6 +698,44 @@ writeTimestamp( vtkUnstructuredGrid * ug,
   ug->GetFieldData()->AddArray( t );
 }
 
+/**
+ * @brief Create the VTK data container for a field.
+ * @tparam T the value type of the field
+ * @param[in] singlePrecision whether double precision values are converted to single precision
+ * @return the new container (to be owned by a smart pointer)
+ */
+template< typename T >
+static vtkDataArray *
+newDataArray( bool const singlePrecision )
+{
+  if( std::is_same< T, real64 >::value && singlePrecision )
+  {
+    return vtkAOSDataArrayTemplate< float >::New();
+  }
+  return vtkAOSDataArrayTemplate< T >::New();
+}
+
+/**
+ * @brief Call a function with the typed VTK data container created by newDataArray for a field.
+ * @tparam T the value type of the field
+ * @param[in,out] data a VTK data container, must be a vtkAOSDataArrayTemplate of @p T (or of float)
+ * @param[in] lambda the function called with a typed pointer to @p data
+ */
+template< typename T, typename LAMBDA >
+static void
+forTypedDataArray( vtkDataArray * const data,
+                   LAMBDA && lambda )
+{
+  if( vtkAOSDataArrayTemplate< T > * const typedData = vtkAOSDataArrayTemplate< T >::FastDownCast( data ) )
+  {
+    lambda( typedData );
+  }
+  else
+  {
+    lambda( vtkAOSDataArrayTemplate< float >::FastDownCast( data ) );
+  }
+}
+
 /**
  * @brief Writes a field from @p wrapper.
  * @param[in] wrapper a wrapper around the field to be written
@@ -653,14 +751,17 @@ writeField( WrapperBase const & wrapper,
   {
     using ArrayType = camp::first< decltype( tupleOfTypes ) >;
     using T = typename ArrayType::ValueType;
-    vtkAOSDataArrayTemplate< T > * typedData = vtkAOSDataArrayTemplate< T >::FastDownCast( data );
     auto const sourceArray = Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
 
-    forAll< parallelHostPolicy >( sourceArray.size( 0 ), [sourceArray, offset, typedData]( localIndex const i )
+    forTypedDataArray< T >( data, [&]( auto * const typedData )
     {
-      LvArray::forValuesInSlice( sourceArray[i], [&, compIndex = 0]( T const & value ) mutable
+      using VTK_T = typename std::remove_pointer_t< decltype( typedData ) >::ValueType;
+      forAll< parallelHostPolicy >( sourceArray.size( 0 ), [sourceArray, offset, typedData]( localIndex const i )
       {
-        typedData->SetTypedComponent( offset + i, compIndex++, value );
+        LvArray::forValuesInSlice( sourceArray[i], [&, compIndex = 0]( T const & value ) mutable
+        {
+          typedData->SetTypedComponent( offset + i, compIndex++, static_cast< VTK_T >( value ) );
+        } );
       } );
     } );
   }, wrapper );
@@ -683,14 +784,17 @@ writeField( WrapperBase const & wrapper,
   {
     using ArrayType = camp::first< decltype( tupleOfTypes ) >;
     using T = typename ArrayType::ValueType;
-    vtkAOSDataArrayTemplate< T > * typedData = vtkAOSDataArrayTemplate< T >::FastDownCast( data );
     auto const sourceArray = Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
 
-    forAll< parallelHostPolicy >( indices.size(), [=]( localIndex const i )
+    forTypedDataArray< T >( data, [&]( auto * const typedData )
     {
-      LvArray::forValuesInSlice( sourceArray[indices[i]], [&, compIndex = 0]( T const & value ) mutable
+      using VTK_T = typename std::remove_pointer_t< decltype( typedData ) >::ValueType;
+      forAll< parallelHostPolicy >( indices.size(), [=]( localIndex const i )
       {
-        typedData->SetTypedComponent( offset + i, compIndex++, value );
+        LvArray::forValuesInSlice( sourceArray[indices[i]], [&, compIndex = 0]( T const & value ) mutable
+        {
+          typedData->SetTypedComponent( offset + i, compIndex++, static_cast< VTK_T >( value ) );
+        } );
       } );
     } );
   }, wrapper );
@@ -768,7 +872,7 @@ makeComponentName( std::vector< string >(&dimLabels)[sizeof...( Ts )],
 template< typename T, typename PERM >
 static void
 setComponentMetadata( Wrapper< Array< T, 1, PERM > > const &,
-                      vtkAOSDataArrayTemplate< T > * data )
+                      vtkDataArray * data )
 {
   data->SetNumberOfComponents( 1 );
 }
@@ -785,7 +889,7 @@ setComponentMetadata( Wrapper< Array< T, 1, PERM > > const &,
 template< typename T, typename PERM >
 static void
 setComponentMetadata( Wrapper< Array< T, 2, PERM > > const & wrapper,
-                      vtkAOSDataArrayTemplate< T > * data )
+                      vtkDataArray * data )
 {
   auto const view = wrapper.referenceAsView();
   data->SetNumberOfComponents( view.size( 1 ) );
@@ -828,7 +932,7 @@ makeTemporarySlice( ArrayView< T const, NDIM, USD > const & view )
 template< typename T, int NDIM, typename PERM >
 static void
 setComponentMetadata( Wrapper< Array< T, NDIM, PERM > > const & wrapper,
-                      vtkAOSDataArrayTemplate< T > * data )
+                      vtkDataArray * data )
 {
   data->SetNumberOfComponents( wrapper.numArrayComp() );
 
@@ -854,7 +958,9 @@ template< class SUBREGION = Group >
 static void
 writeElementField( Group const & subRegions,
                    string const & field,
-                   vtkCellData * cellData )
+                   vtkCellData * cellData,
+                   bool const singlePrecision,
+                   ElementSelection const * const selection = nullptr )
 {
   // instantiate vtk array of the correct type
   vtkSmartPointer< vtkDataArray > data;
@@ -863,7 +969,7 @@ writeElementField( Group const & subRegions,
   int numDims = 0;
   subRegions.forSubGroups< SUBREGION >( [&]( SUBREGION const & subRegion )
   {
-    numElements += subRegion.size();
+    numElements += getSubRegionSelection( subRegion, selection ).size;
     WrapperBase const & wrapper = subRegion.getWrapperBase( field );
     if( first )
     {
@@ -871,9 +977,8 @@ writeElementField( Group const & subRegions,
       {
         using ArrayType = camp::first< decltype( tupleOfTypes ) >;
         using T = typename ArrayType::ValueType;
-        auto typedData = vtkAOSDataArrayTemplate< T >::New();
-        data.TakeReference( typedData );
-        setComponentMetadata( Wrapper< ArrayType >::cast( wrapper ), typedData );
+        data.TakeReference( newDataArray< T >( singlePrecision ) );
+        setComponentMetadata( Wrapper< ArrayType >::cast( wrapper ), data.GetPointer() );
       }, wrapper );
       first = false;
       numDims = wrapper.numArrayDims();
@@ -896,8 +1001,16 @@ writeElementField( Group const & subRegions,
   subRegions.forSubGroups< SUBREGION >( [&]( SUBREGION const & subRegion )
   {
     WrapperBase const & wrapper = subRegion.getWrapperBase( field );
-    writeField( wrapper, offset, data.GetPointer() );
-    offset += subRegion.size();
+    SubRegionSelection const elems = getSubRegionSelection( subRegion, selection );
+    if( elems.all )
+    {
+      writeField( wrapper, offset, data.GetPointer() );
+    }
+    else
+    {
+      writeField( wrapper, elems.indices, offset, data.GetPointer() );
+    }
+    offset += elems.size;
   } );
   cellData->AddArray( data );
 }
@@ -932,7 +1045,7 @@ void VTKPolyDataWriterInterface::writeParticleFields( ParticleRegionBase const &
   // Write averaged material data
   for( string const & field : materialFields )
   {
-    writeElementField( materialData, field, cellData );
+    writeElementField( materialData, field, cellData, m_writeSinglePrecision );
   }
 
   // Collect a list of regular fields (filter out material field wrappers)
@@ -952,7 +1065,7 @@ void VTKPolyDataWriterInterface::writeParticleFields( ParticleRegionBase const &
   // Write regular fields
   for( string const & field : regularFields )
   {
-    writeElementField( region.getGroup( ParticleRegionBase::viewKeyStruct::particleSubRegions() ), field, cellData );
+    writeElementField( region.getGroup( ParticleRegionBase::viewKeyStruct::particleSubRegions() ), field, cellData, m_writeSinglePrecision );
   }
 }
 
@@ -970,9 +1083,8 @@ void VTKPolyDataWriterInterface::writeNodeFields( NodeManager const & nodeManage
       {
         using ArrayType = camp::first< decltype( tupleOfTypes ) >;
         using T = typename ArrayType::ValueType;
-        auto typedData = vtkAOSDataArrayTemplate< T >::New();
-        data.TakeReference( typedData );
-        setComponentMetadata( Wrapper< ArrayType >::cast( wrapper ), typedData );
+        data.TakeReference( newDataArray< T >( m_writeSinglePrecision ) );
+        setComponentMetadata( Wrapper< ArrayType >::cast( wrapper ), data.GetPointer() );
       }, wrapper );
 
       data->SetNumberOfTuples( nodeIndices.size() );
@@ -985,7 +1097,8 @@ void VTKPolyDataWriterInterface::writeNodeFields( NodeManager const & nodeManage
 }
 
 void VTKPolyDataWriterInterface::writeElementFields( ElementRegionBase const & region,
-                                                     vtkCellData * cellData ) const
+                                                     vtkCellData * cellData,
+                                                     ElementSelection const * const selection ) const
 {
   std::unordered_set< string > materialFields;
   conduit::Node fakeRoot;
@@ -1014,7 +1127,7 @@ void VTKPolyDataWriterInterface::writeElementFields( ElementRegionBase const & r
   // Write averaged material data
   for( string const & field : materialFields )
   {
-    writeElementField( materialData, field, cellData );
+    writeElementField( materialData, field, cellData, m_writeSinglePrecision, selection );
   }
 
   // Collect a list of regular fields (filter out material field wrappers)
@@ -1034,26 +1147,93 @@ void VTKPolyDataWriterInterface::writeElementFields( ElementRegionBase const & r
   // Write regular fields
   for( string const & field : regularFields )
   {
-    writeElementField( region.getGroup( ElementRegionBase::viewKeyStruct::elementSubRegions() ), field, cellData );
+    writeElementField( region.getGroup( ElementRegionBase::viewKeyStruct::elementSubRegions() ), field, cellData, m_writeSinglePrecision, selection );
   }
 }
 
+ElementSelection
+VTKPolyDataWriterInterface::selectElements( CellElementRegion const & region,
+                                            InternalMeshGenerator const * const internalMesh ) const
+{
+  std::vector< SimpleGeometricObjectBase const * > objects;
+  GeometricObjectManager::getInstance().forGeometricObject< SimpleGeometricObjectBase >( m_regionOfInterest,
+                                                                                      [&]( localIndex const,
+                                                                                           SimpleGeometricObjectBase const & object )
+  {
+    objects.push_back( &object );
+  } );
+
+  std::array< globalIndex, 3 > const numBoxes = internalMesh != nullptr ? internalMesh->getNumBoxesInDirections()
+                                                                        : std::array< globalIndex, 3 >{ 0, 0, 0 };
+  integer const stride = m_decimationStride;
+
+  ElementSelection selection;
+  region.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+    arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+    integer const numElemsPerBox = ( internalMesh != nullptr && stride > 1 ) ? internalMesh->getNumElementsPerBox( subRegion.getName() ) : 0;
+
+    // 1. Mark (in parallel) the selected elements
+    array1d< integer > isSelected( subRegion.size() );
+    arrayView1d< integer > const isSelectedView = isSelected.toView();
+    forAll< parallelHostPolicy >( subRegion.size(), [&, elemCenter, localToGlobal, isSelectedView]( localIndex const ei )
+    {
+      bool selected = true;
+      if( !objects.empty() )
+      {
+        real64 const center[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( elemCenter[ei] );
+        selected = std::any_of( objects.begin(), objects.end(),
+                                [&]( SimpleGeometricObjectBase const * const object ) { return object->isCoordInObject( center ); } );
+      }
+      if( selected && numElemsPerBox > 0 )
+      {
+        // keep the elements of one box out of stride in each direction of the structured mesh
+        globalIndex const box = localToGlobal[ei] / numElemsPerBox;
+        globalIndex const ijk[3] = { box % numBoxes[0],
+                                     ( box / numBoxes[0] ) % numBoxes[1],
+                                     box / ( numBoxes[0] * numBoxes[1] ) };
+        selected = ijk[0] % stride == 0 && ijk[1] % stride == 0 && ijk[2] % stride == 0;
+      }
+      isSelectedView[ei] = selected ? 1 : 0;
+    } );
+
+    // 2. Gather the selected elements (serial step)
+    array1d< localIndex > & indices = selection[subRegion.getName()];
+    indices.reserve( subRegion.size() );
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( isSelected[ei] )
+      {
+        indices.emplace_back( ei );
+      }
+    }
+  } );
+  return selection;
+}
+
 void VTKPolyDataWriterInterface::writeCellElementRegions( real64 const time,
                                                           ElementRegionManager const & elemManager,
                                                           NodeManager const & nodeManager,
+                                                          InternalMeshGenerator const * const internalMesh,
                                                           string const & path ) const
 {
+  bool const isFiltered = !m_regionOfInterest.empty() || ( internalMesh != nullptr && m_decimationStride > 1 );
+
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & region )
   {
-    CellData VTKCells = getVtkCells( region, nodeManager.size() );
-    vtkSmartPointer< vtkPoints > const VTKPoints = getVtkPoints( nodeManager, VTKCells.nodes );
+    ElementSelection const selection = isFiltered ? selectElements( region, internalMesh ) : ElementSelection();
+    ElementSelection const * const selectionPtr = isFiltered ? &selection : nullptr;
+
+    CellData VTKCells = getVtkCells( region, nodeManager.size(), selectionPtr );
+    vtkSmartPointer< vtkPoints > const VTKPoints = getVtkPoints( nodeManager, VTKCells.nodes, m_writeSinglePrecision );
 
     auto const ug = vtkSmartPointer< vtkUnstructuredGrid >::New();
     ug->SetCells( VTKCells.cellTypes.data(), VTKCells.cells );
     ug->SetPoints( VTKPoints );
 
     writeTimestamp( ug.GetPointer(), time );
-    writeElementFields( region, ug->GetCellData() );
+    writeElementFields( region, ug->GetCellData(), selectionPtr );
     writeNodeFields( nodeManager, VTKCells.nodes, ug->GetPointData() );
 
     string const regionDir = joinPath( path, region.getName() );
@@ -1346,7 +1526,10 @@ void VTKPolyDataWriterInterface::write( real64 const time,
 
       if( m_outputRegionType == VTKRegionTypes::CELL || m_outputRegionType == VTKRegionTypes::ALL )
       {
-        writeCellElementRegions( time, elemManager, nodeManager, meshDir );
+        // the decimation relies on the structure of the meshes generated by InternalMesh
+        InternalMeshGenerator const * const internalMesh =
+          m_decimationStride > 1 ? domain.getGroupByPath( "/Problem/Mesh" ).getGroupPointer< InternalMeshGenerator >( meshBodyName ) : nullptr;
+        writeCellElementRegions( time, elemManager, nodeManager, internalMesh, meshDir );
       }
       if( m_outputRegionType == VTKRegionTypes::WELL || m_outputRegionType == VTKRegionTypes::ALL )
       {
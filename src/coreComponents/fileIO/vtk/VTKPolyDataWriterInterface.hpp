@@ -38,6 +38,8 @@ class ElementRegionManager;
 class NodeManager;
 class ParticleManager;
 class FaceManager;
+class CellElementRegion;
+class InternalMeshGenerator;
 
 namespace vtk
 {
@@ -70,6 +72,9 @@ ENUM_STRINGS( VTKRegionTypes,
               "particle",
               "all" );
 
+/// The indices of the elements to write, for each sub-region (identified by its name)
+using ElementSelection = std::map< string, array1d< localIndex > >;
+
 /**
  * @brief Encapsulate output methods for vtk
  */
@@ -168,6 +173,34 @@ public:
     m_levelNames.insert( levelNames.begin(), levelNames.end() );
   }
 
+  /**
+   * @brief Set the geometric objects delimiting the region of interest
+   * @param[in] geometricObjectNames the names of the geometric objects (an empty array means the whole mesh is written)
+   * @details Only the cells whose center is inside one of the objects are written.
+   */
+  void setRegionOfInterest( arrayView1d< string const > const & geometricObjectNames )
+  {
+    m_regionOfInterest.assign( geometricObjectNames.begin(), geometricObjectNames.end() );
+  }
+
+  /**
+   * @brief Set the decimation stride of the meshes generated by InternalMesh
+   * @param[in] stride one cell out of @p stride is written in each direction (1 means all the cells are written)
+   */
+  void setDecimationStride( integer const stride )
+  {
+    m_decimationStride = stride;
+  }
+
+  /**
+   * @brief Defines whether the double precision fields are written in single precision
+   * @param[in] writeSinglePrecision The boolean flag.
+   */
+  void setWriteSinglePrecision( bool const writeSinglePrecision )
+  {
+    m_writeSinglePrecision = writeSinglePrecision;
+  }
+
   /**
    * @brief Main method of this class. Write all the files for one time step.
    * @details This method writes a .pvd file (if a previous one was created from a precedent time step,
@@ -228,12 +261,23 @@ private:
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    * @param[in] meshLevelName the name of the MeshLevel containing the nodes and elements to be output
    * @param[in] meshBodyName the name of the MeshBody containing the nodes and elements to be output
+   * @param[in] internalMesh the generator of the mesh if it is structured, used for decimation (may be null)
    */
   void writeCellElementRegions( real64 time,
                                 ElementRegionManager const & elemManager,
                                 NodeManager const & nodeManager,
+                                InternalMeshGenerator const * internalMesh,
                                 string const & path ) const;
 
+  /**
+   * @brief Select the elements of a CellElementRegion to write, according to the region of interest and the decimation
+   * @param[in] region the CellElementRegion being written
+   * @param[in] internalMesh the generator of the mesh if it is structured, used for decimation (may be null)
+   * @return the indices of the selected elements of each sub-region
+   */
+  ElementSelection selectElements( CellElementRegion const & region,
+                                   InternalMeshGenerator const * internalMesh ) const;
+
   void writeParticleRegions( real64 const time,
                              ParticleManager const & particleManager,
                              string const & path ) const;
@@ -293,9 +337,11 @@ private:
    * @brief Writes all the fields associated to the elements of \p er if their plotlevel is <= m_plotLevel
    * @param[in] subRegion ElementRegion being written
    * @param[in] cellData a VTK object containing all the fields associated with the elements
+   * @param[in] selection the elements to write in each sub-region (all the elements if null)
    */
   void writeElementFields( ElementRegionBase const & subRegion,
-                           vtkCellData * cellData ) const;
+                           vtkCellData * cellData,
+                           ElementSelection const * selection = nullptr ) const;
 
   void writeParticleFields( ParticleRegionBase const & region,
                             vtkCellData * cellData ) const;
@@ -352,6 +398,15 @@ private:
 
   /// Defines whether to plot a faceElement as a 3D volumetric element or not.
   bool m_writeFaceElementsAs3D;
+
+  /// Names of the geometric objects delimiting the cells to output (an empty array means all cells are saved)
+  std::vector< string > m_regionOfInterest;
+
+  /// One cell out of m_decimationStride is written in each direction of the InternalMesh meshes
+  integer m_decimationStride;
+
+  /// Defines whether the double precision fields and coordinates are written in single precision
+  bool m_writeSinglePrecision;
 };
 
 } // namespace vtk
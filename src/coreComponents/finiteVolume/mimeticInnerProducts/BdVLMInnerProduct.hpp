@@ -23,6 +23,7 @@
 #include "finiteVolume/mimeticInnerProducts/MimeticInnerProductBase.hpp"
 #include "finiteVolume/mimeticInnerProducts/MimeticInnerProductHelpers.hpp"
 #include "mesh/utilities/ComputationalGeometry.hpp"
+#include "denseLinearAlgebra/denseLAFactorizations.hpp"
 
 namespace geos
 {
@@ -66,36 +67,115 @@ public:
            real64 const & lengthTolerance,
            arraySlice2d< real64 > const & transMatrix );
 
+  /**
+   * @brief Recompute the transmissibility matrices of a batch of elements, with the 3x3 systems of all the
+   *        elements of the batch factorized and solved together
+   * @tparam NF the number of faces of the elements
+   * @tparam BATCH_SIZE the maximum number of elements in the batch
+   * @param[in] nodePosition the position of the nodes
+   * @param[in] transMultiplier the transmissibility multipliers at the mesh faces
+   * @param[in] faceToNodes the map from the face to their nodes
+   * @param[in] elemToFaces the maps from the one-sided face to the corresponding face
+   * @param[in] elemCenter the center of the elements
+   * @param[in] elemPerm the permeability in the elements
+   * @param[in] lengthTolerance the tolerance used in the trans calculations
+   * @param[in] elems the elements of the batch
+   * @param[in] numElems the number of elements in the batch
+   * @param[out] transMatrix the transmissibility matrices of the elements of the batch
+   *
+   * @details The result is the one of compute for each element. The systems are interleaved as in
+   *          denseLinearAlgebra::batched, so that the factorizations and the solves are vectorized across the elements.
+   */
+  template< localIndex NF, integer BATCH_SIZE >
+  GEOS_HOST_DEVICE
+  static void
+  computeBatch( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                arrayView1d< real64 const > const & transMultiplier,
+                ArrayOfArraysView< localIndex const > const & faceToNodes,
+                arrayView2d< localIndex const > const & elemToFaces,
+                arrayView2d< real64 const > const & elemCenter,
+                arrayView3d< real64 const > const & elemPerm,
+                real64 const & lengthTolerance,
+                localIndex const (&elems)[ BATCH_SIZE ],
+                integer const numElems,
+                real64 (& transMatrix)[ BATCH_SIZE ][ NF ][ NF ] );
+
+private:
+
+  /**
+   * @brief Compute the geometric quantities of an element used in the inner product
+   * @param[in] nodePosition the position of the nodes
+   * @param[in] transMultiplier the transmissibility multipliers at the mesh faces
+   * @param[in] faceToNodes the map from the face to their nodes
+   * @param[in] elemToFaces the maps from the one-sided face to the corresponding face
+   * @param[in] elemCenter the center of the element
+   * @param[in] elemPerm the permeability in the element
+   * @param[in] lengthTolerance the tolerance used in the trans calculations
+   * @param[out] cellToFaceMat the vectors from the cell center to the face centers, times the face areas (R)
+   * @param[out] permNormalsMat the face normals times the permeability (N)
+   * @param[out] faceArea the areas of the faces
+   * @param[out] tpTransInv the inverses of the two-point transmissibilities, used for the multipliers
+   */
+  template< localIndex NF >
+  GEOS_HOST_DEVICE
+  static void
+  computeGeometry( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                   arrayView1d< real64 const > const & transMultiplier,
+                   ArrayOfArraysView< localIndex const > const & faceToNodes,
+                   arraySlice1d< localIndex const > const & elemToFaces,
+                   arraySlice1d< real64 const > const & elemCenter,
+                   real64 const (&elemPerm)[ 3 ],
+                   real64 const & lengthTolerance,
+                   real64 (& cellToFaceMat)[ NF ][ 3 ],
+                   real64 (& permNormalsMat)[ NF ][ 3 ],
+                   real64 (& faceArea)[ NF ],
+                   real64 (& tpTransInv)[ NF ] );
+
+  /**
+   * @brief Assemble the transmissibility matrix of an element from the solutions of its 3x3 systems
+   * @tparam NF the number of faces of the element
+   * @tparam MATRIX_TYPE the type of the transmissibility matrix
+   * @param[in] cellToFaceMat R, as computed by computeGeometry
+   * @param[in] permNormalsMat N, as computed by computeGeometry
+   * @param[in] faceArea the areas of the faces
+   * @param[in] tpTransInv the inverses of the two-point transmissibilities
+   * @param[in] consistencySol ( N^T R )^-1 N^T
+   * @param[in] stabilizationSol ( R^T R )^-1 R^T
+   * @param[out] transMatrix the transmissibility matrix
+   */
+  template< localIndex NF, typename MATRIX_TYPE >
+  GEOS_HOST_DEVICE
+  static void
+  assemble( real64 const (&cellToFaceMat)[ NF ][ 3 ],
+            real64 const (&permNormalsMat)[ NF ][ 3 ],
+            real64 const (&faceArea)[ NF ],
+            real64 const (&tpTransInv)[ NF ],
+            real64 const (&consistencySol)[ 3 ][ NF ],
+            real64 const (&stabilizationSol)[ 3 ][ NF ],
+            MATRIX_TYPE && transMatrix );
+
 };
 
 template< localIndex NF >
 GEOS_HOST_DEVICE
 void
-BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
-                            arrayView1d< real64 const > const & transMultiplier,
-                            ArrayOfArraysView< localIndex const > const & faceToNodes,
-                            arraySlice1d< localIndex const > const & elemToFaces,
-                            arraySlice1d< real64 const > const & elemCenter,
-                            real64 const & elemVolume,
-                            real64 const (&elemPerm)[ 3 ],
-                            real64 const & lengthTolerance,
-                            arraySlice2d< real64 > const & transMatrix )
+BdVLMInnerProduct::computeGeometry( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                                    arrayView1d< real64 const > const & transMultiplier,
+                                    ArrayOfArraysView< localIndex const > const & faceToNodes,
+                                    arraySlice1d< localIndex const > const & elemToFaces,
+                                    arraySlice1d< real64 const > const & elemCenter,
+                                    real64 const (&elemPerm)[ 3 ],
+                                    real64 const & lengthTolerance,
+                                    real64 (& cellToFaceMat)[ NF ][ 3 ],
+                                    real64 (& permNormalsMat)[ NF ][ 3 ],
+                                    real64 (& faceArea)[ NF ],
+                                    real64 (& tpTransInv)[ NF ] )
 {
-  GEOS_UNUSED_VAR( elemVolume );
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
   real64 const weightToleranceInv = 1e30 / lengthTolerance;
 
-  real64 cellToFaceMat[ NF ][ 3 ] = {{ 0 }};
   real64 normalsMat[ NF ][ 3 ] = {{ 0 }};
   real64 permMat[ 3 ][ 3 ] = {{ 0 }};
-  real64 faceAreaMat[ NF ][ NF ] = {{ 0 }};
-
-  real64 work_dimByDim[ 3 ][ 3 ] = {{ 0 }};
-  real64 work_numFacesByDim[ NF ][ 3 ] = {{ 0 }};
-  real64 work_dimByNumFaces[ 3 ][ NF ] = {{ 0 }};
-  real64 work_numFacesByNumFaces[ NF ][ NF ] = {{ 0 }};
-
-  real64 tpTransInv[ NF ] = { 0.0 };
 
   // 0) assemble full coefficient tensor from principal axis/components
   MimeticInnerProductHelpers::makeFullTensor( elemPerm, permMat );
@@ -105,7 +185,7 @@ BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION
   {
     real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[ 3 ];
     // compute the face geometry data: center, normal, vector from cell center to face center
-    faceAreaMat[ ifaceLoc ][ ifaceLoc ] =
+    faceArea[ ifaceLoc ] =
       computationalGeometry::centroid_3DPolygon( faceToNodes[elemToFaces[ifaceLoc]],
                                                  nodePosition,
                                                  faceCenter,
@@ -115,9 +195,9 @@ BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION
     LvArray::tensorOps::copy< 3 >( cellToFaceVec, faceCenter );
     LvArray::tensorOps::subtract< 3 >( cellToFaceVec, elemCenter );
 
-    cellToFaceMat[ ifaceLoc ][0] = faceAreaMat[ ifaceLoc ][ ifaceLoc ] * cellToFaceVec[ 0 ];
-    cellToFaceMat[ ifaceLoc ][1] = faceAreaMat[ ifaceLoc ][ ifaceLoc ] * cellToFaceVec[ 1 ];
-    cellToFaceMat[ ifaceLoc ][2] = faceAreaMat[ ifaceLoc ][ ifaceLoc ] * cellToFaceVec[ 2 ];
+    cellToFaceMat[ ifaceLoc ][0] = faceArea[ ifaceLoc ] * cellToFaceVec[ 0 ];
+    cellToFaceMat[ ifaceLoc ][1] = faceArea[ ifaceLoc ] * cellToFaceVec[ 1 ];
+    cellToFaceMat[ ifaceLoc ][2] = faceArea[ ifaceLoc ] * cellToFaceVec[ 2 ];
 
     if( LvArray::tensorOps::AiBi< 3 >( cellToFaceVec, faceNormal ) < 0.0 )
     {
@@ -130,7 +210,7 @@ BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION
     real64 diagEntry = 0.0;
     MimeticInnerProductHelpers::computeInvTPFATransWithMultiplier< NF >( elemPerm,
                                                                          faceNormal,
-                                                                         faceAreaMat[ifaceLoc][ifaceLoc],
+                                                                         faceArea[ifaceLoc],
                                                                          transMultiplier[elemToFaces[ifaceLoc]],
                                                                          weightToleranceInv,
                                                                          cellToFaceVec,
@@ -144,23 +224,33 @@ BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION
   }
 
   // 2) compute N of Beirao da Veiga, Lipnikov, Manzini
-  LvArray::tensorOps::Rij_eq_AikBkj< NF, 3, 3 >( work_numFacesByDim,
+  LvArray::tensorOps::Rij_eq_AikBkj< NF, 3, 3 >( permNormalsMat,
                                                  normalsMat,
                                                  permMat );
+}
 
-  // 3) compute ( N^T R )^-1 of Beirao da Veiga, Lipnikov, Manzini
-  LvArray::tensorOps::Rij_eq_AkiBkj< 3, 3, NF >( work_dimByDim,
-                                                 work_numFacesByDim,
-                                                 cellToFaceMat );
-  LvArray::tensorOps::invert< 3 >( work_dimByDim );
+template< localIndex NF, typename MATRIX_TYPE >
+GEOS_HOST_DEVICE
+void
+BdVLMInnerProduct::assemble( real64 const (&cellToFaceMat)[ NF ][ 3 ],
+                             real64 const (&permNormalsMat)[ NF ][ 3 ],
+                             real64 const (&faceArea)[ NF ],
+                             real64 const (&tpTransInv)[ NF ],
+                             real64 const (&consistencySol)[ 3 ][ NF ],
+                             real64 const (&stabilizationSol)[ 3 ][ NF ],
+                             MATRIX_TYPE && transMatrix )
+{
+  real64 faceAreaMat[ NF ][ NF ] = {{ 0 }};
+  real64 work_numFacesByNumFaces[ NF ][ NF ] = {{ 0 }};
+  for( localIndex ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+  {
+    faceAreaMat[ ifaceLoc ][ ifaceLoc ] = faceArea[ ifaceLoc ];
+  }
 
   // 4) compute N ( N^T R )^-1 N^T
-  LvArray::tensorOps::Rij_eq_AikBjk< 3, NF, 3 >( work_dimByNumFaces,
-                                                 work_dimByDim,
-                                                 work_numFacesByDim );
   LvArray::tensorOps::Rij_eq_AikBkj< NF, NF, 3 >( transMatrix,
-                                                  work_numFacesByDim,
-                                                  work_dimByNumFaces );
+                                                  permNormalsMat,
+                                                  consistencySol );
 
   // 5) compute the stabilization coefficient \tilde{ \lambda }
   real64 const stabCoef = 2.0 / NF * LvArray::tensorOps::trace< NF >( transMatrix );
@@ -168,19 +258,11 @@ BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION
   // at this point we have N ( N^T R )^-1 N^T and \tilde{ \lambda }
   // we have to compute I - R ( R^T R )^-1 R^T and sum
 
-  // 6) compute ( R^T R )^-1
-  LvArray::tensorOps::Rij_eq_AkiAkj< 3, NF >( work_dimByDim,
-                                              cellToFaceMat );
-  LvArray::tensorOps::invert< 3 >( work_dimByDim );
-
   // 7) compute I - R ( R^T R )^-1 R^T
   LvArray::tensorOps::addIdentity< NF >( work_numFacesByNumFaces, -1 );
-  LvArray::tensorOps::Rij_eq_AikBjk< 3, NF, 3 >( work_dimByNumFaces,
-                                                 work_dimByDim,
-                                                 cellToFaceMat );
   LvArray::tensorOps::Rij_add_AikBkj< NF, NF, 3 >( work_numFacesByNumFaces,
                                                    cellToFaceMat,
-                                                   work_dimByNumFaces );
+                                                   stabilizationSol );
 
   // 8) compute N ( N^T R )^-1 N^T + \tilde{ \lambda } * (I - R ( R^T R )^-1 R^T)
   LvArray::tensorOps::scaledAdd< NF, NF >( transMatrix, work_numFacesByNumFaces, -stabCoef );
@@ -204,7 +286,145 @@ BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION
     MimeticInnerProductHelpers::computeTransMatrixWithMultipliers< NF >( tpTransInv,
                                                                          transMatrix );
   }
+}
 
+template< localIndex NF >
+GEOS_HOST_DEVICE
+void
+BdVLMInnerProduct::compute( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                            arrayView1d< real64 const > const & transMultiplier,
+                            ArrayOfArraysView< localIndex const > const & faceToNodes,
+                            arraySlice1d< localIndex const > const & elemToFaces,
+                            arraySlice1d< real64 const > const & elemCenter,
+                            real64 const & elemVolume,
+                            real64 const (&elemPerm)[ 3 ],
+                            real64 const & lengthTolerance,
+                            arraySlice2d< real64 > const & transMatrix )
+{
+  GEOS_UNUSED_VAR( elemVolume );
+
+  real64 cellToFaceMat[ NF ][ 3 ] = {{ 0 }};
+  real64 permNormalsMat[ NF ][ 3 ] = {{ 0 }};
+  real64 faceArea[ NF ] = { 0.0 };
+  real64 tpTransInv[ NF ] = { 0.0 };
+
+  real64 work_dimByDim[ 3 ][ 3 ] = {{ 0 }};
+  real64 consistencySol[ 3 ][ NF ] = {{ 0 }};
+  real64 stabilizationSol[ 3 ][ NF ] = {{ 0 }};
+
+  // 0-2) compute the geometric quantities, R and N of Beirao da Veiga, Lipnikov, Manzini
+  computeGeometry< NF >( nodePosition, transMultiplier, faceToNodes, elemToFaces, elemCenter, elemPerm, lengthTolerance,
+                         cellToFaceMat, permNormalsMat, faceArea, tpTransInv );
+
+  // 3) factorize N^T R, and solve for the columns of N^T
+  LvArray::tensorOps::Rij_eq_AkiBkj< 3, 3, NF >( work_dimByDim,
+                                                 permNormalsMat,
+                                                 cellToFaceMat );
+  integer pivots[ 3 ];
+  bool const factorized = denseLinearAlgebra::luFactorize< 3 >( work_dimByDim, pivots );
+  GEOS_ERROR_IF( !factorized, "Singular matrix N^T R in the BdVLM inner product" );
+  LvArray::tensorOps::transpose< 3, NF >( consistencySol,
+                                          permNormalsMat );
+  denseLinearAlgebra::luSolveMultiple< 3, NF >( work_dimByDim, pivots, consistencySol );
+
+  // 6) factorize the symmetric positive definite matrix R^T R, and solve for the columns of R^T
+  LvArray::tensorOps::Rij_eq_AkiAkj< 3, NF >( work_dimByDim,
+                                              cellToFaceMat );
+  bool const positiveDefinite = denseLinearAlgebra::choleskyFactorize< 3 >( work_dimByDim );
+  GEOS_ERROR_IF( !positiveDefinite, "Singular matrix R^T R in the BdVLM inner product" );
+  LvArray::tensorOps::transpose< 3, NF >( stabilizationSol,
+                                          cellToFaceMat );
+  denseLinearAlgebra::choleskySolveMultiple< 3, NF >( work_dimByDim, stabilizationSol );
+
+  // 4-10) assemble the transmissibility matrix
+  assemble< NF >( cellToFaceMat, permNormalsMat, faceArea, tpTransInv, consistencySol, stabilizationSol, transMatrix );
+}
+
+template< localIndex NF, integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+void
+BdVLMInnerProduct::computeBatch( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                                 arrayView1d< real64 const > const & transMultiplier,
+                                 ArrayOfArraysView< localIndex const > const & faceToNodes,
+                                 arrayView2d< localIndex const > const & elemToFaces,
+                                 arrayView2d< real64 const > const & elemCenter,
+                                 arrayView3d< real64 const > const & elemPerm,
+                                 real64 const & lengthTolerance,
+                                 localIndex const (&elems)[ BATCH_SIZE ],
+                                 integer const numElems,
+                                 real64 (& transMatrix)[ BATCH_SIZE ][ NF ][ NF ] )
+{
+  real64 cellToFaceMat[ BATCH_SIZE ][ NF ][ 3 ] = {};
+  real64 permNormalsMat[ BATCH_SIZE ][ NF ][ 3 ] = {};
+  real64 faceArea[ BATCH_SIZE ][ NF ] = {};
+  real64 tpTransInv[ BATCH_SIZE ][ NF ] = {};
+
+  // the interleaved systems N^T R and R^T R, and their right-hand sides N^T and R^T
+  real64 consistencyMat[ 3 ][ 3 ][ BATCH_SIZE ];
+  real64 stabilizationMat[ 3 ][ 3 ][ BATCH_SIZE ];
+  real64 consistencySol[ 3 ][ NF ][ BATCH_SIZE ];
+  real64 stabilizationSol[ 3 ][ NF ][ BATCH_SIZE ];
+
+  for( integer b = 0; b < BATCH_SIZE; ++b )
+  {
+    if( b < numElems )
+    {
+      localIndex const ei = elems[b];
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      // 0-2) compute the geometric quantities, R and N of Beirao da Veiga, Lipnikov, Manzini
+      computeGeometry< NF >( nodePosition, transMultiplier, faceToNodes, elemToFaces[ei], elemCenter[ei], perm, lengthTolerance,
+                             cellToFaceMat[b], permNormalsMat[b], faceArea[b], tpTransInv[b] );
+    }
+
+    // the unused entries of the batch hold identity systems, so that their factorizations succeed
+    for( integer i = 0; i < 3; ++i )
+    {
+      for( integer j = 0; j < 3; ++j )
+      {
+        consistencyMat[i][j][b] = ( b < numElems ) ? 0.0 : ( i == j );
+        stabilizationMat[i][j][b] = ( b < numElems ) ? 0.0 : ( i == j );
+        for( localIndex ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+        {
+          consistencyMat[i][j][b] += permNormalsMat[b][ifaceLoc][i] * cellToFaceMat[b][ifaceLoc][j];
+          stabilizationMat[i][j][b] += cellToFaceMat[b][ifaceLoc][i] * cellToFaceMat[b][ifaceLoc][j];
+        }
+      }
+      for( localIndex ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+      {
+        consistencySol[i][ifaceLoc][b] = permNormalsMat[b][ifaceLoc][i];
+        stabilizationSol[i][ifaceLoc][b] = cellToFaceMat[b][ifaceLoc][i];
+      }
+    }
+  }
+
+  // 3) factorize N^T R, and solve for the columns of N^T
+  integer pivots[ 3 ][ BATCH_SIZE ];
+  bool const factorized = denseLinearAlgebra::batched::luFactorize< 3, BATCH_SIZE >( consistencyMat, pivots );
+  GEOS_ERROR_IF( !factorized, "Singular matrix N^T R in the BdVLM inner product" );
+  denseLinearAlgebra::batched::luSolveMultiple< 3, NF, BATCH_SIZE >( consistencyMat, pivots, consistencySol );
+
+  // 6) factorize the symmetric positive definite matrix R^T R, and solve for the columns of R^T
+  bool const positiveDefinite = denseLinearAlgebra::batched::choleskyFactorize< 3, BATCH_SIZE >( stabilizationMat );
+  GEOS_ERROR_IF( !positiveDefinite, "Singular matrix R^T R in the BdVLM inner product" );
+  denseLinearAlgebra::batched::choleskySolveMultiple< 3, NF, BATCH_SIZE >( stabilizationMat, stabilizationSol );
+
+  // 4-10) assemble the transmissibility matrices
+  for( integer b = 0; b < numElems; ++b )
+  {
+    real64 elemConsistencySol[ 3 ][ NF ];
+    real64 elemStabilizationSol[ 3 ][ NF ];
+    for( integer i = 0; i < 3; ++i )
+    {
+      for( localIndex ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+      {
+        elemConsistencySol[i][ifaceLoc] = consistencySol[i][ifaceLoc][b];
+        elemStabilizationSol[i][ifaceLoc] = stabilizationSol[i][ifaceLoc][b];
+      }
+    }
+    assemble< NF >( cellToFaceMat[b], permNormalsMat[b], faceArea[b], tpTransInv[b],
+                    elemConsistencySol, elemStabilizationSol, transMatrix[b] );
+  }
 }
 
 } // end namespace mimeticInnerProduct
@@ -162,6 +162,105 @@ struct MimeticInnerProductHelpers
     }
   }
 
+  /**
+   * @brief Get the size of the cache of the transmissibility matrix of an element.
+   * @param[in] numFaces number of faces in the element
+   * @return the three permeability components used to compute the matrix, plus the size of its packed upper triangle
+   */
+  GEOS_HOST_DEVICE
+  static constexpr localIndex transMatrixCacheSize( localIndex const numFaces )
+  {
+    return 3 + numFaces * ( numFaces + 1 ) / 2;
+  }
+
+  /**
+   * @brief In a given element, get the transmissibility matrix from a cache, recomputing it if the permeability has changed.
+   * @tparam IP_TYPE the type of inner product
+   * @tparam NF number of faces in the element
+   * @param[in] nodePosition the position of the nodes
+   * @param[in] transMultiplier the transmissibility multipliers at the mesh faces
+   * @param[in] faceToNodes the map from the face to their nodes
+   * @param[in] elemToFaces the maps from the one-sided face to the corresponding face
+   * @param[in] elemCenter the center of the element
+   * @param[in] elemVolume the volume of the element
+   * @param[in] elemPerm the permeability in the element
+   * @param[in] lengthTolerance the tolerance used in the trans calculations
+   * @param[inout] cache the permeability used to compute the cached matrix, followed by its packed upper triangle
+   * @param[out] transMatrix the transmissibility matrix
+   *
+   * The transmissibility matrix only depends on the geometry and on the permeability of the element,
+   * so the cache is updated only when the permeability differs from the one it was computed with.
+   */
+  template< typename IP_TYPE, localIndex NF >
+  GEOS_HOST_DEVICE
+  static void
+  computeCached( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                 arrayView1d< real64 const > const & transMultiplier,
+                 ArrayOfArraysView< localIndex const > const & faceToNodes,
+                 arraySlice1d< localIndex const > const & elemToFaces,
+                 arraySlice1d< real64 const > const & elemCenter,
+                 real64 const & elemVolume,
+                 real64 const (&elemPerm)[ 3 ],
+                 real64 const & lengthTolerance,
+                 arraySlice1d< real64 > const & cache,
+                 arraySlice2d< real64 > const & transMatrix )
+  {
+    if( cache[0] != elemPerm[0] || cache[1] != elemPerm[1] || cache[2] != elemPerm[2] )
+    {
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces,
+                                       elemCenter,
+                                       elemVolume,
+                                       elemPerm,
+                                       lengthTolerance,
+                                       transMatrix );
+
+      storeInCache< NF >( transMatrix, elemPerm, cache );
+    }
+
+    localIndex k = 3;
+    for( localIndex i = 0; i < NF; ++i )
+    {
+      for( localIndex j = i; j < NF; ++j )
+      {
+        transMatrix[i][j] = cache[k];
+        transMatrix[j][i] = cache[k];
+        ++k;
+      }
+    }
+  }
+
+  /**
+   * @brief Store a transmissibility matrix in the cache of an element, with the permeability it was computed with
+   * @tparam NF the number of faces of the element
+   * @tparam MATRIX_TYPE the type of the transmissibility matrix
+   * @param[in] transMatrix the transmissibility matrix
+   * @param[in] elemPerm the permeability used to compute the transmissibility matrix
+   * @param[out] cache the cache of the element
+   */
+  template< localIndex NF, typename MATRIX_TYPE >
+  GEOS_HOST_DEVICE
+  static void
+  storeInCache( MATRIX_TYPE const & transMatrix,
+                real64 const (&elemPerm)[ 3 ],
+                arraySlice1d< real64 > const & cache )
+  {
+    // the matrix is symmetric up to round-off, only its upper triangle is stored
+    localIndex k = 3;
+    for( localIndex i = 0; i < NF; ++i )
+    {
+      for( localIndex j = i; j < NF; ++j )
+      {
+        cache[k++] = 0.5 * ( transMatrix[i][j] + transMatrix[j][i] );
+      }
+    }
+    cache[0] = elemPerm[0];
+    cache[1] = elemPerm[1];
+    cache[2] = elemPerm[2];
+  }
+
 };
 
 } // namespace mimeticInnerProduct
@@ -49,6 +49,56 @@ integer FunctionBase::isFunctionOfTime() const
   return 0;
 }
 
+FunctionBase::InputAccessor FunctionBase::createInputAccessor( dataRepository::Group const & group,
+                                                               real64 const time,
+                                                               LvArray::MemorySpace const space ) const
+{
+  InputAccessor inputs;
+  inputs.numVars = LvArray::integerConversion< integer >( m_inputVarNames.size() );
+  inputs.time = time;
+
+  // Make sure the number of variables does not exceed the maximum length before filling the accessor
+  GEOS_ERROR_IF_GT_MSG( inputs.numVars, MAX_VARS,
+                        getDataContext() << ": Function input size exceeded" );
+
+  localIndex totalVarSize = 0;
+  for( integer varIndex = 0; varIndex < inputs.numVars; ++varIndex )
+  {
+    string const & varName = m_inputVarNames[varIndex];
+
+    if( varName == "time" )
+    {
+      inputs.inputPtrs[varIndex] = nullptr;
+      inputs.varSize[varIndex] = 1;
+    }
+    else
+    {
+      dataRepository::WrapperBase const & wrapper = group.getWrapperBase( varName );
+      inputs.varSize[varIndex] = wrapper.numArrayComp();
+
+      using Types = types::ListofTypeList< types::ArrayTypes< types::TypeList< real64 >, types::DimsUpTo< 2 > > >;
+      types::dispatch( Types{}, [&]( auto tupleOfTypes )
+      {
+        using ArrayType = camp::first< decltype( tupleOfTypes ) >;
+        auto const view = dataRepository::Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
+        view.move( space, false );
+        for( int dim = 0; dim < ArrayType::NDIM; ++dim )
+        {
+          inputs.varStride[varIndex][dim] = view.strides()[dim];
+        }
+        inputs.inputPtrs[varIndex] = view.data();
+      }, wrapper );
+    }
+    totalVarSize += inputs.varSize[varIndex];
+  }
+
+  // Make sure the inputs do not exceed the maximum length
+  GEOS_ERROR_IF_GT_MSG( totalVarSize, MAX_VARS,
+                        getDataContext() << ": Function input size exceeded" );
+
+  return inputs;
+}
+
 real64_array FunctionBase::evaluateStats( dataRepository::Group const & group,
                                           real64 const time,
                                           SortedArray< localIndex > const & set ) const
@@ -56,6 +106,7 @@ real64_array FunctionBase::evaluateStats( dataRepository::Group const & group,
   localIndex N = set.size();
   real64_array sub( N );
   evaluate( group, time, set.toViewConst(), sub );
+  sub.move( hostMemorySpace, false );
 
   real64_array result( 3 );
   result[0] = 1e10;   // min
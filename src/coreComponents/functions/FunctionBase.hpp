@@ -124,6 +124,12 @@ public:
    */
   void setInputVarNames( string_array inputVarNames ) { m_inputVarNames = std::move( inputVarNames ); }
 
+  /**
+   * @brief Get the input variable names
+   * @return the list of input variable names
+   */
+  string_array const & getInputVarNames() const { return m_inputVarNames; }
+
   /**
    * @brief Get the output directory for function output
    * @return a string containing the output directory
@@ -140,6 +146,58 @@ protected:
   /// names for the input variables
   string_array m_inputVarNames;
 
+  /**
+   * @struct InputAccessor
+   * @brief Access to the input variables of the function at the points of an object.
+   */
+  struct InputAccessor
+  {
+    /**
+     * @brief Gather the inputs of the function at a point.
+     * @param[in] index the index of the point in the object
+     * @param[out] input the values of the input variables, components included
+     */
+    GEOS_HOST_DEVICE
+    void gather( localIndex const index, real64 * const input ) const
+    {
+      int offset = 0;
+      for( integer varIndex = 0; varIndex < numVars; ++varIndex )
+      {
+        if( inputPtrs[varIndex] == nullptr )
+        {
+          input[offset++] = time;
+          continue;
+        }
+        for( localIndex compIndex = 0; compIndex < varSize[varIndex]; ++compIndex )
+        {
+          input[offset++] = inputPtrs[varIndex][index * varStride[varIndex][0] + compIndex * varStride[varIndex][1]];
+        }
+      }
+    }
+
+    /// The data of the input arrays (nullptr for the time)
+    real64 const * inputPtrs[MAX_VARS]{};
+    /// The number of components of the input variables
+    localIndex varSize[MAX_VARS]{};
+    /// The strides of the input arrays
+    localIndex varStride[MAX_VARS][2]{};
+    /// The number of input variables
+    integer numVars = 0;
+    /// The current time
+    real64 time = 0.0;
+  };
+
+  /**
+   * @brief Create an accessor to the input variables of the function.
+   * @param[in] group the object holding the function arguments
+   * @param[in] time current time
+   * @param[in] space the memory space in which the inputs are accessed
+   * @return the accessor
+   */
+  InputAccessor createInputAccessor( dataRepository::Group const & group,
+                                     real64 const time,
+                                     LvArray::MemorySpace const space ) const;
+
   /**
    * @brief Method to apply an function with an arbitrary type of output
    * @tparam LEAF the return type
@@ -164,45 +222,7 @@ void FunctionBase::evaluateT( dataRepository::Group const & group,
                               SortedArrayView< localIndex const > const & set,
                               arrayView1d< real64 > const & result ) const
 {
-  real64 const * inputPtrs[MAX_VARS]{};
-  localIndex varSize[MAX_VARS]{};
-  localIndex varStride[MAX_VARS][2]{};
-
-  integer const numVars = LvArray::integerConversion< integer >( m_inputVarNames.size() );
-  localIndex totalVarSize = 0;
-  for( integer varIndex = 0; varIndex < numVars; ++varIndex )
-  {
-    string const & varName = m_inputVarNames[varIndex];
-
-    if( varName == "time" )
-    {
-      inputPtrs[varIndex] = &time;
-      varSize[varIndex] = 1;
-    }
-    else
-    {
-      dataRepository::WrapperBase const & wrapper = group.getWrapperBase( varName );
-      varSize[varIndex] = wrapper.numArrayComp();
-
-      using Types = types::ListofTypeList< types::ArrayTypes< types::TypeList< real64 >, types::DimsUpTo< 2 > > >;
-      types::dispatch( Types{}, [&]( auto tupleOfTypes )
-      {
-        using ArrayType = camp::first< decltype( tupleOfTypes ) >;
-        auto const view = dataRepository::Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
-        view.move( hostMemorySpace, false );
-        for( int dim = 0; dim < ArrayType::NDIM; ++dim )
-        {
-          varStride[varIndex][dim] = view.strides()[dim];
-        }
-        inputPtrs[varIndex] = view.data();
-      }, wrapper );
-    }
-    totalVarSize += varSize[varIndex];
-  }
-
-  // Make sure the inputs do not exceed the maximum length
-  GEOS_ERROR_IF_GT_MSG( totalVarSize, MAX_VARS,
-                        getDataContext() << ": Function input size exceeded" );
+  InputAccessor const inputs = createInputAccessor( group, time, hostMemorySpace );
 
   // Make sure the result / set size match
   GEOS_ERROR_IF_NE_MSG( result.size(), set.size(),
@@ -210,16 +230,8 @@ void FunctionBase::evaluateT( dataRepository::Group const & group,
 
   forAll< POLICY >( set.size(), [=]( localIndex const i )
   {
-    localIndex const index = set[i];
     real64 input[MAX_VARS]{};
-    int offset = 0;
-    for( integer varIndex = 0; varIndex < numVars; ++varIndex )
-    {
-      for( localIndex compIndex = 0; compIndex < varSize[varIndex]; ++compIndex )
-      {
-        input[offset++] = inputPtrs[varIndex][index * varStride[varIndex][0] + compIndex * varStride[varIndex][1]];
-      }
-    }
+    inputs.gather( set[i], input );
     result[i] = static_cast< LEAF const * >( this )->evaluate( input );
   } );
 }
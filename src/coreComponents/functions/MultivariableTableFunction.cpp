@@ -20,6 +20,7 @@
 #include "MultivariableTableFunction.hpp"
 
 #include "common/DataTypes.hpp"
+#include "common/TimingMacros.hpp"
 #include <algorithm>
 
 namespace geos
@@ -156,6 +157,104 @@ void MultivariableTableFunction::getHypercubePoints( globalIndex const hypercube
 }
 
 
+void MultivariableTableFunction::getPointValues( globalIndex const pointIndex, real64 * const values ) const
+{
+  if( !m_pointEvaluator )
+  {
+    std::copy( m_pointData.begin() + pointIndex * m_numOps,
+               m_pointData.begin() + (pointIndex + 1) * m_numOps,
+               values );
+    return;
+  }
+
+  // points are shared by neighboring hypercubes, evaluate each of them only once
+  auto point = m_evaluatedPoints.find( pointIndex );
+  if( point == m_evaluatedPoints.end() )
+  {
+    std::vector< real64 > coordinates( m_numDims );
+    globalIndex remainder = pointIndex;
+    for( integer dim = 0; dim < m_numDims; ++dim )
+    {
+      globalIndex const axisIndex = remainder / m_axisPointMults[dim];
+      remainder = remainder % m_axisPointMults[dim];
+      coordinates[dim] = m_axisMinimums[dim] + axisIndex * m_axisSteps[dim];
+    }
+
+    point = m_evaluatedPoints.emplace( pointIndex, m_evaluatedPointData.size() ).first;
+    m_evaluatedPointData.resize( m_evaluatedPointData.size() + m_numOps );
+    m_pointEvaluator( coordinates.data(), m_evaluatedPointData.data() + point->second );
+  }
+  std::copy_n( m_evaluatedPointData.begin() + point->second, m_numOps, values );
+}
+
+void MultivariableTableFunction::fillHypercubes( arrayView1d< globalIndex const > const & hypercubeIndices ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF( m_storageMode != StorageMode::Adaptive,
+                 catalogName() << " " << getDataContext() << ": hypercubes can only be filled in adaptive storage mode" );
+
+  hypercubeIndices.move( hostMemorySpace, false );
+  m_hypercubeKeys.move( hostMemorySpace, false );
+  m_hypercubeSlots.move( hostMemorySpace, false );
+
+  localIndex const numFilled = m_hypercubeKeys.size();
+  std::vector< globalIndex > missing;
+  for( localIndex i = 0; i < hypercubeIndices.size(); ++i )
+  {
+    globalIndex const hypercubeIndex = hypercubeIndices[i];
+    localIndex const pos = LvArray::sortedArrayManipulation::find( m_hypercubeKeys.data(), numFilled, hypercubeIndex );
+    if( pos == numFilled || m_hypercubeKeys[pos] != hypercubeIndex )
+    {
+      missing.emplace_back( hypercubeIndex );
+    }
+  }
+  if( missing.empty() )
+  {
+    return;
+  }
+  std::sort( missing.begin(), missing.end() );
+  missing.erase( std::unique( missing.begin(), missing.end() ), missing.end() );
+  localIndex const numMissing = LvArray::integerConversion< localIndex >( missing.size() );
+
+  // append the new hypercubes to the data
+  m_hypercubeData.move( hostMemorySpace, true );
+  m_hypercubeData.resize( (numFilled + numMissing) * m_numVerts * m_numOps );
+  m_pointData.move( hostMemorySpace, false );
+  globalIndex_array points( m_numVerts );
+  for( localIndex i = 0; i < numMissing; ++i )
+  {
+    getHypercubePoints( missing[i], points );
+    for( integer j = 0; j < m_numVerts; ++j )
+    {
+      getPointValues( points[j], &m_hypercubeData[m_numOps * ((numFilled + i) * m_numVerts + j)] );
+    }
+  }
+
+  // merge the new hypercubes into the sorted keys
+  globalIndex_array keys( numFilled + numMissing );
+  array1d< localIndex > slots( numFilled + numMissing );
+  localIndex oldPos = 0;
+  localIndex newPos = 0;
+  for( localIndex k = 0; k < keys.size(); ++k )
+  {
+    if( newPos == numMissing || ( oldPos < numFilled && m_hypercubeKeys[oldPos] < missing[newPos] ) )
+    {
+      keys[k] = m_hypercubeKeys[oldPos];
+      slots[k] = m_hypercubeSlots[oldPos];
+      ++oldPos;
+    }
+    else
+    {
+      keys[k] = missing[newPos];
+      slots[k] = numFilled + newPos;
+      ++newPos;
+    }
+  }
+  m_hypercubeKeys = std::move( keys );
+  m_hypercubeSlots = std::move( slots );
+}
+
 void MultivariableTableFunction::initializeFunction()
 {
   // check input
@@ -203,10 +302,31 @@ void MultivariableTableFunction::initializeFunction()
   }
 
 
+  m_numHypercubes = numTableHypercubes;
+
+  // clear the data of a previous initialization
+  m_hypercubeData.clear();
+  m_hypercubeKeys.clear();
+  m_hypercubeSlots.clear();
+  m_evaluatedPoints.clear();
+  m_evaluatedPointData.clear();
+
+  // in adaptive mode, the point data is not needed if the point values are computed by an evaluator
+  if( m_storageMode == StorageMode::Adaptive && m_pointEvaluator )
+  {
+    return;
+  }
+
   // check is point data size is correct
   GEOS_THROW_IF_NE_MSG( globalIndex( numTablePoints ) * m_numOps, m_pointData.size(), catalogName() << " " << getDataContext() <<
                         ": table values array is expected to have length of " + std::to_string( globalIndex( numTablePoints ) * m_numOps ), InputError );
 
+  // hypercubes are filled when they are visited in adaptive mode, and are not used in point mode
+  if( m_storageMode != StorageMode::Hypercube )
+  {
+    return;
+  }
+
   // lets limit the hypercube storage size with 16 Gb
   real64 hypercubeStorageMemoryLimitGB = 16;
 
@@ -25,6 +25,9 @@
 #include "codingUtilities/EnumStrings.hpp"
 #include "LvArray/src/tensorOps.hpp"
 
+#include <functional>
+#include <unordered_map>
+
 namespace geos
 {
 
@@ -33,12 +36,34 @@ namespace geos
  *
  * An interface class for multivariable table function (function with multiple inputs and outputs) with uniform discretization
  * Prepares input data for MultivariableStaticInterpolatorKernel, which performes actual interpolation
+ *
+ * The data used by the interpolation kernel depends on the storage mode:
+ *  - Hypercube: the values at the vertices of each hypercube are stored contiguously, which duplicates
+ *    every point into each of its 2^numDims hypercubes;
+ *  - Point: only the point data is stored, and the vertices of a hypercube are found by index arithmetic;
+ *  - Adaptive: the hypercubes are filled on first access (see fillHypercubes), from the point data or from a
+ *    registered point evaluator, so that only the visited part of the parameter space is stored.
  */
 
 class MultivariableTableFunction : public FunctionBase
 {
 public:
 
+  /// Storage of the table data used by the interpolation
+  enum class StorageMode : integer
+  {
+    Hypercube, ///< all values of each hypercube are stored contiguously
+    Point,     ///< values are stored per point only
+    Adaptive   ///< hypercubes are filled when they are visited
+  };
+
+  /**
+   * @brief Function computing the values of all operators at a point
+   * @param[in] coordinates the coordinates of the point (numDims values)
+   * @param[out] values the operator values (numOps values)
+   */
+  using PointEvaluator = std::function< void ( real64 const * coordinates, real64 * values ) >;
+
   /**
    * @brief The constructor
    * @param[in] name the name of this object manager
@@ -74,6 +99,24 @@ public:
    */
   void setTableValues( real64_array const values );
 
+  /**
+   * @brief Set the storage mode, before the initialization of the function
+   * @param mode the storage mode
+   */
+  void setStorageMode( StorageMode const mode ) { m_storageMode = mode; }
+
+  /**
+   * @brief Set the function computing the operator values at the points in adaptive mode
+   * @param evaluator the point evaluator
+   * @note Without evaluator, the hypercubes are filled from the table values.
+   */
+  void setPointEvaluator( PointEvaluator evaluator ) { m_pointEvaluator = std::move( evaluator ); }
+
+  /**
+   * @brief Fill the hypercubes that have not been visited yet (adaptive mode only)
+   * @param[in] hypercubeIndices the indices of the hypercubes that are about to be accessed
+   */
+  void fillHypercubes( arrayView1d< globalIndex const > const & hypercubeIndices ) const;
 
 
   /**
@@ -159,12 +202,64 @@ public:
    */
   arrayView1d< globalIndex const > getAxisHypercubeMults() const { return m_axisHypercubeMults.toViewConst(); }
 
+  /**
+   * @brief Get the table axes point index multiplicators
+   * @return a reference to an array of table axes point index multiplicators
+   */
+  arrayView1d< globalIndex const > getAxisPointMults() const { return m_axisPointMults.toViewConst(); }
+
+  /**
+   * @brief Get the table values stored per point
+   * @return a reference to an array of table values stored per point
+   */
+  arrayView1d< real64 const > getPointData() const { return m_pointData.toViewConst(); }
+
   /**
    * @brief Get the table values stored per-hypercube
    * @return a reference to an array of table values stored per-hypercube
    */
   arrayView1d< real64 const > getHypercubeData() const { return m_hypercubeData.toViewConst(); }
 
+  /**
+   * @brief Get the sorted indices of the filled hypercubes (adaptive mode)
+   * @return a reference to an array of hypercube indices
+   */
+  arrayView1d< globalIndex const > getHypercubeKeys() const { return m_hypercubeKeys.toViewConst(); }
+
+  /**
+   * @brief Get the position in the hypercube data of the filled hypercubes, in the order of the keys (adaptive mode)
+   * @return a reference to an array of hypercube positions
+   */
+  arrayView1d< localIndex const > getHypercubeSlots() const { return m_hypercubeSlots.toViewConst(); }
+
+  /**
+   * @brief Get the storage mode
+   * @return the storage mode
+   */
+  StorageMode getStorageMode() const { return m_storageMode; }
+
+  /**
+   * @brief Get the number of hypercubes of the table
+   * @return the number of hypercubes
+   */
+  globalIndex numHypercubes() const { return m_numHypercubes; }
+
+  /**
+   * @brief Get the number of hypercubes holding data
+   * @return the number of hypercubes stored (all of them in hypercube mode, the visited ones in adaptive mode, none in point mode)
+   */
+  globalIndex numFilledHypercubes() const
+  {
+    return m_storageMode == StorageMode::Adaptive ? m_hypercubeKeys.size()
+                                                  : ( m_storageMode == StorageMode::Hypercube ? m_numHypercubes : 0 );
+  }
+
+  /**
+   * @brief Get the number of calls to the point evaluator
+   * @return the number of evaluated points
+   */
+  globalIndex numEvaluatedPoints() const { return LvArray::integerConversion< globalIndex >( m_evaluatedPoints.size() ); }
+
   /**
    * @brief Get the number of table dimensions
    * @return the number of table dimensions
@@ -187,6 +282,14 @@ private:
    */
   void getHypercubePoints( globalIndex const hypercubeIndex, globalIndex_array & hypercubePoints ) const;
 
+  /**
+   * @brief Get the operator values at a point of the table
+   *
+   * @param[in] pointIndex index of the point
+   * @param[out] values the operator values
+   */
+  void getPointValues( globalIndex const pointIndex, real64 * const values ) const;
+
   /// Number of table dimensions (inputs)
   integer m_numDims;
 
@@ -225,9 +328,38 @@ private:
   real64_array m_pointData;
 
   ///  Main table data stored per hypercube: all values required for interpolation withing give hypercube are stored contiguously
-  real64_array m_hypercubeData;
+  mutable real64_array m_hypercubeData;
+
+  /// Storage mode
+  StorageMode m_storageMode = StorageMode::Hypercube;
+
+  /// Total number of hypercubes
+  globalIndex m_numHypercubes = 0;
+
+  // adaptive storage: the hypercubes are appended to m_hypercubeData when they are filled
+
+  /// Sorted indices of the filled hypercubes
+  mutable globalIndex_array m_hypercubeKeys;
+
+  /// Position of the filled hypercubes in m_hypercubeData, in the order of m_hypercubeKeys
+  mutable array1d< localIndex > m_hypercubeSlots;
+
+  /// Function computing the operator values at a point
+  PointEvaluator m_pointEvaluator;
+
+  /// Offsets in m_evaluatedPointData of the values of the evaluated points
+  mutable std::unordered_map< globalIndex, std::size_t > m_evaluatedPoints;
+
+  /// Operator values of the evaluated points
+  mutable std::vector< real64 > m_evaluatedPointData;
 };
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( MultivariableTableFunction::StorageMode,
+              "hypercube",
+              "point",
+              "adaptive" );
+
 
 } /* namespace geos */
 
@@ -20,6 +20,8 @@
 #ifndef GEOS_FUNCTIONS_MULTIVARIABLETABLEFUNCTIONKERNELS_HPP_
 #define GEOS_FUNCTIONS_MULTIVARIABLETABLEFUNCTIONKERNELS_HPP_
 
+#include "MultivariableTableFunction.hpp"
+
 namespace geos
 {
 
@@ -36,6 +38,9 @@ namespace geos
  *
  * A class for multivariable piecewise interpolation with static storage
  * All functions are interpolated using the same uniformly discretized space
+ * The vertex values of the target hypercube are read according to the storage mode of the table
+ * (see MultivariableTableFunction::StorageMode); in adaptive mode, the hypercubes must have been
+ * filled with MultivariableTableFunction::fillHypercubes before the kernel is created.
  *
  * @tparam NUM_DIMS number of dimensions (inputs)
  * @tparam NUM_OPS number of interpolated functions (outputs)
@@ -79,9 +84,52 @@ public:
     m_axisSteps ( axisSteps ),
     m_axisStepInvs ( axisStepInvs ),
     m_axisHypercubeMults ( axisHypercubeMults ),
-    m_hypercubeData ( hypercubeData )
+    m_hypercubeData ( hypercubeData ),
+    m_storageMode( MultivariableTableFunction::StorageMode::Hypercube )
   {};
 
+  /**
+   * @brief Construct a new Multivariable Table Function Static Kernel object using the storage of a table
+   *
+   * @param[in] function the table function
+   */
+  explicit MultivariableTableFunctionStaticKernel( MultivariableTableFunction const & function ):
+    m_axisMinimums ( function.getAxisMinimums() ),
+    m_axisMaximums ( function.getAxisMaximums() ),
+    m_axisPoints ( function.getAxisPoints() ),
+    m_axisSteps ( function.getAxisSteps() ),
+    m_axisStepInvs ( function.getAxisStepInvs() ),
+    m_axisHypercubeMults ( function.getAxisHypercubeMults() ),
+    m_hypercubeData ( function.getHypercubeData() ),
+    m_storageMode( function.getStorageMode() ),
+    m_axisPointMults( function.getAxisPointMults() ),
+    m_pointData( function.getPointData() ),
+    m_hypercubeKeys( function.getHypercubeKeys() ),
+    m_hypercubeSlots( function.getHypercubeSlots() )
+  {};
+
+  /**
+   * @brief Get the index of the hypercube containing a given point
+   * Points outside of the table are assigned to the nearest hypercube, as in the interpolation
+   *
+   * @param[in] coordinates point coordinates
+   * @return the hypercube index
+   */
+  template< typename IN_ARRAY >
+  GEOS_HOST_DEVICE
+  globalIndex
+  getHypercubeIndex( IN_ARRAY const & coordinates ) const
+  {
+    globalIndex hypercubeIndex = 0;
+    for( int i = 0; i < numDims; ++i )
+    {
+      integer const axisIndex = LvArray::math::min( LvArray::math::max( integer( (coordinates[i] - m_axisMinimums[i]) * m_axisStepInvs[i] ), 0 ),
+                                                    m_axisPoints[i] - 2 );
+      hypercubeIndex += axisIndex * m_axisHypercubeMults[i];
+    }
+    return hypercubeIndex;
+  }
+
 /**
  * @brief interpolate all operators at a given point
  *
@@ -94,21 +142,20 @@ public:
   compute( IN_ARRAY const & coordinates,
            OUT_ARRAY && values ) const
   {
-    globalIndex hypercubeIndex = 0;
+    integer axisIndices[numDims];
     real64 axisLows[numDims];
     real64 axisMults[numDims];
 
     for( int i = 0; i < numDims; ++i )
     {
-      integer const axisIndex = getAxisIntervalIndexLowMult( coordinates[i],
-                                                             m_axisMinimums[i], m_axisMaximums[i],
-                                                             m_axisSteps[i], m_axisStepInvs[i], m_axisPoints[i],
-                                                             axisLows[i], axisMults[i] );
-      hypercubeIndex += axisIndex * m_axisHypercubeMults[i];
+      axisIndices[i] = getAxisIntervalIndexLowMult( coordinates[i],
+                                                    m_axisMinimums[i], m_axisMaximums[i],
+                                                    m_axisSteps[i], m_axisStepInvs[i], m_axisPoints[i],
+                                                    axisLows[i], axisMults[i] );
     }
 
     interpolatePoint( coordinates,
-                      getHypercubeData( hypercubeIndex ),
+                      &axisIndices[0],
                       &axisLows[0],
                       &m_axisStepInvs[0],
                       values );
@@ -128,21 +175,20 @@ public:
            OUT_ARRAY && values,
            OUT_2D_ARRAY && derivatives ) const
   {
-    globalIndex hypercubeIndex = 0;
+    integer axisIndices[numDims];
     real64 axisLows[numDims];
     real64 axisMults[numDims];
 
     for( int i = 0; i < numDims; ++i )
     {
-      integer const axisIndex = getAxisIntervalIndexLowMult( coordinates[i],
-                                                             m_axisMinimums[i], m_axisMaximums[i],
-                                                             m_axisSteps[i], m_axisStepInvs[i], m_axisPoints[i],
-                                                             axisLows[i], axisMults[i] );
-      hypercubeIndex += axisIndex * m_axisHypercubeMults[i];
+      axisIndices[i] = getAxisIntervalIndexLowMult( coordinates[i],
+                                                    m_axisMinimums[i], m_axisMaximums[i],
+                                                    m_axisSteps[i], m_axisStepInvs[i], m_axisPoints[i],
+                                                    axisLows[i], axisMults[i] );
     }
 
     interpolatePointWithDerivatives( coordinates,
-                                     getHypercubeData( hypercubeIndex ),
+                                     &axisIndices[0],
                                      &axisLows[0], &axisMults[0],
                                      &m_axisStepInvs[0],
                                      values,
@@ -163,9 +209,66 @@ protected:
   real64 const *
   getHypercubeData( globalIndex const hypercubeIndex ) const
   {
+    if( m_storageMode == MultivariableTableFunction::StorageMode::Adaptive )
+    {
+      localIndex const pos = LvArray::sortedArrayManipulation::find( m_hypercubeKeys.data(), m_hypercubeKeys.size(), hypercubeIndex );
+      GEOS_ERROR_IF( pos == m_hypercubeKeys.size() || m_hypercubeKeys[pos] != hypercubeIndex,
+                     "Hypercube " << hypercubeIndex << " has not been filled" );
+      return &m_hypercubeData[m_hypercubeSlots[pos] * numVerts * numOps];
+    }
     return &m_hypercubeData[hypercubeIndex * numVerts * numOps];
   }
 
+  /**
+   * @brief Load the operator values at the vertices of a hypercube
+   *
+   * @param[in] axisIndices interval index of the hypercube on each axis
+   * @param[out] vertexValues operator values at each vertex of the hypercube
+   */
+  GEOS_HOST_DEVICE
+  inline
+  void
+  loadHypercubeValues( integer const * const axisIndices,
+                       real64 (* const vertexValues)[numOps] ) const
+  {
+    if( m_storageMode == MultivariableTableFunction::StorageMode::Point )
+    {
+      globalIndex pointIndex = 0;
+      for( integer i = 0; i < numDims; ++i )
+      {
+        pointIndex += axisIndices[i] * m_axisPointMults[i];
+      }
+      // the bit (numDims - 1 - i) of a vertex index selects the high value on axis i
+      for( integer v = 0; v < numVerts; ++v )
+      {
+        globalIndex vertexPointIndex = pointIndex;
+        for( integer i = 0; i < numDims; ++i )
+        {
+          vertexPointIndex += ((v >> (numDims - 1 - i)) & 1) * m_axisPointMults[i];
+        }
+        for( integer op = 0; op < numOps; ++op )
+        {
+          vertexValues[v][op] = m_pointData[vertexPointIndex * numOps + op];
+        }
+      }
+      return;
+    }
+
+    globalIndex hypercubeIndex = 0;
+    for( integer i = 0; i < numDims; ++i )
+    {
+      hypercubeIndex += axisIndices[i] * m_axisHypercubeMults[i];
+    }
+    real64 const * const hypercubeData = getHypercubeData( hypercubeIndex );
+    for( integer v = 0; v < numVerts; ++v )
+    {
+      for( integer op = 0; op < numOps; ++op )
+      {
+        vertexValues[v][op] = hypercubeData[v * numOps + op];
+      }
+    }
+  }
+
   /**
    * @brief Get the interval index, low and mult values for a given axis coordinate
    *
@@ -223,7 +326,7 @@ protected:
    * The algoritm is based on http://dx.doi.org/10.1090/S0025-5718-1988-0917826-0
    *
    * @param[in] axisCoordinates coordinates of a point
-   * @param[in] hypercubeData data of target hypercube
+   * @param[in] axisIndices interval index of the target hypercube on each axis
    * @param[in] axisLows array of left coordinates of target axis intervals
    * @param[in] axisStepInvs array of inversions of axis steps
    * @param[out] values interpolated operator values
@@ -233,7 +336,7 @@ protected:
   inline
   void
   interpolatePoint( IN_ARRAY const & axisCoordinates,
-                    real64 const * const hypercubeData,
+                    integer const * const axisIndices,
                     real64 const * const axisLows,
                     real64 const * const axisStepInvs,
                     OUT_ARRAY && values ) const
@@ -242,13 +345,7 @@ protected:
     real64 workspace[numVerts][numOps];
 
     // copy operator values for all vertices
-    for( integer i = 0; i < numVerts; ++i )
-    {
-      for( integer j = 0; j < numOps; ++j )
-      {
-        workspace[i][j] = hypercubeData[i * numOps + j];
-      }
-    }
+    loadHypercubeValues( axisIndices, workspace );
 
     for( integer i = 0; i < numDims; ++i )
     {
@@ -275,7 +372,7 @@ protected:
    * The algoritm is based on http://dx.doi.org/10.1090/S0025-5718-1988-0917826-0
    *
    * @param[in] axisCoordinates coordinates of a point
-   * @param[in] hypercubeData data of target hypercube
+   * @param[in] axisIndices interval index of the target hypercube on each axis
    * @param[in] axisLows array of left coordinates of target axis intervals
    * @param[in] axisMults array of weights of right coordinates of target axis intervals
    * @param[in] axisStepInvs array of inversions of axis steps
@@ -287,7 +384,7 @@ protected:
   inline
   void
   interpolatePointWithDerivatives( IN_ARRAY const & axisCoordinates,
-                                   real64 const * const hypercubeData,
+                                   integer const * const axisIndices,
                                    real64 const * const axisLows,
                                    real64 const * const axisMults,
                                    real64 const * const axisStepInvs,
@@ -298,13 +395,7 @@ protected:
     real64 workspace[2 * numVerts - 1][numOps];
 
     // copy operator values for all vertices
-    for( integer i = 0; i < numVerts; ++i )
-    {
-      for( integer j = 0; j < numOps; ++j )
-      {
-        workspace[i][j] = hypercubeData[i * numOps + j];
-      }
-    }
+    loadHypercubeValues( axisIndices, workspace );
 
     for( integer i = 0; i < numDims; ++i )
     {
@@ -373,6 +464,21 @@ protected:
   ///  Main table data stored per hypercube: all values required for interpolation withing give hypercube are stored contiguously
   arrayView1d< real64 const > m_hypercubeData;
 
+  /// Storage mode of the table
+  MultivariableTableFunction::StorageMode m_storageMode;
+
+  ///  Array [numDims] of point index mult factors for each axis (point mode)
+  arrayView1d< globalIndex const > m_axisPointMults;
+
+  ///  Main table data stored per point (point mode)
+  arrayView1d< real64 const > m_pointData;
+
+  ///  Sorted indices of the filled hypercubes (adaptive mode)
+  arrayView1d< globalIndex const > m_hypercubeKeys;
+
+  ///  Position of the filled hypercubes in the hypercube data (adaptive mode)
+  arrayView1d< localIndex const > m_hypercubeSlots;
+
   // inputs: where to interpolate
 
   /// Coordinates in numDims-dimensional space where interpolation is requested
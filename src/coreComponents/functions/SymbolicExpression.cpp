@@ -0,0 +1,381 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SymbolicExpression.cpp
+ */
+
+#include "SymbolicExpression.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+namespace geos
+{
+
+namespace
+{
+
+/**
+ * @class ExpressionParser
+ * @brief Recursive descent parser emitting the bytecode of an expression.
+ *
+ * The grammar, from the lowest to the highest precedence, is:
+ *   comparison := sum ( ( '<' | '<=' | '>' | '>=' | '==' | '!=' ) sum )*
+ *   sum        := product ( ( '+' | '-' ) product )*
+ *   product    := unary ( ( '*' | '/' | '%' ) unary )*
+ *   unary      := ( '-' | '+' ) unary | power
+ *   power      := primary ( '^' unary )?
+ *   primary    := number | constant | variable | function '(' comparison ( ',' comparison )? ')' | '(' comparison ')'
+ */
+class ExpressionParser
+{
+public:
+
+  using OpCode = SymbolicExpression::OpCode;
+  using Instruction = SymbolicExpression::Instruction;
+
+  ExpressionParser( string const & expression,
+                    arrayView1d< string const > const & variableNames ):
+    m_expression( expression ),
+    m_variableNames( variableNames )
+  {}
+
+  /**
+   * @brief Parse the expression.
+   * @param instructions the bytecode
+   * @param errorMessage the description of the error if the parsing failed
+   * @return true if the expression has been parsed
+   */
+  bool parse( std::vector< Instruction > & instructions, string & errorMessage )
+  {
+    bool success = parseComparison();
+    skipSpaces();
+    if( success && m_pos < m_expression.size() )
+    {
+      success = fail( "unexpected character" );
+    }
+    if( !success )
+    {
+      errorMessage = GEOS_FMT( "{} at position {} of expression \"{}\"", m_error, m_errorPos, m_expression );
+      return false;
+    }
+    instructions = std::move( m_instructions );
+    return true;
+  }
+
+private:
+
+  bool fail( char const * const message )
+  {
+    if( m_error.empty() )
+    {
+      m_error = message;
+      m_errorPos = m_pos;
+    }
+    return false;
+  }
+
+  void skipSpaces()
+  {
+    while( m_pos < m_expression.size() && std::isspace( static_cast< unsigned char >( m_expression[m_pos] ) ) )
+    {
+      ++m_pos;
+    }
+  }
+
+  /// Consume the given token if it is next in the expression (two-character tokens must be tried first)
+  bool accept( char const * const token )
+  {
+    skipSpaces();
+    string::size_type const length = std::char_traits< char >::length( token );
+    if( m_expression.compare( m_pos, length, token ) == 0 )
+    {
+      m_pos += length;
+      return true;
+    }
+    return false;
+  }
+
+  /// Emit an instruction, folding the operations on constants
+  bool emit( Instruction const & instruction )
+  {
+    integer const numOperands = SymbolicExpression::numOperands( instruction.op );
+    localIndex const size = LvArray::integerConversion< localIndex >( m_instructions.size() );
+    bool constantOperands = size >= numOperands && numOperands > 0;
+    for( integer i = 1; i <= numOperands && constantOperands; ++i )
+    {
+      constantOperands = m_instructions[size - i].op == OpCode::Constant;
+    }
+
+    if( constantOperands )
+    {
+      real64 const value = ( numOperands == 1 )
+                           ? SymbolicExpression::apply( instruction.op, m_instructions[size-1].value )
+                           : SymbolicExpression::apply( instruction.op, m_instructions[size-2].value, m_instructions[size-1].value );
+      m_instructions.resize( size - numOperands + 1 );
+      m_instructions.back() = Instruction{ OpCode::Constant, 0, value };
+    }
+    else
+    {
+      m_instructions.emplace_back( instruction );
+    }
+
+    m_stackSize += 1 - numOperands;
+    m_maxStackSize = std::max( m_maxStackSize, m_stackSize );
+    if( m_maxStackSize > SymbolicExpression::maxStackSize )
+    {
+      return fail( "expression too deeply nested" );
+    }
+    return true;
+  }
+
+  bool emit( OpCode const op )
+  {
+    return emit( Instruction{ op, 0, 0.0 } );
+  }
+
+  bool parseComparison()
+  {
+    if( !parseSum() )
+    {
+      return false;
+    }
+    while( true )
+    {
+      OpCode op;
+      if( accept( "<=" ) ) { op = OpCode::LessEqual; }
+      else if( accept( ">=" ) ) { op = OpCode::GreaterEqual; }
+      else if( accept( "==" ) ) { op = OpCode::Equal; }
+      else if( accept( "!=" ) ) { op = OpCode::NotEqual; }
+      else if( accept( "<" ) ) { op = OpCode::Less; }
+      else if( accept( ">" ) ) { op = OpCode::Greater; }
+      else { return true; }
+      if( !parseSum() || !emit( op ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  bool parseSum()
+  {
+    if( !parseProduct() )
+    {
+      return false;
+    }
+    while( true )
+    {
+      OpCode op;
+      if( accept( "+" ) ) { op = OpCode::Add; }
+      else if( accept( "-" ) ) { op = OpCode::Subtract; }
+      else { return true; }
+      if( !parseProduct() || !emit( op ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  bool parseProduct()
+  {
+    if( !parseUnary() )
+    {
+      return false;
+    }
+    while( true )
+    {
+      OpCode op;
+      if( accept( "*" ) ) { op = OpCode::Multiply; }
+      else if( accept( "/" ) ) { op = OpCode::Divide; }
+      else if( accept( "%" ) ) { op = OpCode::Modulo; }
+      else { return true; }
+      if( !parseUnary() || !emit( op ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  bool parseUnary()
+  {
+    if( accept( "-" ) )
+    {
+      return parseUnary() && emit( OpCode::Negate );
+    }
+    if( accept( "+" ) )
+    {
+      return parseUnary();
+    }
+    return parsePower();
+  }
+
+  bool parsePower()
+  {
+    if( !parsePrimary() )
+    {
+      return false;
+    }
+    if( accept( "^" ) )
+    {
+      // right-associative, and binding tighter than the unary minus on its left: -a^b = -(a^b)
+      return parseUnary() && emit( OpCode::Power );
+    }
+    return true;
+  }
+
+  bool parsePrimary()
+  {
+    skipSpaces();
+    if( m_pos == m_expression.size() )
+    {
+      return fail( "unexpected end of expression" );
+    }
+
+    if( accept( "(" ) )
+    {
+      return parseComparison() && ( accept( ")" ) ? true : fail( "expected ')'" ) );
+    }
+
+    char const c = m_expression[m_pos];
+    if( std::isdigit( static_cast< unsigned char >( c ) ) || c == '.' )
+    {
+      char const * const begin = m_expression.c_str() + m_pos;
+      char * end = nullptr;
+      real64 const value = std::strtod( begin, &end );
+      if( end == begin )
+      {
+        return fail( "invalid number" );
+      }
+      m_pos += end - begin;
+      return emit( Instruction{ OpCode::Constant, 0, value } );
+    }
+
+    if( std::isalpha( static_cast< unsigned char >( c ) ) || c == '_' )
+    {
+      string::size_type const begin = m_pos;
+      while( m_pos < m_expression.size() &&
+             ( std::isalnum( static_cast< unsigned char >( m_expression[m_pos] ) ) || m_expression[m_pos] == '_' ) )
+      {
+        ++m_pos;
+      }
+      string const name = m_expression.substr( begin, m_pos - begin );
+
+      for( localIndex i = 0; i < m_variableNames.size(); ++i )
+      {
+        if( m_variableNames[i] == name )
+        {
+          return emit( Instruction{ OpCode::Variable, LvArray::integerConversion< integer >( i ), 0.0 } );
+        }
+      }
+      if( name == "PI" )
+      {
+        return emit( Instruction{ OpCode::Constant, 0, M_PI } );
+      }
+      if( name == "E" )
+      {
+        return emit( Instruction{ OpCode::Constant, 0, M_E } );
+      }
+
+      static std::unordered_map< string, OpCode > const functions =
+      {
+        { "sin", OpCode::Sin }, { "cos", OpCode::Cos }, { "tan", OpCode::Tan },
+        { "asin", OpCode::Asin }, { "acos", OpCode::Acos }, { "atan", OpCode::Atan },
+        { "sinh", OpCode::Sinh }, { "cosh", OpCode::Cosh }, { "tanh", OpCode::Tanh },
+        { "sqrt", OpCode::Sqrt }, { "exp", OpCode::Exp }, { "log", OpCode::Log }, { "log10", OpCode::Log10 },
+        { "abs", OpCode::Abs }, { "floor", OpCode::Floor }, { "ceil", OpCode::Ceil },
+        { "round", OpCode::Round }, { "trunc", OpCode::Trunc },
+        { "pow", OpCode::Power }, { "min", OpCode::Min }, { "max", OpCode::Max },
+        { "atan2", OpCode::Atan2 }, { "hypot", OpCode::Hypot }
+      };
+      auto const function = functions.find( name );
+      if( function == functions.end() )
+      {
+        m_pos = begin;
+        return fail( "unknown variable or function" );
+      }
+      if( !accept( "(" ) )
+      {
+        return fail( "expected '('" );
+      }
+      integer const numArgs = SymbolicExpression::numOperands( function->second );
+      for( integer arg = 0; arg < numArgs; ++arg )
+      {
+        if( !parseComparison() )
+        {
+          return false;
+        }
+        if( !accept( arg + 1 < numArgs ? "," : ")" ) )
+        {
+          return fail( arg + 1 < numArgs ? "expected ','" : "expected ')'" );
+        }
+      }
+      return emit( function->second );
+    }
+
+    return fail( "unexpected character" );
+  }
+
+  /// The expression
+  string const & m_expression;
+
+  /// The names of the variables
+  arrayView1d< string const > const m_variableNames;
+
+  /// The position of the parser in the expression
+  string::size_type m_pos = 0;
+
+  /// The bytecode
+  std::vector< Instruction > m_instructions;
+
+  /// The depth of the stack after the emitted instructions
+  integer m_stackSize = 0;
+
+  /// The maximum depth of the stack
+  integer m_maxStackSize = 0;
+
+  /// The first error
+  string m_error;
+
+  /// The position of the first error
+  string::size_type m_errorPos = 0;
+};
+
+}
+
+bool SymbolicExpression::compile( string const & expression,
+                                  arrayView1d< string const > const & variableNames,
+                                  string & errorMessage )
+{
+  m_instructions.clear();
+
+  std::vector< Instruction > instructions;
+  ExpressionParser parser( expression, variableNames );
+  if( !parser.parse( instructions, errorMessage ) )
+  {
+    return false;
+  }
+
+  m_instructions.resize( LvArray::integerConversion< localIndex >( instructions.size() ) );
+  for( localIndex i = 0; i < m_instructions.size(); ++i )
+  {
+    m_instructions[i] = instructions[i];
+  }
+  return true;
+}
+
+} /* namespace geos */
@@ -0,0 +1,345 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SymbolicExpression.hpp
+ */
+
+#ifndef GEOS_FUNCTIONS_SYMBOLICEXPRESSION_HPP_
+#define GEOS_FUNCTIONS_SYMBOLICEXPRESSION_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <cmath>
+
+namespace geos
+{
+
+/**
+ * @class SymbolicExpression
+ * @brief Math expression compiled into a bytecode that can be evaluated in device kernels.
+ *
+ * The expression is parsed once into a sequence of instructions of a stack machine (in postfix
+ * order), where the subexpressions that do not depend on the variables are folded into constants.
+ * The bytecode is held in arrays, and is evaluated through a KernelWrapper on any execution space.
+ * The evaluation can also be done on a batch of points at once, in which case every instruction
+ * is applied to all the points of the batch in a loop that the compiler can vectorize.
+ *
+ * The supported syntax is:
+ *  - numbers, variables, and the constants PI and E;
+ *  - the binary operators + - * / % ^ (power), the comparisons < <= > >= == != (evaluated to 0 or 1),
+ *    and the unary operators - and +;
+ *  - the functions sin, cos, tan, asin, acos, atan, sinh, cosh, tanh, sqrt, exp, log, log10,
+ *    abs, floor, ceil, round, trunc (one argument), and pow, min, max, atan2, hypot (two arguments).
+ */
+class SymbolicExpression
+{
+public:
+
+  /// Maximum depth of the evaluation stack
+  static constexpr integer maxStackSize = 16;
+
+  /// Operations of the stack machine
+  enum class OpCode : integer
+  {
+    Constant,   ///< push a constant
+    Variable,   ///< push a variable
+    Negate,     ///< unary minus
+    Add,        ///< addition
+    Subtract,   ///< subtraction
+    Multiply,   ///< multiplication
+    Divide,     ///< division
+    Modulo,     ///< floating-point remainder
+    Power,      ///< power
+    Less,       ///< comparison <
+    LessEqual,  ///< comparison <=
+    Greater,    ///< comparison >
+    GreaterEqual, ///< comparison >=
+    Equal,      ///< comparison ==
+    NotEqual,   ///< comparison !=
+    Min,        ///< minimum of two values
+    Max,        ///< maximum of two values
+    Atan2,      ///< two-argument arc tangent
+    Hypot,      ///< hypotenuse
+    Sin,        ///< sine
+    Cos,        ///< cosine
+    Tan,        ///< tangent
+    Asin,       ///< arc sine
+    Acos,       ///< arc cosine
+    Atan,       ///< arc tangent
+    Sinh,       ///< hyperbolic sine
+    Cosh,       ///< hyperbolic cosine
+    Tanh,       ///< hyperbolic tangent
+    Sqrt,       ///< square root
+    Exp,        ///< exponential
+    Log,        ///< natural logarithm
+    Log10,      ///< base 10 logarithm
+    Abs,        ///< absolute value
+    Floor,      ///< floor
+    Ceil,       ///< ceiling
+    Round,      ///< rounding to the nearest integer
+    Trunc       ///< truncation
+  };
+
+  /// Instruction of the stack machine
+  struct Instruction
+  {
+    /// The operation
+    OpCode op;
+    /// The index of the variable (for OpCode::Variable)
+    integer variable;
+    /// The value of the constant (for OpCode::Constant)
+    real64 value;
+  };
+
+  /**
+   * @brief Apply a unary operation.
+   * @param op the operation
+   * @param a the operand
+   * @return the result
+   */
+  GEOS_HOST_DEVICE
+  static real64 apply( OpCode const op, real64 const a );
+
+  /**
+   * @brief Apply a binary operation.
+   * @param op the operation
+   * @param a the first operand
+   * @param b the second operand
+   * @return the result
+   */
+  GEOS_HOST_DEVICE
+  static real64 apply( OpCode const op, real64 const a, real64 const b );
+
+  /**
+   * @brief @return the number of operands of an operation
+   * @param op the operation
+   */
+  GEOS_HOST_DEVICE
+  static integer numOperands( OpCode const op )
+  {
+    return ( op == OpCode::Constant || op == OpCode::Variable ) ? 0 : ( ( op == OpCode::Negate || op >= OpCode::Sin ) ? 1 : 2 );
+  }
+
+  /**
+   * @class KernelWrapper
+   * @brief Evaluation of the bytecode.
+   */
+  class KernelWrapper
+  {
+public:
+
+    /// @cond DO_NOT_DOCUMENT
+    KernelWrapper() = default;
+    KernelWrapper( KernelWrapper const & ) = default;
+    KernelWrapper( KernelWrapper && ) = default;
+    KernelWrapper & operator=( KernelWrapper const & ) = default;
+    KernelWrapper & operator=( KernelWrapper && ) = default;
+    /// @endcond
+
+    /**
+     * @brief Evaluate the expression at a point.
+     * @param input the values of the variables
+     * @return the value of the expression
+     */
+    GEOS_HOST_DEVICE
+    real64 compute( real64 const * const input ) const
+    {
+      real64 result;
+      compute< 1 >( input, 0, &result );
+      return result;
+    }
+
+    /**
+     * @brief Evaluate the expression at a batch of points.
+     * @tparam BATCH_SIZE the number of points
+     * @param input the values of the variables, the values of point b starting at input[b * inputStride]
+     * @param inputStride the distance between the values of two consecutive points
+     * @param result the values of the expression at the points
+     */
+    template< integer BATCH_SIZE >
+    GEOS_HOST_DEVICE
+    void compute( real64 const * const input,
+                  localIndex const inputStride,
+                  real64 * const result ) const;
+
+    /**
+     * @brief Move the KernelWrapper to the given execution space, optionally touching it.
+     * @param space the space to move the KernelWrapper to
+     * @param touch whether the KernelWrapper should be touched in the new space or not
+     */
+    void move( LvArray::MemorySpace const space, bool const touch )
+    {
+      m_instructions.move( space, touch );
+    }
+
+private:
+
+    friend class SymbolicExpression; // Allow only parent class to construct the wrapper
+
+    /**
+     * @brief Constructor.
+     * @param instructions the bytecode
+     */
+    explicit KernelWrapper( arrayView1d< Instruction const > const & instructions ):
+      m_instructions( instructions )
+    {}
+
+    /// The bytecode
+    arrayView1d< Instruction const > m_instructions;
+  };
+
+  /**
+   * @brief Compile an expression.
+   * @param expression the expression
+   * @param variableNames the names of the variables, in the order of the inputs of the evaluation
+   * @param errorMessage the description of the error if the compilation failed
+   * @return true if the expression has been compiled
+   */
+  bool compile( string const & expression,
+                arrayView1d< string const > const & variableNames,
+                string & errorMessage );
+
+  /**
+   * @brief @return whether an expression has been compiled
+   */
+  bool isCompiled() const
+  { return !m_instructions.empty(); }
+
+  /**
+   * @brief @return the bytecode
+   */
+  arrayView1d< Instruction const > instructions() const
+  { return m_instructions.toViewConst(); }
+
+  /**
+   * @brief Create an instance of the kernel wrapper.
+   * @return the kernel wrapper
+   */
+  KernelWrapper createKernelWrapper() const
+  { return KernelWrapper( m_instructions.toViewConst() ); }
+
+private:
+
+  /// The bytecode
+  array1d< Instruction > m_instructions;
+};
+
+GEOS_HOST_DEVICE
+inline real64 SymbolicExpression::apply( OpCode const op, real64 const a )
+{
+  switch( op )
+  {
+    case OpCode::Negate: return -a;
+    case OpCode::Sin: return std::sin( a );
+    case OpCode::Cos: return std::cos( a );
+    case OpCode::Tan: return std::tan( a );
+    case OpCode::Asin: return std::asin( a );
+    case OpCode::Acos: return std::acos( a );
+    case OpCode::Atan: return std::atan( a );
+    case OpCode::Sinh: return std::sinh( a );
+    case OpCode::Cosh: return std::cosh( a );
+    case OpCode::Tanh: return std::tanh( a );
+    case OpCode::Sqrt: return std::sqrt( a );
+    case OpCode::Exp: return std::exp( a );
+    case OpCode::Log: return std::log( a );
+    case OpCode::Log10: return std::log10( a );
+    case OpCode::Abs: return std::fabs( a );
+    case OpCode::Floor: return std::floor( a );
+    case OpCode::Ceil: return std::ceil( a );
+    case OpCode::Round: return std::round( a );
+    case OpCode::Trunc: return std::trunc( a );
+    default: return 0.0;
+  }
+}
+
+GEOS_HOST_DEVICE
+inline real64 SymbolicExpression::apply( OpCode const op, real64 const a, real64 const b )
+{
+  switch( op )
+  {
+    case OpCode::Add: return a + b;
+    case OpCode::Subtract: return a - b;
+    case OpCode::Multiply: return a * b;
+    case OpCode::Divide: return a / b;
+    case OpCode::Modulo: return std::fmod( a, b );
+    case OpCode::Power: return std::pow( a, b );
+    case OpCode::Less: return a < b ? 1.0 : 0.0;
+    case OpCode::LessEqual: return a <= b ? 1.0 : 0.0;
+    case OpCode::Greater: return a > b ? 1.0 : 0.0;
+    case OpCode::GreaterEqual: return a >= b ? 1.0 : 0.0;
+    case OpCode::Equal: return a == b ? 1.0 : 0.0;
+    case OpCode::NotEqual: return a != b ? 1.0 : 0.0;
+    case OpCode::Min: return a < b ? a : b;
+    case OpCode::Max: return a > b ? a : b;
+    case OpCode::Atan2: return std::atan2( a, b );
+    case OpCode::Hypot: return std::hypot( a, b );
+    default: return 0.0;
+  }
+}
+
+template< integer BATCH_SIZE >
+GEOS_HOST_DEVICE
+inline void SymbolicExpression::KernelWrapper::compute( real64 const * const input,
+                                                        localIndex const inputStride,
+                                                        real64 * const result ) const
+{
+  // the compilation guarantees that the stack never exceeds maxStackSize
+  real64 stack[maxStackSize][BATCH_SIZE];
+  integer top = -1;
+
+  for( localIndex i = 0; i < m_instructions.size(); ++i )
+  {
+    Instruction const & instruction = m_instructions[i];
+    switch( numOperands( instruction.op ) )
+    {
+      case 0:
+      {
+        ++top;
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          stack[top][b] = ( instruction.op == OpCode::Constant ) ? instruction.value : input[b * inputStride + instruction.variable];
+        }
+        break;
+      }
+      case 1:
+      {
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          stack[top][b] = apply( instruction.op, stack[top][b] );
+        }
+        break;
+      }
+      default:
+      {
+        --top;
+        for( integer b = 0; b < BATCH_SIZE; ++b )
+        {
+          stack[top][b] = apply( instruction.op, stack[top][b], stack[top+1][b] );
+        }
+        break;
+      }
+    }
+  }
+
+  for( integer b = 0; b < BATCH_SIZE; ++b )
+  {
+    result[b] = stack[0][b];
+  }
+}
+
+} /* namespace geos */
+
+#endif /* GEOS_FUNCTIONS_SYMBOLICEXPRESSION_HPP_ */
@@ -124,6 +124,62 @@ void SymbolicFunction::initializeFunction()
     return parserExpression.compile( parserContext, m_expression.c_str(), mathpresso::kNoOptions, &outputLog );
   }();
   GEOS_ERROR_IF( err != mathpresso::kErrorOk, "MathPresso JIT Compiler Error" );
+
+  // Compile the bytecode used in the batch evaluations, the JIT being used for the expressions it does not support
+  string errorMessage;
+  if( !m_compiledExpression.compile( m_expression, m_variableNames.toViewConst(), errorMessage ) )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "{} '{}': evaluated on host only ({})", catalogName(), getName(), errorMessage ) );
+  }
+}
+
+void SymbolicFunction::evaluate( dataRepository::Group const & group,
+                                 real64 const time,
+                                 SortedArrayView< localIndex const > const & set,
+                                 arrayView1d< real64 > const & result ) const
+{
+  if( !m_compiledExpression.isCompiled() )
+  {
+    FunctionBase::evaluateT< SymbolicFunction >( group, time, set, result );
+    return;
+  }
+
+  GEOS_ERROR_IF_NE_MSG( result.size(), set.size(),
+                        getDataContext() << ": To apply a function to a set, the size of the result and set must match" );
+
+  InputAccessor const inputs = createInputAccessor( group, time, parallelDeviceMemorySpace );
+  SymbolicExpression::KernelWrapper const expression = m_compiledExpression.createKernelWrapper();
+
+#if defined( GEOS_USE_DEVICE )
+  forAll< parallelDevicePolicy<> >( set.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    real64 input[MAX_VARS]{};
+    inputs.gather( set[i], input );
+    result[i] = expression.compute( input );
+  } );
+#else
+  // each instruction is applied to a batch of points
+  localIndex const numPoints = set.size();
+  localIndex const numBatches = ( numPoints + batchSize - 1 ) / batchSize;
+  forAll< parallelHostPolicy >( numBatches, [=]( localIndex const batch )
+  {
+    localIndex const first = batch * batchSize;
+    localIndex const size = LvArray::math::min( localIndex( batchSize ), numPoints - first );
+
+    // the points missing in the last batch are replaced by the first one
+    real64 input[batchSize][MAX_VARS]{};
+    real64 values[batchSize];
+    for( integer b = 0; b < batchSize; ++b )
+    {
+      inputs.gather( set[first + ( b < size ? b : 0 )], input[b] );
+    }
+    expression.compute< batchSize >( &input[0][0], MAX_VARS, values );
+    for( integer b = 0; b < size; ++b )
+    {
+      result[first + b] = values[b];
+    }
+  } );
+#endif
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, SymbolicFunction, string const &, Group * const )
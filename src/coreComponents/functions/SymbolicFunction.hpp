@@ -18,6 +18,8 @@
 
 #include "FunctionBase.hpp"
 
+#include "functions/SymbolicExpression.hpp"
+
 #include <mathpresso/mathpresso.h>
 
 namespace geos
@@ -57,14 +59,14 @@ public:
    * @param time current time
    * @param set the subset of nodes to apply the function to
    * @param result an array to hold the results of the function
+   *
+   * If the expression is supported by SymbolicExpression, the function is evaluated from its
+   * bytecode on device (or on host by batches of points), otherwise with the JIT on host.
    */
-  inline void evaluate( dataRepository::Group const & group,
-                        real64 const time,
-                        SortedArrayView< localIndex const > const & set,
-                        arrayView1d< real64 > const & result ) const override final
-  {
-    FunctionBase::evaluateT< SymbolicFunction >( group, time, set, result );
-  }
+  void evaluate( dataRepository::Group const & group,
+                 real64 const time,
+                 SortedArrayView< localIndex const > const & set,
+                 arrayView1d< real64 > const & result ) const override final;
 
   /**
    * @brief Method to evaluate a function
@@ -89,9 +91,16 @@ public:
    */
   void setSymbolicExpression( string expression ) { m_expression = std::move( expression ); }
 
-
+  /**
+   * @brief @return the compiled expression, which may be empty if the expression is only supported by the JIT
+   */
+  SymbolicExpression const & getCompiledExpression() const { return m_compiledExpression; }
 
 private:
+
+  /// Number of points evaluated at once on host
+  static constexpr integer batchSize = 8;
+
   // Symbolic math driver objects
   mathpresso::Context parserContext;
   mathpresso::Expression parserExpression;
@@ -101,6 +110,9 @@ private:
 
   /// Symbolic expression
   string m_expression;
+
+  /// Bytecode of the expression, evaluated in kernels
+  SymbolicExpression m_compiledExpression;
 };
 
 
@@ -21,6 +21,7 @@
 #include "functions/TableFunction.hpp"
 #include "functions/MultivariableTableFunction.hpp"
 #include "functions/MultivariableTableFunctionKernels.hpp"
+#include "functions/SymbolicExpression.hpp"
 //#include "mainInterface/GeosxState.hpp"
 
 #ifdef GEOS_USE_MATHPRESSO
@@ -540,6 +541,96 @@ TEST( FunctionTests, 4DTable_derivatives )
   }
 }
 
+void evaluateSymbolicExpression( SymbolicExpression const & expression,
+                                 arrayView2d< real64 const > const & inputs,
+                                 arrayView1d< real64 > const & scalarValues,
+                                 arrayView1d< real64 > const & batchValues )
+{
+  SymbolicExpression::KernelWrapper const kernelWrapper = expression.createKernelWrapper();
+  localIndex const numVars = inputs.size( 1 );
+
+  forAll< parallelDevicePolicy<> >( inputs.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    scalarValues[i] = kernelWrapper.compute( &inputs( i, 0 ) );
+  } );
+
+  // batches of 4 points, the number of points being a multiple of 4
+  forAll< parallelDevicePolicy<> >( inputs.size( 0 ) / 4, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    kernelWrapper.compute< 4 >( &inputs( 4 * i, 0 ), numVars, &batchValues[4 * i] );
+  } );
+}
+
+TEST( FunctionTests, SymbolicExpression )
+{
+  string_array variableNames;
+  variableNames.emplace_back( "x" );
+  variableNames.emplace_back( "y" );
+  variableNames.emplace_back( "time" );
+
+  localIndex const numPoints = 16;
+  array2d< real64 > inputs( numPoints, 3 );
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( 0.1, 2.0 );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    for( integer j = 0; j < 3; ++j )
+    {
+      inputs( i, j ) = distribution( generator );
+    }
+  }
+
+  auto const checkExpression = [&]( string const & text, auto const & reference )
+  {
+    SymbolicExpression expression;
+    string errorMessage;
+    ASSERT_TRUE( expression.compile( text, variableNames.toViewConst(), errorMessage ) ) << errorMessage;
+
+    array1d< real64 > scalarValues( numPoints );
+    array1d< real64 > batchValues( numPoints );
+    evaluateSymbolicExpression( expression, inputs.toViewConst(), scalarValues.toView(), batchValues.toView() );
+    scalarValues.move( hostMemorySpace, false );
+    batchValues.move( hostMemorySpace, false );
+    inputs.move( hostMemorySpace, false );
+
+    for( localIndex i = 0; i < numPoints; ++i )
+    {
+      real64 const expected = reference( inputs( i, 0 ), inputs( i, 1 ), inputs( i, 2 ) );
+      EXPECT_NEAR( scalarValues[i], expected, 1e-12 * ( 1.0 + std::fabs( expected ) ) ) << text;
+      EXPECT_EQ( scalarValues[i], batchValues[i] ) << text;
+    }
+  };
+
+  checkExpression( "1.0+(2.0*x)-(3.0*y*y)+(5.0*time*time*time)",
+                   []( real64 x, real64 y, real64 t ) { return 1.0+(2.0*x)-(3.0*y*y)+(5.0*t*t*t); } );
+  checkExpression( "-x^2 + 2^-y - x/y % 0.3",
+                   []( real64 x, real64 y, real64 ) { return -std::pow( x, 2 ) + std::pow( 2, -y ) - std::fmod( x/y, 0.3 ); } );
+  checkExpression( "sin(PI*x)*exp(-time) + sqrt(abs(log(y))) + max(x, min(y, 1)) + atan2(y, x)",
+                   []( real64 x, real64 y, real64 t )
+  {
+    return std::sin( M_PI*x )*std::exp( -t ) + std::sqrt( std::fabs( std::log( y ) ) ) + std::max( x, std::min( y, 1.0 ) ) + std::atan2( y, x );
+  } );
+  checkExpression( "(x < y) * 10 + (x >= 1) + (time == time) - (y != y)",
+                   []( real64 x, real64 y, real64 ) { return ( x < y ) * 10.0 + ( x >= 1.0 ) + 1.0; } );
+  checkExpression( "pow(x, 1.5) * 1e-3 + floor(10*y) + ceil(time) + .5",
+                   []( real64 x, real64 y, real64 t ) { return std::pow( x, 1.5 ) * 1e-3 + std::floor( 10*y ) + std::ceil( t ) + 0.5; } );
+
+  // operations on constants are folded
+  SymbolicExpression expression;
+  string errorMessage;
+  ASSERT_TRUE( expression.compile( "2*PI*(1+E) + cos(0) * x", variableNames.toViewConst(), errorMessage ) );
+  EXPECT_EQ( expression.instructions().size(), 5 );
+
+  // unsupported expressions are reported
+  EXPECT_FALSE( expression.compile( "x + z", variableNames.toViewConst(), errorMessage ) );
+  EXPECT_FALSE( expression.isCompiled() );
+  EXPECT_FALSE( expression.compile( "x + (y", variableNames.toViewConst(), errorMessage ) );
+  EXPECT_FALSE( expression.compile( "x y", variableNames.toViewConst(), errorMessage ) );
+  EXPECT_FALSE( expression.compile( "atan2(x)", variableNames.toViewConst(), errorMessage ) );
+  EXPECT_FALSE( expression.compile( "a = x; a * 2", variableNames.toViewConst(), errorMessage ) );
+  EXPECT_FALSE( expression.compile( "", variableNames.toViewConst(), errorMessage ) );
+}
+
 #ifdef GEOS_USE_MATHPRESSO
 
 TEST( FunctionTests, 4DTable_symbolic )
@@ -614,6 +705,7 @@ TEST( FunctionTests, 4DTable_symbolic )
 
   // Evaluate the function in batch mode
   table_e.evaluate( testGroup, 0.0, set.toView(), output );
+  output.move( hostMemorySpace, false );
 
   // Compare results
   for( localIndex jj=0; jj<Ntest; ++jj )
@@ -643,14 +735,20 @@ void testMutivariableFunction( MultivariableTableFunction & function,
   arrayView2d< real64 > evaluatedDerivativesView = evaluatedDerivatives.toView();
 
 
-  MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS > kernel( function.getAxisMinimums(),
-                                                                      function.getAxisMaximums(),
-                                                                      function.getAxisPoints(),
-                                                                      function.getAxisSteps(),
-                                                                      function.getAxisStepInvs(),
-                                                                      function.getAxisHypercubeMults(),
-                                                                      function.getHypercubeData()
-                                                                      );
+  // in adaptive mode, the visited hypercubes must be filled before the interpolation
+  if( function.getStorageMode() == MultivariableTableFunction::StorageMode::Adaptive )
+  {
+    MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS > const indexKernel( function );
+    array1d< globalIndex > hypercubeIndices( numElems );
+    inputs.move( hostMemorySpace, false );
+    for( localIndex elemIndex = 0; elemIndex < numElems; ++elemIndex )
+    {
+      hypercubeIndices[elemIndex] = indexKernel.getHypercubeIndex( &inputs[elemIndex * NUM_DIMS] );
+    }
+    function.fillHypercubes( hypercubeIndices.toViewConst() );
+  }
+
+  MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS > kernel( function );
   // Test values evaluation first
   forAll< geos::parallelDevicePolicy< > >( numElems, [=] GEOS_HOST_DEVICE
                                              ( localIndex const elemIndex )
@@ -825,6 +923,105 @@ TEST( FunctionTests, 2DMultivariableTable )
   testMutivariableFunction< nDims, nOps >( table_g, testCoordinates, testExpectedValues, testExpectedDerivatives, 1e-2, 2e-2 );
 }
 
+TEST( FunctionTests, 2DMultivariableTableStorageModes )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  localIndex constexpr nDims = 2;
+  localIndex constexpr nOps = 3;
+  localIndex const nTest = 3;
+
+  // Setup table
+  array1d< real64 > axisMins( nDims );
+  array1d< real64 > axisMaxs( nDims );
+  integer_array axisPoints( nDims );
+  axisMins[0] = 1;
+  axisMins[1] = 0;
+  axisMaxs[0] = 2;
+  axisMaxs[1] = 1;
+  axisPoints[0] = 201;
+  axisPoints[1] = 101;
+
+  auto const evaluateOperators = []( real64 const * const coordinates, real64 * const values )
+  {
+    values[0] = operator1( coordinates[0], coordinates[1] );
+    values[1] = operator2( coordinates[0], coordinates[1] );
+    values[2] = operator3( coordinates[0], coordinates[1] );
+  };
+
+  array1d< real64 > values( axisPoints[0] * axisPoints[1] * nOps );
+  for( auto i = 0; i < axisPoints[0]; i++ )
+    for( auto j = 0; j < axisPoints[1]; j++ )
+    {
+      real64 const coordinates[nDims] = { axisMins[0] + i * (axisMaxs[0] - axisMins[0]) / (axisPoints[0] - 1),
+                                          axisMins[1] + j * (axisMaxs[1] - axisMins[1]) / (axisPoints[1] - 1) };
+      evaluateOperators( coordinates, &values[( i * axisPoints[1] + j ) * nOps] );
+    }
+
+  // Setup testing coordinates, expected values
+  array1d< real64 > testCoordinates( nTest * nDims );
+  testCoordinates[0] = 1.2334;
+  testCoordinates[1] = 0.1232;
+  testCoordinates[2] = 1.7342;
+  testCoordinates[3] = 0.2454;
+  testCoordinates[4] = 2.0;
+  testCoordinates[5] = 0.7745;
+
+  array1d< real64 > testExpectedValues( nTest * nOps );
+  array1d< real64 > testExpectedDerivatives( nTest * nOps * nDims );
+
+  // the reference is the interpolation with the hypercube storage
+  MultivariableTableFunction & table_ref = dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_ref" ) );
+  table_ref.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+  table_ref.setTableValues( values );
+  table_ref.initializeFunction();
+  EXPECT_EQ( table_ref.numFilledHypercubes(), table_ref.numHypercubes() );
+
+  MultivariableTableFunctionStaticKernel< nDims, nOps > const kernel( table_ref );
+  for( auto i = 0; i < nTest; i++ )
+  {
+    real64 derivatives[nOps][nDims];
+    kernel.compute( &testCoordinates[i * nDims], &testExpectedValues[i * nOps], derivatives );
+    for( auto op = 0; op < nOps; op++ )
+      for( auto dim = 0; dim < nDims; dim++ )
+        testExpectedDerivatives[( i * nOps + op ) * nDims + dim] = derivatives[op][dim];
+  }
+
+  // point storage
+  MultivariableTableFunction & table_point = dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_point" ) );
+  table_point.setStorageMode( MultivariableTableFunction::StorageMode::Point );
+  table_point.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+  table_point.setTableValues( values );
+  table_point.initializeFunction();
+  EXPECT_EQ( table_point.getHypercubeData().size(), 0 );
+  testMutivariableFunction< nDims, nOps >( table_point, testCoordinates, testExpectedValues, testExpectedDerivatives );
+
+  // adaptive storage filled from the table values
+  MultivariableTableFunction & table_adaptive = dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_adaptive" ) );
+  table_adaptive.setStorageMode( MultivariableTableFunction::StorageMode::Adaptive );
+  table_adaptive.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+  table_adaptive.setTableValues( values );
+  table_adaptive.initializeFunction();
+  EXPECT_EQ( table_adaptive.numFilledHypercubes(), 0 );
+  testMutivariableFunction< nDims, nOps >( table_adaptive, testCoordinates, testExpectedValues, testExpectedDerivatives );
+  EXPECT_EQ( table_adaptive.numFilledHypercubes(), nTest );
+
+  // adaptive storage filled from a point evaluator, without table values
+  MultivariableTableFunction & table_evaluator = dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_evaluator" ) );
+  table_evaluator.setStorageMode( MultivariableTableFunction::StorageMode::Adaptive );
+  table_evaluator.setPointEvaluator( evaluateOperators );
+  table_evaluator.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+  table_evaluator.initializeFunction();
+  testMutivariableFunction< nDims, nOps >( table_evaluator, testCoordinates, testExpectedValues, testExpectedDerivatives );
+  EXPECT_EQ( table_evaluator.numFilledHypercubes(), nTest );
+  EXPECT_EQ( table_evaluator.numEvaluatedPoints(), nTest * 4 );
+
+  // visiting the same hypercubes again does not evaluate any point
+  testMutivariableFunction< nDims, nOps >( table_evaluator, testCoordinates, testExpectedValues, testExpectedDerivatives );
+  EXPECT_EQ( table_evaluator.numFilledHypercubes(), nTest );
+  EXPECT_EQ( table_evaluator.numEvaluatedPoints(), nTest * 4 );
+}
+
 TEST( FunctionTests, MultivariableTableFromFile )
 {
   FunctionManager * functionManager = &FunctionManager::getInstance();
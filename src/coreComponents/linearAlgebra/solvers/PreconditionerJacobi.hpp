@@ -46,7 +46,7 @@ public:
    */
   virtual void setup( Matrix const & mat ) override
   {
-    GEOS_LAI_ASSERT( mat.ready() );
+    Base::setup( mat );
     m_diagInv.createWithLocalSize( mat.numLocalRows(), mat.comm() );
     mat.extractDiagonal( m_diagInv );
     m_diagInv.reciprocal();
@@ -65,6 +65,7 @@ public:
    */
   virtual void clear() override
   {
+    Base::clear();
     m_diagInv.reset();
   }
 
@@ -73,6 +73,7 @@ struct LinearSolverParameters
   integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
   bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
   integer stopIfError = 1;  ///< Whether to stop the simulation if the linear solver reports an error
+  integer matrixFree = 0;   ///< Whether to apply the operator matrix-free instead of assembling it (if supported by the solver)
 
   SolverType solverType = SolverType::direct;          ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
@@ -239,6 +239,40 @@ localIndex ObjectManagerBase::pack( buffer_unit_type * & buffer,
   return this->packImpl< true >( buffer, wrapperNames, packList, recursive, onDevice, events );
 }
 
+std::vector< string > ObjectManagerBase::getWrapperNamesToPack( string_array const & wrapperNames ) const
+{
+  std::set< string > input;
+  std::copy( wrapperNames.begin(), wrapperNames.end(), std::inserter( input, input.end() ) );
+
+  std::set< string > const & exclusion = m_packingExclusionList;
+  std::set< string > const available = mapKeys< std::set >( wrappers() );
+
+  // Checking that all the requested wrappers are available.
+  std::set< string > reqNotAvail;
+  std::set_difference( input.cbegin(), input.cend(), available.cbegin(), available.cend(), std::inserter( reqNotAvail, reqNotAvail.end() ) );
+  if( !reqNotAvail.empty() )
+  {
+    GEOS_ERROR( "Wrapper(s) \"" << stringutilities::join( reqNotAvail, ", " ) << "\" was (were) requested from \"" << getName() << "\" but is (are) not available." );
+  }
+  // From now on all the requested wrappers are guarantied to be available.
+
+  // Discarding the wrappers that are excluded.
+  std::set< string > reqNotExcl;
+  std::set_difference( input.cbegin(), input.cend(), exclusion.cbegin(), exclusion.cend(), std::inserter( reqNotExcl, reqNotExcl.end() ) );
+
+  // Now we build the final list.
+  // No packing by index is allowed if the registered wrapper does not share the size of the owning group.
+  // Hence, the sufficient (but not necessary...) condition on `wrapper.sizedFromParent()`.
+  std::vector< string > reqNotExclAndSized;
+  auto predicate = [this]( string const & wrapperName ) -> bool
+  {
+    return bool( this->getWrapperBase( wrapperName ).sizedFromParent() );
+  };
+  std::copy_if( reqNotExcl.cbegin(), reqNotExcl.cend(), std::back_inserter( reqNotExclAndSized ), predicate );
+
+  return reqNotExclAndSized;
+}
+
 template< bool DO_PACKING >
 localIndex ObjectManagerBase::packImpl( buffer_unit_type * & buffer,
                                         string_array const & wrapperNames,
@@ -257,42 +291,12 @@ localIndex ObjectManagerBase::packImpl( buffer_unit_type * & buffer,
   packedSize += bufferOps::Pack< DO_PACKING >( buffer, numPackedIndices );
   if( numPackedIndices > 0 )
   {
-    std::set< string > input;
-    std::copy( wrapperNames.begin(), wrapperNames.end(), std::inserter( input, input.end() ) );
-
-    std::set< string > const & exclusion = m_packingExclusionList;
-    std::set< string > const available = mapKeys< std::set >( wrappers() );
-
-    // Checking that all the requested wrappers are available.
-    std::set< string > reqNotAvail;
-    std::set_difference( input.cbegin(), input.cend(), available.cbegin(), available.cend(), std::inserter( reqNotAvail, reqNotAvail.end() ) );
-    if( !reqNotAvail.empty() )
-    {
-      GEOS_ERROR( "Wrapper(s) \"" << stringutilities::join( reqNotAvail, ", " ) << "\" was (were) requested from \"" << getName() << "\" but is (are) not available." );
-    }
-    // From now on all the requested wrappers are guarantied to be available.
-
-    // Discarding the wrappers that are excluded.
-    std::set< string > reqNotExcl;
-    std::set_difference( input.cbegin(), input.cend(), exclusion.cbegin(), exclusion.cend(), std::inserter( reqNotExcl, reqNotExcl.end() ) );
-
-    // Now we build the final list.
-    // No packing by index is allowed if the registered wrapper does not share the size of the owning group.
-    // Hence, the sufficient (but not necessary...) condition on `wrapper.sizedFromParent()`.
-    std::vector< string > reqNotExclAndSized;
-    auto predicate = [this]( string const & wrapperName ) -> bool
-    {
-      return bool( this->getWrapperBase( wrapperName ).sizedFromParent() );
-    };
-    std::copy_if( reqNotExcl.cbegin(), reqNotExcl.cend(), std::back_inserter( reqNotExclAndSized ), predicate );
-
     // Extracting the wrappers
     std::vector< WrapperBase const * > wrappers;
-    auto transformer = [this]( string const & wrapperName ) -> WrapperBase const *
+    for( string const & wrapperName : getWrapperNamesToPack( wrapperNames ) )
     {
-      return &this->getWrapperBase( wrapperName );
-    };
-    std::transform( reqNotExclAndSized.cbegin(), reqNotExclAndSized.cend(), std::back_inserter( wrappers ), transformer );
+      wrappers.emplace_back( &this->getWrapperBase( wrapperName ) );
+    }
 
     // Additional refactoring should be done by using `Group::packImpl` that duplicates the following pack code.
     packedSize += bufferOps::Pack< DO_PACKING >( buffer, string( "Wrappers" ) );
@@ -724,6 +728,71 @@ void ObjectManagerBase::excludeWrappersFromPacking( std::set< string > const & w
   m_packingExclusionList.insert( wrapperNames.cbegin(), wrapperNames.cend() );
 }
 
+bool ObjectManagerBase::isFusedPackable( string_array const & wrapperNames ) const
+{
+  bufferOps::FusedPackLayout layout;
+  for( string const & wrapperName : getWrapperNamesToPack( wrapperNames ) )
+  {
+    if( !getWrapperBase( wrapperName ).getFusedPackLayout( layout ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+localIndex ObjectManagerBase::fusedPackSize( string_array const & wrapperNames,
+                                             arrayView1d< localIndex const > const & packList ) const
+{
+  localIndex packedSize = 0;
+  for( string const & wrapperName : getWrapperNamesToPack( wrapperNames ) )
+  {
+    bufferOps::FusedPackLayout layout;
+    getWrapperBase( wrapperName ).getFusedPackLayout( layout );
+    packedSize += bufferOps::FusedPackTable::segmentSize( layout, packList.size() );
+  }
+  return packedSize;
+}
+
+localIndex ObjectManagerBase::addFusedPackSegments( bufferOps::FusedPackTable & table,
+                                                    buffer_unit_type * & buffer,
+                                                    string_array const & wrapperNames,
+                                                    arrayView1d< localIndex const > const & packList ) const
+{
+  localIndex packedSize = 0;
+  for( string const & wrapperName : getWrapperNamesToPack( wrapperNames ) )
+  {
+    WrapperBase const & wrapper = getWrapperBase( wrapperName );
+    wrapper.move( parallelDeviceMemorySpace, false );
+
+    bufferOps::FusedPackLayout layout;
+    GEOS_ERROR_IF( !wrapper.getFusedPackLayout( layout ),
+                   "Wrapper " << wrapperName << " of " << getName() << " cannot be packed by the fused device kernels." );
+    packedSize += table.addPackSegment( wrapper.voidPointer(), layout, packList, buffer );
+  }
+  return packedSize;
+}
+
+localIndex ObjectManagerBase::addFusedUnpackSegments( bufferOps::FusedPackTable & table,
+                                                      buffer_unit_type const * & buffer,
+                                                      string_array const & wrapperNames,
+                                                      arrayView1d< localIndex const > const & unpackList )
+{
+  localIndex unpackedSize = 0;
+  for( string const & wrapperName : getWrapperNamesToPack( wrapperNames ) )
+  {
+    WrapperBase & wrapper = getWrapperBase( wrapperName );
+    wrapper.move( parallelDeviceMemorySpace, true );
+
+    bufferOps::FusedPackLayout layout;
+    GEOS_ERROR_IF( !wrapper.getFusedPackLayout( layout ),
+                   "Wrapper " << wrapperName << " of " << getName() << " cannot be unpacked by the fused device kernels." );
+    // the wrapper is not const, only its accessor is
+    unpackedSize += table.addUnpackSegment( const_cast< void * >( wrapper.voidPointer() ), layout, unpackList, buffer );
+  }
+  return unpackedSize;
+}
+
 
 localIndex ObjectManagerBase::getNumberOfGhosts() const
 {
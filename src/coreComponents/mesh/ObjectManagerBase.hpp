@@ -120,6 +120,52 @@ public:
    */
   void excludeWrappersFromPacking( std::set< string > const & wrapperNames );
 
+  /**
+   * @brief Check whether wrappers can be packed by the fused device kernels.
+   * @param wrapperNames The names of the wrappers to pack.
+   * @return @p true if all the wrappers that would be packed have a layout supported by bufferOps::FusedPackTable.
+   */
+  bool isFusedPackable( string_array const & wrapperNames ) const;
+
+  /**
+   * @brief Computes the size of the fused packing of wrappers.
+   * @param wrapperNames The names of the wrappers to pack.
+   * @param packList The elements we want packed.
+   * @return The packed size.
+   */
+  localIndex fusedPackSize( string_array const & wrapperNames,
+                            arrayView1d< localIndex const > const & packList ) const;
+
+  /**
+   * @brief Adds the packing of wrappers to a fused packing table.
+   * @param table The table that will pack the data.
+   * @param buffer The buffer that will receive the packed data, advanced past the packed data.
+   * @param wrapperNames The names of the wrappers to pack.
+   * @param packList The elements we want packed.
+   * @return The packed size.
+   *
+   * The data is only packed by bufferOps::FusedPackTable::pack.
+   */
+  localIndex addFusedPackSegments( bufferOps::FusedPackTable & table,
+                                   buffer_unit_type * & buffer,
+                                   string_array const & wrapperNames,
+                                   arrayView1d< localIndex const > const & packList ) const;
+
+  /**
+   * @brief Adds the unpacking of wrappers to a fused packing table.
+   * @param table The table that will unpack the data.
+   * @param buffer The buffer containing the packed data, advanced past the packed data.
+   * @param wrapperNames The names of the packed wrappers.
+   * @param unpackList The elements to unpack.
+   * @return The unpacked size.
+   *
+   * The data is only unpacked by bufferOps::FusedPackTable::unpack.
+   */
+  localIndex addFusedUnpackSegments( bufferOps::FusedPackTable & table,
+                                     buffer_unit_type const * & buffer,
+                                     string_array const & wrapperNames,
+                                     arrayView1d< localIndex const > const & unpackList );
+
   /**
    * @brief Computes the pack size of the global maps elements in the @ packList.
    * @param packList The element we want packed.
@@ -234,6 +280,13 @@ public:
                                     localIndex_array & packList );
 
 private:
+  /**
+   * @brief Select the wrappers packed by index among requested wrappers.
+   * @param wrapperNames The names of the requested wrappers.
+   * @return The sorted names of the requested wrappers that are not excluded from packing and are sized from this group.
+   */
+  std::vector< string > getWrapperNamesToPack( string_array const & wrapperNames ) const;
+
   /**
    * @brief Concrete implementation of the packing method.
    * @tparam DO_PACKING A template parameter to discriminate between actually packing or only computing the packing size.
@@ -22,6 +22,7 @@
 
 #include "common/DataTypes.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace geos
@@ -541,6 +542,12 @@ static void getElemToNodesRelationInBox( ElementType const elementType,
   }
 }
 
+integer InternalMeshGenerator::getNumElementsPerBox( string const & cellBlockName ) const
+{
+  auto const it = std::find( m_regionNames.begin(), m_regionNames.end(), cellBlockName );
+  return it == m_regionNames.end() ? 0 : m_numElePerBox[ std::distance( m_regionNames.begin(), it ) ];
+}
+
 void InternalMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager, SpatialPartition & partition )
 {
   GEOS_MARK_FUNCTION;
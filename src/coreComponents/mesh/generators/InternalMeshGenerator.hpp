@@ -140,6 +140,25 @@ public:
     GEOS_UNUSED_VAR( nodeSets );
   }
 
+  /**
+   * @brief Get the number of boxes of the structured mesh in each direction.
+   * @return The total number of boxes (i.e. of hexahedral elements) in each direction.
+   * @note The global index of a box is i + nx * ( j + ny * k ).
+   */
+  std::array< globalIndex, 3 > getNumBoxesInDirections() const
+  {
+    return { m_numElemsTotal[0], m_numElemsTotal[1], m_numElemsTotal[2] };
+  }
+
+  /**
+   * @brief Get the number of elements generated in each box of a cell block.
+   * @param[in] cellBlockName The name of the cell block.
+   * @return The number of elements per box, or 0 if the cell block was not generated by this mesh.
+   * @note The global index of an element is the global index of its box times the number of elements per box,
+   *       plus the index of the element in the box.
+   */
+  integer getNumElementsPerBox( string const & cellBlockName ) const;
+
 
 protected:
 
@@ -0,0 +1,814 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VTKLegacySlabReader.cpp
+ */
+
+#include "mesh/generators/VTKLegacySlabReader.hpp"
+
+#include "common/format/StringUtilities.hpp"
+
+#include <vtkByteSwap.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkDataArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+namespace geos
+{
+namespace vtk
+{
+
+namespace
+{
+
+/// Type of the values stored in a legacy file
+struct LegacyType
+{
+  /// Name of the type in the file
+  char const * name;
+  /// Type of the VTK array receiving the values
+  int vtkType;
+  /// Size of one value in the file
+  int diskSize;
+};
+
+/// Types supported by the slab reader. Note that @p vtkIdType values are stored as 32-bit integers.
+LegacyType const legacyTypes[] =
+{
+  { "char", VTK_CHAR, 1 },
+  { "unsigned_char", VTK_UNSIGNED_CHAR, 1 },
+  { "short", VTK_SHORT, 2 },
+  { "unsigned_short", VTK_UNSIGNED_SHORT, 2 },
+  { "int", VTK_INT, 4 },
+  { "unsigned_int", VTK_UNSIGNED_INT, 4 },
+  { "long", VTK_LONG, 8 },
+  { "unsigned_long", VTK_UNSIGNED_LONG, 8 },
+  { "float", VTK_FLOAT, 4 },
+  { "double", VTK_DOUBLE, 8 },
+  { "vtkidtype", VTK_ID_TYPE, 4 },
+  { "vtktypeint8", VTK_TYPE_INT8, 1 },
+  { "vtktypeuint8", VTK_TYPE_UINT8, 1 },
+  { "vtktypeint16", VTK_TYPE_INT16, 2 },
+  { "vtktypeuint16", VTK_TYPE_UINT16, 2 },
+  { "vtktypeint32", VTK_TYPE_INT32, 4 },
+  { "vtktypeuint32", VTK_TYPE_UINT32, 4 },
+  { "vtktypeint64", VTK_TYPE_INT64, 8 },
+  { "vtktypeuint64", VTK_TYPE_UINT64, 8 },
+};
+
+/**
+ * @brief Find a legacy type from its name.
+ * @param[in] name the name of the type (case insensitive)
+ * @return The type, or a null pointer if the type is not supported.
+ */
+LegacyType const * findLegacyType( string const & name )
+{
+  string const lowerName = stringutilities::toLower( name );
+  for( LegacyType const & type : legacyTypes )
+  {
+    if( lowerName == type.name )
+    {
+      return &type;
+    }
+  }
+  return nullptr;
+}
+
+/// Description of a data array stored in the file
+struct ArraySection
+{
+  /// Name of the array
+  string name;
+  /// Whether the array is attached to the points (or to the cells)
+  bool onPoints = false;
+  /// Whether the array holds the global ids
+  bool isGlobalIds = false;
+  /// Type of the VTK array receiving the values
+  int vtkType = VTK_VOID;
+  /// Size of one value in the file
+  int diskSize = 0;
+  /// Number of components
+  int numComponents = 0;
+  /// Position of the first value in the file
+  std::int64_t offset = 0;
+};
+
+/// Position of the sections of the file
+struct FileLayout
+{
+  std::int64_t numPoints = -1;
+  int pointsDiskSize = 0;
+  std::int64_t pointsOffset = -1;
+
+  std::int64_t numCells = -1;
+  int offsetsDiskSize = 0;
+  std::int64_t offsetsOffset = -1;
+  std::int64_t connectivitySize = 0;
+  int connectivityDiskSize = 0;
+  std::int64_t connectivityOffset = -1;
+  std::int64_t typesOffset = -1;
+
+  std::vector< ArraySection > arrays;
+
+  /**
+   * @brief Check that all the mandatory sections were found.
+   * @return @p true if the layout is complete.
+   */
+  bool isComplete() const
+  {
+    return pointsOffset >= 0 && offsetsOffset >= 0 && connectivityOffset >= 0 && typesOffset >= 0;
+  }
+};
+
+string serializeLayout( FileLayout const & layout )
+{
+  std::ostringstream oss;
+  oss << layout.numPoints << ' ' << layout.pointsDiskSize << ' ' << layout.pointsOffset << ' '
+      << layout.numCells << ' ' << layout.offsetsDiskSize << ' ' << layout.offsetsOffset << ' '
+      << layout.connectivitySize << ' ' << layout.connectivityDiskSize << ' ' << layout.connectivityOffset << ' '
+      << layout.typesOffset << ' ' << layout.arrays.size();
+  for( ArraySection const & array : layout.arrays )
+  {
+    oss << ' ' << array.name << ' ' << array.onPoints << ' ' << array.isGlobalIds << ' ' << array.vtkType << ' '
+        << array.diskSize << ' ' << array.numComponents << ' ' << array.offset;
+  }
+  return oss.str();
+}
+
+FileLayout deserializeLayout( string const & str )
+{
+  FileLayout layout;
+  std::istringstream iss( str );
+  std::size_t numArrays = 0;
+  iss >> layout.numPoints >> layout.pointsDiskSize >> layout.pointsOffset
+  >> layout.numCells >> layout.offsetsDiskSize >> layout.offsetsOffset
+  >> layout.connectivitySize >> layout.connectivityDiskSize >> layout.connectivityOffset
+  >> layout.typesOffset >> numArrays;
+  layout.arrays.resize( numArrays );
+  for( ArraySection & array : layout.arrays )
+  {
+    iss >> array.name >> array.onPoints >> array.isGlobalIds >> array.vtkType
+    >> array.diskSize >> array.numComponents >> array.offset;
+  }
+  return layout;
+}
+
+/**
+ * @brief Read the next non-empty line of the file and split it.
+ * @param[in] is the file stream
+ * @return The tokens of the line, empty at the end of the file.
+ */
+std::vector< string > nextTokens( std::istream & is )
+{
+  string line;
+  while( std::getline( is, line ) )
+  {
+    std::vector< string > tokens = stringutilities::tokenizeBySpaces< std::vector >( line );
+    if( !tokens.empty() )
+    {
+      tokens[0] = stringutilities::toLower( tokens[0] );
+      return tokens;
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief Scan the structure of a legacy file, skipping over the binary blocks.
+ * @param[in] filePath the path of the file
+ * @return The layout of the file, if it can be read in slabs.
+ */
+std::optional< FileLayout > scanLayout( Path const & filePath )
+{
+  std::ifstream is( filePath, std::ios::binary );
+  GEOS_THROW_IF( !is, GEOS_FMT( "Could not open mesh file {}", filePath ), InputError );
+
+  // Header: version, title, and format
+  {
+    string versionLine, title, format;
+    std::getline( is, versionLine );
+    std::getline( is, title );
+    std::getline( is, format );
+    std::vector< string > const versionTokens = stringutilities::tokenizeBySpaces< std::vector >( versionLine );
+    if( versionTokens.empty() || std::stoi( versionTokens.back() ) < 5 ||
+        stringutilities::toLower( string( stringutilities::trimSpaces( format ) ) ) != "binary" )
+    {
+      return std::nullopt;
+    }
+  }
+
+  FileLayout layout;
+  std::int64_t attributeSize = 0;
+  bool attributeOnPoints = false;
+  bool inAttributes = false;
+
+  auto const skipBlock = [&]( std::int64_t const numValues, int const diskSize )
+  {
+    std::int64_t const start = is.tellg();
+    is.seekg( numValues * diskSize, std::ios::cur );
+    return start;
+  };
+
+  auto const addArray = [&]( string const & name, string const & typeName, int const numComponents, bool const isGlobalIds )
+  {
+    LegacyType const * const type = findLegacyType( typeName );
+    if( type == nullptr || numComponents <= 0 )
+    {
+      return false;
+    }
+    ArraySection array;
+    array.name = name;
+    array.onPoints = attributeOnPoints;
+    array.isGlobalIds = isGlobalIds;
+    array.vtkType = type->vtkType;
+    array.diskSize = type->diskSize;
+    array.numComponents = numComponents;
+    array.offset = skipBlock( attributeSize * numComponents, type->diskSize );
+    layout.arrays.push_back( array );
+    return true;
+  };
+
+  for( std::vector< string > tokens = nextTokens( is ); !tokens.empty(); tokens = nextTokens( is ) )
+  {
+    string const & keyword = tokens[0];
+    bool valid = true;
+    if( keyword == "dataset" )
+    {
+      valid = tokens.size() == 2 && stringutilities::toLower( tokens[1] ) == "unstructured_grid";
+    }
+    else if( keyword == "points" && tokens.size() == 3 )
+    {
+      LegacyType const * const type = findLegacyType( tokens[2] );
+      valid = type != nullptr && ( type->vtkType == VTK_FLOAT || type->vtkType == VTK_DOUBLE );
+      if( valid )
+      {
+        layout.numPoints = std::stoll( tokens[1] );
+        layout.pointsDiskSize = type->diskSize;
+        layout.pointsOffset = skipBlock( 3 * layout.numPoints, type->diskSize );
+      }
+    }
+    else if( keyword == "cells" && tokens.size() == 3 )
+    {
+      layout.numCells = std::stoll( tokens[1] ) - 1;
+      layout.connectivitySize = std::stoll( tokens[2] );
+      std::vector< string > const offsetsTokens = nextTokens( is );
+      LegacyType const * const offsetsType = offsetsTokens.size() == 2 ? findLegacyType( offsetsTokens[1] ) : nullptr;
+      valid = offsetsType != nullptr && offsetsTokens[0] == "offsets";
+      if( valid )
+      {
+        layout.offsetsDiskSize = offsetsType->diskSize;
+        layout.offsetsOffset = skipBlock( layout.numCells + 1, offsetsType->diskSize );
+        std::vector< string > const connectivityTokens = nextTokens( is );
+        LegacyType const * const connectivityType = connectivityTokens.size() == 2 ? findLegacyType( connectivityTokens[1] ) : nullptr;
+        valid = connectivityType != nullptr && connectivityTokens[0] == "connectivity";
+        if( valid )
+        {
+          layout.connectivityDiskSize = connectivityType->diskSize;
+          layout.connectivityOffset = skipBlock( layout.connectivitySize, connectivityType->diskSize );
+        }
+      }
+    }
+    else if( keyword == "cell_types" && tokens.size() == 2 )
+    {
+      valid = std::stoll( tokens[1] ) == layout.numCells;
+      layout.typesOffset = skipBlock( layout.numCells, 4 );
+    }
+    else if( ( keyword == "cell_data" || keyword == "point_data" ) && tokens.size() == 2 )
+    {
+      inAttributes = true;
+      attributeOnPoints = keyword == "point_data";
+      attributeSize = std::stoll( tokens[1] );
+      valid = attributeSize == ( attributeOnPoints ? layout.numPoints : layout.numCells );
+    }
+    else if( keyword == "scalars" && inAttributes && ( tokens.size() == 3 || tokens.size() == 4 ) )
+    {
+      std::vector< string > const lookupTokens = nextTokens( is );
+      valid = !lookupTokens.empty() && lookupTokens[0] == "lookup_table" &&
+              addArray( tokens[1], tokens[2], tokens.size() == 4 ? std::stoi( tokens[3] ) : 1, false );
+    }
+    else if( ( keyword == "vectors" || keyword == "normals" ) && inAttributes && tokens.size() == 3 )
+    {
+      valid = addArray( tokens[1], tokens[2], 3, false );
+    }
+    else if( ( keyword == "tensors" || keyword == "tensors6" ) && inAttributes && tokens.size() == 3 )
+    {
+      valid = addArray( tokens[1], tokens[2], keyword == "tensors" ? 9 : 6, false );
+    }
+    else if( keyword == "texture_coordinates" && inAttributes && tokens.size() == 4 )
+    {
+      valid = addArray( tokens[1], tokens[3], std::stoi( tokens[2] ), false );
+    }
+    else if( ( keyword == "global_ids" || keyword == "pedigree_ids" ) && inAttributes && tokens.size() == 3 )
+    {
+      valid = addArray( tokens[1], tokens[2], 1, keyword == "global_ids" );
+    }
+    else if( keyword == "field" && tokens.size() == 3 )
+    {
+      int const numFieldArrays = std::stoi( tokens[2] );
+      for( int i = 0; i < numFieldArrays && valid; ++i )
+      {
+        std::vector< string > const arrayTokens = nextTokens( is );
+        valid = arrayTokens.size() == 4;
+        if( !valid )
+        {
+          break;
+        }
+        int const numComponents = std::stoi( arrayTokens[1] );
+        std::int64_t const numTuples = std::stoll( arrayTokens[2] );
+        if( inAttributes )
+        {
+          valid = numTuples == attributeSize && addArray( arrayTokens[0], arrayTokens[3], numComponents, false );
+        }
+        else
+        {
+          // Field data attached to the whole dataset are not imported.
+          LegacyType const * const type = findLegacyType( arrayTokens[3] );
+          valid = type != nullptr;
+          if( valid )
+          {
+            skipBlock( numTuples * numComponents, type->diskSize );
+          }
+        }
+      }
+    }
+    else if( keyword == "metadata" )
+    {
+      // The metadata block ends with an empty line.
+      string line;
+      while( std::getline( is, line ) && !stringutilities::trimSpaces( line ).empty() )
+      {}
+    }
+    else
+    {
+      valid = false;
+    }
+
+    if( !valid || !is )
+    {
+      return std::nullopt;
+    }
+  }
+
+  if( !layout.isComplete() )
+  {
+    return std::nullopt;
+  }
+  return layout;
+}
+
+/**
+ * @brief Convert a range of big endian values to the host byte order.
+ * @param[inout] data the values
+ * @param[in] numValues the number of values
+ * @param[in] diskSize the size of one value
+ */
+void swapFromBigEndian( char * const data, std::size_t const numValues, int const diskSize )
+{
+  switch( diskSize )
+  {
+    case 2: vtkByteSwap::SwapBERange( reinterpret_cast< vtkTypeInt16 * >( data ), numValues ); break;
+    case 4: vtkByteSwap::SwapBERange( reinterpret_cast< vtkTypeInt32 * >( data ), numValues ); break;
+    case 8: vtkByteSwap::SwapBERange( reinterpret_cast< vtkTypeInt64 * >( data ), numValues ); break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Read a contiguous range of values from the file.
+ * @param[in] is the file stream
+ * @param[in] offset the position of the first value of the section
+ * @param[in] first the index of the first value to read in the section
+ * @param[in] numValues the number of values to read
+ * @param[in] diskSize the size of one value
+ * @return The values, in the host byte order.
+ */
+std::vector< char > readRange( std::istream & is,
+                               std::int64_t const offset,
+                               std::int64_t const first,
+                               std::int64_t const numValues,
+                               int const diskSize )
+{
+  std::vector< char > buffer( numValues * diskSize );
+  is.seekg( offset + first * diskSize );
+  is.read( buffer.data(), LvArray::integerConversion< std::streamsize >( buffer.size() ) );
+  GEOS_THROW_IF( !is, "Failed to read a section of the legacy VTK mesh file", std::runtime_error );
+  swapFromBigEndian( buffer.data(), buffer.size() / diskSize, diskSize );
+  return buffer;
+}
+
+/**
+ * @brief Read a contiguous range of integers from the file.
+ * @param[in] is the file stream
+ * @param[in] offset the position of the first value of the section
+ * @param[in] first the index of the first value to read in the section
+ * @param[in] numValues the number of values to read
+ * @param[in] diskSize the size of one value (4 or 8 bytes)
+ * @return The values.
+ */
+std::vector< vtkIdType > readIds( std::istream & is,
+                                  std::int64_t const offset,
+                                  std::int64_t const first,
+                                  std::int64_t const numValues,
+                                  int const diskSize )
+{
+  std::vector< char > const buffer = readRange( is, offset, first, numValues, diskSize );
+  std::vector< vtkIdType > ids( numValues );
+  for( std::int64_t i = 0; i < numValues; ++i )
+  {
+    if( diskSize == 4 )
+    {
+      vtkTypeInt32 value;
+      std::memcpy( &value, buffer.data() + 4 * i, 4 );
+      ids[i] = value;
+    }
+    else
+    {
+      vtkTypeInt64 value;
+      std::memcpy( &value, buffer.data() + 8 * i, 8 );
+      ids[i] = value;
+    }
+  }
+  return ids;
+}
+
+/**
+ * @brief Copy the values of one tuple, in the host byte order, into a VTK array.
+ * @param[in] src the values
+ * @param[in] section the description of the array
+ * @param[in] tuple the index of the target tuple
+ * @param[inout] array the target array
+ */
+void setTuple( char const * const src,
+               ArraySection const & section,
+               vtkIdType const tuple,
+               vtkDataArray & array )
+{
+  if( array.GetDataTypeSize() == section.diskSize )
+  {
+    std::memcpy( array.GetVoidPointer( tuple * section.numComponents ), src, section.numComponents * section.diskSize );
+  }
+  else
+  {
+    // Only vtkIdType values have a different size on disk (32 bits) and in memory.
+    for( int c = 0; c < section.numComponents; ++c )
+    {
+      vtkTypeInt32 value;
+      std::memcpy( &value, src + 4 * c, 4 );
+      array.SetComponent( tuple, c, value );
+    }
+  }
+}
+
+/**
+ * @brief Allocate a VTK array for a section of the file.
+ * @param[in] section the description of the array
+ * @param[in] numTuples the number of local tuples
+ * @return The array.
+ */
+vtkSmartPointer< vtkDataArray > createArray( ArraySection const & section,
+                                             vtkIdType const numTuples )
+{
+  vtkSmartPointer< vtkDataArray > array = vtkSmartPointer< vtkDataArray >::Take( vtkDataArray::CreateDataArray( section.vtkType ) );
+  array->SetName( section.name.c_str() );
+  array->SetNumberOfComponents( section.numComponents );
+  array->SetNumberOfTuples( numTuples );
+  return array;
+}
+
+/**
+ * @brief Build the global ids array expected by GEOS.
+ * @param[in] fileIds the global ids found in the file, if any
+ * @param[in] defaultIds the ids to use when the file does not provide them (only allowed when useGlobalIds <= 0)
+ * @return The global ids array.
+ */
+vtkSmartPointer< vtkIdTypeArray > buildGlobalIds( vtkDataArray * const fileIds,
+                                                  std::vector< vtkIdType > const & defaultIds )
+{
+  vtkSmartPointer< vtkIdTypeArray > globalIds = vtkSmartPointer< vtkIdTypeArray >::New();
+  globalIds->SetName( fileIds != nullptr ? fileIds->GetName() : "GlobalIds" );
+  globalIds->SetNumberOfTuples( LvArray::integerConversion< vtkIdType >( defaultIds.size() ) );
+  for( std::size_t i = 0; i < defaultIds.size(); ++i )
+  {
+    vtkIdType const index = LvArray::integerConversion< vtkIdType >( i );
+    globalIds->SetValue( index, fileIds != nullptr ? static_cast< vtkIdType >( fileIds->GetTuple1( index ) ) : defaultIds[i] );
+  }
+  return globalIds;
+}
+
+/**
+ * @brief First index of the slab of a rank when @p numValues values are evenly split.
+ * @param[in] numValues the total number of values
+ * @param[in] rank the rank
+ * @param[in] numRanks the number of ranks
+ * @return The index.
+ */
+std::int64_t slabBegin( std::int64_t const numValues, int const rank, int const numRanks )
+{
+  return numValues / numRanks * rank + std::min< std::int64_t >( rank, numValues % numRanks );
+}
+
+/**
+ * @brief Rank owning the value @p index when @p numValues values are evenly split.
+ * @param[in] index the index of the value
+ * @param[in] numValues the total number of values
+ * @param[in] numRanks the number of ranks
+ * @return The rank.
+ */
+int slabOwner( std::int64_t const index, std::int64_t const numValues, int const numRanks )
+{
+  std::int64_t const quotient = numValues / numRanks;
+  std::int64_t const remainder = numValues % numRanks;
+  std::int64_t const largeSlabsEnd = remainder * ( quotient + 1 );
+  return LvArray::integerConversion< int >( index < largeSlabsEnd
+                                            ? index / ( quotient + 1 )
+                                            : remainder + ( index - largeSlabsEnd ) / quotient );
+}
+
+/**
+ * @brief Compute the displacements from the counts of an all-to-all exchange.
+ * @param[in] counts the counts
+ * @return The displacements.
+ */
+std::vector< int > computeDisplacements( std::vector< int > const & counts )
+{
+  std::vector< int > displacements( counts.size() + 1, 0 );
+  std::partial_sum( counts.begin(), counts.end(), displacements.begin() + 1 );
+  return displacements;
+}
+
+} // namespace
+
+vtkSmartPointer< vtkUnstructuredGrid >
+readLegacyUnstructuredGridSlabs( Path const & filePath,
+                                 int const useGlobalIds,
+                                 MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::commRank( comm );
+  int const numRanks = MpiWrapper::commSize( comm );
+
+  string serializedLayout;
+  if( rank == 0 )
+  {
+    std::optional< FileLayout > const layout = scanLayout( filePath );
+    serializedLayout = layout ? serializeLayout( *layout ) : string();
+  }
+  MpiWrapper::broadcast( serializedLayout, 0, comm );
+  if( serializedLayout.empty() )
+  {
+    return nullptr;
+  }
+  FileLayout const layout = deserializeLayout( serializedLayout );
+
+  // All the ranks share the layout, and throw together.
+  auto const hasGlobalIds = [&]( bool const onPoints )
+  {
+    return std::any_of( layout.arrays.begin(), layout.arrays.end(), [&]( ArraySection const & section )
+    {
+      return section.isGlobalIds && section.onPoints == onPoints;
+    } );
+  };
+  GEOS_THROW_IF( useGlobalIds > 0 && !( hasGlobalIds( true ) && hasGlobalIds( false ) ),
+                 GEOS_FMT( "Global IDs strictly required (useGlobalIds > 0) but unavailable in mesh file {}. "
+                           "Set useGlobalIds to 0 to build them automatically.", filePath ),
+                 InputError );
+
+  std::ifstream is( filePath, std::ios::binary );
+  GEOS_THROW_IF( !is, GEOS_FMT( "Could not open mesh file {}", filePath ), InputError );
+
+  // Step 1: read the slab of cells.
+  std::int64_t const firstCell = slabBegin( layout.numCells, rank, numRanks );
+  std::int64_t const numLocalCells = slabBegin( layout.numCells, rank + 1, numRanks ) - firstCell;
+
+  std::vector< vtkIdType > const offsets = readIds( is, layout.offsetsOffset, firstCell, numLocalCells + 1, layout.offsetsDiskSize );
+  std::vector< vtkIdType > connectivity = readIds( is, layout.connectivityOffset, offsets.front(),
+                                                   offsets.back() - offsets.front(), layout.connectivityDiskSize );
+  std::vector< vtkIdType > const cellTypes = readIds( is, layout.typesOffset, firstCell, numLocalCells, 4 );
+
+  // Polyhedra need their face streams, which are not stored in the cell connectivity.
+  int const hasPolyhedra = std::find( cellTypes.begin(), cellTypes.end(), VTK_POLYHEDRON ) != cellTypes.end();
+  if( MpiWrapper::max( hasPolyhedra, comm ) )
+  {
+    return nullptr;
+  }
+
+  // Step 2: request the points used by the local cells from the ranks owning them.
+  std::vector< vtkIdType > localPoints( connectivity );
+  std::sort( localPoints.begin(), localPoints.end() );
+  localPoints.erase( std::unique( localPoints.begin(), localPoints.end() ), localPoints.end() );
+
+  std::vector< int > sendCounts( numRanks, 0 );
+  for( vtkIdType const pointId : localPoints )
+  {
+    ++sendCounts[ slabOwner( pointId, layout.numPoints, numRanks ) ];
+  }
+  std::vector< int > recvCounts( numRanks, 0 );
+  MpiWrapper::allToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+  std::vector< int > const sendDispls = computeDisplacements( sendCounts );
+  std::vector< int > const recvDispls = computeDisplacements( recvCounts );
+
+  // Since the local points are sorted, the requests are already grouped by owner.
+  std::vector< vtkIdType > requestedPoints( recvDispls.back() );
+  MpiWrapper::allToAllv( localPoints.data(), sendCounts.data(), sendDispls.data(),
+                         requestedPoints.data(), recvCounts.data(), recvDispls.data(), comm );
+
+  // Step 3: read the slab of points and answer the requests.
+  std::vector< ArraySection const * > pointSections;
+  std::vector< ArraySection const * > cellSections;
+  for( ArraySection const & section : layout.arrays )
+  {
+    ( section.onPoints ? pointSections : cellSections ).push_back( &section );
+  }
+
+  int bytesPerPoint = 3 * sizeof( double );
+  for( ArraySection const * section : pointSections )
+  {
+    bytesPerPoint += section->numComponents * section->diskSize;
+  }
+
+  std::vector< char > replies( requestedPoints.size() * bytesPerPoint );
+  {
+    std::int64_t const firstPoint = slabBegin( layout.numPoints, rank, numRanks );
+    std::int64_t const numSlabPoints = slabBegin( layout.numPoints, rank + 1, numRanks ) - firstPoint;
+
+    std::vector< char > const coordinates = readRange( is, layout.pointsOffset, 3 * firstPoint, 3 * numSlabPoints, layout.pointsDiskSize );
+    std::vector< std::vector< char > > pointData;
+    for( ArraySection const * section : pointSections )
+    {
+      pointData.emplace_back( readRange( is, section->offset, firstPoint * section->numComponents,
+                                         numSlabPoints * section->numComponents, section->diskSize ) );
+    }
+
+    char * reply = replies.data();
+    for( vtkIdType const pointId : requestedPoints )
+    {
+      std::int64_t const slabIndex = pointId - firstPoint;
+      GEOS_ASSERT( slabIndex >= 0 && slabIndex < numSlabPoints );
+      for( int dim = 0; dim < 3; ++dim )
+      {
+        double coord;
+        if( layout.pointsDiskSize == sizeof( float ) )
+        {
+          float value;
+          std::memcpy( &value, coordinates.data() + sizeof( float ) * ( 3 * slabIndex + dim ), sizeof( float ) );
+          coord = value;
+        }
+        else
+        {
+          std::memcpy( &coord, coordinates.data() + sizeof( double ) * ( 3 * slabIndex + dim ), sizeof( double ) );
+        }
+        std::memcpy( reply, &coord, sizeof( double ) );
+        reply += sizeof( double );
+      }
+      for( std::size_t iArray = 0; iArray < pointSections.size(); ++iArray )
+      {
+        int const tupleSize = pointSections[iArray]->numComponents * pointSections[iArray]->diskSize;
+        std::memcpy( reply, pointData[iArray].data() + slabIndex * tupleSize, tupleSize );
+        reply += tupleSize;
+      }
+    }
+  }
+
+  std::vector< char > receivedPoints( localPoints.size() * bytesPerPoint );
+  {
+    auto const toBytes = [bytesPerPoint]( std::vector< int > counts )
+    {
+      for( int & count : counts )
+      {
+        count = LvArray::integerConversion< int >( static_cast< std::int64_t >( count ) * bytesPerPoint );
+      }
+      return counts;
+    };
+    std::vector< int > const replyCounts = toBytes( recvCounts );
+    std::vector< int > const replyDispls = toBytes( recvDispls );
+    std::vector< int > const receiveCounts = toBytes( sendCounts );
+    std::vector< int > const receiveDispls = toBytes( sendDispls );
+    MpiWrapper::allToAllv( replies.data(), replyCounts.data(), replyDispls.data(),
+                           receivedPoints.data(), receiveCounts.data(), receiveDispls.data(), comm );
+  }
+
+  // Step 4: assemble the local grid.
+  vtkIdType const numLocalPoints = LvArray::integerConversion< vtkIdType >( localPoints.size() );
+  vtkSmartPointer< vtkUnstructuredGrid > grid = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  {
+    vtkNew< vtkPoints > points;
+    points->SetDataTypeToDouble();
+    points->SetNumberOfPoints( numLocalPoints );
+
+    std::vector< vtkSmartPointer< vtkDataArray > > pointArrays;
+    for( ArraySection const * section : pointSections )
+    {
+      pointArrays.emplace_back( createArray( *section, numLocalPoints ) );
+    }
+
+    char const * src = receivedPoints.data();
+    for( vtkIdType i = 0; i < numLocalPoints; ++i )
+    {
+      double coords[3];
+      std::memcpy( coords, src, 3 * sizeof( double ) );
+      points->SetPoint( i, coords );
+      src += 3 * sizeof( double );
+      for( std::size_t iArray = 0; iArray < pointSections.size(); ++iArray )
+      {
+        setTuple( src, *pointSections[iArray], i, *pointArrays[iArray] );
+        src += pointSections[iArray]->numComponents * pointSections[iArray]->diskSize;
+      }
+    }
+    grid->SetPoints( points );
+
+    vtkDataArray * fileGlobalIds = nullptr;
+    for( std::size_t iArray = 0; iArray < pointSections.size(); ++iArray )
+    {
+      if( pointSections[iArray]->isGlobalIds )
+      {
+        fileGlobalIds = pointArrays[iArray];
+      }
+      else
+      {
+        grid->GetPointData()->AddArray( pointArrays[iArray] );
+      }
+    }
+    grid->GetPointData()->SetGlobalIds( buildGlobalIds( fileGlobalIds, localPoints ) );
+  }
+  {
+    vtkNew< vtkIdTypeArray > cellOffsets;
+    cellOffsets->SetNumberOfTuples( numLocalCells + 1 );
+    for( std::int64_t i = 0; i <= numLocalCells; ++i )
+    {
+      cellOffsets->SetValue( i, offsets[i] - offsets.front() );
+    }
+    vtkNew< vtkIdTypeArray > cellConnectivity;
+    cellConnectivity->SetNumberOfTuples( LvArray::integerConversion< vtkIdType >( connectivity.size() ) );
+    for( std::size_t i = 0; i < connectivity.size(); ++i )
+    {
+      auto const it = std::lower_bound( localPoints.begin(), localPoints.end(), connectivity[i] );
+      cellConnectivity->SetValue( LvArray::integerConversion< vtkIdType >( i ), std::distance( localPoints.begin(), it ) );
+    }
+    vtkNew< vtkCellArray > cells;
+    cells->SetData( cellOffsets, cellConnectivity );
+
+    vtkNew< vtkUnsignedCharArray > types;
+    types->SetNumberOfTuples( numLocalCells );
+    for( std::int64_t i = 0; i < numLocalCells; ++i )
+    {
+      types->SetValue( i, static_cast< unsigned char >( cellTypes[i] ) );
+    }
+    grid->SetCells( types, cells );
+
+    vtkSmartPointer< vtkDataArray > fileGlobalIds;
+    for( ArraySection const * section : cellSections )
+    {
+      std::vector< char > const values = readRange( is, section->offset, firstCell * section->numComponents,
+                                                    numLocalCells * section->numComponents, section->diskSize );
+      vtkSmartPointer< vtkDataArray > array = createArray( *section, numLocalCells );
+      int const tupleSize = section->numComponents * section->diskSize;
+      for( std::int64_t i = 0; i < numLocalCells; ++i )
+      {
+        setTuple( values.data() + i * tupleSize, *section, i, *array );
+      }
+      if( section->isGlobalIds )
+      {
+        fileGlobalIds = array;
+      }
+      else
+      {
+        grid->GetCellData()->AddArray( array );
+      }
+    }
+
+    std::vector< vtkIdType > cellIds( numLocalCells );
+    std::iota( cellIds.begin(), cellIds.end(), firstCell );
+    grid->GetCellData()->SetGlobalIds( buildGlobalIds( fileGlobalIds, cellIds ) );
+  }
+
+  return grid;
+}
+
+} // namespace vtk
+} // namespace geos
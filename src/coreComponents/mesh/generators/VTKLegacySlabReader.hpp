@@ -0,0 +1,61 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VTKLegacySlabReader.hpp
+ */
+
+#ifndef GEOS_MESH_GENERATORS_VTKLEGACYSLABREADER_HPP
+#define GEOS_MESH_GENERATORS_VTKLEGACYSLABREADER_HPP
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+namespace geos
+{
+namespace vtk
+{
+
+/**
+ * @brief Read a binary legacy VTK unstructured grid in parallel.
+ * @param[in] filePath the path of the legacy .vtk file
+ * @param[in] useGlobalIds the @p useGlobalIds parameter of the mesh generator
+ * @param[in] comm the MPI communicator
+ * @return The part of the mesh read by the current rank, or a null pointer on all ranks
+ *         if the file cannot be read this way (see below). In the latter case, nothing was read.
+ *
+ * Each rank reads a contiguous slab of cells (and of their data), and a contiguous slab of points
+ * (and of their data). The points used by the local cells are then fetched from the ranks owning them.
+ * Only the first rank scans the structure of the file, the other ranks directly seek the data they need.
+ *
+ * The global ids of the points and cells are the ones of the @p GLOBAL_IDS attributes of the file when available.
+ * Otherwise, the position of the point or of the cell in the file is used if @p useGlobalIds <= 0,
+ * and an InputError is thrown on all ranks if @p useGlobalIds > 0.
+ *
+ * The supported files are the binary legacy files of version 5.1 or newer (i.e. with @p OFFSETS and @p CONNECTIVITY cells),
+ * without polyhedral cells. ASCII files and older versions must be read serially.
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+readLegacyUnstructuredGridSlabs( Path const & filePath,
+                                 int const useGlobalIds,
+                                 MPI_Comm const comm );
+
+} // namespace vtk
+} // namespace geos
+
+#endif /* GEOS_MESH_GENERATORS_VTKLEGACYSLABREADER_HPP */
@@ -0,0 +1,444 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VTKMeshCache.cpp
+ */
+
+#include "mesh/generators/VTKMeshCache.hpp"
+
+#include "dataRepository/xmlWrapper.hpp"
+
+#include <vtkNew.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLUnstructuredGridWriter.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include <sys/stat.h>
+
+namespace geos
+{
+namespace vtk
+{
+
+namespace
+{
+
+/// Identifies a mesh cache file ("GEOSMSHC" in ASCII).
+std::uint64_t constexpr cacheMagic = 0x434853454D534F47ULL;
+
+/// Version of the cache file layout, to be increased when the layout changes.
+std::uint32_t constexpr cacheVersion = 1;
+
+/// Size of the chunks used to hash the input file.
+std::size_t constexpr hashChunkSize = 1 << 20;
+
+/**
+ * @brief Incrementally update a 64-bit FNV-1a hash.
+ * @param[in] hash the current value of the hash
+ * @param[in] data the bytes to hash
+ * @param[in] size the number of bytes
+ * @return The updated hash.
+ */
+std::uint64_t fnv1a( std::uint64_t hash, char const * const data, std::size_t const size )
+{
+  std::uint64_t constexpr prime = 0x100000001B3ULL;
+  for( std::size_t i = 0; i < size; ++i )
+  {
+    hash ^= static_cast< unsigned char >( data[i] );
+    hash *= prime;
+  }
+  return hash;
+}
+
+/// Initial value of the 64-bit FNV-1a hash.
+std::uint64_t constexpr fnv1aOffset = 0xCBF29CE484222325ULL;
+
+/**
+ * @brief Hash the contents of a file.
+ * @param[in] filePath the path of the file
+ * @param[inout] hash the hash to update
+ * @return @p false if the file could not be read.
+ */
+bool hashFileContents( string const & filePath, std::uint64_t & hash )
+{
+  std::ifstream is( filePath, std::ios::binary );
+  if( !is )
+  {
+    return false;
+  }
+  std::vector< char > chunk( hashChunkSize );
+  while( is )
+  {
+    is.read( chunk.data(), LvArray::integerConversion< std::streamsize >( chunk.size() ) );
+    hash = fnv1a( hash, chunk.data(), LvArray::integerConversion< std::size_t >( is.gcount() ) );
+  }
+  return is.eof();
+}
+
+/**
+ * @brief Collect the files referenced by a VTK XML multi-block (.vtm) or parallel (.pvt*) file.
+ * @param[in] node the XML node to search, recursively
+ * @param[inout] pieces the paths of the referenced files, as written in the file
+ */
+void collectReferencedPieces( xmlWrapper::xmlNode const & node, std::vector< string > & pieces )
+{
+  for( xmlWrapper::xmlNode const & child : node.children() )
+  {
+    // multi-block datasets reference their blocks as <DataSet file="...">,
+    // parallel datasets reference their partitions as <Piece Source="...">
+    for( char const * const attributeName : { "file", "Source" } )
+    {
+      xmlWrapper::xmlAttribute const attribute = child.attribute( attributeName );
+      if( attribute && attribute.value()[0] != '\0' )
+      {
+        pieces.emplace_back( attribute.value() );
+      }
+    }
+    collectReferencedPieces( child, pieces );
+  }
+}
+
+/**
+ * @brief Hash a mesh file and the files it references.
+ * @param[in] filePath the path of the mesh file
+ * @param[inout] hash the hash to update
+ * @return @p false if one of the files could not be read.
+ *
+ * The contents of the mesh file are hashed. If the mesh file is a multi-block or a parallel file,
+ * the paths, the sizes and the modification times of the referenced pieces are hashed as well,
+ * so that a modified piece invalidates the cache without reading all the pieces on one rank.
+ */
+bool hashMeshFiles( Path const & filePath, std::uint64_t & hash )
+{
+  if( !hashFileContents( filePath, hash ) )
+  {
+    return false;
+  }
+
+  string const extension = filePath.extension();
+  if( extension != "vtm" && extension.rfind( "pvt", 0 ) != 0 )
+  {
+    return true;
+  }
+
+  xmlWrapper::xmlDocument document;
+  if( !document.loadFile( filePath ) )
+  {
+    return false;
+  }
+  std::vector< string > pieces;
+  collectReferencedPieces( document.getFirstChild(), pieces );
+
+  string const directory = splitPath( getAbsolutePath( filePath ) ).first;
+  for( string const & piece : pieces )
+  {
+    string const piecePath = isAbsolutePath( piece ) ? piece : joinPath( directory, piece );
+    struct stat pieceStat;
+    if( stat( piecePath.c_str(), &pieceStat ) != 0 )
+    {
+      return false;
+    }
+    std::int64_t const size = pieceStat.st_size;
+    std::int64_t const modificationTime = pieceStat.st_mtime;
+    hash = fnv1a( hash, piece.data(), piece.size() + 1 );
+    hash = fnv1a( hash, reinterpret_cast< char const * >( &size ), sizeof( size ) );
+    hash = fnv1a( hash, reinterpret_cast< char const * >( &modificationTime ), sizeof( modificationTime ) );
+  }
+  return true;
+}
+
+string getCacheFileName( string const & cacheDirectory,
+                         string const & key,
+                         int const rank )
+{
+  return joinPath( cacheDirectory, GEOS_FMT( "{}.{}.bin", key, rank ) );
+}
+
+template< typename T >
+void writeValue( std::ostream & os, T const & value )
+{
+  static_assert( std::is_trivially_copyable< T >::value, "Only trivially copyable types can be written directly" );
+  os.write( reinterpret_cast< char const * >( &value ), sizeof( T ) );
+}
+
+template< typename T >
+bool readValue( std::istream & is, T & value )
+{
+  static_assert( std::is_trivially_copyable< T >::value, "Only trivially copyable types can be read directly" );
+  is.read( reinterpret_cast< char * >( &value ), sizeof( T ) );
+  return is.good();
+}
+
+void writeString( std::ostream & os, std::string const & str )
+{
+  writeValue( os, static_cast< std::uint64_t >( str.size() ) );
+  os.write( str.data(), LvArray::integerConversion< std::streamsize >( str.size() ) );
+}
+
+bool readString( std::istream & is, std::string & str )
+{
+  std::uint64_t size = 0;
+  if( !readValue( is, size ) )
+  {
+    return false;
+  }
+  str.resize( size );
+  is.read( str.data(), LvArray::integerConversion< std::streamsize >( size ) );
+  return is.good();
+}
+
+/**
+ * @brief Serialize an unstructured grid into a raw binary (appended) VTK XML buffer.
+ * @param[in] grid the grid to serialize
+ * @return The buffer.
+ */
+std::string serializeGrid( vtkUnstructuredGrid & grid )
+{
+  vtkNew< vtkXMLUnstructuredGridWriter > writer;
+  writer->SetInputData( &grid );
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+  writer->SetCompressorTypeToLZ4();
+  writer->WriteToOutputStringOn();
+  writer->Write();
+  return writer->GetOutputString();
+}
+
+/**
+ * @brief Rebuild an unstructured grid from a buffer created by @p serializeGrid.
+ * @param[in] buffer the buffer
+ * @return The grid, or a null pointer if the buffer could not be read.
+ */
+vtkSmartPointer< vtkUnstructuredGrid > deserializeGrid( std::string const & buffer )
+{
+  vtkNew< vtkXMLUnstructuredGridReader > reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString( buffer );
+  reader->Update();
+  if( reader->GetErrorCode() != 0 )
+  {
+    return nullptr;
+  }
+  return vtkSmartPointer< vtkUnstructuredGrid >( reader->GetOutput() );
+}
+
+/**
+ * @brief Read the cache file of the current rank.
+ * @param[in] fileName the name of the cache file
+ * @param[in] key the expected cache key
+ * @param[out] meshes the meshes read from the file
+ * @param[out] neighbors the neighbor ranks read from the file
+ * @return @p true if the file exists and is valid.
+ */
+bool readCacheFile( string const & fileName,
+                    string const & key,
+                    AllMeshes & meshes,
+                    std::vector< int > & neighbors )
+{
+  std::ifstream is( fileName, std::ios::binary );
+  if( !is )
+  {
+    return false;
+  }
+
+  std::uint64_t magic = 0;
+  std::uint32_t version = 0;
+  std::string fileKey;
+  if( !readValue( is, magic ) || magic != cacheMagic ||
+      !readValue( is, version ) || version != cacheVersion ||
+      !readString( is, fileKey ) || fileKey != key )
+  {
+    return false;
+  }
+
+  std::uint64_t numNeighbors = 0;
+  if( !readValue( is, numNeighbors ) )
+  {
+    return false;
+  }
+  neighbors.resize( numNeighbors );
+  for( int & neighbor : neighbors )
+  {
+    if( !readValue( is, neighbor ) )
+    {
+      return false;
+    }
+  }
+
+  std::uint64_t numBlocks = 0;
+  if( !readValue( is, numBlocks ) || numBlocks == 0 )
+  {
+    return false;
+  }
+
+  std::map< string, vtkSmartPointer< vtkDataSet > > faceBlocks;
+  for( std::uint64_t iBlock = 0; iBlock < numBlocks; ++iBlock )
+  {
+    std::string blockName;
+    std::string buffer;
+    if( !readString( is, blockName ) || !readString( is, buffer ) )
+    {
+      return false;
+    }
+    vtkSmartPointer< vtkUnstructuredGrid > grid = deserializeGrid( buffer );
+    if( !grid )
+    {
+      return false;
+    }
+    // The main mesh is always stored first, the face blocks follow.
+    if( iBlock == 0 )
+    {
+      meshes.setMainMesh( grid );
+    }
+    else
+    {
+      faceBlocks[blockName] = grid;
+    }
+  }
+  meshes.setFaceBlocks( faceBlocks );
+
+  return true;
+}
+
+} // namespace
+
+string computeMeshCacheKey( Path const & filePath,
+                            std::vector< string > const & parameters,
+                            MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  std::uint64_t hash = fnv1aOffset;
+  int isHashed = 1;
+  if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    isHashed = hashMeshFiles( filePath, hash ) ? 1 : 0;
+    for( string const & parameter : parameters )
+    {
+      // Separate the parameters so that e.g. ("ab", "c") and ("a", "bc") do not collide.
+      hash = fnv1a( hash, parameter.data(), parameter.size() + 1 );
+    }
+  }
+  // All the ranks must fail together, not only the one that hashed the files.
+  MpiWrapper::broadcast( isHashed, 0, comm );
+  GEOS_THROW_IF( isHashed == 0, GEOS_FMT( "Could not read mesh file {} (or one of its pieces) for hashing", filePath ), InputError );
+  MpiWrapper::broadcast( hash, 0, comm );
+
+  return GEOS_FMT( "{:016x}_np{}", hash, MpiWrapper::commSize( comm ) );
+}
+
+bool loadMeshCache( string const & cacheDirectory,
+                    string const & key,
+                    AllMeshes & meshes,
+                    std::vector< int > & neighbors,
+                    MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  AllMeshes cachedMeshes;
+  std::vector< int > cachedNeighbors;
+  string const fileName = getCacheFileName( cacheDirectory, key, MpiWrapper::commRank( comm ) );
+  int const isValid = readCacheFile( fileName, key, cachedMeshes, cachedNeighbors ) ? 1 : 0;
+
+  // A partial cache is useless: all the ranks must agree on using it.
+  if( MpiWrapper::min( isValid, comm ) == 0 )
+  {
+    return false;
+  }
+
+  meshes = cachedMeshes;
+  neighbors = std::move( cachedNeighbors );
+  return true;
+}
+
+void writeMeshCache( string const & cacheDirectory,
+                     string const & key,
+                     AllMeshes & meshes,
+                     std::vector< int > const & neighbors,
+                     MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  std::vector< vtkUnstructuredGrid * > grids{ vtkUnstructuredGrid::SafeDownCast( meshes.getMainMesh() ) };
+  for( auto const & nameToFaceBlock : meshes.getFaceBlocks() )
+  {
+    grids.push_back( vtkUnstructuredGrid::SafeDownCast( nameToFaceBlock.second ) );
+  }
+  int const isCacheable = std::all_of( grids.begin(), grids.end(), []( auto const * g ) { return g != nullptr; } ) ? 1 : 0;
+  if( MpiWrapper::min( isCacheable, comm ) == 0 )
+  {
+    GEOS_LOG_RANK_0( "Mesh cache: only unstructured partitions can be cached, skipping cache creation." );
+    return;
+  }
+
+  if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    makeDirsForPath( cacheDirectory );
+  }
+  MpiWrapper::barrier( comm );
+
+  string const fileName = getCacheFileName( cacheDirectory, key, MpiWrapper::commRank( comm ) );
+  // Write into a temporary file first, so that an interrupted run never leaves a truncated entry behind.
+  string const tmpFileName = fileName + ".tmp";
+  bool isWritten = false;
+  {
+    std::ofstream os( tmpFileName, std::ios::binary | std::ios::trunc );
+    if( os )
+    {
+      writeValue( os, cacheMagic );
+      writeValue( os, cacheVersion );
+      writeString( os, key );
+
+      writeValue( os, static_cast< std::uint64_t >( neighbors.size() ) );
+      for( int const neighbor : neighbors )
+      {
+        writeValue( os, neighbor );
+      }
+
+      writeValue( os, static_cast< std::uint64_t >( grids.size() ) );
+      writeString( os, "" );
+      writeString( os, serializeGrid( *grids[0] ) );
+      std::size_t iGrid = 1;
+      for( auto const & nameToFaceBlock : meshes.getFaceBlocks() )
+      {
+        writeString( os, nameToFaceBlock.first );
+        writeString( os, serializeGrid( *grids[iGrid++] ) );
+      }
+      os.close();
+      isWritten = !os.fail();
+    }
+  }
+  isWritten = isWritten && std::rename( tmpFileName.c_str(), fileName.c_str() ) == 0;
+  if( !isWritten )
+  {
+    std::remove( tmpFileName.c_str() );
+  }
+
+  // A rank that failed to write its entry must not be the only one to throw.
+  int const numFailedRanks = MpiWrapper::sum( isWritten ? 0 : 1, comm );
+  GEOS_THROW_IF( numFailedRanks > 0,
+                 GEOS_FMT( "Failed to write the mesh cache files in {} on {} rank(s)", cacheDirectory, numFailedRanks ),
+                 std::runtime_error );
+
+  GEOS_LOG_RANK_0( GEOS_FMT( "Mesh cache: wrote partitioned mesh to {} (key {})", cacheDirectory, key ) );
+}
+
+} // namespace vtk
+} // namespace geos
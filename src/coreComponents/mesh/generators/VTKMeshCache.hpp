@@ -0,0 +1,81 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VTKMeshCache.hpp
+ */
+
+#ifndef GEOS_MESH_GENERATORS_VTKMESHCACHE_HPP
+#define GEOS_MESH_GENERATORS_VTKMESHCACHE_HPP
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mesh/generators/VTKUtilities.hpp"
+
+namespace geos
+{
+namespace vtk
+{
+
+/**
+ * @brief Compute the key identifying a preprocessed (partitioned) mesh in the cache.
+ * @param[in] filePath the path of the input mesh file
+ * @param[in] parameters the generator parameters that influence the partitioning
+ * @param[in] comm the MPI communicator
+ * @return A key combining the hash of the file contents, the parameters and the number of ranks.
+ * @note The file is hashed by the first rank only, the result is then broadcast. For a multi-block (.vtm)
+ *       or parallel (.pvt*) file, the paths, sizes and modification times of the referenced pieces are hashed too.
+ * @throw InputError on all the ranks if the file or one of its pieces cannot be read.
+ */
+string computeMeshCacheKey( Path const & filePath,
+                            std::vector< string > const & parameters,
+                            MPI_Comm const comm );
+
+/**
+ * @brief Load the partitioned meshes of the current rank from the cache.
+ * @param[in] cacheDirectory the directory holding the cache files
+ * @param[in] key the cache key, as computed by @p computeMeshCacheKey
+ * @param[out] meshes the main mesh and the face blocks of the current rank
+ * @param[out] neighbors the list of neighboring ranks
+ * @param[in] comm the MPI communicator
+ * @return @p true if all the ranks could read a valid cache entry, @p false otherwise.
+ * @note The outputs are only modified when the whole communicator succeeded.
+ */
+bool loadMeshCache( string const & cacheDirectory,
+                    string const & key,
+                    AllMeshes & meshes,
+                    std::vector< int > & neighbors,
+                    MPI_Comm const comm );
+
+/**
+ * @brief Write the partitioned meshes of the current rank into the cache.
+ * @param[in] cacheDirectory the directory holding the cache files
+ * @param[in] key the cache key, as computed by @p computeMeshCacheKey
+ * @param[in] meshes the main mesh and the face blocks of the current rank
+ * @param[in] neighbors the list of neighboring ranks
+ * @param[in] comm the MPI communicator
+ * @note Only unstructured partitions can be cached. Nothing is written if any rank holds another type of dataset.
+ * @throw std::runtime_error on all the ranks if any rank fails to write its cache file.
+ */
+void writeMeshCache( string const & cacheDirectory,
+                     string const & key,
+                     AllMeshes & meshes,
+                     std::vector< int > const & neighbors,
+                     MPI_Comm const comm );
+
+} // namespace vtk
+} // namespace geos
+
+#endif /* GEOS_MESH_GENERATORS_VTKMESHCACHE_HPP */
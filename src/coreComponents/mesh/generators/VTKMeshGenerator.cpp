@@ -20,6 +20,7 @@
 #include "VTKMeshGenerator.hpp"
 
 #include "mesh/generators/VTKFaceBlockUtilities.hpp"
+#include "mesh/generators/VTKMeshCache.hpp"
 #include "mesh/generators/VTKMeshGeneratorTools.hpp"
 #include "mesh/generators/CellBlockManager.hpp"
 #include "common/DataTypes.hpp"
@@ -75,6 +76,64 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
                     " If set to 0 (default value), the GlobalId arrays in the input mesh are used if available, and generated otherwise."
                     " If set to a negative value, the GlobalId arrays in the input mesh are not used, and generated global Ids are automatically generated."
                     " If set to a positive value, the GlobalId arrays in the input mesh are used and required, and the simulation aborts if they are not available" );
+
+  registerWrapper( viewKeyStruct::parallelReadString(), &m_parallelRead ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Set to 1 to read the mesh on all ranks instead of the first one. "
+                    "Binary legacy .vtk files (version 5.1 or newer, without polyhedra) are read in slabs of cells and points, "
+                    "the pieces of .vtm files are distributed among the ranks. Other files are read by the first rank." );
+
+  registerWrapper( viewKeyStruct::meshCacheDirectoryString(), &m_meshCacheDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Directory where the partitioned mesh of each rank is cached. "
+                    "If the cache holds an entry for the same file contents, partitioning parameters and number of ranks, "
+                    "the mesh is read from the cache and the loading and redistribution steps are skipped. "
+                    "Otherwise, the cache entry is created. Leave empty (default) to disable the cache." );
+}
+
+std::vector< int > VTKMeshGenerator::loadAndRedistributeMeshes( MPI_Comm const comm )
+{
+  string cacheKey;
+  if( !m_meshCacheDirectory.empty() )
+  {
+    std::vector< string > parameters{ m_mainBlockName,
+                                      EnumStrings< vtk::PartitionMethod >::toString( m_partitionMethod ),
+                                      std::to_string( m_partitionRefinement ),
+                                      std::to_string( m_useGlobalIds ),
+                                      std::to_string( m_parallelRead ) };
+    parameters.insert( parameters.end(), m_faceBlockNames.begin(), m_faceBlockNames.end() );
+    cacheKey = vtk::computeMeshCacheKey( m_filePath, parameters, comm );
+
+    vtk::AllMeshes cachedMeshes;
+    std::vector< int > neighbors;
+    if( vtk::loadMeshCache( m_meshCacheDirectory, cacheKey, cachedMeshes, neighbors, comm ) )
+    {
+      GEOS_LOG_RANK_0( GEOS_FMT( "{} '{}': using cached partitions from {}", catalogName(), getName(), m_meshCacheDirectory ) );
+      m_vtkMesh = cachedMeshes.getMainMesh();
+      m_faceBlockMeshes = cachedMeshes.getFaceBlocks();
+      return neighbors;
+    }
+  }
+
+  GEOS_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
+  vtk::AllMeshes allMeshes = vtk::loadAllMeshes( m_filePath, m_mainBlockName, m_faceBlockNames, m_parallelRead != 0, m_useGlobalIds );
+  GEOS_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
+  vtk::AllMeshes redistributedMeshes =
+    vtk::redistributeMeshes( getLogLevel(), allMeshes.getMainMesh(), allMeshes.getFaceBlocks(), comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds );
+  m_vtkMesh = redistributedMeshes.getMainMesh();
+  m_faceBlockMeshes = redistributedMeshes.getFaceBlocks();
+  GEOS_LOG_LEVEL_RANK_0( 2, "  finding neighbor ranks..." );
+  std::vector< vtkBoundingBox > boxes = vtk::exchangeBoundingBoxes( *m_vtkMesh, comm );
+  std::vector< int > neighbors = vtk::findNeighborRanks( std::move( boxes ) );
+
+  if( !m_meshCacheDirectory.empty() )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 2, "  writing the mesh cache..." );
+    vtk::writeMeshCache( m_meshCacheDirectory, cacheKey, redistributedMeshes, neighbors, comm );
+  }
+
+  return neighbors;
 }
 
 void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager, SpatialPartition & partition )
@@ -88,16 +147,7 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
 
   GEOS_LOG_RANK_0( GEOS_FMT( "{} '{}': reading mesh from {}", catalogName(), getName(), m_filePath ) );
   {
-    GEOS_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
-    vtk::AllMeshes allMeshes = vtk::loadAllMeshes( m_filePath, m_mainBlockName, m_faceBlockNames );
-    GEOS_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
-    vtk::AllMeshes redistributedMeshes =
-      vtk::redistributeMeshes( getLogLevel(), allMeshes.getMainMesh(), allMeshes.getFaceBlocks(), comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds );
-    m_vtkMesh = redistributedMeshes.getMainMesh();
-    m_faceBlockMeshes = redistributedMeshes.getFaceBlocks();
-    GEOS_LOG_LEVEL_RANK_0( 2, "  finding neighbor ranks..." );
-    std::vector< vtkBoundingBox > boxes = vtk::exchangeBoundingBoxes( *m_vtkMesh, comm );
-    std::vector< int > const neighbors = vtk::findNeighborRanks( std::move( boxes ) );
+    std::vector< int > neighbors = loadAndRedistributeMeshes( comm );
     partition.setMetisNeighborList( std::move( neighbors ) );
     GEOS_LOG_LEVEL_RANK_0( 2, "  done!" );
   }
@@ -64,10 +64,17 @@ public:
    *
    * - If a .vtu, .vts, .vti or .vtk file is used, the root MPI process will load it.
    *   The mesh will be then redistribute among all the available MPI processes
+   * - If parallelRead is enabled, binary legacy .vtk files (version 5.1 or newer) are read by all the MPI processes,
+   *   each one reading a contiguous slab of cells and points, and the pieces of .vtm files are distributed among them.
+   *   A geometric (kd-tree) partition is then computed before the graph partitioning.
    * - If a .pvtu or .pvts file is used, it means that the mesh is pre-partionned in the file system.
    *   The available MPI processes will load the pre-partionned mesh. The mesh will be then
    *   redistributed among ALL the available MPI processes.
    *
+   * If a mesh cache directory is provided, the partitioned mesh of each rank is stored there after the first run.
+   * The following runs on the same file, with the same partitioning parameters and the same number of MPI processes,
+   * read the partitions back directly and skip the loading, redistribution and neighbor search steps.
+   *
    * The properties on the mesh will be also and redistributed. The only compatible types are double and float.
    * The properties can be multi-dimensional.
    * The name of the properties has to have the right name in order to be used by GEOSX. For instance,
@@ -110,6 +117,8 @@ private:
     constexpr static char const * partitionRefinementString() { return "partitionRefinement"; }
     constexpr static char const * partitionMethodString() { return "partitionMethod"; }
     constexpr static char const * useGlobalIdsString() { return "useGlobalIds"; }
+    constexpr static char const * meshCacheDirectoryString() { return "meshCacheDirectory"; }
+    constexpr static char const * parallelReadString() { return "parallelRead"; }
   };
   /// @endcond
 
@@ -118,6 +127,13 @@ private:
                                   bool isMaterialField,
                                   dataRepository::WrapperBase & wrapper ) const;
 
+  /**
+   * @brief Load and redistribute the input meshes, or read them from the mesh cache when possible.
+   * @param[in] comm the MPI communicator
+   * @return the list of neighbor ranks of the current partition
+   */
+  std::vector< int > loadAndRedistributeMeshes( MPI_Comm const comm );
+
   void importSurfacicFieldOnArray( string const & faceBlockName,
                                    string const & meshFieldName,
                                    dataRepository::WrapperBase & wrapper ) const;
@@ -153,6 +169,12 @@ private:
   /// Method (library) used to partition the mesh
   vtk::PartitionMethod m_partitionMethod = vtk::PartitionMethod::parmetis;
 
+  /// Whether legacy and multi-block files are read by all the ranks
+  integer m_parallelRead = 0;
+
+  /// Directory where the partitioned mesh is cached (empty to disable the cache)
+  Path m_meshCacheDirectory;
+
   /// Lists of VTK cell ids, organized by element type, then by region
   vtk::CellMapType m_cellMap;
 };
@@ -15,6 +15,7 @@
 
 
 #include "mesh/generators/CollocatedNodes.hpp"
+#include "mesh/generators/VTKLegacySlabReader.hpp"
 #include "mesh/generators/VTKMeshGeneratorTools.hpp"
 #include "mesh/generators/VTKUtilities.hpp"
 
@@ -25,10 +26,13 @@
 
 #include "common/TypeDispatch.hpp"
 
+#include <vtkAppendFilter.h>
 #include <vtkArrayDispatch.h>
 #include <vtkBoundingBox.h>
 #include <vtkCellData.h>
 #include <vtkDataArray.h>
+#include <vtkDataObjectTree.h>
+#include <vtkDataObjectTreeIterator.h>
 #include <vtkDataSetReader.h>
 #include <vtkExtractCells.h>
 #include <vtkGenerateGlobalIds.h>
@@ -448,10 +452,102 @@ VTKLegacyDatasetType getVTKLegacyDatasetType( vtkSmartPointer< vtkDataSetReader
   return {};
 }
 
+/**
+ * @brief Redistributes the mesh using a Kd-Tree
+ *
+ * @param[in] mesh a vtk grid
+ * @return the vtk grid redistributed
+ */
+vtkSmartPointer< vtkDataSet >
+redistributeByKdTree( vtkDataSet & mesh )
+{
+  GEOS_MARK_FUNCTION;
+
+  // Use a VTK filter which employs a kd-tree partition internally
+  vtkNew< vtkRedistributeDataSetFilter > rdsf;
+  rdsf->SetInputDataObject( &mesh );
+  rdsf->SetNumberOfPartitions( MpiWrapper::commSize() );
+  rdsf->Update();
+  return vtkDataSet::SafeDownCast( rdsf->GetOutputDataObject( 0 ) );
+}
+
+/**
+ * @brief Read the pieces of a multi-block block assigned to the current rank.
+ * @param[in] filePath the path of the .vtm file
+ * @param[in] blockName the name of the block to read
+ * @return the local part of the block
+ * @details The leaf datasets of the block are distributed among the ranks by the VTK reader.
+ * The pieces assigned to a rank are merged, and points shared between them are merged as well.
+ */
+vtkSmartPointer< vtkDataSet >
+loadMultiBlockPieces( Path const & filePath,
+                      string const & blockName )
+{
+  auto reader = vtkSmartPointer< vtkXMLMultiBlockDataReader >::New();
+  reader->SetFileName( filePath.c_str() );
+  reader->UpdateInformation();
+  reader->UpdatePiece( MpiWrapper::commRank(), MpiWrapper::commSize(), 0 );
+  vtkMultiBlockDataSet * multiBlockDataSet = vtkMultiBlockDataSet::SafeDownCast( reader->GetOutput() );
+  GEOS_ERROR_IF( multiBlockDataSet == nullptr,
+                 "Unsupported vtk multi-block format in file \"" << filePath << "\".\n" << generalMeshErrorAdvice );
+
+  for( unsigned int i = 0; i < multiBlockDataSet->GetNumberOfBlocks(); ++i )
+  {
+    if( multiBlockDataSet->GetMetaData( i )->Get( multiBlockDataSet->NAME() ) != blockName )
+    {
+      continue;
+    }
+    vtkDataObject * block = multiBlockDataSet->GetBlock( i );
+    if( block == nullptr )
+    {
+      // This block was assigned to another rank.
+      return vtkSmartPointer< vtkUnstructuredGrid >::New();
+    }
+    if( block->IsA( "vtkDataSet" ) )
+    {
+      return vtkDataSet::SafeDownCast( block );
+    }
+    if( vtkDataObjectTree * const tree = vtkDataObjectTree::SafeDownCast( block ) )
+    {
+      vtkNew< vtkAppendFilter > append;
+      append->MergePointsOn();
+      vtkSmartPointer< vtkDataObjectTreeIterator > iter =
+        vtkSmartPointer< vtkDataObjectTreeIterator >::Take( tree->NewTreeIterator() );
+      for( iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem() )
+      {
+        if( vtkDataSet * piece = vtkDataSet::SafeDownCast( iter->GetCurrentDataObject() ) )
+        {
+          append->AddInputData( piece );
+        }
+      }
+      if( append->GetNumberOfInputConnections( 0 ) == 0 )
+      {
+        return vtkSmartPointer< vtkUnstructuredGrid >::New();
+      }
+      append->Update();
+      return vtkSmartPointer< vtkUnstructuredGrid >( append->GetOutput() );
+    }
+  }
+  GEOS_ERROR( "Could not find mesh \"" << blockName << "\" in multi-block vtk file \"" << filePath << "\".\n" <<
+              generalMeshErrorAdvice );
+  return {};
+}
+
+/**
+ * @brief Load the VTK file into the VTK data structure
+ * @param[in] filePath the Path of the file to load
+ * @param[in] blockName the name of the block to import (multi-block files only)
+ * @param[in] readerRank the rank reading the files that are read serially
+ * @param[in] parallelRead whether the legacy and multi-block files may be read by all the ranks
+ * @param[in] useGlobalIds controls whether global id arrays from the vtk input must be used
+ * @return the part of the mesh loaded on the current rank
+ */
 vtkSmartPointer< vtkDataSet >
 loadMesh( Path const & filePath,
           string const & blockName,
-          int readerRank = 0 )
+          int readerRank = 0,
+          bool const parallelRead = false,
+          int const useGlobalIds = 0 )
 {
   string const extension = filePath.extension();
 
@@ -483,7 +579,11 @@ loadMesh( Path const & filePath,
   {
     case VTKMeshExtension::vtm:
     {
-      if( MpiWrapper::commRank() == readerRank )
+      if( parallelRead )
+      {
+        return loadMultiBlockPieces( filePath, blockName );
+      }
+      else if( MpiWrapper::commRank() == readerRank )
       {
         // The multi-block format is a container of multiple datasets (or even of other containers).
         // We must navigate this multi-block to extract the relevant information.
@@ -524,6 +624,18 @@ loadMesh( Path const & filePath,
     }
     case VTKMeshExtension::vtk:
     {
+      if( parallelRead )
+      {
+        vtkSmartPointer< vtkUnstructuredGrid > slabs = readLegacyUnstructuredGridSlabs( filePath, useGlobalIds, MPI_COMM_GEOS );
+        if( slabs )
+        {
+          // The slabs follow the ordering of the file: a quick geometric partition gives
+          // the graph partitioner a much better starting point.
+          return redistributeByKdTree( *slabs );
+        }
+        GEOS_LOG_RANK_0( GEOS_FMT( "File {} cannot be read in parallel (only binary legacy files of version 5.1 or newer "
+                                   "without polyhedra are supported), falling back to a serial read.", filePath ) );
+      }
       VTKLegacyDatasetType const datasetType = getVTKLegacyDatasetType( vtkSmartPointer< vtkDataSetReader >::New(),
                                                                         filePath );
       switch( datasetType )
@@ -565,10 +677,13 @@ loadMesh( Path const & filePath,
 
 AllMeshes loadAllMeshes( Path const & filePath,
                          string const & mainBlockName,
-                         array1d< string > const & faceBlockNames )
+                         array1d< string > const & faceBlockNames,
+                         bool const parallelRead,
+                         int const useGlobalIds )
 {
   int const lastRank = MpiWrapper::commSize() - 1;
-  vtkSmartPointer< vtkDataSet > main = loadMesh( filePath, mainBlockName );
+  vtkSmartPointer< vtkDataSet > main = loadMesh( filePath, mainBlockName, 0, parallelRead, useGlobalIds );
+  // The face blocks are always gathered on the last rank, as expected by the redistribution.
   std::map< string, vtkSmartPointer< vtkDataSet > > faces;
 
   for( string const & faceBlockName: faceBlockNames )
@@ -691,25 +806,6 @@ AllMeshes redistributeByCellGraph( AllMeshes & input,
   return AllMeshes( finalMesh, finalFractures );
 }
 
-/**
- * @brief Redistributes the mesh using a Kd-Tree
- *
- * @param[in] mesh a vtk grid
- * @return the vtk grid redistributed
- */
-vtkSmartPointer< vtkDataSet >
-redistributeByKdTree( vtkDataSet & mesh )
-{
-  GEOS_MARK_FUNCTION;
-
-  // Use a VTK filter which employs a kd-tree partition internally
-  vtkNew< vtkRedistributeDataSetFilter > rdsf;
-  rdsf->SetInputDataObject( &mesh );
-  rdsf->SetNumberOfPartitions( MpiWrapper::commSize() );
-  rdsf->Update();
-  return vtkDataSet::SafeDownCast( rdsf->GetOutputDataObject( 0 ) );
-}
-
 std::vector< int >
 findNeighborRanks( std::vector< vtkBoundingBox > boundingBoxes )
 {
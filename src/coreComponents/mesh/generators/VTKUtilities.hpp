@@ -130,11 +130,18 @@ private:
  * @param[in] filePath the Path of the file to load
  * @param[in] mainBlockName The name of the block to import (will be considered for multi-block files only).
  * @param[in] faceBlockNames The names of the face blocks to import  (will be considered for multi-block files only).
+ * @param[in] parallelRead Whether the main mesh of legacy (.vtk) and multi-block (.vtm) files is read by all the ranks.
+ *            Legacy files are read in slabs of cells and points, multi-block files piece by piece.
+ *            Other formats, and legacy files that cannot be read in slabs, are still read by the first rank.
+ * @param[in] useGlobalIds Controls whether the global id arrays of the file must be used. When the legacy files
+ *            read in slabs have no global ids, the positions in the file are used as global ids if useGlobalIds <= 0.
  * @return The compound of the main mesh and the face block meshes.
  */
 AllMeshes loadAllMeshes( Path const & filePath,
                          string const & mainBlockName,
-                         array1d< string > const & faceBlockNames );
+                         array1d< string > const & faceBlockNames,
+                         bool const parallelRead = false,
+                         int const useGlobalIds = 0 );
 
 /**
  * @brief Compute the rank neighbor candidate list.
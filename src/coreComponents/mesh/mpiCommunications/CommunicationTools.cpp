@@ -932,12 +932,17 @@ void CommunicationTools::synchronizePackSendRecvSizes( FieldIdentifiers const &
   GEOS_MARK_FUNCTION;
   icomm.setFieldsToBeSync( fieldsToBeSync );
   icomm.resize( neighbors.size() );
+  // the same decision is made on all the ranks, as it only depends on the types of the fields
+  icomm.setUseFusedPacking( icomm.allowFusedPacking() && onDevice &&
+                            NeighborCommunicator::canFuseSyncPacking( fieldsToBeSync, mesh ) );
 
   parallelDeviceEvents events;
   for( std::size_t neighborIndex = 0; neighborIndex < neighbors.size(); ++neighborIndex )
   {
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
-    int const bufferSize = neighbor.packCommSizeForSync( fieldsToBeSync, mesh, icomm.commID(), onDevice, events );
+    int const bufferSize = icomm.useFusedPacking() ?
+                           neighbor.fusedPackSizeForSync( fieldsToBeSync, mesh, icomm.commID() ) :
+                           neighbor.packCommSizeForSync( fieldsToBeSync, mesh, icomm.commID(), onDevice, events );
 
     neighbor.mpiISendReceiveBufferSizes( icomm.commID(),
                                          icomm.mpiSendBufferSizeRequest( neighborIndex ),
@@ -958,6 +963,18 @@ void CommunicationTools::asyncPack( FieldIdentifiers const & fieldsToBeSync,
                                     parallelDeviceEvents & events )
 {
   GEOS_MARK_FUNCTION;
+  if( icomm.useFusedPacking() )
+  {
+    // a single kernel packs all the fields for all the neighbors
+    bufferOps::FusedPackTable table;
+    for( NeighborCommunicator & neighbor : neighbors )
+    {
+      neighbor.addFusedPackForSync( fieldsToBeSync, mesh, icomm.commID(), table );
+    }
+    table.pack();
+    return;
+  }
+
   for( NeighborCommunicator & neighbor : neighbors )
   {
     neighbor.packCommBufferForSync( fieldsToBeSync, mesh, icomm.commID(), onDevice, events );
@@ -1027,10 +1044,26 @@ bool CommunicationTools::asyncUnpack( MeshLevel & mesh,
                         &neighborIndices[0],
                         icomm.mpiRecvBufferStatus() );
 
-  for( int recvIdx = 0; recvIdx < recvCount; ++recvIdx )
+  if( icomm.useFusedPacking() )
   {
-    NeighborCommunicator & neighbor = neighbors[ neighborIndices[ recvIdx ] ];
-    neighbor.unpackBufferForSync( icomm.getFieldsToBeSync(), mesh, icomm.commID(), onDevice, events, op );
+    GEOS_ERROR_IF( op != MPI_REPLACE, "The fused unpacking only supports MPI_REPLACE." );
+
+    // a single kernel unpacks all the fields for all the neighbors received so far
+    bufferOps::FusedPackTable table;
+    for( int recvIdx = 0; recvIdx < recvCount; ++recvIdx )
+    {
+      NeighborCommunicator & neighbor = neighbors[ neighborIndices[ recvIdx ] ];
+      neighbor.addFusedUnpackForSync( icomm.getFieldsToBeSync(), mesh, icomm.commID(), table );
+    }
+    table.unpack();
+  }
+  else
+  {
+    for( int recvIdx = 0; recvIdx < recvCount; ++recvIdx )
+    {
+      NeighborCommunicator & neighbor = neighbors[ neighborIndices[ recvIdx ] ];
+      neighbor.unpackBufferForSync( icomm.getFieldsToBeSync(), mesh, icomm.commID(), onDevice, events, op );
+    }
   }
 
   // we don't want to check if the request has completed,
@@ -1094,6 +1127,7 @@ void CommunicationTools::synchronizeFields( FieldIdentifiers const & fieldsToBeS
 {
   MPI_iCommData icomm( getCommID() );
   icomm.resize( neighbors.size() );
+  icomm.setAllowFusedPacking( true );
   synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
   synchronizePackSendRecv( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
   synchronizeUnpack( mesh, neighbors, icomm, onDevice );
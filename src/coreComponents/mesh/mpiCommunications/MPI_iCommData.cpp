@@ -21,6 +21,8 @@ namespace geos
 MPI_iCommData::MPI_iCommData( int const inputCommID ):
   m_size( 0 ),
   m_commID( inputCommID ),      // CommunicationTools::getInstance().getCommID() ),
+  m_allowFusedPacking( false ),
+  m_useFusedPacking( false ),
   m_mpiSendBufferRequest(),
   m_mpiRecvBufferRequest(),
   m_mpiSendBufferStatus(),
@@ -70,6 +70,29 @@ public:
    */
   void setFieldsToBeSync( FieldIdentifiers const & fieldsToBeSync ) { m_fieldsToBeSync = fieldsToBeSync; }
 
+  /**
+   * @brief Allow the fields to be packed by the fused device kernels (see bufferOps::FusedPackTable).
+   * @param allow Whether the fused packing is allowed.
+   * @note The fused unpacking only supports MPI_REPLACE.
+   */
+  void setAllowFusedPacking( bool const allow ) { m_allowFusedPacking = allow; }
+
+  /**
+   * @return Whether the fused packing is allowed.
+   */
+  bool allowFusedPacking() const { return m_allowFusedPacking; }
+
+  /**
+   * @return Whether the registered fields are packed by the fused device kernels.
+   */
+  bool useFusedPacking() const { return m_useFusedPacking; }
+
+  /**
+   * @brief Setter of the use of the fused packing for the registered fields.
+   * @param useFused Whether the fused packing is used.
+   */
+  void setUseFusedPacking( bool const useFused ) { m_useFusedPacking = useFused; }
+
 
   MPI_Request * mpiSendBufferRequest() { return m_mpiSendBufferRequest.data(); }
   MPI_Request * mpiRecvBufferRequest() { return m_mpiRecvBufferRequest.data(); }
@@ -103,6 +126,12 @@ private:
 
   FieldIdentifiers m_fieldsToBeSync;
 
+  /// Whether the fields may be packed by the fused device kernels
+  bool m_allowFusedPacking;
+
+  /// Whether the registered fields are packed by the fused device kernels
+  bool m_useFusedPacking;
+
   array1d< MPI_Request > m_mpiSendBufferRequest;
   array1d< MPI_Request > m_mpiRecvBufferRequest;
   array1d< MPI_Status >  m_mpiSendBufferStatus;
@@ -481,6 +481,117 @@ void NeighborCommunicator::unpackAndRebuildSyncLists( MeshLevel & mesh,
 }
 
 
+namespace
+{
+
+/**
+ * @brief Call a function on each object manager holding fields to synchronize.
+ * @tparam MESH_LEVEL the type of the mesh level (possibly const)
+ * @tparam LAMBDA the type of the function
+ * @param fieldsToBeSync the fields to synchronize
+ * @param mesh the mesh level
+ * @param lambda the function, called with the object manager and the names of its fields
+ */
+template< typename MESH_LEVEL, typename LAMBDA >
+void forObjectsToSync( FieldIdentifiers const & fieldsToBeSync,
+                       MESH_LEVEL & mesh,
+                       LAMBDA && lambda )
+{
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    FieldLocation location{};
+    fieldsToBeSync.getLocation( iter.first, location );
+    switch( location )
+    {
+      case FieldLocation::Node:
+      {
+        lambda( mesh.getNodeManager(), iter.second );
+        break;
+      }
+      case FieldLocation::Edge:
+      {
+        lambda( mesh.getEdgeManager(), iter.second );
+        break;
+      }
+      case FieldLocation::Face:
+      {
+        lambda( mesh.getFaceManager(), iter.second );
+        break;
+      }
+      case FieldLocation::Elem:
+      {
+        mesh.getElemManager().getRegion( fieldsToBeSync.getRegionName( iter.first ) ).template forElementSubRegions< ElementSubRegionBase >( [&]( auto & subRegion )
+        {
+          lambda( subRegion, iter.second );
+        } );
+        break;
+      }
+    }
+  }
+}
+
+}
+
+bool NeighborCommunicator::canFuseSyncPacking( FieldIdentifiers const & fieldsToBeSync,
+                                               MeshLevel const & mesh )
+{
+  bool canFuse = true;
+  forObjectsToSync( fieldsToBeSync, mesh, [&]( ObjectManagerBase const & object, string_array const & wrapperNames )
+  {
+    canFuse = canFuse && object.isFusedPackable( wrapperNames );
+  } );
+  return canFuse;
+}
+
+int NeighborCommunicator::fusedPackSizeForSync( FieldIdentifiers const & fieldsToBeSync,
+                                                MeshLevel const & mesh,
+                                                int const commID )
+{
+  GEOS_MARK_FUNCTION;
+
+  localIndex bufferSize = 0;
+  forObjectsToSync( fieldsToBeSync, mesh, [&]( ObjectManagerBase const & object, string_array const & wrapperNames )
+  {
+    bufferSize += object.fusedPackSize( wrapperNames, object.getNeighborData( m_neighborRank ).ghostsToSend() );
+  } );
+  this->m_sendBufferSize[commID] = LvArray::integerConversion< int >( bufferSize );
+  return this->m_sendBufferSize[commID];
+}
+
+void NeighborCommunicator::addFusedPackForSync( FieldIdentifiers const & fieldsToBeSync,
+                                                MeshLevel const & mesh,
+                                                int const commID,
+                                                bufferOps::FusedPackTable & table )
+{
+  buffer_type & sendBuff = sendBuffer( commID );
+  buffer_unit_type * sendBufferPtr = sendBuff.data();
+
+  localIndex packedSize = 0;
+  forObjectsToSync( fieldsToBeSync, mesh, [&]( ObjectManagerBase const & object, string_array const & wrapperNames )
+  {
+    packedSize += object.addFusedPackSegments( table, sendBufferPtr, wrapperNames, object.getNeighborData( m_neighborRank ).ghostsToSend() );
+  } );
+
+  GEOS_ERROR_IF_NE( LvArray::integerConversion< localIndex >( sendBuff.size() ), packedSize );
+}
+
+void NeighborCommunicator::addFusedUnpackForSync( FieldIdentifiers const & fieldsToBeSync,
+                                                  MeshLevel & mesh,
+                                                  int const commID,
+                                                  bufferOps::FusedPackTable & table )
+{
+  buffer_type const & receiveBuff = receiveBuffer( commID );
+  buffer_unit_type const * receiveBufferPtr = receiveBuff.data();
+
+  localIndex unpackedSize = 0;
+  forObjectsToSync( fieldsToBeSync, mesh, [&]( ObjectManagerBase & object, string_array const & wrapperNames )
+  {
+    unpackedSize += object.addFusedUnpackSegments( table, receiveBufferPtr, wrapperNames, object.getNeighborData( m_neighborRank ).ghostsToReceive() );
+  } );
+
+  GEOS_ERROR_IF_NE( LvArray::integerConversion< localIndex >( receiveBuff.size() ), unpackedSize );
+}
+
 int NeighborCommunicator::packCommSizeForSync( FieldIdentifiers const & fieldsToBeSync,
                                                MeshLevel const & mesh,
                                                int const commID,
@@ -20,6 +20,7 @@
 #include "mesh/FieldIdentifiers.hpp"
 
 #include "common/GEOS_RAJA_Interface.hpp"
+#include "dataRepository/BufferOpsFused.hpp"
 #include "dataRepository/ReferenceWrapper.hpp"
 #include "LvArray/src/limits.hpp"
 
@@ -237,6 +238,50 @@ public:
                             parallelDeviceEvents & events,
                             MPI_Op op=MPI_REPLACE );
 
+  /**
+   * @brief Check whether the fields to synchronize can be packed by the fused device kernels.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param meshLevel the mesh level holding the fields
+   * @return true if all the fields have a layout supported by bufferOps::FusedPackTable
+   */
+  static bool canFuseSyncPacking( FieldIdentifiers const & fieldsToBeSync,
+                                  MeshLevel const & meshLevel );
+
+  /**
+   * @brief Compute the size of the fused packing of the fields to synchronize with this neighbor.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param meshLevel the mesh level holding the fields
+   * @param commID the communication pipeline
+   * @return the size of the send buffer
+   */
+  int fusedPackSizeForSync( FieldIdentifiers const & fieldsToBeSync,
+                            MeshLevel const & meshLevel,
+                            int const commID );
+
+  /**
+   * @brief Add the packing of the fields to synchronize with this neighbor to a fused packing table.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param meshLevel the mesh level holding the fields
+   * @param commID the communication pipeline, whose send buffer has been sized by fusedPackSizeForSync
+   * @param table the table packing the send buffers of all the neighbors
+   */
+  void addFusedPackForSync( FieldIdentifiers const & fieldsToBeSync,
+                            MeshLevel const & meshLevel,
+                            int const commID,
+                            bufferOps::FusedPackTable & table );
+
+  /**
+   * @brief Add the unpacking of the fields received from this neighbor to a fused packing table.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param meshLevel the mesh level holding the fields
+   * @param commID the communication pipeline, whose receive buffer has been received
+   * @param table the table unpacking the receive buffers of the neighbors
+   */
+  void addFusedUnpackForSync( FieldIdentifiers const & fieldsToBeSync,
+                              MeshLevel & meshLevel,
+                              int const commID,
+                              bufferOps::FusedPackTable & table );
+
   int neighborRank() const { return m_neighborRank; }
 
   void clear();
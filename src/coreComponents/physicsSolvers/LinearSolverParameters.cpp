@@ -49,6 +49,14 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Whether to stop the simulation if the linear solver reports an error" );
 
+  registerWrapper( viewKeyStruct::matrixFreeString(), &m_parameters.matrixFree ).
+    setApplyDefaultValue( m_parameters.matrixFree ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether to apply the system operator matrix-free, element by element, instead of assembling it. "
+                    "Only supported by the quasi-static solid mechanics solver with linear elastic models and an iterative "
+                    "solver, in which case only the diagonal of the matrix is assembled to build a Jacobi preconditioner "
+                    "(other preconditioner types than jacobi and none are replaced by jacobi)" );
+
   registerWrapper( viewKeyStruct::directCheckResidualString(), &m_parameters.direct.checkResidual ).
     setApplyDefaultValue( m_parameters.direct.checkResidual ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -226,6 +234,9 @@ void LinearSolverParametersInput::postInputInitialization()
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.stopIfError ) == 0,
                  getWrapperDataContext( viewKeyStruct::stopIfErrorString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.matrixFree ) == 0,
+                 getWrapperDataContext( viewKeyStruct::matrixFreeString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.direct.checkResidual ) == 0,
                  getWrapperDataContext( viewKeyStruct::directCheckResidualString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
@@ -286,6 +297,7 @@ void LinearSolverParametersInput::print()
   tableData.addRow( "Linear solver type", m_parameters.solverType );
   tableData.addRow( "Preconditioner type", m_parameters.preconditionerType );
   tableData.addRow( "Stop if error", m_parameters.stopIfError );
+  tableData.addRow( "Matrix-free operator", m_parameters.matrixFree );
   if( m_parameters.solverType == LinearSolverParameters::SolverType::direct )
   {
     tableData.addRow( "Check residual", m_parameters.direct.checkResidual );
@@ -77,6 +77,8 @@ public:
     static constexpr char const * preconditionerTypeString() { return "preconditionerType"; }
     /// stop if error key
     static constexpr char const * stopIfErrorString() { return "stopIfError"; }
+    /// matrix-free operator key
+    static constexpr char const * matrixFreeString() { return "matrixFree"; }
 
     /// direct solver check residual key
     static constexpr char const * directCheckResidualString() { return "directCheckResidual"; }
@@ -139,6 +139,23 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Factor by which the time-step will be cut if a time-step cut is required." );
 
+  registerWrapper( viewKeysStruct::timeStepControlTypeString(), &m_timeStepControlType ).
+    setApplyDefaultValue( TimeStepControlType::Heuristic ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Controller used to choose the next time-step size. Options are: \n "
+                    "* Heuristic - Increase or decrease the time-step by fixed factors based on the number of Newton iterations and on the state change targets.\n"
+                    "* PID       - Predict the time-step with a PID controller on the ratio between the state changes and their targets, "
+                    "and scale it smoothly with the ratio between the target and actual numbers of Newton iterations." );
+
+  registerWrapper( viewKeysStruct::timeStepCutWarmStartString(), &m_timeStepCutWarmStart ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to start the attempt following a time-step cut from the state at the beginning of the time step moved by "
+                    "the sum of the Newton updates of the iterate with the smallest residual norm of the failed attempt, scaled by "
+                    "the time-step cut factor, instead of the state at the beginning of the time step. The Newton updates are only "
+                    "tracked until a line search or a modified application of the solution (chopping of negative densities, "
+                    "local scaling) occurs." );
+
   registerWrapper( viewKeysStruct::maxTimeStepCutsString(), &m_maxTimeStepCuts ).
     setApplyDefaultValue( 2 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -180,7 +197,13 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
   registerWrapper( viewKeysStruct::nonlinearAccelerationTypeString(), &m_nonlinearAccelerationType ).
     setApplyDefaultValue( NonlinearAccelerationType::None ).
     setInputFlag( dataRepository::InputFlags::OPTIONAL ).
-    setDescription( "Nonlinear acceleration type for sequential solver." );
+    setDescription( "Nonlinear acceleration type for sequential solver. "
+                    "Valid options:\n* " + EnumStrings< NonlinearAccelerationType >::concat( "\n* " ) );
+
+  registerWrapper( viewKeysStruct::andersonDepthString(), &m_andersonDepth ).
+    setApplyDefaultValue( 5 ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setDescription( "Number of previous sequential iterations used by the Anderson acceleration." );
 
 }
 
@@ -193,6 +216,9 @@ void NonlinearSolverParameters::postInputInitialization()
   GEOS_ERROR_IF_LE_MSG( m_lineSearchResidualFactor, 0.0,
                         getWrapperDataContext( viewKeysStruct::lineSearchResidualFactorString() ) << ": should be positive" );
 
+  GEOS_ERROR_IF_LT_MSG( m_andersonDepth, 1,
+                        getWrapperDataContext( viewKeysStruct::andersonDepthString() ) << ": should be at least 1" );
+
   if( getLogLevel() > 0 )
   {
     print();
@@ -225,6 +251,8 @@ void NonlinearSolverParameters::print() const
   tableData.addRow( "Time-step decrease factor", m_timeStepDecreaseFactor );
   tableData.addRow( "Time-step increase factor", m_timeStepDecreaseFactor );
   tableData.addRow( "Time-step cut factor", m_timeStepCutFactor );
+  tableData.addRow( "Time-step control type", m_timeStepControlType );
+  tableData.addRow( "Warm start after time-step cut", m_timeStepCutWarmStart );
   tableData.addRow( "Minimum time-step increase interval", m_minTimeStepIncreaseInterval );
   tableData.addRow( "Maximum time-step cuts", m_maxTimeStepCuts );
   tableData.addRow( "Maximum sub time-steps", m_maxSubSteps );
@@ -234,6 +262,11 @@ void NonlinearSolverParameters::print() const
   {
     tableData.addRow( "Sequential convergence criterion", m_sequentialConvergenceCriterion );
     tableData.addRow( "Subcycling", m_subcyclingOption );
+    tableData.addRow( "Nonlinear acceleration", m_nonlinearAccelerationType );
+    if( m_nonlinearAccelerationType == NonlinearAccelerationType::Anderson )
+    {
+      tableData.addRow( "  Anderson depth", m_andersonDepth );
+    }
   }
   TableLayout const tableLayout = TableLayout( {
       TableLayout::ColumnParam{"Parameter", TableLayout::Alignment::left},
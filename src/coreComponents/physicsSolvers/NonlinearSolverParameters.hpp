@@ -83,6 +83,8 @@ public:
     m_maxSubSteps = params.m_maxSubSteps;
     m_maxTimeStepCuts = params.m_maxTimeStepCuts;
     m_timeStepCutFactor = params.m_timeStepCutFactor;
+    m_timeStepControlType = params.m_timeStepControlType;
+    m_timeStepCutWarmStart = params.m_timeStepCutWarmStart;
     m_maxNumConfigurationAttempts = params.m_maxNumConfigurationAttempts;
     m_configurationTolerance = params.m_configurationTolerance;
 
@@ -131,6 +133,8 @@ public:
     static constexpr char const * maxSubStepsString()             { return "maxSubSteps"; }
     static constexpr char const * maxTimeStepCutsString()         { return "maxTimeStepCuts"; }
     static constexpr char const * timeStepCutFactorString()       { return "timeStepCutFactor"; }
+    static constexpr char const * timeStepControlTypeString()     { return "timeStepControlType"; }
+    static constexpr char const * timeStepCutWarmStartString()    { return "timeStepCutWarmStart"; }
     static constexpr char const * maxAllowedResidualNormString()  { return "maxAllowedResidualNorm"; }
 
     static constexpr char const * maxNumConfigurationAttemptsString() { return "maxNumConfigurationAttempts"; }
@@ -140,6 +144,7 @@ public:
     static constexpr char const * sequentialConvergenceCriterionString() { return "sequentialConvergenceCriterion"; }
     static constexpr char const * subcyclingOptionString()               { return "subcycling"; }
     static constexpr char const * nonlinearAccelerationTypeString() { return "nonlinearAccelerationType"; }
+    static constexpr char const * andersonDepthString()                  { return "andersonDepth"; }
   } viewKeys;
 
   /**
@@ -186,7 +191,17 @@ public:
   enum class NonlinearAccelerationType : integer
   {
     None, ///< no acceleration
-    Aitken ///< Aitken acceleration
+    Aitken, ///< Aitken acceleration
+    Anderson ///< Anderson acceleration
+  };
+
+  /**
+   * @brief Time-step size controller
+   */
+  enum class TimeStepControlType : integer
+  {
+    Heuristic, ///< increase or decrease the time step by fixed factors based on the Newton iterations and state changes
+    PID        ///< predict the time step with a PID controller on the state changes and the Newton iterations
   };
 
   /**
@@ -237,6 +252,15 @@ public:
     return m_minTimeStepIncreaseInterval;
   }
 
+  /**
+   * @brief Getter for the time-step size controller
+   * @return the time-step size controller
+   */
+  TimeStepControlType timeStepControlType() const
+  {
+    return m_timeStepControlType;
+  }
+
   /**
    * @brief Getter for the norm type used to check convergence in the flow/well solvers
    * @return the norm type
@@ -327,6 +351,12 @@ public:
   /// Factor by which the time step will be cut if a timestep cut is required.
   real64 m_timeStepCutFactor;
 
+  /// Time-step size controller
+  TimeStepControlType m_timeStepControlType;
+
+  /// Flag to start the attempt following a time-step cut from the best iterate of the failed attempt
+  integer m_timeStepCutWarmStart;
+
   /// Number of times that the time-step had to be cut
   integer m_numTimeStepAttempts;
 
@@ -351,6 +381,9 @@ public:
   /// Type of nonlinear acceleration for sequential solver
   NonlinearAccelerationType m_nonlinearAccelerationType;
 
+  /// Number of previous sequential iterations used by the Anderson acceleration
+  integer m_andersonDepth;
+
   /// Value used to make sure that residual normalizers are not too small when computing residual norm
   real64 m_minNormalizer = 1e-12;
 };
@@ -364,6 +397,10 @@ ENUM_STRINGS( NonlinearSolverParameters::LineSearchInterpolationType,
               "Linear",
               "Parabolic" );
 
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControlType,
+              "Heuristic",
+              "PID" );
+
 ENUM_STRINGS( NonlinearSolverParameters::CouplingType,
               "FullyImplicit",
               "Sequential" );
@@ -375,7 +412,8 @@ ENUM_STRINGS( NonlinearSolverParameters::SequentialConvergenceCriterion,
 
 ENUM_STRINGS( NonlinearSolverParameters::NonlinearAccelerationType,
               "None",
-              "Aitken" );
+              "Aitken",
+              "Anderson" );
 
 } /* namespace geos */
 
@@ -40,11 +40,15 @@ SolverBase::SolverBase( string const & name,
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
   m_numTimestepsSinceLastDtCut( -1 ),
+  m_relativeStateChange{ -1.0, -1.0 },
   m_dofManager( name ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString(), this ),
   m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString(), this ),
   m_solverStatistics( groupKeyStruct::solverStatisticsString(), this ),
-  m_systemSetupTimestamp( 0 )
+  m_systemSetupTimestamp( 0 ),
+  m_isAppliedSolutionModified( false ),
+  m_bestResidualNorm( LvArray::NumericLimits< real64 >::max ),
+  m_isTimeStepIncrementValid( false )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -423,7 +427,17 @@ real64 SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt )
   integer const iterIncreaseLimit = m_nonlinearSolverParameters.timeStepIncreaseIterLimit();
 
   real64 nextDt = 0;
-  if( newtonIter < iterIncreaseLimit )
+  if( m_nonlinearSolverParameters.timeStepControlType() == NonlinearSolverParameters::TimeStepControlType::PID )
+  {
+    // Scale the time step smoothly to aim at the middle of the [increase, decrease] iteration range
+    real64 const targetIter = 0.5 * ( iterIncreaseLimit + iterDecreaseLimit );
+    real64 const factor = targetIter / std::max( newtonIter, 1 );
+    nextDt = currentDt * std::min( std::max( factor, m_nonlinearSolverParameters.timeStepDecreaseFactor() ),
+                                   m_nonlinearSolverParameters.timeStepIncreaseFactor() );
+    if( m_nonlinearSolverParameters.getLogLevel() > 0 )
+      GEOS_LOG_RANK_0( GEOS_FMT( "{}: number of iterations = {} for a target of {}, next time step = {}", getName(), newtonIter, targetIter, nextDt ));
+  }
+  else if( newtonIter < iterIncreaseLimit )
   {
     // Easy convergence, let's increase the time-step.
     nextDt = currentDt * m_nonlinearSolverParameters.timeStepIncreaseFactor();
@@ -453,6 +467,42 @@ real64 SolverBase::setNextDtBasedOnCFL( const geos::real64 & currentDt, geos::Do
   return LvArray::NumericLimits< real64 >::max;       // i.e., not implemented
 }
 
+real64 SolverBase::setNextDtBasedOnPIDControl( real64 const & currentDt,
+                                               real64 const relativeChange )
+{
+  // PID gains of Valli, Carey and Coutinho (2005), Int. J. Numer. Meth. Fluids 47(3)
+  real64 constexpr kP = 0.075;
+  real64 constexpr kI = 0.175;
+  real64 constexpr kD = 0.01;
+
+  // keep the ratios away from zero when the state barely changes
+  real64 const e = std::max( relativeChange, 1e-3 );
+  // when the history is unknown, the controller degenerates to an integral (first step) or PI (second step) controller
+  real64 const e_nm1 = m_relativeStateChange[0] > 0 ? m_relativeStateChange[0] : e;
+  real64 const e_nm2 = m_relativeStateChange[1] > 0 ? m_relativeStateChange[1] : e_nm1;
+
+  real64 factor = 0.0;
+  if( e > 1.0 )
+  {
+    // the target was exceeded, shrink the time step proportionally
+    factor = 1.0 / e;
+  }
+  else
+  {
+    factor = std::pow( e_nm1 / e, kP ) * std::pow( 1.0 / e, kI ) * std::pow( e_nm1 * e_nm1 / ( e * e_nm2 ), kD );
+    factor = std::min( std::max( factor, m_nonlinearSolverParameters.timeStepDecreaseFactor() ),
+                       m_nonlinearSolverParameters.timeStepIncreaseFactor() );
+  }
+
+  m_relativeStateChange[1] = m_relativeStateChange[0];
+  m_relativeStateChange[0] = e;
+
+  real64 const nextDt = currentDt * factor;
+  if( m_nonlinearSolverParameters.getLogLevel() > 0 )
+    GEOS_LOG_RANK_0( GEOS_FMT( "{}: ratio between the state change and its target = {}, next time step = {} (PID)", getName(), e, nextDt ));
+  return nextDt;
+}
+
 
 
 real64 SolverBase::linearImplicitStep( real64 const & time_n,
@@ -768,6 +818,8 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
 
   bool const allowNonConverged = m_nonlinearSolverParameters.m_allowNonConverged > 0;
 
+  bool const useWarmStart = m_nonlinearSolverParameters.m_timeStepCutWarmStart > 0;
+
   integer & dtAttempt = m_nonlinearSolverParameters.m_numTimeStepAttempts;
 
   integer const & maxConfigurationIter = m_nonlinearSolverParameters.m_maxNumConfigurationAttempts;
@@ -776,6 +828,11 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
 
   bool isConfigurationLoopConverged = false;
 
+  if( useWarmStart )
+  {
+    resetTimeStepIncrement( false );
+  }
+
   // outer loop attempts to apply full timestep, and managed the cutting of the timestep if
   // required.
   for( dtAttempt = 0; dtAttempt < maxNumberDtCuts; ++dtAttempt )
@@ -785,6 +842,12 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
     {
       resetStateToBeginningOfStep( domain );
       resetConfigurationToBeginningOfStep( domain );
+
+      // start from the best iterate of the failed attempt, scaled to the new time step
+      if( useWarmStart )
+      {
+        warmStartAfterTimeStepCut( stepDt, dtCutFactor, domain );
+      }
     }
 
     // it's the simplest configuration that can be attempted whenever Newton's fails as a last resource.
@@ -820,6 +883,11 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       else if( !attemptedSimplestConfiguration )
       {
         resetStateToBeginningOfStep( domain );
+        if( useWarmStart )
+        {
+          // the best iterate of the attempt is kept for the warm start following a time-step cut
+          resetTimeStepIncrement( true );
+        }
         bool const breakLoop = resetConfigurationToDefault( domain );
         attemptedSimplestConfiguration = true;
         if( breakLoop )
@@ -887,6 +955,9 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
 
   bool isNewtonConverged = false;
 
+  // whether the state has been refreshed for the convergence check of the current Newton iteration
+  bool isStateRefreshed = false;
+
   for( newtonIter = 0; newtonIter < maxNewtonIter; ++newtonIter )
   {
     GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "    Attempt: {:2}, ConfigurationIter: {:2}, NewtonIter: {:2}", dtAttempt, configurationLoopIter, newtonIter ) );
@@ -945,9 +1016,19 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
     // converged and break from the Newton loop immediately.
     if( residualNorm < newtonTol && newtonIter >= minNewtonIter )
     {
+      // a residual assembled from a partially updated state cannot be trusted: the state is
+      // refreshed and the residual is assembled and checked again, in the same Newton iteration
+      if( !isStateRefreshed && refreshStateForConvergenceCheck( domain ) )
+      {
+        GEOS_LOG_LEVEL_RANK_0( 1, "        State refreshed before the convergence check" );
+        isStateRefreshed = true;
+        --newtonIter;
+        continue;
+      }
       isNewtonConverged = true;
       break;
     }
+    isStateRefreshed = false;
 
     // if the residual norm is above the max allowed residual norm, we break from
     // the Newton loop to avoid crashes due to Newton divergence
@@ -961,11 +1042,21 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
       break;
     }
 
+    // keep the iterate with the smallest residual norm to warm start the attempt following a time-step cut
+    if( m_isTimeStepIncrementValid && residualNorm < m_bestResidualNorm )
+    {
+      m_bestResidualNorm = residualNorm;
+      m_bestTimeStepIncrement.copy( m_timeStepIncrement );
+    }
+
     // do line search in case residual has increased
     if( m_nonlinearSolverParameters.m_lineSearchAction != NonlinearSolverParameters::LineSearchAction::None
         && residualNorm > lastResidual * m_nonlinearSolverParameters.m_lineSearchResidualFactor
         && newtonIter >= m_nonlinearSolverParameters.m_lineSearchStartingIteration )
     {
+      // the line search modifies the applied update, which is no longer tracked
+      m_isTimeStepIncrementValid = false;
+
       bool lineSearchSuccess = false;
       if( m_nonlinearSolverParameters.m_lineSearchInterpType == NonlinearSolverParameters::LineSearchInterpolationType::Linear )
       {
@@ -1068,6 +1159,16 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
 
       // apply the system solution to the fields/variables
       applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, stepDt, domain );
+
+      // the sum of the scaled solutions only matches the state if they have been applied exactly
+      if( isAppliedSolutionModified() )
+      {
+        m_isTimeStepIncrementValid = false;
+      }
+      else if( m_isTimeStepIncrementValid )
+      {
+        m_timeStepIncrement.axpy( scaleFactor, m_solution );
+      }
     }
 
     {
@@ -1083,6 +1184,55 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
   return isNewtonConverged;
 }
 
+void SolverBase::resetTimeStepIncrement( bool const keepBestIterate )
+{
+  localIndex const numLocalDofs = m_dofManager.numLocalDofs();
+  if( !m_timeStepIncrement.created() || m_timeStepIncrement.localSize() != numLocalDofs )
+  {
+    m_timeStepIncrement.create( numLocalDofs, MPI_COMM_GEOS );
+    m_bestTimeStepIncrement.create( numLocalDofs, MPI_COMM_GEOS );
+  }
+  m_timeStepIncrement.zero();
+  if( !keepBestIterate )
+  {
+    m_bestResidualNorm = LvArray::NumericLimits< real64 >::max;
+  }
+  m_isTimeStepIncrementValid = true;
+}
+
+void SolverBase::warmStartAfterTimeStepCut( real64 const & dt,
+                                            real64 const cutFactor,
+                                            DomainPartition & domain )
+{
+  // the residual norm is global, so that all the ranks take the same decision
+  if( m_bestResidualNorm >= LvArray::NumericLimits< real64 >::max ||
+      m_bestTimeStepIncrement.localSize() != m_dofManager.numLocalDofs() )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, "    No tracked iterate to warm start from, restarting from the beginning of the time step." );
+    resetTimeStepIncrement( false );
+    return;
+  }
+
+  arrayView1d< real64 const > const bestIncrement = m_bestTimeStepIncrement.values();
+  if( !checkSystemSolution( domain, m_dofManager, bestIncrement, cutFactor ) )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, "    Warm start solution check failed, restarting from the beginning of the time step." );
+    resetTimeStepIncrement( false );
+    return;
+  }
+
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "    Warm start from the iterate with ( R ) = ( {:4.2e} ) of the failed attempt", m_bestResidualNorm ) );
+
+  applySystemSolution( m_dofManager, bestIncrement, cutFactor, dt, domain );
+  updateState( domain );
+
+  // the new attempt starts from the scaled best increment
+  m_timeStepIncrement.copy( m_bestTimeStepIncrement );
+  m_timeStepIncrement.scale( cutFactor );
+  m_bestResidualNorm = LvArray::NumericLimits< real64 >::max;
+  m_isTimeStepIncrementValid = !isAppliedSolutionModified();
+}
+
 real64 SolverBase::explicitStep( real64 const & GEOS_UNUSED_PARAM( time_n ),
                                  real64 const & GEOS_UNUSED_PARAM( dt ),
                                  integer const GEOS_UNUSED_PARAM( cycleNumber ),
@@ -1337,6 +1487,11 @@ void SolverBase::updateState( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
   GEOS_ERROR( "SolverBase::updateState called!. Should be overridden." );
 }
 
+bool SolverBase::refreshStateForConvergenceCheck( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
+{
+  return false;
+}
+
 bool SolverBase::updateConfiguration( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
 {
   return true;
@@ -247,6 +247,16 @@ public:
   virtual real64 setNextDtBasedOnCFL( real64 const & currentDt,
                                       DomainPartition & domain );
 
+  /**
+   * @brief function to set the next dt with a PID controller on the state change
+   * @param[in] currentDt the current time step size
+   * @param[in] relativeChange the ratio between the state change during the time step and its target
+   * @return the prescribed time step size
+   *
+   * The controller uses the ratios of the last three time steps, so it must be called once per converged time step.
+   */
+  real64 setNextDtBasedOnPIDControl( real64 const & currentDt,
+                                     real64 const relativeChange );
 
 
   /**
@@ -575,6 +585,15 @@ public:
                        real64 const dt,
                        DomainPartition & domain );
 
+  /**
+   * @brief Check whether the last call to applySystemSolution modified the scaled solution before adding it
+   * @return true if the primary variables have not been moved by exactly the scaled solution,
+   *         for instance because of a chopping or of a local scaling
+   *
+   * @note The returned value must be the same on all ranks.
+   */
+  virtual bool isAppliedSolutionModified() const { return m_isAppliedSolutionModified; }
+
   /**
    * @brief updates the configuration (if needed) based on the state after a converged Newton loop.
    * @param domain the domain containing the mesh and fields
@@ -608,6 +627,15 @@ public:
    */
   virtual void updateState( DomainPartition & domain );
 
+  /**
+   * @brief Bring the dependent quantities up to date before a converged residual is accepted
+   * @param domain the domain containing the mesh and fields
+   * @return true if the state has been updated, in which case the residual must be assembled again
+   *
+   * This is needed by solvers whose state update only evaluates some of the dependent quantities.
+   */
+  virtual bool refreshStateForConvergenceCheck( DomainPartition & domain );
+
   /**
    * @brief reset state of physics back to the beginning of the step.
    * @param domain
@@ -1016,6 +1044,9 @@ protected:
   /// Number of cycles since last timestep cut
   integer m_numTimestepsSinceLastDtCut;
 
+  /// Ratios between the state change and its target of the last two time steps (negative if unknown), used by the PID controller
+  real64 m_relativeStateChange[2];
+
   /// name of the FV discretization object in the data repository
   string m_discretizationName;
 
@@ -1055,6 +1086,9 @@ protected:
   /// Timestamp of the last call to setup system
   Timestamp m_systemSetupTimestamp;
 
+  /// Flag indicating whether the last call to applySystemSolution modified the scaled solution (see isAppliedSolutionModified)
+  bool m_isAppliedSolutionModified;
+
   /// Callback function for assembly step
   std::function< void( CRSMatrix< real64, globalIndex >, array1d< real64 > ) > m_assemblyCallback;
 
@@ -1068,6 +1102,19 @@ private:
   /// Map containing the array of target regions (value) for each MeshBody (key).
   map< std::pair< string, string >, array1d< string > > m_meshTargets;
 
+  /// Sum of the Newton updates applied since the beginning of the time step attempt
+  ParallelVector m_timeStepIncrement;
+
+  /// Sum of the Newton updates of the iterate with the smallest residual norm of the time step attempt
+  ParallelVector m_bestTimeStepIncrement;
+
+  /// Residual norm of the iterate stored in m_bestTimeStepIncrement
+  real64 m_bestResidualNorm;
+
+  /// Flag indicating whether m_timeStepIncrement still matches the applied Newton updates
+  /// (false after a line search or a modified application of the solution)
+  bool m_isTimeStepIncrementValid;
+
   /**
    * @brief This function sets constitutive name fields on an
    *  ElementSubRegionBase, and DOES NOT call the base function it overrides.
@@ -1089,6 +1136,25 @@ private:
                              integer const cycleNumber,
                              DomainPartition & domain );
 
+  /**
+   * @brief Reset the sum of the Newton updates tracked to warm start the attempt following a time-step cut
+   * @param keepBestIterate flag to keep the iterate with the smallest residual norm recorded so far
+   */
+  void resetTimeStepIncrement( bool const keepBestIterate );
+
+  /**
+   * @brief Start the attempt following a time-step cut from the best iterate of the failed attempt
+   * @param dt the time step size of the new attempt
+   * @param cutFactor the ratio between the time step sizes of the new and failed attempts
+   * @param domain the domain partition
+   *
+   * The state, reset to the beginning of the step, is moved by cutFactor times the sum of the Newton
+   * updates of the iterate with the smallest residual norm of the failed attempt.
+   */
+  void warmStartAfterTimeStepCut( real64 const & dt,
+                                  real64 const cutFactor,
+                                  DomainPartition & domain );
+
   /**
    * @brief output information about the cycle to the log
    * @param cycleNumber the current cycle number
@@ -22,6 +22,7 @@
 #define GEOS_PHYSICSSOLVERS_CONTACT_SOLIDMECHANICSEFEMJUMPUPDATEKERNELS_HPP_
 
 #include "SolidMechanicsEFEMKernelsBase.hpp"
+#include "denseLinearAlgebra/denseLAFactorizations.hpp"
 
 namespace geos
 {
@@ -205,17 +206,15 @@ public:
     LvArray::tensorOps::scaledAdd< 3 >( stack.localRw, stack.tractionVec, -1 );
     LvArray::tensorOps::scaledAdd< 3, 3 >( stack.localKww, stack.dTractiondw, -1 );
 
-    // Compute dw given du
-    real64 dWlocal[3], InvKww[3][3], InvKwwKwu[3][nUdof];
-
-    // compute inv(Kww)
-    LvArray::tensorOps::invert< 3 >( InvKww, stack.localKww );
-    // compute inv(kww)Kwu
-    LvArray::tensorOps::Rij_eq_AikBkj< 3, nUdof, 3 >( InvKwwKwu, InvKww, stack.localKwu );
-    // add invKww Rw to dw
-    LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( dWlocal, InvKww, stack.localRw );
-    // add inv(kww)Kwu * du to dw
-    LvArray::tensorOps::Ri_add_AijBj< 3, nUdof >( dWlocal, InvKwwKwu, stack.dUlocal );
+    // Compute dw given du: dw = -inv(Kww) * ( Rw + Kwu * du ), with a single solve
+    real64 dWlocal[3];
+    LvArray::tensorOps::copy< 3 >( dWlocal, stack.localRw );
+    LvArray::tensorOps::Ri_add_AijBj< 3, nUdof >( dWlocal, stack.localKwu, stack.dUlocal );
+
+    integer KwwPivots[3];
+    bool const factorized = denseLinearAlgebra::luFactorize< 3 >( stack.localKww, KwwPivots );
+    GEOS_ERROR_IF( !factorized, "Singular Kww block in the jump update" );
+    denseLinearAlgebra::luSolve< 3 >( stack.localKww, KwwPivots, dWlocal );
     LvArray::tensorOps::scale< 3 >( dWlocal, -1 );
 
     localIndex const embSurfIndex = m_cellsToEmbeddedSurfaces[k][0];
@@ -22,6 +22,7 @@
 #define GEOS_PHYSICSSOLVERS_CONTACT_SOLIDMECHANICSEFEMSTATICCONDENSATIONKERNELS_HPP_
 
 #include "SolidMechanicsEFEMKernelsBase.hpp"
+#include "denseLinearAlgebra/denseLAFactorizations.hpp"
 
 namespace geos
 {
@@ -202,18 +203,22 @@ public:
     // Apply static condensation
     real64 localJacobian[nUdof][nUdof];
 
-    real64 InvKww[3][3];
-    LvArray::tensorOps::invert< 3 >( InvKww, stack.localKww );
+    // Kww is factorized once and solved for Rw and the columns of Kwu, instead of being inverted
+    integer KwwPivots[3];
+    bool const factorized = denseLinearAlgebra::luFactorize< 3 >( stack.localKww, KwwPivots );
+    GEOS_ERROR_IF( !factorized, "Singular Kww block in the static condensation" );
 
     // Residual (Ru -= Kuw * Inv(Kww)Rw)
-    real64 KuwInvKww[nUdof][3], Ruw[nUdof];
-    LvArray::tensorOps::Rij_eq_AikBkj< nUdof, 3, 3 >( KuwInvKww, stack.localKuw, InvKww );
-    LvArray::tensorOps::Ri_eq_AijBj< nUdof, 3 >( Ruw, KuwInvKww, stack.localRw );
+    real64 InvKwwRw[3], Ruw[nUdof];
+    LvArray::tensorOps::copy< 3 >( InvKwwRw, stack.localRw );
+    denseLinearAlgebra::luSolve< 3 >( stack.localKww, KwwPivots, InvKwwRw );
+    LvArray::tensorOps::Ri_eq_AijBj< nUdof, 3 >( Ruw, stack.localKuw, InvKwwRw );
     LvArray::tensorOps::scaledAdd< nUdof >( stack.localRu, Ruw, -1 );
 
     // Jacobian to add to Kuu block  ( Kuu -= Kuw * Inv(Kww) * Kwu )
     real64 InvKwwKwu[3][nUdof];
-    LvArray::tensorOps::Rij_eq_AikBkj< 3, nUdof, 3 >( InvKwwKwu, InvKww, stack.localKwu );
+    LvArray::tensorOps::copy< 3, nUdof >( InvKwwKwu, stack.localKwu );
+    denseLinearAlgebra::luSolveMultiple< 3, nUdof >( stack.localKww, KwwPivots, InvKwwKwu );
     LvArray::tensorOps::Rij_eq_AikBkj< nUdof, nUdof, 3 >( localJacobian, stack.localKuw, InvKwwKwu );
     LvArray::tensorOps::scale< nUdof, nUdof >( localJacobian, -1 );
 
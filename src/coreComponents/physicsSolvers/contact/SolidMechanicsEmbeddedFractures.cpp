@@ -512,20 +512,16 @@ void SolidMechanicsEmbeddedFractures::applyTractionBC( real64 const time_n,
                                                                arrayView1d< string const > const & )
   {
 
-    fsManager.apply< ElementSubRegionBase >( time_n+ dt,
-                                             mesh,
-                                             contact::traction::key(),
-                                             [&] ( FieldSpecificationBase const & fs,
-                                                   string const &,
-                                                   SortedArrayView< localIndex const > const & targetSet,
-                                                   ElementSubRegionBase & subRegion,
-                                                   string const & )
-    {
-      fs.applyFieldValue< FieldSpecificationEqual, parallelHostPolicy >( targetSet,
-                                                                         time_n+dt,
-                                                                         subRegion,
-                                                                         contact::traction::key() );
-    } );
+    fsManager.applyFieldValueToField< ElementSubRegionBase, parallelHostPolicy >( time_n+ dt,
+                                                                                  mesh,
+                                                                                  contact::traction::key(),
+                                                                                  contact::traction::key(),
+                                                                                  [&] ( FieldSpecificationBase const &,
+                                                                                        string const &,
+                                                                                        SortedArrayView< localIndex const > const &,
+                                                                                        ElementSubRegionBase &,
+                                                                                        string const & )
+    {} );
   } );
 }
 
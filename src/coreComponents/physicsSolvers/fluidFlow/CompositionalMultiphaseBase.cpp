@@ -33,6 +33,7 @@
 #include "constitutive/relativePermeability/RelativePermeabilitySelector.hpp"
 #include "constitutive/solid/SolidInternalEnergy.hpp"
 #include "constitutive/thermalConductivity/MultiPhaseThermalConductivitySelector.hpp"
+#include "dataRepository/WrapperHandle.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
 #include "fieldSpecification/EquilibriumInitialCondition.hpp"
 #include "fieldSpecification/SourceFluxBoundaryCondition.hpp"
@@ -68,7 +69,11 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
   m_allowCompDensChopping( 1 ),
   m_useTotalMassEquation( 1 ),
   m_useSimpleAccumulation( 1 ),
-  m_minCompDens( isothermalCompositionalMultiphaseBaseKernels::minDensForDivision )
+  m_minCompDens( isothermalCompositionalMultiphaseBaseKernels::minDensForDivision ),
+  m_activeSetTolerance( 0.0 ),
+  m_activeSetRefreshFrequency( 5 ),
+  m_numStateUpdates( 0 ),
+  m_isStateUpdatePartial( 0 )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::inputTemperatureString(), &m_inputTemperature ).
@@ -129,6 +134,13 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( LvArray::NumericLimits< real64 >::max/1.0e100 ). // disabled by default
     setDescription( "Maximum (relative) change in a component density in a Newton iteration" );
+  this->registerWrapper( viewKeyStruct::maxPhaseVolFracChangeString(), &m_maxPhaseVolFracChange ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1.0 ). // disabled by default
+    setDescription( "Maximum (absolute) change in a phase volume fraction in a Newton iteration, predicted with the derivatives of the phase volume fractions. "
+                    "The Newton update is chopped in the cells where this change is exceeded (a value of 1.0 disables the chopping). "
+                    "This is a cheaper alternative to the line search, which requires an assembly for each backtracking step" );
 
   this->registerWrapper( viewKeyStruct::allowLocalCompDensChoppingString(), &m_allowCompDensChopping ).
     setSizedFromParent( 0 ).
@@ -171,6 +183,23 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0.01 ).
     setDescription( "Minimum value for solution scaling factor" );
+
+  this->registerWrapper( viewKeyStruct::activeSetToleranceString(), &m_activeSetTolerance ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Change in pressure, temperature (both relative), or global component fraction (absolute) since the last "
+                    "evaluation of the properties of a cell, below which the cell is frozen during the Newton state update: "
+                    "its fluid, relative permeability, and capillary pressure properties (and their derivatives) are reused "
+                    "from the last evaluation. The properties of all the cells are evaluated before convergence is declared. "
+                    "A value of 0 disables the active set" );
+
+  this->registerWrapper( viewKeyStruct::activeSetRefreshFrequencyString(), &m_activeSetRefreshFrequency ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 5 ).
+    setDescription( "Number of Newton state updates between two evaluations of the properties of all the cells, "
+                    "when activeSetTolerance is positive" );
 }
 
 void CompositionalMultiphaseBase::postInputInitialization()
@@ -192,6 +221,12 @@ void CompositionalMultiphaseBase::postInputInitialization()
   GEOS_ERROR_IF_LE_MSG( m_maxRelativeCompDensChange, 0.0,
                         getWrapperDataContext( viewKeyStruct::maxRelativeCompDensChangeString() ) <<
                         ": The maximum relative change in component density in a Newton iteration must be larger than 0.0" );
+  GEOS_ERROR_IF_LE_MSG( m_maxPhaseVolFracChange, 0.0,
+                        getWrapperDataContext( viewKeyStruct::maxPhaseVolFracChangeString() ) <<
+                        ": The maximum absolute change in phase volume fraction in a Newton iteration must be larger than 0.0" );
+  GEOS_ERROR_IF_GT_MSG( m_maxPhaseVolFracChange, 1.0,
+                        getWrapperDataContext( viewKeyStruct::maxPhaseVolFracChangeString() ) <<
+                        ": The maximum absolute change in phase volume fraction in a Newton iteration must be smaller or equal to 1.0" );
   GEOS_ERROR_IF_LE_MSG( m_targetRelativePresChange, 0.0,
                         getWrapperDataContext( viewKeyStruct::targetRelativePresChangeString() ) <<
                         ": The target relative change in pressure in a time step must be larger than 0.0" );
@@ -217,6 +252,12 @@ void CompositionalMultiphaseBase::postInputInitialization()
   GEOS_ERROR_IF_GT_MSG( m_minScalingFactor, 1.0,
                         getWrapperDataContext( viewKeyStruct::minScalingFactorString() ) <<
                         ": The minumum scaling factor must be smaller or equal to 1.0" );
+  GEOS_ERROR_IF_LT_MSG( m_activeSetTolerance, 0.0,
+                        getWrapperDataContext( viewKeyStruct::activeSetToleranceString() ) <<
+                        ": The active set tolerance must be larger or equal to 0.0" );
+  GEOS_ERROR_IF_LT_MSG( m_activeSetRefreshFrequency, 1,
+                        getWrapperDataContext( viewKeyStruct::activeSetRefreshFrequencyString() ) <<
+                        ": The active set refresh frequency must be at least 1" );
 
   if( m_isThermal && m_useSimpleAccumulation == 1 ) // useSimpleAccumulation is not yet compatible with thermal
   {
@@ -402,6 +443,15 @@ void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
         setDimLabels( 1, fluid.componentNames() ).
         reference().resizeDimension< 1 >( m_numComponents );
 
+      if( m_activeSetTolerance > 0.0 )
+      {
+        subRegion.registerField< isActiveForStateUpdate >( getName() );
+        subRegion.registerField< pressure_lastStateUpdate >( getName() );
+        subRegion.registerField< temperature_lastStateUpdate >( getName() );
+        subRegion.registerField< globalCompFraction_lastStateUpdate >( getName() ).
+          reference().resizeDimension< 1 >( m_numComponents );
+      }
+
     } );
 
     FaceManager & faceManager = mesh.getFaceManager();
@@ -552,7 +602,7 @@ void CompositionalMultiphaseBase::initializePreSubGroups()
                                                 [&]( localIndex const,
                                                      ElementSubRegionBase & subRegion )
     {
-      arrayView1d< real64 > const temp = subRegion.getField< fields::flow::temperature >();
+      arrayView1d< real64 > const temp = getCachedField< fields::flow::temperature >( subRegion );
       temp.setValues< parallelHostPolicy >( m_inputTemperature );
     } );
   } );
@@ -662,14 +712,55 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
 {
   GEOS_MARK_FUNCTION;
 
-  arrayView1d< real64 const > const pres = dataGroup.getField< fields::flow::pressure >();
-  arrayView1d< real64 const > const temp = dataGroup.getField< fields::flow::temperature >();
+  arrayView1d< real64 const > const pres = getCachedField< fields::flow::pressure >( dataGroup );
+  arrayView1d< real64 const > const temp = getCachedField< fields::flow::temperature >( dataGroup );
   arrayView2d< real64 const, compflow::USD_COMP > const compFrac =
-    dataGroup.getField< fields::flow::globalCompFraction >();
+    getCachedField< fields::flow::globalCompFraction >( dataGroup );
 
   string const & fluidName = dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() );
   MultiFluidBase & fluid = getConstitutiveModel< MultiFluidBase >( dataGroup, fluidName );
 
+  if( m_activeSetTolerance > 0.0 )
+  {
+    arrayView1d< integer const > const isActive = getCachedField< fields::flow::isActiveForStateUpdate >( dataGroup );
+
+    constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+    {
+      using FluidType = TYPEOFREF( castedFluid );
+      using ExecPolicy = typename FluidType::exec_policy;
+      typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( isActive,
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    } );
+
+    // record the state at which the properties have been evaluated
+    arrayView1d< real64 > const presLast = getCachedField< fields::flow::pressure_lastStateUpdate >( dataGroup );
+    arrayView1d< real64 > const tempLast = getCachedField< fields::flow::temperature_lastStateUpdate >( dataGroup );
+    arrayView2d< real64, compflow::USD_COMP > const compFracLast =
+      getCachedField< fields::flow::globalCompFraction_lastStateUpdate >( dataGroup );
+    integer const numComp = m_numComponents;
+
+    forAll< parallelDevicePolicy<> >( dataGroup.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+    {
+      if( isActive[ei] )
+      {
+        presLast[ei] = pres[ei];
+        tempLast[ei] = temp[ei];
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          compFracLast[ei][ic] = compFrac[ei][ic];
+        }
+      }
+    } );
+    return;
+  }
+
   constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
   {
     using FluidType = TYPEOFREF( castedFluid );
@@ -686,12 +777,48 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
   } );
 }
 
+localIndex CompositionalMultiphaseBase::updateActiveSet( ObjectManagerBase & dataGroup ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const pres = getCachedField< fields::flow::pressure >( dataGroup );
+  arrayView1d< real64 const > const temp = getCachedField< fields::flow::temperature >( dataGroup );
+  arrayView2d< real64 const, compflow::USD_COMP > const compFrac =
+    getCachedField< fields::flow::globalCompFraction >( dataGroup );
+  arrayView1d< real64 const > const presLast = getCachedField< fields::flow::pressure_lastStateUpdate >( dataGroup );
+  arrayView1d< real64 const > const tempLast = getCachedField< fields::flow::temperature_lastStateUpdate >( dataGroup );
+  arrayView2d< real64 const, compflow::USD_COMP > const compFracLast =
+    getCachedField< fields::flow::globalCompFraction_lastStateUpdate >( dataGroup );
+  arrayView1d< integer const > const ghostRank = dataGroup.ghostRank();
+  arrayView1d< integer > const isActive = getCachedField< fields::flow::isActiveForStateUpdate >( dataGroup );
+
+  real64 const tol = m_activeSetTolerance;
+  integer const numComp = m_numComponents;
+
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > numActive( 0 );
+  forAll< parallelDevicePolicy<> >( dataGroup.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+  {
+    bool active = LvArray::math::abs( pres[ei] - presLast[ei] ) > tol * LvArray::math::abs( presLast[ei] )
+                  || LvArray::math::abs( temp[ei] - tempLast[ei] ) > tol * LvArray::math::abs( tempLast[ei] );
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      active = active || LvArray::math::abs( compFrac[ei][ic] - compFracLast[ei][ic] ) > tol;
+    }
+    isActive[ei] = active;
+    if( active && ghostRank[ei] < 0 )
+    {
+      numActive += 1;
+    }
+  } );
+  return numActive.get();
+}
+
 void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGroup ) const
 {
   GEOS_MARK_FUNCTION;
 
   arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
-    dataGroup.getField< fields::flow::phaseVolumeFraction >();
+    getCachedField< fields::flow::phaseVolumeFraction >( dataGroup );
 
   string const & relPermName = dataGroup.getReference< string >( viewKeyStruct::relPermNamesString() );
   RelativePermeabilityBase & relPerm = getConstitutiveModel< RelativePermeabilityBase >( dataGroup, relPermName );
@@ -700,11 +827,22 @@ void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGr
   {
     typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
 
-    isothermalCompositionalMultiphaseBaseKernels::
-      RelativePermeabilityUpdateKernel::
-      launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                        relPermWrapper,
-                                        phaseVolFrac );
+    if( m_activeSetTolerance > 0.0 )
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( getCachedField< fields::flow::isActiveForStateUpdate >( dataGroup ).toViewConst(),
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
+    else
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
   } );
 }
 
@@ -715,7 +853,7 @@ void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & da
   if( m_hasCapPressure )
   {
     arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
-      dataGroup.getField< fields::flow::phaseVolumeFraction >();
+      getCachedField< fields::flow::phaseVolumeFraction >( dataGroup );
 
     string const & cappresName = dataGroup.getReference< string >( viewKeyStruct::capPressureNamesString() );
     CapillaryPressureBase & capPressure = getConstitutiveModel< CapillaryPressureBase >( dataGroup, cappresName );
@@ -724,11 +862,22 @@ void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & da
     {
       typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
 
-      isothermalCompositionalMultiphaseBaseKernels::
-        CapillaryPressureUpdateKernel::
-        launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                          capPresWrapper,
-                                          phaseVolFrac );
+      if( m_activeSetTolerance > 0.0 )
+      {
+        isothermalCompositionalMultiphaseBaseKernels::
+          CapillaryPressureUpdateKernel::
+          launch< parallelDevicePolicy<> >( getCachedField< fields::flow::isActiveForStateUpdate >( dataGroup ).toViewConst(),
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
+      else
+      {
+        isothermalCompositionalMultiphaseBaseKernels::
+          CapillaryPressureUpdateKernel::
+          launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
     } );
   }
 }
@@ -741,8 +890,8 @@ void CompositionalMultiphaseBase::updateCompAmount( ElementSubRegionBase & subRe
   CoupledSolidBase const & porousMaterial = getConstitutiveModel< CoupledSolidBase >( subRegion, solidName );
   arrayView2d< real64 const > const porosity = porousMaterial.getPorosity();
   arrayView1d< real64 const > const volume = subRegion.getElementVolume();
-  arrayView2d< real64 const, compflow::USD_COMP > const compDens = subRegion.getField< fields::flow::globalCompDensity >();
-  arrayView2d< real64, compflow::USD_COMP > const compAmount = subRegion.getField< fields::flow::compAmount >();
+  arrayView2d< real64 const, compflow::USD_COMP > const compDens = getCachedField< fields::flow::globalCompDensity >( subRegion );
+  arrayView2d< real64, compflow::USD_COMP > const compAmount = getCachedField< fields::flow::compAmount >( subRegion );
 
   integer const numComp = m_numComponents;
 
@@ -764,13 +913,13 @@ void CompositionalMultiphaseBase::updateEnergy( ElementSubRegionBase & subRegion
   arrayView2d< real64 const > const porosity = porousMaterial.getPorosity();
   arrayView2d< real64 const > rockInternalEnergy = porousMaterial.getInternalEnergy();
   arrayView1d< real64 const > const volume = subRegion.getElementVolume();
-  arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac = subRegion.getField< fields::flow::phaseVolumeFraction >();
+  arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac = getCachedField< fields::flow::phaseVolumeFraction >( subRegion );
   string const & fluidName = getConstitutiveName< MultiFluidBase >( subRegion );
   MultiFluidBase & fluid = subRegion.getConstitutiveModel< MultiFluidBase >( fluidName );
   arrayView3d< real64 const, multifluid::USD_PHASE > const phaseDens = fluid.phaseDensity();
   arrayView3d< real64 const, multifluid::USD_PHASE > const phaseInternalEnergy = fluid.phaseInternalEnergy();
 
-  arrayView1d< real64 > const energy = subRegion.getField< fields::flow::energy >();
+  arrayView1d< real64 > const energy = getCachedField< fields::flow::energy >( subRegion );
 
   integer const numPhases = m_numPhases;
 
@@ -786,7 +935,7 @@ void CompositionalMultiphaseBase::updateEnergy( ElementSubRegionBase & subRegion
 
 void CompositionalMultiphaseBase::updateSolidInternalEnergyModel( ObjectManagerBase & dataGroup ) const
 {
-  arrayView1d< real64 const > const temp = dataGroup.getField< fields::flow::temperature >();
+  arrayView1d< real64 const > const temp = getCachedField< fields::flow::temperature >( dataGroup );
 
   string const & solidInternalEnergyName = dataGroup.getReference< string >( viewKeyStruct::solidInternalEnergyNamesString() );
   SolidInternalEnergy & solidInternalEnergy = getConstitutiveModel< SolidInternalEnergy >( dataGroup, solidInternalEnergyName );
@@ -807,6 +956,13 @@ real64 CompositionalMultiphaseBase::updateFluidState( ElementSubRegionBase & sub
   GEOS_MARK_FUNCTION;
 
   updateGlobalComponentFraction( subRegion );
+  return updateFluidProperties( subRegion );
+}
+
+real64 CompositionalMultiphaseBase::updateFluidProperties( ElementSubRegionBase & subRegion ) const
+{
+  GEOS_MARK_FUNCTION;
+
   updateFluidModel( subRegion );
   updateCompAmount( subRegion );
   real64 const maxDeltaPhaseVolFrac = updatePhaseVolumeFraction( subRegion );
@@ -845,9 +1001,9 @@ void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh,
     arrayView2d< real64 const, multifluid::USD_FLUID > const totalDens = fluid.totalDensity();
 
     arrayView2d< real64 const, compflow::USD_COMP > const compFrac =
-      subRegion.getField< fields::flow::globalCompFraction >();
+      getCachedField< fields::flow::globalCompFraction >( subRegion );
     arrayView2d< real64, compflow::USD_COMP > const compDens =
-      subRegion.getField< fields::flow::globalCompDensity >();
+      getCachedField< fields::flow::globalCompDensity >( subRegion );
 
     forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
     {
@@ -874,7 +1030,7 @@ void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh,
     //      - the fluid constitutive quantities (as they have already been updated)
     // We postpone the other constitutive models for now
     // In addition, to avoid multiplying permeability/porosity bay netToGross in the assembly kernel, we do it once and for all here
-    arrayView1d< real64 const > const netToGross = subRegion.template getField< fields::flow::netToGross >();
+    arrayView1d< real64 const > const netToGross = getCachedField< fields::flow::netToGross >( subRegion );
     CoupledSolidBase const & porousSolid =
       getConstitutiveModel< CoupledSolidBase >( subRegion, subRegion.template getReference< string >( viewKeyStruct::solidNamesString() ) );
     PermeabilityBase const & permeabilityModel =
@@ -907,7 +1063,7 @@ void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh,
 
     // initialized phase volume fraction
     arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
-      subRegion.template getField< fields::flow::phaseVolumeFraction >();
+      getCachedField< fields::flow::phaseVolumeFraction >( subRegion );
 
     string const & relpermName = subRegion.template getReference< string >( viewKeyStruct::relPermNamesString() );
     RelativePermeabilityBase & relPermMaterial =
@@ -980,7 +1136,7 @@ void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh,
     {
       string const & diffusionName = subRegion.template getReference< string >( viewKeyStruct::diffusionNamesString() );
       DiffusionBase const & diffusionMaterial = getConstitutiveModel< DiffusionBase >( subRegion, diffusionName );
-      arrayView1d< real64 const > const temperature = subRegion.template getField< fields::flow::temperature >();
+      arrayView1d< real64 const > const temperature = getCachedField< fields::flow::temperature >( subRegion );
       diffusionMaterial.initializeTemperatureState( temperature );
     }
     if( m_hasDispersion )
@@ -998,10 +1154,10 @@ void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh,
   mesh.getElemManager().forElementSubRegions( regionNames, [&]( localIndex const,
                                                                 ElementSubRegionBase & subRegion )
   {
-    arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
-    arrayView1d< real64 > const initPres = subRegion.getField< fields::flow::initialPressure >();
-    arrayView1d< real64 const > const temp = subRegion.getField< fields::flow::temperature >();
-    arrayView1d< real64 > const initTemp = subRegion.template getField< fields::flow::initialTemperature >();
+    arrayView1d< real64 const > const pres = getCachedField< fields::flow::pressure >( subRegion );
+    arrayView1d< real64 > const initPres = getCachedField< fields::flow::initialPressure >( subRegion );
+    arrayView1d< real64 const > const temp = getCachedField< fields::flow::temperature >( subRegion );
+    arrayView1d< real64 > const initTemp = getCachedField< fields::flow::initialTemperature >( subRegion );
     initPres.setValues< parallelDevicePolicy<> >( pres );
     initTemp.setValues< parallelDevicePolicy<> >( temp );
   } );
@@ -1320,6 +1476,9 @@ CompositionalMultiphaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM
                                                 real64 const & GEOS_UNUSED_PARAM( dt ),
                                                 DomainPartition & domain )
 {
+  m_numStateUpdates = 0;
+  m_isStateUpdatePartial = 0;
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1343,9 +1502,9 @@ CompositionalMultiphaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM
 
       // after the update, save the new saturation
       arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
-        subRegion.template getField< fields::flow::phaseVolumeFraction >();
+        getCachedField< fields::flow::phaseVolumeFraction >( subRegion );
       arrayView2d< real64, compflow::USD_PHASE > const phaseVolFrac_n =
-        subRegion.template getField< fields::flow::phaseVolumeFraction_n >();
+        getCachedField< fields::flow::phaseVolumeFraction_n >( subRegion );
       phaseVolFrac_n.setValues< parallelDevicePolicy<> >( phaseVolFrac );
 
     } );
@@ -1983,9 +2142,9 @@ void CompositionalMultiphaseBase::keepFlowVariablesConstantDuringInitStep( real6
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
       arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
 
-      arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
-      arrayView1d< real64 const > const temp = subRegion.getField< fields::flow::temperature >();
-      arrayView2d< real64 const, compflow::USD_COMP > const compDens = subRegion.getField< fields::flow::globalCompDensity >();
+      arrayView1d< real64 const > const pres = getCachedField< fields::flow::pressure >( subRegion );
+      arrayView1d< real64 const > const temp = getCachedField< fields::flow::temperature >( subRegion );
+      arrayView2d< real64 const, compflow::USD_COMP > const compDens = getCachedField< fields::flow::globalCompDensity >( subRegion );
 
       integer const numComp = m_numComponents;
       integer const isThermal = m_isThermal;
@@ -2037,7 +2196,7 @@ void CompositionalMultiphaseBase::keepFlowVariablesConstantDuringInitStep( real6
   } );
 }
 
-void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domain )
+bool CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
 
@@ -2045,6 +2204,7 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
 
   integer const numComp = m_numComponents;
   real64 const minCompDens = m_minCompDens;
+  integer isChopped = 0;
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
@@ -2057,8 +2217,9 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
       arrayView2d< real64, compflow::USD_COMP > const compDens =
-        subRegion.getField< fields::flow::globalCompDensity >();
+        getCachedField< fields::flow::globalCompDensity >( subRegion );
 
+      RAJA::ReduceMax< parallelDeviceReduce, integer > subRegionIsChopped( 0 );
       forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
       {
         if( ghostRank[ei] < 0 )
@@ -2068,12 +2229,16 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
             if( compDens[ei][ic] < minCompDens )
             {
               compDens[ei][ic] = minCompDens;
+              subRegionIsChopped.max( 1 );
             }
           }
         }
       } );
+      isChopped = LvArray::math::max( isChopped, subRegionIsChopped.get() );
     } );
   } );
+
+  return MpiWrapper::max( isChopped ) > 0;
 }
 
 real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const & currentDt,
@@ -2105,18 +2270,18 @@ real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const &
     {
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
-      arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
-      arrayView1d< real64 const > const pres_n = subRegion.getField< fields::flow::pressure_n >();
-      arrayView1d< real64 const > const temp = subRegion.getField< fields::flow::temperature >();
-      arrayView1d< real64 const > const temp_n = subRegion.getField< fields::flow::temperature_n >();
+      arrayView1d< real64 const > const pres = getCachedField< fields::flow::pressure >( subRegion );
+      arrayView1d< real64 const > const pres_n = getCachedField< fields::flow::pressure_n >( subRegion );
+      arrayView1d< real64 const > const temp = getCachedField< fields::flow::temperature >( subRegion );
+      arrayView1d< real64 const > const temp_n = getCachedField< fields::flow::temperature_n >( subRegion );
       arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
-        subRegion.getField< fields::flow::phaseVolumeFraction >();
+        getCachedField< fields::flow::phaseVolumeFraction >( subRegion );
       arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac_n =
-        subRegion.getField< fields::flow::phaseVolumeFraction_n >();
+        getCachedField< fields::flow::phaseVolumeFraction_n >( subRegion );
       arrayView2d< real64 const, compflow::USD_COMP > const compDens =
-        subRegion.getField< fields::flow::globalCompDensity >();
+        getCachedField< fields::flow::globalCompDensity >( subRegion );
       arrayView2d< real64, compflow::USD_COMP > const compDens_n =
-        subRegion.getField< fields::flow::globalCompDensity_n >();
+        getCachedField< fields::flow::globalCompDensity_n >( subRegion );
 
       RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionMaxPresChange( 0.0 );
       RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionMaxTempChange( 0.0 );
@@ -2171,6 +2336,22 @@ real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const &
                                         getName(), GEOS_FMT( "{:.{}f}", 100*maxRelativeTempChange, 3 ) ) );
   }
 
+  if( m_nonlinearSolverParameters.timeStepControlType() == NonlinearSolverParameters::TimeStepControlType::PID )
+  {
+    // the controller acts on the ratio between the largest state change and its target
+    real64 relativeChange = std::max( maxRelativePresChange / m_targetRelativePresChange,
+                                      maxAbsolutePhaseVolFracChange / m_targetPhaseVolFracChange );
+    if( m_targetRelativeCompDensChange < LvArray::NumericLimits< real64 >::max )
+    {
+      relativeChange = std::max( relativeChange, maxRelativeCompDensChange / m_targetRelativeCompDensChange );
+    }
+    if( m_isThermal )
+    {
+      relativeChange = std::max( relativeChange, maxRelativeTempChange / m_targetRelativeTempChange );
+    }
+    return setNextDtBasedOnPIDControl( currentDt, relativeChange );
+  }
+
   real64 const eps = LvArray::NumericLimits< real64 >::epsilon;
 
   real64 const nextDtPressure = currentDt * ( 1.0 + m_solutionChangeScalingFactor ) * m_targetRelativePresChange
@@ -2233,9 +2414,9 @@ void CompositionalMultiphaseBase::computeCFLNumbers( geos::DomainPartition & dom
                                                      ElementSubRegionBase & subRegion )
     {
       arrayView2d< real64, compflow::USD_PHASE > const & phaseOutflux =
-        subRegion.getField< fields::flow::phaseOutflux >();
+        getCachedField< fields::flow::phaseOutflux >( subRegion );
       arrayView2d< real64, compflow::USD_COMP > const & compOutflux =
-        subRegion.getField< fields::flow::componentOutflux >();
+        getCachedField< fields::flow::componentOutflux >( subRegion );
       phaseOutflux.zero();
       compOutflux.zero();
     } );
@@ -2303,21 +2484,21 @@ void CompositionalMultiphaseBase::computeCFLNumbers( geos::DomainPartition & dom
                                                      ElementSubRegionBase & subRegion )
     {
       arrayView2d< real64 const, compflow::USD_PHASE > const & phaseOutflux =
-        subRegion.getField< fields::flow::phaseOutflux >();
+        getCachedField< fields::flow::phaseOutflux >( subRegion );
       arrayView2d< real64 const, compflow::USD_COMP > const & compOutflux =
-        subRegion.getField< fields::flow::componentOutflux >();
+        getCachedField< fields::flow::componentOutflux >( subRegion );
 
-      arrayView1d< real64 > const & phaseCFLNumber = subRegion.getField< fields::flow::phaseCFLNumber >();
-      arrayView1d< real64 > const & compCFLNumber = subRegion.getField< fields::flow::componentCFLNumber >();
+      arrayView1d< real64 > const & phaseCFLNumber = getCachedField< fields::flow::phaseCFLNumber >( subRegion );
+      arrayView1d< real64 > const & compCFLNumber = getCachedField< fields::flow::componentCFLNumber >( subRegion );
 
       arrayView1d< real64 const > const & volume = subRegion.getElementVolume();
 
       arrayView2d< real64 const, compflow::USD_COMP > const & compDens =
-        subRegion.getField< fields::flow::globalCompDensity >();
+        getCachedField< fields::flow::globalCompDensity >( subRegion );
       arrayView2d< real64 const, compflow::USD_COMP > const compFrac =
-        subRegion.getField< fields::flow::globalCompFraction >();
+        getCachedField< fields::flow::globalCompFraction >( subRegion );
       arrayView2d< real64, compflow::USD_PHASE > const phaseVolFrac =
-        subRegion.getField< fields::flow::phaseVolumeFraction >();
+        getCachedField< fields::flow::phaseVolumeFraction >( subRegion );
 
       Group const & constitutiveModels = subRegion.getGroup( ElementSubRegionBase::groupKeyStruct::constitutiveModelsString() );
 
@@ -2381,23 +2562,23 @@ void CompositionalMultiphaseBase::resetStateToBeginningOfStep( DomainPartition &
                                                                                 auto & subRegion )
     {
       arrayView1d< real64 > const & pres =
-        subRegion.template getField< fields::flow::pressure >();
+        getCachedField< fields::flow::pressure >( subRegion );
       arrayView1d< real64 const > const & pres_n =
-        subRegion.template getField< fields::flow::pressure_n >();
+        getCachedField< fields::flow::pressure_n >( subRegion );
       pres.setValues< parallelDevicePolicy<> >( pres_n );
 
       arrayView2d< real64, compflow::USD_COMP > const & compDens =
-        subRegion.template getField< fields::flow::globalCompDensity >();
+        getCachedField< fields::flow::globalCompDensity >( subRegion );
       arrayView2d< real64 const, compflow::USD_COMP > const & compDens_n =
-        subRegion.template getField< fields::flow::globalCompDensity_n >();
+        getCachedField< fields::flow::globalCompDensity_n >( subRegion );
       compDens.setValues< parallelDevicePolicy<> >( compDens_n );
 
       if( m_isThermal )
       {
         arrayView1d< real64 > const & temp =
-          subRegion.template getField< fields::flow::temperature >();
+          getCachedField< fields::flow::temperature >( subRegion );
         arrayView1d< real64 const > const & temp_n =
-          subRegion.template getField< fields::flow::temperature_n >();
+          getCachedField< fields::flow::temperature_n >( subRegion );
         temp.setValues< parallelDevicePolicy<> >( temp_n );
       }
 
@@ -2433,12 +2614,18 @@ void CompositionalMultiphaseBase::implicitStepComplete( real64 const & time,
                                                      ElementSubRegionBase & subRegion )
     {
       // update deltaPressure
-      arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
-      arrayView1d< real64 const > const initPres = subRegion.getField< fields::flow::initialPressure >();
-      arrayView1d< real64 > const deltaPres = subRegion.getField< fields::flow::deltaPressure >();
+      arrayView1d< real64 const > const pres = getCachedField< fields::flow::pressure >( subRegion );
+      arrayView1d< real64 const > const initPres = getCachedField< fields::flow::initialPressure >( subRegion );
+      arrayView1d< real64 > const deltaPres = getCachedField< fields::flow::deltaPressure >( subRegion );
       isothermalCompositionalMultiphaseBaseKernels::StatisticsKernel::
         saveDeltaPressure< parallelDevicePolicy<> >( subRegion.size(), pres, initPres, deltaPres );
 
+      // with the active set, the properties of some cells may have been evaluated at a previous Newton iteration
+      if( m_isStateUpdatePartial )
+      {
+        updateFluidState( subRegion );
+      }
+
       // Step 2: save the converged fluid state
       string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
       MultiFluidBase const & fluidMaterial = getConstitutiveModel< MultiFluidBase >( subRegion, fluidName );
@@ -2458,7 +2645,7 @@ void CompositionalMultiphaseBase::implicitStepComplete( real64 const & time,
 
       // Step 4: save converged state for the relperm model to handle hysteresis
       arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
-        subRegion.getField< fields::flow::phaseVolumeFraction >();
+        getCachedField< fields::flow::phaseVolumeFraction >( subRegion );
       string const & relPermName = subRegion.getReference< string >( viewKeyStruct::relPermNamesString() );
       RelativePermeabilityBase const & relPermMaterial =
         getConstitutiveModel< RelativePermeabilityBase >( subRegion, relPermName );
@@ -2498,7 +2685,7 @@ void CompositionalMultiphaseBase::implicitStepComplete( real64 const & time,
       {
         string const & diffusionName = subRegion.getReference< string >( viewKeyStruct::diffusionNamesString() );
         DiffusionBase const & diffusionMaterial = getConstitutiveModel< DiffusionBase >( subRegion, diffusionName );
-        arrayView1d< real64 const > const temperature = subRegion.template getField< fields::flow::temperature >();
+        arrayView1d< real64 const > const temperature = getCachedField< fields::flow::temperature >( subRegion );
         diffusionMaterial.saveConvergedTemperatureState( temperature );
       }
       if( m_hasDispersion )
@@ -2518,21 +2705,21 @@ void CompositionalMultiphaseBase::saveConvergedState( ElementSubRegionBase & sub
   FlowSolverBase::saveConvergedState( subRegion );
 
   arrayView2d< real64 const, compflow::USD_COMP > const & compDens =
-    subRegion.template getField< fields::flow::globalCompDensity >();
+    getCachedField< fields::flow::globalCompDensity >( subRegion );
   arrayView2d< real64, compflow::USD_COMP > const & compDens_n =
-    subRegion.template getField< fields::flow::globalCompDensity_n >();
+    getCachedField< fields::flow::globalCompDensity_n >( subRegion );
   compDens_n.setValues< parallelDevicePolicy<> >( compDens );
 
   arrayView2d< real64 const, compflow::USD_COMP > const & compAmount =
-    subRegion.template getField< fields::flow::compAmount >();
+    getCachedField< fields::flow::compAmount >( subRegion );
   arrayView2d< real64, compflow::USD_COMP > const & compAmount_n =
-    subRegion.template getField< fields::flow::compAmount_n >();
+    getCachedField< fields::flow::compAmount_n >( subRegion );
   compAmount_n.setValues< parallelDevicePolicy<> >( compAmount );
 
   if( m_isFixedStressPoromechanicsUpdate )
   {
     arrayView2d< real64, compflow::USD_COMP > const & compDens_k =
-      subRegion.template getField< fields::flow::globalCompDensity_k >();
+      getCachedField< fields::flow::globalCompDensity_k >( subRegion );
     compDens_k.setValues< parallelDevicePolicy<> >( compDens );
   }
 }
@@ -2555,9 +2742,9 @@ void CompositionalMultiphaseBase::saveSequentialIterationState( DomainPartition
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
       arrayView2d< real64 const, compflow::USD_COMP >
-      const compDens = subRegion.getField< fields::flow::globalCompDensity >();
+      const compDens = getCachedField< fields::flow::globalCompDensity >( subRegion );
       arrayView2d< real64, compflow::USD_COMP >
-      const compDens_k = subRegion.getField< fields::flow::globalCompDensity_k >();
+      const compDens_k = getCachedField< fields::flow::globalCompDensity_k >( subRegion );
 
       RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionMaxCompDensChange( 0.0 );
 
@@ -2586,6 +2773,14 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
 
+  // with the active set, the properties are only evaluated in the cells whose state has changed,
+  // except in the first update of the time step and every activeSetRefreshFrequency updates
+  bool const useActiveSet = m_activeSetTolerance > 0.0 && m_numStateUpdates % m_activeSetRefreshFrequency != 0;
+  ++m_numStateUpdates;
+  m_isStateUpdatePartial = useActiveSet;
+  globalIndex numActiveCells = 0;
+  globalIndex numCells = 0;
+
   real64 maxDeltaPhaseVolFrac = 0.0;
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
@@ -2597,9 +2792,21 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
     {
       // update porosity, permeability, and solid internal energy
       updatePorosityAndPermeability( subRegion );
+      // the active set is based on the updated global component fractions
+      updateGlobalComponentFraction( subRegion );
+      if( useActiveSet )
+      {
+        numActiveCells += updateActiveSet( subRegion );
+        numCells += subRegion.getNumberOfLocalIndices();
+      }
       // update all fluid properties
-      real64 const deltaPhaseVolFrac = updateFluidState( subRegion );
+      real64 const deltaPhaseVolFrac = updateFluidProperties( subRegion );
       maxDeltaPhaseVolFrac = LvArray::math::max( maxDeltaPhaseVolFrac, deltaPhaseVolFrac );
+      if( useActiveSet )
+      {
+        // the other updates of the fluid state evaluate the properties of all the cells
+        getCachedField< fields::flow::isActiveForStateUpdate >( subRegion ).template setValues< parallelDevicePolicy<> >( 1 );
+      }
       // for thermal, update solid internal energy
       if( m_isThermal )
       {
@@ -2612,6 +2819,28 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
   maxDeltaPhaseVolFrac = MpiWrapper::max( maxDeltaPhaseVolFrac );
 
   GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        {}: Max phase volume fraction change = {}", getName(), fmt::format( "{:.{}f}", maxDeltaPhaseVolFrac, 4 ) ) );
+
+  if( useActiveSet )
+  {
+    numActiveCells = MpiWrapper::sum( numActiveCells );
+    numCells = MpiWrapper::sum( numCells );
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        {}: Active cells in the state update = {:.1f}%",
+                                        getName(), numCells > 0 ? 100.0 * numActiveCells / numCells : 100.0 ) );
+  }
+}
+
+bool CompositionalMultiphaseBase::refreshStateForConvergenceCheck( DomainPartition & domain )
+{
+  if( !m_isStateUpdatePartial )
+  {
+    return false;
+  }
+
+  // the residual has been assembled with the properties of the frozen cells evaluated at a previous iterate,
+  // so all the properties are evaluated before the convergence check
+  m_numStateUpdates = 0;
+  updateState( domain );
+  return true;
 }
 
 bool CompositionalMultiphaseBase::checkSequentialSolutionIncrements( DomainPartition & domain ) const
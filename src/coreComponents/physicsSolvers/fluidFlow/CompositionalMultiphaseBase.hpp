@@ -122,6 +122,16 @@ public:
    */
   void updateFluidModel( ObjectManagerBase & dataGroup ) const;
 
+  /**
+   * @brief Flag the cells whose fluid properties must be evaluated in the current state update
+   * @param dataGroup the group storing the required fields
+   * @return the number of locally owned cells flagged as active
+   *
+   * A cell is active if its pressure, temperature, or global component fraction has changed
+   * by more than activeSetTolerance since the last evaluation of its properties.
+   */
+  localIndex updateActiveSet( ObjectManagerBase & dataGroup ) const;
+
   /**
    * @brief Update all relevant relperm models using current values of phase volume fraction
    * @param dataGroup the group storing the required fields
@@ -160,12 +170,21 @@ public:
 
   real64 updateFluidState( ElementSubRegionBase & subRegion ) const;
 
+  /**
+   * @brief Update the fluid properties from the current global component fractions
+   * @param subRegion the subregion storing the required fields
+   * @return the max change in phase volume fraction
+   */
+  real64 updateFluidProperties( ElementSubRegionBase & subRegion ) const;
+
   virtual void saveConvergedState( ElementSubRegionBase & subRegion ) const override final;
 
   virtual void saveSequentialIterationState( DomainPartition & domain ) override final;
 
   virtual void updateState( DomainPartition & domain ) override final;
 
+  virtual bool refreshStateForConvergenceCheck( DomainPartition & domain ) override final;
+
   /**
    * @brief Getter for the number of fluid components (species)
    * @return the number of components
@@ -265,12 +284,15 @@ public:
     static constexpr char const * maxRelativePresChangeString() { return "maxRelativePressureChange"; }
     static constexpr char const * maxRelativeTempChangeString() { return "maxRelativeTemperatureChange"; }
     static constexpr char const * maxRelativeCompDensChangeString() { return "maxRelativeCompDensChange"; }
+    static constexpr char const * maxPhaseVolFracChangeString() { return "maxPhaseVolFractionChange"; }
     static constexpr char const * allowLocalCompDensChoppingString() { return "allowLocalCompDensityChopping"; }
     static constexpr char const * useTotalMassEquationString() { return "useTotalMassEquation"; }
     static constexpr char const * useSimpleAccumulationString() { return "useSimpleAccumulation"; }
     static constexpr char const * minCompDensString() { return "minCompDens"; }
     static constexpr char const * maxSequentialCompDensChangeString() { return "maxSequentialCompDensChange"; }
     static constexpr char const * minScalingFactorString() { return "minScalingFactor"; }
+    static constexpr char const * activeSetToleranceString() { return "activeSetTolerance"; }
+    static constexpr char const * activeSetRefreshFrequencyString() { return "activeSetRefreshFrequency"; }
 
   };
 
@@ -359,8 +381,9 @@ public:
   /**
    * @brief Sets all the negative component densities (if any) to zero.
    * @param domain the physical domain object
+   * @return true if a component density has been chopped on any rank
    */
-  void chopNegativeDensities( DomainPartition & domain );
+  bool chopNegativeDensities( DomainPartition & domain );
 
   virtual real64 setNextDtBasedOnStateChange( real64 const & currentDt,
                                               DomainPartition & domain ) override;
@@ -409,7 +432,7 @@ protected:
   void initializeAquiferBC( constitutive::ConstitutiveManager const & cm ) const;
 
   /**
-   * @brief Utility function that encapsulates the call to FieldSpecificationBase::applyFieldValue in BC application
+   * @brief Utility function that encapsulates the call to FieldSpecificationManager::applyFieldValueToField in BC application
    * @param[in] time_n the time at the beginning of the step
    * @param[in] dt the time step
    * @param[in] mesh the mesh level object
@@ -455,6 +478,9 @@ protected:
   /// maximum (relative) change in component density in a Newton iteration
   real64 m_maxRelativeCompDensChange;
 
+  /// maximum (absolute) linearized change in a phase volume fraction in a Newton iteration
+  real64 m_maxPhaseVolFracChange;
+
   /// damping factor for solution change targets
   real64 m_solutionChangeScalingFactor;
 
@@ -495,6 +521,18 @@ protected:
   /// the targeted CFL for timestep
   real64 m_targetFlowCFL;
 
+  /// change of the state below which the properties of a cell are not re-evaluated (disabled if zero)
+  real64 m_activeSetTolerance;
+
+  /// number of state updates between two evaluations of the properties of all the cells
+  integer m_activeSetRefreshFrequency;
+
+  /// number of state updates since the beginning of the time step
+  integer m_numStateUpdates;
+
+  /// flag indicating whether the last state update only evaluated the properties of the active cells
+  integer m_isStateUpdatePartial;
+
 private:
 
   /**
@@ -519,14 +557,16 @@ void CompositionalMultiphaseBase::applyFieldValue( real64 const & time_n,
 {
   FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
 
-  fsManager.apply< OBJECT_TYPE >( time_n + dt,
-                                  mesh,
-                                  fieldKey,
-                                  [&]( FieldSpecificationBase const & fs,
-                                       string const & setName,
-                                       SortedArrayView< localIndex const > const & lset,
-                                       OBJECT_TYPE & targetGroup,
-                                       string const & )
+  // Specify the bc value of the field
+  fsManager.applyFieldValueToField< OBJECT_TYPE, parallelDevicePolicy<> >( time_n + dt,
+                                                                           mesh,
+                                                                           fieldKey,
+                                                                           boundaryFieldKey,
+                                                                           [&]( FieldSpecificationBase const & fs,
+                                                                                string const & setName,
+                                                                                SortedArrayView< localIndex const > const & lset,
+                                                                                OBJECT_TYPE & targetGroup,
+                                                                                string const & )
   {
     if( fs.getLogLevel() >= 1 && m_nonlinearSolverParameters.m_numNewtonIterations == 0 )
     {
@@ -535,13 +575,6 @@ void CompositionalMultiphaseBase::applyFieldValue( real64 const & time_n,
                                  getName(), time_n+dt, fs.getCatalogName(), fs.getName(),
                                  setName, targetGroup.getName(), fs.getScale(), numTargetElems ) );
     }
-
-    // Specify the bc value of the field
-    fs.applyFieldValue< FieldSpecificationEqual,
-                        parallelDevicePolicy<> >( lset,
-                                                  time_n + dt,
-                                                  targetGroup,
-                                                  boundaryFieldKey );
   } );
 }
 
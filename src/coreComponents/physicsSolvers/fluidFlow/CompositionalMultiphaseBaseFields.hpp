@@ -185,6 +185,38 @@ DECLARE_FIELD( compAmount_n,
                WRITE_AND_READ,
                "Component amount at the previous converged time step" );
 
+DECLARE_FIELD( isActiveForStateUpdate,
+               "isActiveForStateUpdate",
+               array1d< integer >,
+               1,
+               NOPLOT,
+               NO_WRITE,
+               "Flag indicating whether the properties of the cell are evaluated in the current state update" );
+
+DECLARE_FIELD( pressure_lastStateUpdate,
+               "pressure_lastStateUpdate",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Pressure at the last evaluation of the fluid properties" );
+
+DECLARE_FIELD( temperature_lastStateUpdate,
+               "temperature_lastStateUpdate",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Temperature at the last evaluation of the fluid properties" );
+
+DECLARE_FIELD( globalCompFraction_lastStateUpdate,
+               "globalCompFraction_lastStateUpdate",
+               array2dLayoutComp,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Global component fraction at the last evaluation of the fluid properties" );
+
 }
 
 }
@@ -480,6 +480,7 @@ real64 CompositionalMultiphaseFVM::scalingForSystemSolution( DomainPartition & d
   real64 scalingFactor = 1.0;
   real64 maxDeltaPres = 0.0, maxDeltaCompDens = 0.0, maxDeltaTemp = 0.0;
   real64 minPresScalingFactor = 1.0, minCompDensScalingFactor = 1.0, minTempScalingFactor = 1.0;
+  real64 minPhaseVolFracScalingFactor = 1.0;
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
@@ -525,6 +526,28 @@ real64 CompositionalMultiphaseFVM::scalingForSystemSolution( DomainPartition & d
       minPresScalingFactor = std::min( minPresScalingFactor, subRegionData.localMinPresScalingFactor );
       minCompDensScalingFactor = std::min( minCompDensScalingFactor, subRegionData.localMinCompDensScalingFactor );
       minTempScalingFactor = std::min( minTempScalingFactor, subRegionData.localMinTempScalingFactor );
+
+      // chop the update where the predicted change in phase volume fraction is too large
+      if( m_maxPhaseVolFracChange < 1.0 )
+      {
+        real64 const phaseVolFracScalingFactor =
+          isothermalCompositionalMultiphaseBaseKernels::
+            PhaseVolumeFractionScalingKernelFactory::
+            createAndLaunch< parallelDevicePolicy<> >( m_maxPhaseVolFracChange,
+                                                       m_scalingType == ScalingType::Local,
+                                                       m_isThermal,
+                                                       dofManager.rankOffset(),
+                                                       m_numComponents,
+                                                       m_numPhases,
+                                                       dofKey,
+                                                       subRegion,
+                                                       localSolution );
+        if( m_scalingType == ScalingType::Global )
+        {
+          scalingFactor = std::min( scalingFactor, phaseVolFracScalingFactor );
+        }
+        minPhaseVolFracScalingFactor = std::min( minPhaseVolFracScalingFactor, phaseVolFracScalingFactor );
+      }
     } );
   } );
 
@@ -533,6 +556,7 @@ real64 CompositionalMultiphaseFVM::scalingForSystemSolution( DomainPartition & d
   maxDeltaCompDens = MpiWrapper::max( maxDeltaCompDens );
   minPresScalingFactor = MpiWrapper::min( minPresScalingFactor );
   minCompDensScalingFactor = MpiWrapper::min( minCompDensScalingFactor );
+  minPhaseVolFracScalingFactor = MpiWrapper::min( minPhaseVolFracScalingFactor );
 
   string const massUnit = m_useMass ? "kg/m3" : "mol/m3";
   GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        {}: Max pressure change = {} Pa (before scaling)",
@@ -548,6 +572,11 @@ real64 CompositionalMultiphaseFVM::scalingForSystemSolution( DomainPartition & d
                                         getName(), GEOS_FMT( "{:.{}f}", maxDeltaTemp, 3 ) ) );
   }
 
+  if( m_maxPhaseVolFracChange < 1.0 )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        {}: Min phase volume fraction scaling factor = {}", getName(), minPhaseVolFracScalingFactor ) );
+  }
+
   if( m_scalingType == ScalingType::Local )
   {
     GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        {}: Min pressure scaling factor = {}", getName(), minPresScalingFactor ) );
@@ -710,10 +739,10 @@ void CompositionalMultiphaseFVM::applySystemSolution( DofManager const & dofMana
 
   // if component density chopping is allowed, some component densities may be negative after the update
   // these negative component densities are set to zero in this function
-  if( m_allowCompDensChopping )
-  {
-    chopNegativeDensities( domain );
-  }
+  bool const isChopped = m_allowCompDensChopping && chopNegativeDensities( domain );
+
+  // with local scaling, the solution is not applied with the given scaling factor
+  m_isAppliedSolutionModified = localScaling || isChopped;
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
@@ -19,6 +19,7 @@
 
 #include "CompositionalMultiphaseHybridFVM.hpp"
 
+#include "dataRepository/WrapperHandle.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "constitutive/ConstitutivePassThru.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidBase.hpp"
@@ -31,6 +32,7 @@
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseHybridFVMKernels.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
 #include "physicsSolvers/fluidFlow/IsothermalCompositionalMultiphaseBaseKernels.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseHybridFVMKernels.hpp"
 
@@ -61,6 +63,23 @@ void CompositionalMultiphaseHybridFVM::registerDataOnMesh( Group & meshBodies )
   // 1) Register the elem-centered data
   CompositionalMultiphaseBase::registerDataOnMesh( meshBodies );
 
+  // cache of the transmissibility matrices of the flux and of the gravity term
+  forDiscretizationOnMeshTargets( meshBodies, [&] ( string const &,
+                                                    MeshLevel & mesh,
+                                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      localIndex const cacheSize = MimeticInnerProductHelpers::transMatrixCacheSize( subRegion.numFacesPerElement() );
+      subRegion.registerField< fields::flow::mimeticTransMatrix >( getName() ).
+        reference().resizeDimension< 1 >( cacheSize );
+      subRegion.registerField< fields::flow::mimeticGravityTransMatrix >( getName() ).
+        reference().resizeDimension< 1 >( cacheSize );
+    } );
+  } );
+
   // 2) Register the face data
   meshBodies.forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
   {
@@ -135,7 +154,7 @@ void CompositionalMultiphaseHybridFVM::initializePostInitialConditionsPreSubGrou
 
     // check that multipliers are stricly larger than 0, which would work with SinglePhaseFVM, but not with SinglePhaseHybridFVM.
     // To deal with a 0 multiplier, we would just have to skip the corresponding face in the FluxKernel
-    arrayView1d< real64 const > const & transMultiplier = faceManager.getField< fields::flow::transMultiplier >();
+    arrayView1d< real64 const > const & transMultiplier = getCachedField< fields::flow::transMultiplier >( faceManager );
 
     RAJA::ReduceMin< parallelDeviceReduce, real64 > minVal( 1.0 );
     forAll< parallelDevicePolicy<> >( faceManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const iface )
@@ -155,6 +174,34 @@ void CompositionalMultiphaseHybridFVM::initializePostInitialConditionsPreSubGrou
                        bc.getName() << " was requested in the XML file. \n" <<
                        "This type of boundary condition is not yet supported by CompositionalMultiphaseHybridFVM and will be ignored" );
     } );
+
+    // precompute the transmissibility matrices, which are then only recomputed when the permeability changes
+    // (the matrices of the gravity term have been computed in precomputeData)
+    NodeManager const & nodeManager = mesh.getNodeManager();
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      string const & permName = subRegion.getReference< string >( viewKeyStruct::permeabilityNamesString() );
+      PermeabilityBase const & permeability = getConstitutiveModel< PermeabilityBase >( subRegion, permName );
+
+      mimeticInnerProductReducedDispatch( mimeticInnerProductBase,
+                                          [&] ( auto const mimeticInnerProduct )
+      {
+        using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+        simpleKernelLaunchSelector< hybridFVMKernels::TransMatrixCacheKernel,
+                                    IP_TYPE >( subRegion.numFacesPerElement(),
+                                               subRegion.size(),
+                                               nodeManager.referencePosition(),
+                                               transMultiplier,
+                                               faceManager.nodeList().toViewConst(),
+                                               subRegion.faceList().toViewConst(),
+                                               subRegion.getElementCenter(),
+                                               subRegion.getElementVolume(),
+                                               permeability.permeability(),
+                                               m_lengthTolerance,
+                                               subRegion.getField< fields::flow::mimeticTransMatrix >().toView() );
+      } );
+    } );
   } );
 
 }
@@ -178,10 +225,10 @@ void CompositionalMultiphaseHybridFVM::precomputeData( MeshLevel & mesh, arrayVi
   // face data
 
   arrayView1d< real64 const > const & transMultiplier =
-    faceManager.getField< fields::flow::transMultiplier >();
+    getCachedField< fields::flow::transMultiplier >( faceManager );
 
   arrayView1d< real64 > const mimFaceGravCoef =
-    faceManager.getField< fields::flow::mimGravityCoefficient >();
+    getCachedField< fields::flow::mimGravityCoefficient >( faceManager );
 
   ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
 
@@ -220,7 +267,8 @@ void CompositionalMultiphaseHybridFVM::precomputeData( MeshLevel & mesh, arrayVi
                                                                            lengthTolerance,
                                                                            mimFaceGravCoefNumerator.toView(),
                                                                            mimFaceGravCoefDenominator.toView(),
-                                                                           mimFaceGravCoef );
+                                                                           mimFaceGravCoef,
+                                                                           subRegion.getField< fields::flow::mimeticGravityTransMatrix >().toView() );
 
   } );
 
@@ -243,9 +291,9 @@ void CompositionalMultiphaseHybridFVM::implicitStepSetup( real64 const & time_n,
     FaceManager & faceManager = mesh.getFaceManager();
 
     arrayView1d< real64 > const & facePres_n =
-      faceManager.getField< fields::flow::facePressure_n >();
+      getCachedField< fields::flow::facePressure_n >( faceManager );
     arrayView1d< real64 const > const & facePres =
-      faceManager.getField< fields::flow::facePressure >();
+      getCachedField< fields::flow::facePressure >( faceManager );
     facePres_n.setValues< parallelDevicePolicy<> >( facePres );
   } );
 
@@ -338,17 +386,17 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
 
     // get the face-centered pressures
     arrayView1d< real64 const > const & facePres =
-      faceManager.getField< fields::flow::facePressure >();
+      getCachedField< fields::flow::facePressure >( faceManager );
 
     // get the face-centered depth
     arrayView1d< real64 const > const & faceGravCoef =
-      faceManager.getField< fields::flow::gravityCoefficient >();
+      getCachedField< fields::flow::gravityCoefficient >( faceManager );
     arrayView1d< real64 const > const & mimFaceGravCoef =
-      faceManager.getField< fields::flow::mimGravityCoefficient >();
+      getCachedField< fields::flow::mimGravityCoefficient >( faceManager );
 
     // get the face-centered transMultiplier
     arrayView1d< real64 const > const & transMultiplier =
-      faceManager.getField< fields::flow::transMultiplier >();
+      getCachedField< fields::flow::transMultiplier >( faceManager );
 
     // get the face-to-nodes connectivity for the transmissibility calculation
     ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
@@ -460,6 +508,24 @@ real64 CompositionalMultiphaseHybridFVM::scalingForSystemSolution( DomainPartiti
                                                      localSolution );
 
       scalingFactor = std::min( scalingFactor, subRegionData.localMinVal );
+
+      // chop the update where the predicted change in phase volume fraction is too large
+      if( m_maxPhaseVolFracChange < 1.0 )
+      {
+        real64 const phaseVolFracScalingFactor =
+          isothermalCompositionalMultiphaseBaseKernels::
+            PhaseVolumeFractionScalingKernelFactory::
+            createAndLaunch< parallelDevicePolicy<> >( m_maxPhaseVolFracChange,
+                                                       0, // global scaling
+                                                       0, // isothermal
+                                                       dofManager.rankOffset(),
+                                                       m_numComponents,
+                                                       m_numPhases,
+                                                       dofKey,
+                                                       subRegion,
+                                                       localSolution );
+        scalingFactor = std::min( scalingFactor, phaseVolFracScalingFactor );
+      }
     } );
 
     FaceManager const & faceManager = mesh.getFaceManager();
@@ -471,7 +537,7 @@ real64 CompositionalMultiphaseHybridFVM::scalingForSystemSolution( DomainPartiti
       faceManager.getReference< array1d< globalIndex > >( faceDofKey );
     arrayView1d< integer const > const & faceGhostRank = faceManager.ghostRank();
     arrayView1d< real64 const > const & facePressure =
-      faceManager.getField< fields::flow::facePressure >();
+      getCachedField< fields::flow::facePressure >( faceManager );
     globalIndex const rankOffset = dofManager.rankOffset();
 
     RAJA::ReduceMin< parallelDeviceReduce, real64 > minFaceVal( 1.0 );
@@ -739,10 +805,7 @@ void CompositionalMultiphaseHybridFVM::applySystemSolution( DofManager const & d
 
   // if component density chopping is allowed, some component densities may be negative after the update
   // these negative component densities are set to zero in this function
-  if( m_allowCompDensChopping )
-  {
-    chopNegativeDensities( domain );
-  }
+  m_isAppliedSolutionModified = m_allowCompDensChopping && chopNegativeDensities( domain );
 
   // 2. apply the face-based update
 
@@ -789,9 +852,9 @@ void CompositionalMultiphaseHybridFVM::resetStateToBeginningOfStep( DomainPartit
     FaceManager & faceManager = mesh.getFaceManager();
 
     arrayView1d< real64 const > const & facePres_n =
-      faceManager.getField< fields::flow::facePressure_n >();
+      getCachedField< fields::flow::facePressure_n >( faceManager );
     arrayView1d< real64 > const & facePres =
-      faceManager.getField< fields::flow::facePressure >();
+      getCachedField< fields::flow::facePressure >( faceManager );
     facePres.setValues< parallelDevicePolicy<> >( facePres_n );
   } );
 }
@@ -1537,6 +1537,10 @@ FluxKernel::
   arrayView1d< real64 const > const & elemGravCoef =
     subRegion.getReference< array1d< real64 > >( fields::flow::gravityCoefficient::key() );
 
+  // get the cached transmissibility matrices (recomputed below if the permeability has changed)
+  arrayView2d< real64 > const transMatrixCache = subRegion.getField< fields::flow::mimeticTransMatrix >().toView();
+  arrayView2d< real64 > const gravTransMatrixCache = subRegion.getField< fields::flow::mimeticGravityTransMatrix >().toView();
+
   // assemble the residual and Jacobian element by element
   // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
   forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_DEVICE ( localIndex const ei )
@@ -1547,30 +1551,32 @@ FluxKernel::
 
     real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
 
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    IP_TYPE::template compute< NF >( nodePosition,
-                                     transMultiplier,
-                                     faceToNodes,
-                                     elemToFaces[ei],
-                                     elemCenter[ei],
-                                     elemVolume[ei],
-                                     perm,
-                                     lengthTolerance,
-                                     transMatrix );
+    // get the local transmissibility matrix from the cache
+    // it is only recomputed if the permeability has changed since it was cached
+    mimeticInnerProduct::MimeticInnerProductHelpers::computeCached< IP_TYPE, NF >( nodePosition,
+                                                                                  transMultiplier,
+                                                                                  faceToNodes,
+                                                                                  elemToFaces[ei],
+                                                                                  elemCenter[ei],
+                                                                                  elemVolume[ei],
+                                                                                  perm,
+                                                                                  lengthTolerance,
+                                                                                  transMatrixCache[ei],
+                                                                                  transMatrix );
 
     // currently the gravity term in the transport scheme is treated as in MRST, that is, always with TPFA
-    // this is why below we have to recompute the TPFA transmissibility in addition to the transmissibility matrix above
+    // this is why below we need the TPFA transmissibility in addition to the transmissibility matrix above
     // TODO: treat the gravity term with a consistent inner product
-    mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition,
-                                                          transMultiplier,
-                                                          faceToNodes,
-                                                          elemToFaces[ei],
-                                                          elemCenter[ei],
-                                                          elemVolume[ei],
-                                                          perm,
-                                                          lengthTolerance,
-                                                          transMatrixGrav );
+    mimeticInnerProduct::MimeticInnerProductHelpers::computeCached< mimeticInnerProduct::TPFAInnerProduct, NF >( nodePosition,
+                                                                                                                transMultiplier,
+                                                                                                                faceToNodes,
+                                                                                                                elemToFaces[ei],
+                                                                                                                elemCenter[ei],
+                                                                                                                elemVolume[ei],
+                                                                                                                perm,
+                                                                                                                lengthTolerance,
+                                                                                                                gravTransMatrixCache[ei],
+                                                                                                                transMatrixGrav );
 
     // perform flux assembly in this element
     compositionalMultiphaseHybridFVMKernels::AssemblerKernel::compute< NF, NC, NP >( er, esr, ei,
@@ -28,6 +28,7 @@
 #include "constitutive/solid/porosity/PorosityBase.hpp"
 #include "constitutive/solid/porosity/PorosityFields.hpp"
 #include "constitutive/relativePermeability/RelativePermeabilityBase.hpp"
+#include "finiteVolume/mimeticInnerProducts/MimeticInnerProductHelpers.hpp"
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/ObjectManagerBase.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
@@ -1088,7 +1089,8 @@ struct PrecomputeKernel
           real64 const & lengthTolerance,
           arrayView1d< RAJA::ReduceSum< serialReduce, real64 > > const & mimFaceGravCoefNumerator,
           arrayView1d< RAJA::ReduceSum< serialReduce, real64 > > const & mimFaceGravCoefDenominator,
-          arrayView1d< real64 > const & mimFaceGravCoef )
+          arrayView1d< real64 > const & mimFaceGravCoef,
+          arrayView2d< real64 > const & transMatrixCache )
   {
     forAll< serialPolicy >( subRegionSize, [=] ( localIndex const ei )
     {
@@ -1096,15 +1098,17 @@ struct PrecomputeKernel
 
       real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
 
-      IP_TYPE::template compute< NF >( nodePosition,
-                                       transMultiplier,
-                                       faceToNodes,
-                                       elemToFaces[ei],
-                                       elemCenter[ei],
-                                       elemVolume[ei],
-                                       perm,
-                                       lengthTolerance,
-                                       transMatrix );
+      // the matrix is cached for the gravity term of the FluxKernel
+      mimeticInnerProduct::MimeticInnerProductHelpers::computeCached< IP_TYPE, NF >( nodePosition,
+                                                                                    transMultiplier,
+                                                                                    faceToNodes,
+                                                                                    elemToFaces[ei],
+                                                                                    elemCenter[ei],
+                                                                                    elemVolume[ei],
+                                                                                    perm,
+                                                                                    lengthTolerance,
+                                                                                    transMatrixCache[ei],
+                                                                                    transMatrix );
 
       for( integer ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
       {
@@ -185,6 +185,22 @@ DECLARE_FIELD( mimGravityCoefficient,
                WRITE_AND_READ,
                "Mimetic gravity coefficient" );
 
+DECLARE_FIELD( mimeticTransMatrix,
+               "mimeticTransMatrix",
+               array2d< real64 >,
+               -1,
+               NOPLOT,
+               NO_WRITE,
+               "Cached mimetic transmissibility matrix (permeability used for the computation, followed by the packed upper triangle)" );
+
+DECLARE_FIELD( mimeticGravityTransMatrix,
+               "mimeticGravityTransMatrix",
+               array2d< real64 >,
+               -1,
+               NOPLOT,
+               NO_WRITE,
+               "Cached TPFA transmissibility matrix of the gravity term (permeability used for the computation, followed by the packed upper triangle)" );
+
 DECLARE_FIELD( macroElementIndex,
                "macroElementIndex",
                array1d< integer >,
@@ -21,6 +21,8 @@
 #define GEOS_PHYSICSSOLVERS_FLUIDFLOW_HYBRIDFVMUPWINDINGHELPERKERNELS_HPP
 
 #include "common/DataTypes.hpp"
+#include "finiteVolume/mimeticInnerProducts/BdVLMInnerProduct.hpp"
+#include "finiteVolume/mimeticInnerProducts/MimeticInnerProductHelpers.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mesh/MeshLevel.hpp"
 
@@ -86,6 +88,115 @@ struct CellConnectivity
 
 };
 
+/******************************** TransMatrixCacheKernel ********************************/
+
+struct TransMatrixCacheKernel
+{
+
+  /// The number of elements whose transmissibility matrices are computed together with the BdVLM inner product
+#if defined( GEOS_USE_DEVICE )
+  static constexpr integer batchSize = 1;
+#else
+  static constexpr integer batchSize = 8;
+#endif
+
+  /**
+   * @brief Fill the cache of the transmissibility matrices of the elements of a subregion.
+   * @tparam IP_TYPE the type of inner product
+   * @tparam NF number of faces per element
+   * @tparam BATCH_SIZE the number of elements whose BdVLM transmissibility matrices are computed together
+   * @param[in] subRegionSize the number of elements in the subregion
+   * @param[in] nodePosition the position of the nodes
+   * @param[in] transMultiplier the transmissibility multipliers at the mesh faces
+   * @param[in] faceToNodes the map from the face to their nodes
+   * @param[in] elemToFaces the map from the elements to their faces
+   * @param[in] elemCenter the center of the elements
+   * @param[in] elemVolume the volume of the elements
+   * @param[in] elemPerm the permeability in the elements
+   * @param[in] lengthTolerance the tolerance used in the trans calculations
+   * @param[inout] transMatrixCache the cache of the transmissibility matrices
+   *
+   * @details With the BdVLM inner product, the stale entries of each block of BATCH_SIZE consecutive elements
+   *          are recomputed with BdVLMInnerProduct::computeBatch, which factorizes their 3x3 systems together.
+   */
+  template< typename IP_TYPE, integer NF, integer BATCH_SIZE = batchSize >
+  static void
+  launch( localIndex const subRegionSize,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          arrayView1d< real64 const > const & transMultiplier,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          arrayView2d< localIndex const > const & elemToFaces,
+          arrayView2d< real64 const > const & elemCenter,
+          arrayView1d< real64 const > const & elemVolume,
+          arrayView3d< real64 const > const & elemPerm,
+          real64 const lengthTolerance,
+          arrayView2d< real64 > const & transMatrixCache )
+  {
+    if constexpr ( std::is_same_v< IP_TYPE, mimeticInnerProduct::BdVLMInnerProduct > && BATCH_SIZE > 1 )
+    {
+      localIndex const numBatches = ( subRegionSize + BATCH_SIZE - 1 ) / BATCH_SIZE;
+      forAll< parallelDevicePolicy<> >( numBatches, [=] GEOS_HOST_DEVICE ( localIndex const batch )
+      {
+        // gather the elements of the block whose cached matrix was computed with another permeability
+        localIndex elems[ BATCH_SIZE ]{};
+        integer numElems = 0;
+        for( localIndex ei = batch * BATCH_SIZE; ei < LvArray::math::min( ( batch + 1 ) * BATCH_SIZE, subRegionSize ); ++ei )
+        {
+          if( transMatrixCache[ei][0] != elemPerm[ei][0][0] ||
+              transMatrixCache[ei][1] != elemPerm[ei][0][1] ||
+              transMatrixCache[ei][2] != elemPerm[ei][0][2] )
+          {
+            elems[numElems++] = ei;
+          }
+        }
+        if( numElems == 0 )
+        {
+          return;
+        }
+
+        real64 transMatrix[ BATCH_SIZE ][ NF ][ NF ];
+        mimeticInnerProduct::BdVLMInnerProduct::computeBatch< NF, BATCH_SIZE >( nodePosition,
+                                                                               transMultiplier,
+                                                                               faceToNodes,
+                                                                               elemToFaces,
+                                                                               elemCenter,
+                                                                               elemPerm,
+                                                                               lengthTolerance,
+                                                                               elems,
+                                                                               numElems,
+                                                                               transMatrix );
+
+        for( integer b = 0; b < numElems; ++b )
+        {
+          localIndex const ei = elems[b];
+          real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+          mimeticInnerProduct::MimeticInnerProductHelpers::storeInCache< NF >( transMatrix[b], perm, transMatrixCache[ei] );
+        }
+      } );
+    }
+    else
+    {
+      forAll< parallelDevicePolicy<> >( subRegionSize, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+      {
+        stackArray2d< real64, NF *NF > transMatrix( NF, NF );
+
+        real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+        mimeticInnerProduct::MimeticInnerProductHelpers::computeCached< IP_TYPE, NF >( nodePosition,
+                                                                                      transMultiplier,
+                                                                                      faceToNodes,
+                                                                                      elemToFaces[ei],
+                                                                                      elemCenter[ei],
+                                                                                      elemVolume[ei],
+                                                                                      perm,
+                                                                                      lengthTolerance,
+                                                                                      transMatrixCache[ei],
+                                                                                      transMatrix );
+      } );
+    }
+  }
+
+};
 
 } // namespace hybridFVMUpwindingKernels
 
@@ -501,6 +501,24 @@ struct RelativePermeabilityUpdateKernel
       }
     } );
   }
+
+  template< typename POLICY, typename RELPERM_WRAPPER >
+  static void
+  launch( arrayView1d< integer const > const & isActive,
+          RELPERM_WRAPPER const & relPermWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( isActive.size(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( isActive[k] )
+      {
+        for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+        {
+          relPermWrapper.update( k, q, phaseVolFrac[k] );
+        }
+      }
+    } );
+  }
 };
 
 /******************************** CapillaryPressureUpdateKernel ********************************/
@@ -537,6 +555,24 @@ struct CapillaryPressureUpdateKernel
       }
     } );
   }
+
+  template< typename POLICY, typename CAPPRES_WRAPPER >
+  static void
+  launch( arrayView1d< integer const > const & isActive,
+          CAPPRES_WRAPPER const & capPresWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( isActive.size(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( isActive[k] )
+      {
+        for( localIndex q = 0; q < capPresWrapper.numGauss(); ++q )
+        {
+          capPresWrapper.update( k, q, phaseVolFrac[k] );
+        }
+      }
+    } );
+  }
 };
 
 /******************************** ElementBasedAssemblyKernel ********************************/
@@ -1481,6 +1517,170 @@ public:
   }
 };
 
+/******************************** PhaseVolumeFractionScalingKernel ********************************/
+
+/**
+ * @class PhaseVolumeFractionScalingKernel
+ * @brief Define the kernel chopping the Newton update based on the predicted change of the phase volume fractions
+ *
+ * The change in phase volume fraction is predicted with the derivatives of the phase volume fractions
+ * (no flash is performed), and the update of the cells in which it exceeds the max allowed change is
+ * scaled down (Appleyard-type chop). With local scaling, the update of each cell is scaled independently.
+ */
+class PhaseVolumeFractionScalingKernel : public ScalingAndCheckingSystemSolutionKernelBase< real64 >
+{
+public:
+
+  using Base = ScalingAndCheckingSystemSolutionKernelBase< real64 >;
+  using Base::m_numComp;
+  using Base::m_localSolution;
+  using Base::m_pressureScalingFactor;
+  using Base::m_compDensScalingFactor;
+
+  /**
+   * @brief Create a new kernel instance
+   * @param[in] maxPhaseVolFracChange the max allowed (absolute) phase volume fraction change
+   * @param[in] localScaling flag to indicate whether the update is scaled locally (cell by cell)
+   * @param[in] isThermal flag to indicate whether the temperature is a primary variable
+   * @param[in] rankOffset the rank offset
+   * @param[in] numComp the number of components
+   * @param[in] numPhase the number of phases
+   * @param[in] dofKey the dof key to get dof numbers
+   * @param[in] subRegion the subRegion
+   * @param[in] localSolution the Newton update
+   */
+  PhaseVolumeFractionScalingKernel( real64 const maxPhaseVolFracChange,
+                                    integer const localScaling,
+                                    integer const isThermal,
+                                    globalIndex const rankOffset,
+                                    integer const numComp,
+                                    integer const numPhase,
+                                    string const dofKey,
+                                    ElementSubRegionBase & subRegion,
+                                    arrayView1d< real64 const > const localSolution )
+    : Base( rankOffset,
+            numComp,
+            dofKey,
+            subRegion,
+            localSolution,
+            subRegion.getField< fields::flow::pressure >(),
+            subRegion.getField< fields::flow::globalCompDensity >(),
+            subRegion.getField< fields::flow::pressureScalingFactor >(),
+            subRegion.getField< fields::flow::globalCompDensityScalingFactor >() ),
+    m_maxPhaseVolFracChange( maxPhaseVolFracChange ),
+    m_localScaling( localScaling ),
+    m_isThermal( isThermal ),
+    m_numPhase( numPhase ),
+    m_dPhaseVolFrac( subRegion.getField< fields::flow::dPhaseVolumeFraction >() ),
+    m_temperatureScalingFactor( subRegion.getField< fields::flow::temperatureScalingFactor >() )
+  {}
+
+  /**
+   * @brief Compute the local value
+   * @param[in] ei the element index
+   * @param[inout] stack the stack variables
+   */
+  GEOS_HOST_DEVICE
+  void compute( localIndex const ei,
+                StackVariables & stack ) const
+  {
+    using Deriv = constitutive::multifluid::DerivativeOffset;
+
+    // with local scaling, the prediction uses the update already scaled in this cell
+    real64 const presScaling = m_localScaling ? m_pressureScalingFactor[ei] : 1.0;
+    real64 const compDensScaling = m_localScaling ? m_compDensScalingFactor[ei] : 1.0;
+    real64 const tempScaling = m_localScaling ? m_temperatureScalingFactor[ei] : 1.0;
+
+    real64 const deltaPres = presScaling * m_localSolution[stack.localRow];
+    real64 const deltaTemp = m_isThermal ? tempScaling * m_localSolution[stack.localRow + m_numComp + 1] : 0.0;
+
+    arraySlice2d< real64 const, compflow::USD_PHASE_DC - 1 > const dPhaseVolFrac = m_dPhaseVolFrac[ei];
+
+    real64 scalingFactor = 1.0;
+    for( integer ip = 0; ip < m_numPhase; ++ip )
+    {
+      real64 deltaPhaseVolFrac = dPhaseVolFrac[ip][Deriv::dP] * deltaPres + dPhaseVolFrac[ip][Deriv::dT] * deltaTemp;
+      for( integer ic = 0; ic < m_numComp; ++ic )
+      {
+        deltaPhaseVolFrac += dPhaseVolFrac[ip][Deriv::dC+ic] * compDensScaling * m_localSolution[stack.localRow + ic + 1];
+      }
+      real64 const absPhaseVolFracChange = LvArray::math::abs( deltaPhaseVolFrac );
+      if( absPhaseVolFracChange > m_maxPhaseVolFracChange )
+      {
+        scalingFactor = LvArray::math::min( scalingFactor, m_maxPhaseVolFracChange / absPhaseVolFracChange );
+      }
+    }
+
+    if( m_localScaling )
+    {
+      m_pressureScalingFactor[ei] = presScaling * scalingFactor;
+      m_compDensScalingFactor[ei] = compDensScaling * scalingFactor;
+      m_temperatureScalingFactor[ei] = tempScaling * scalingFactor;
+    }
+    stack.localMinVal = scalingFactor;
+  }
+
+protected:
+
+  /// Max allowed change in phase volume fraction
+  real64 const m_maxPhaseVolFracChange;
+
+  /// Flag to indicate whether the update is scaled locally
+  integer const m_localScaling;
+
+  /// Flag to indicate whether the temperature is a primary variable
+  integer const m_isThermal;
+
+  /// Number of phases
+  integer const m_numPhase;
+
+  /// View on the derivatives of the phase volume fractions
+  arrayView3d< real64 const, compflow::USD_PHASE_DC > const m_dPhaseVolFrac;
+
+  /// View on the temperature scaling factor
+  arrayView1d< real64 > const m_temperatureScalingFactor;
+
+};
+
+/**
+ * @class PhaseVolumeFractionScalingKernelFactory
+ */
+class PhaseVolumeFractionScalingKernelFactory
+{
+public:
+
+  /*
+   * @brief Create and launch the kernel chopping the Newton update based on the phase volume fractions
+   * @tparam POLICY the kernel policy
+   * @param[in] maxPhaseVolFracChange the max allowed (absolute) phase volume fraction change
+   * @param[in] localScaling flag to indicate whether the update is scaled locally (cell by cell)
+   * @param[in] isThermal flag to indicate whether the temperature is a primary variable
+   * @param[in] rankOffset the rank offset
+   * @param[in] numComp the number of components
+   * @param[in] numPhase the number of phases
+   * @param[in] dofKey the dof key to get dof numbers
+   * @param[in] subRegion the subRegion
+   * @param[in] localSolution the Newton update
+   * @return the min scaling factor in the subRegion
+   */
+  template< typename POLICY >
+  static real64
+  createAndLaunch( real64 const maxPhaseVolFracChange,
+                   integer const localScaling,
+                   integer const isThermal,
+                   globalIndex const rankOffset,
+                   integer const numComp,
+                   integer const numPhase,
+                   string const dofKey,
+                   ElementSubRegionBase & subRegion,
+                   arrayView1d< real64 const > const localSolution )
+  {
+    PhaseVolumeFractionScalingKernel kernel( maxPhaseVolFracChange, localScaling, isThermal, rankOffset,
+                                             numComp, numPhase, dofKey, subRegion, localSolution );
+    return PhaseVolumeFractionScalingKernel::launch< POLICY >( subRegion.size(), kernel );
+  }
+};
+
 /******************************** SolutionCheckKernel ********************************/
 
 /**
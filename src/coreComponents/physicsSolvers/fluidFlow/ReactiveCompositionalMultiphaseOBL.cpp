@@ -19,6 +19,7 @@
 
 #include "ReactiveCompositionalMultiphaseOBL.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "constitutive/solid/CoupledSolidBase.hpp"
 #include "dataRepository/Group.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
@@ -45,6 +46,7 @@ namespace
 {
 
 MultivariableTableFunction const * makeOBLOperatorsTable( string const & OBLOperatorsTableFile,
+                                                          MultivariableTableFunction::StorageMode const storageMode,
                                                           FunctionManager & functionManager )
 {
   string const tableName = "OBL_operators_table";
@@ -55,6 +57,7 @@ MultivariableTableFunction const * makeOBLOperatorsTable( string const & OBLOper
   else
   {
     MultivariableTableFunction * const table = dynamicCast< MultivariableTableFunction * >( functionManager.createChild( "MultivariableTableFunction", tableName ) );
+    table->setStorageMode( storageMode );
     table->initializeFunctionFromFile ( OBLOperatorsTableFile );
     return table;
   }
@@ -88,6 +91,11 @@ ReactiveCompositionalMultiphaseOBL::ReactiveCompositionalMultiphaseOBL( const st
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "File containing OBL operator values" );
 
+  this->registerWrapper( viewKeyStruct::OBLOperatorsTableStorageString(), &m_OBLOperatorsTableStorage ).
+    setApplyDefaultValue( MultivariableTableFunction::StorageMode::Hypercube ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Storage of the OBL operator values. Valid options:\n* " + EnumStrings< MultivariableTableFunction::StorageMode >::concat( "\n* " ) );
+
   this->registerWrapper( viewKeyStruct::maxCompFracChangeString(), &m_maxCompFracChange ).
     setApplyDefaultValue( 1.0 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -184,6 +192,19 @@ void ReactiveCompositionalMultiphaseOBL::implicitStepComplete( real64 const & ti
       porousMaterial.saveConvergedState();
     } );
   } );
+
+  if( getLogLevel() >= 1 && m_OBLOperatorsTable->getStorageMode() == MultivariableTableFunction::StorageMode::Adaptive )
+  {
+    // the hypercubes are filled independently on each rank
+    globalIndex const numFilled = m_OBLOperatorsTable->numFilledHypercubes();
+    globalIndex const maxNumFilled = MpiWrapper::max( numFilled );
+    globalIndex const sumNumFilled = MpiWrapper::sum( numFilled );
+    globalIndex const sumNumEvaluated = MpiWrapper::sum( m_OBLOperatorsTable->numEvaluatedPoints() );
+    real64 const numHypercubes = m_OBLOperatorsTable->numHypercubes();
+    GEOS_LOG_RANK_0( GEOS_FMT( "{}: visited OBL hypercubes per rank: max {} ({:.2f}% of {}), total over ranks {}; evaluated points {}",
+                               getName(), maxNumFilled, 100.0 * maxNumFilled / numHypercubes, numHypercubes,
+                               sumNumFilled, sumNumEvaluated ) );
+  }
 }
 
 void ReactiveCompositionalMultiphaseOBL::postInputInitialization()
@@ -200,7 +221,7 @@ void ReactiveCompositionalMultiphaseOBL::postInputInitialization()
                                   getWrapperDataContext( viewKeyStruct::maxCompFracChangeString() ), m_maxCompFracChange ),
                         InputError );
 
-  m_OBLOperatorsTable = makeOBLOperatorsTable( m_OBLOperatorsTableFile, FunctionManager::getInstance());
+  m_OBLOperatorsTable = makeOBLOperatorsTable( m_OBLOperatorsTableFile, m_OBLOperatorsTableStorage, FunctionManager::getInstance());
 
   // Equations: [NC] Molar mass balance, ([1] energy balance if enabled)
   // Primary variables: [1] pressure, [NC-1] global component fractions, ([1] temperature)
@@ -1084,14 +1105,15 @@ void ReactiveCompositionalMultiphaseOBL::applyDirichletBC( real64 const time,
   {
 
     // 1. Apply pressure Dirichlet BCs, store in a separate field
-    fsManager.apply< ElementSubRegionBase >( time + dt,
-                                             mesh,
-                                             fields::flow::pressure::key(),
-                                             [&]( FieldSpecificationBase const & fs,
-                                                  string const & setName,
-                                                  SortedArrayView< localIndex const > const & targetSet,
-                                                  ElementSubRegionBase & subRegion,
-                                                  string const & )
+    fsManager.applyFieldValueToField< ElementSubRegionBase, parallelDevicePolicy<> >( time + dt,
+                                                                                      mesh,
+                                                                                      fields::flow::pressure::key(),
+                                                                                      fields::flow::bcPressure::key(),
+                                                                                      [&]( FieldSpecificationBase const & fs,
+                                                                                           string const & setName,
+                                                                                           SortedArrayView< localIndex const > const & targetSet,
+                                                                                           ElementSubRegionBase & subRegion,
+                                                                                           string const & )
     {
       if( fs.getLogLevel() >= 1 && m_nonlinearSolverParameters.m_numNewtonIterations == 0 )
       {
@@ -1100,38 +1122,30 @@ void ReactiveCompositionalMultiphaseOBL::applyDirichletBC( real64 const time,
                                    getName(), time+dt, fs.getCatalogName(), fs.getName(),
                                    setName, subRegion.getName(), fs.getScale(), numTargetElems ) );
       }
-
-      fs.applyFieldValue< FieldSpecificationEqual, parallelDevicePolicy<> >( targetSet,
-                                                                             time + dt,
-                                                                             subRegion,
-                                                                             fields::flow::bcPressure::key() );
     } );
 
     // 2. Apply composition BC (global component fraction), store in a separate field
-    fsManager.apply< ElementSubRegionBase >( time + dt,
-                                             mesh,
-                                             fields::flow::globalCompFraction::key(),
-                                             [&] ( FieldSpecificationBase const & fs,
-                                                   string const &,
-                                                   SortedArrayView< localIndex const > const & targetSet,
-                                                   ElementSubRegionBase & subRegion,
-                                                   string const & )
-    {
-      fs.applyFieldValue< FieldSpecificationEqual, parallelDevicePolicy<> >( targetSet,
-                                                                             time + dt,
-                                                                             subRegion,
-                                                                             fields::flow::bcGlobalCompFraction::key() );
-    } );
+    fsManager.applyFieldValueToField< ElementSubRegionBase, parallelDevicePolicy<> >( time + dt,
+                                                                                      mesh,
+                                                                                      fields::flow::globalCompFraction::key(),
+                                                                                      fields::flow::bcGlobalCompFraction::key(),
+                                                                                      [&] ( FieldSpecificationBase const &,
+                                                                                            string const &,
+                                                                                            SortedArrayView< localIndex const > const &,
+                                                                                            ElementSubRegionBase &,
+                                                                                            string const & )
+    {} );
 
     // 3. Apply temperature Dirichlet BCs, store in a separate field
-    fsManager.apply< ElementSubRegionBase >( time + dt,
-                                             mesh,
-                                             fields::flow::temperature::key(),
-                                             [&]( FieldSpecificationBase const & fs,
-                                                  string const & setName,
-                                                  SortedArrayView< localIndex const > const & targetSet,
-                                                  ElementSubRegionBase & subRegion,
-                                                  string const & )
+    fsManager.applyFieldValueToField< ElementSubRegionBase, parallelDevicePolicy<> >( time + dt,
+                                                                                      mesh,
+                                                                                      fields::flow::temperature::key(),
+                                                                                      fields::flow::bcTemperature::key(),
+                                                                                      [&]( FieldSpecificationBase const & fs,
+                                                                                           string const & setName,
+                                                                                           SortedArrayView< localIndex const > const & targetSet,
+                                                                                           ElementSubRegionBase & subRegion,
+                                                                                           string const & )
     {
       if( fs.getLogLevel() >= 1 && m_nonlinearSolverParameters.m_numNewtonIterations == 0 )
       {
@@ -1140,11 +1154,6 @@ void ReactiveCompositionalMultiphaseOBL::applyDirichletBC( real64 const time,
                                    getName(), time+dt, fs.getCatalogName(), fs.getName(),
                                    setName, subRegion.getName(), fs.getScale(), numTargetElems ) );
       }
-
-      fs.applyFieldValue< FieldSpecificationEqual, parallelDevicePolicy<> >( targetSet,
-                                                                             time + dt,
-                                                                             subRegion,
-                                                                             fields::flow::bcTemperature::key() );
     } );
 
     globalIndex const rankOffset = dofManager.rankOffset();
@@ -36,10 +36,9 @@ namespace geos
  * - Does not work with wells and aquifers (will require introduction of additional operator tables)
  * - Uses a single operator table for the whole reservoir (introduction of several tables will allow to support different fluid properties
  * in different reservoir regions)
- * - Since only static MultivariableTableFunction is currently implemented, all operator values have to be stored, which limits OBL
- * discretization:
- *    only 3-5 components with 32-64 points is now viable. Adative MultivariableTableFunction with sparse storage will allow for much more
- * refined OBL parametrizations
+ * - With the default (hypercube) storage of MultivariableTableFunction, every point is duplicated in 2^numDims hypercubes, which
+ * limits OBL discretization to 3-5 components with 32-64 points. The point storage avoids this duplication, and the adaptive
+ * storage only keeps the hypercubes visited during the simulation (see OBLOperatorsTableStorage)
  * - Does not use any fluid model, and solid models are only needed to get initial porosity
  */
 //START_SPHINX_INCLUDE_00
@@ -243,6 +242,8 @@ public:
 
     static constexpr char const * OBLOperatorsTableFileString() { return "OBLOperatorsTableFile"; }
 
+    static constexpr char const * OBLOperatorsTableStorageString() { return "OBLOperatorsTableStorage"; }
+
     static constexpr char const * transMultExpString() { return "transMultExp"; }
 
     static constexpr char const * maxCompFracChangeString() { return "maxCompFractionChange"; }
@@ -331,6 +332,9 @@ private:
   /// OBL operators table file (if OBL physics becomes consitutive, multiple regions will be supported )
   Path m_OBLOperatorsTableFile;
 
+  /// storage mode of the OBL operators table
+  MultivariableTableFunction::StorageMode m_OBLOperatorsTableStorage;
+
   /// OBL operators table function tabulated vs all primary variables
   MultivariableTableFunction const * m_OBLOperatorsTable;
 
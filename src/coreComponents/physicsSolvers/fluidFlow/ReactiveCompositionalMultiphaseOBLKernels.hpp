@@ -188,17 +188,16 @@ public:
   {}
 
   /**
-   * @brief Compute the operator values and derivatives for an element
+   * @brief Get the OBL state (table coordinates) of an element
    * @param[in] ei the element index
+   * @param[out] state the OBL state
    */
   GEOS_HOST_DEVICE
   inline
-  void compute( localIndex const ei ) const
+  void getState( localIndex const ei,
+                 real64 ( & state )[numDofs] ) const
   {
     arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compFrac = m_compFrac[ei];
-    arraySlice1d< real64, compflow::USD_OBL_VAL - 1 > const & OBLVals = m_OBLOperatorValues[ei];
-    arraySlice2d< real64, compflow::USD_OBL_DER - 1 > const & OBLDers = m_OBLOperatorDerivatives[ei];
-    real64 state[numDofs];
 
     // we need to convert pressure from Pa (internal unit in GEOSX) to bar (internal unit in DARTS)
     state[0] = m_pressure[ei] * pascalToBarMult;
@@ -213,6 +212,34 @@ public:
     {
       state[numDofs - 1] = m_temperature[ei];
     }
+  }
+
+  /**
+   * @brief Get the index of the table hypercube containing the state of an element
+   * @param[in] ei the element index
+   * @return the hypercube index
+   */
+  GEOS_HOST_DEVICE
+  inline
+  globalIndex getHypercubeIndex( localIndex const ei ) const
+  {
+    real64 state[numDofs];
+    getState( ei, state );
+    return m_OBLOperatorsTable.getHypercubeIndex( state );
+  }
+
+  /**
+   * @brief Compute the operator values and derivatives for an element
+   * @param[in] ei the element index
+   */
+  GEOS_HOST_DEVICE
+  inline
+  void compute( localIndex const ei ) const
+  {
+    arraySlice1d< real64, compflow::USD_OBL_VAL - 1 > const & OBLVals = m_OBLOperatorValues[ei];
+    arraySlice2d< real64, compflow::USD_OBL_DER - 1 > const & OBLDers = m_OBLOperatorDerivatives[ei];
+    real64 state[numDofs];
+    getState( ei, state );
 
     m_OBLOperatorsTable.compute( state, OBLVals, OBLDers );
 
@@ -270,17 +297,23 @@ public:
       integer constexpr NUM_DIMS = ENABLE_ENERGY + NUM_COMPS;
       integer constexpr NUM_OPS  = COMPUTE_NUM_OPS( NUM_PHASES, NUM_COMPS, ENABLE_ENERGY );
 
-      OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >
-      kernel( subRegion,
-              MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS >( function.getAxisMinimums(),
-                                                                           function.getAxisMaximums(),
-                                                                           function.getAxisPoints(),
-                                                                           function.getAxisSteps(),
-                                                                           function.getAxisStepInvs(),
-                                                                           function.getAxisHypercubeMults(),
-                                                                           function.getHypercubeData()
-                                                                           ) );
-      OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >::template launch< POLICY >( subRegion.size(), kernel );
+      using KernelType = OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >;
+
+      if( function.getStorageMode() == MultivariableTableFunction::StorageMode::Adaptive )
+      {
+        // fill the hypercubes visited by the element states before the interpolation
+        KernelType const indexKernel( subRegion, MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS >( function ) );
+        array1d< globalIndex > hypercubeIndices( subRegion.size() );
+        arrayView1d< globalIndex > const hypercubeIndicesView = hypercubeIndices.toView();
+        forAll< POLICY >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+        {
+          hypercubeIndicesView[ei] = indexKernel.getHypercubeIndex( ei );
+        } );
+        function.fillHypercubes( hypercubeIndices.toViewConst() );
+      }
+
+      KernelType kernel( subRegion, MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS >( function ) );
+      KernelType::template launch< POLICY >( subRegion.size(), kernel );
     } );
   }
 
@@ -910,22 +910,17 @@ void applyAndSpecifyFieldValue( real64 const & time_n,
 {
   FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
 
-  fsManager.apply< ElementSubRegionBase >( time_n + dt,
-                                           mesh,
-                                           fieldKey,
-                                           [&]( FieldSpecificationBase const & fs,
-                                                string const &,
-                                                SortedArrayView< localIndex const > const & lset,
-                                                ElementSubRegionBase & subRegion,
-                                                string const & )
+  // Specify the bc value of the field
+  fsManager.applyFieldValueToField< ElementSubRegionBase, parallelDevicePolicy<> >( time_n + dt,
+                                                                                    mesh,
+                                                                                    fieldKey,
+                                                                                    boundaryFieldKey,
+                                                                                    [&]( FieldSpecificationBase const &,
+                                                                                         string const &,
+                                                                                         SortedArrayView< localIndex const > const & lset,
+                                                                                         ElementSubRegionBase & subRegion,
+                                                                                         string const & )
   {
-    // Specify the bc value of the field
-    fs.applyFieldValue< FieldSpecificationEqual,
-                        parallelDevicePolicy<> >( lset,
-                                                  time_n + dt,
-                                                  subRegion,
-                                                  boundaryFieldKey );
-
     arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
     arrayView1d< globalIndex const > const dofNumber =
       subRegion.getReference< array1d< globalIndex > >( dofKey );
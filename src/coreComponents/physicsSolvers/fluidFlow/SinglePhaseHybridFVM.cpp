@@ -75,6 +75,15 @@ void SinglePhaseHybridFVM::registerDataOnMesh( Group & meshBodies )
       subRegion.registerField< pressureGradient >( getName() ).
         reference().resizeDimension< 1 >( 3 );
     } );
+
+    // cache of the transmissibility matrices
+    elemManager.forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                              [&]( localIndex const,
+                                                                   CellElementSubRegion & subRegion )
+    {
+      subRegion.registerField< mimeticTransMatrix >( getName() ).
+        reference().resizeDimension< 1 >( MimeticInnerProductHelpers::transMatrixCacheSize( subRegion.numFacesPerElement() ) );
+    } );
   } );
 
   // 2) Register the face data
@@ -115,6 +124,12 @@ void SinglePhaseHybridFVM::initializePostInitialConditionsPreSubGroups()
 
   DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
 
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & regionNames )
@@ -151,6 +166,23 @@ void SinglePhaseHybridFVM::initializePostInitialConditionsPreSubGroups()
                        "The aquifer boundary condition " << bc.getDataContext() << " was requested in the XML file. \n" <<
                        "This type of boundary condition is not yet supported by SinglePhaseHybridFVM and will be ignored" );
     } );
+
+    // precompute the transmissibility matrices, which are then only recomputed when the permeability changes
+    real64 const lengthTolerance = domain.getMeshBody( 0 ).getGlobalLengthScale() * m_areaRelTol;
+    NodeManager const & nodeManager = mesh.getNodeManager();
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      string const & permName = subRegion.getReference< string >( viewKeyStruct::permeabilityNamesString() );
+      PermeabilityBase const & permeability = getConstitutiveModel< PermeabilityBase >( subRegion, permName );
+
+      TransMatrixCacheKernelFactory::createAndLaunch( lengthTolerance,
+                                                      nodeManager,
+                                                      faceManager,
+                                                      subRegion,
+                                                      mimeticInnerProductBase,
+                                                      permeability );
+    } );
   } );
 }
 
@@ -380,14 +412,16 @@ void SinglePhaseHybridFVM::applyFaceDirichletBC( real64 const time_n,
 
     // take BCs defined for "pressure" field and apply values to "facePressure"
     // this is done this way for consistency with the standard TPFA scheme, which works in the same fashion
-    fsManager.apply< FaceManager >( time_n + dt,
-                                    mesh,
-                                    fields::flow::pressure::key(),
-                                    [&] ( FieldSpecificationBase const & fs,
-                                          string const & setName,
-                                          SortedArrayView< localIndex const > const & targetSet,
-                                          FaceManager & targetGroup,
-                                          string const & )
+    // 1. first, populate the face pressure vector at the boundaries of the domain
+    fsManager.applyFieldValueToField< FaceManager, parallelDevicePolicy<> >( time_n + dt,
+                                                                             mesh,
+                                                                             fields::flow::pressure::key(),
+                                                                             fields::flow::facePressure::key(),
+                                                                             [&] ( FieldSpecificationBase const & fs,
+                                                                                   string const & setName,
+                                                                                   SortedArrayView< localIndex const > const & targetSet,
+                                                                                   FaceManager & targetGroup,
+                                                                                   string const & )
     {
 
       // provide some logging at the first nonlinear iteration
@@ -399,15 +433,6 @@ void SinglePhaseHybridFVM::applyFaceDirichletBC( real64 const time_n,
                                    setName, targetGroup.getName(), numTargetFaces ) );
       }
 
-      // next, we use the field specification functions to apply the boundary conditions to the system
-
-      // 1. first, populate the face pressure vector at the boundaries of the domain
-      fs.applyFieldValue< FieldSpecificationEqual,
-                          parallelDevicePolicy<> >( targetSet,
-                                                    time_n + dt,
-                                                    targetGroup,
-                                                    fields::flow::facePressure::key() );
-
       // 2. second, modify the residual/jacobian matrix as needed to impose the boundary conditions
       forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
       {
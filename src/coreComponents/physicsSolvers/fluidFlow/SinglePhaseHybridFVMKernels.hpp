@@ -298,6 +298,7 @@ public:
     m_elemList( faceManager.elementList() ),
     m_elemPerm( permeability.permeability() ),
     m_transMultiplier( faceManager.getField< fields::flow::transMultiplier >() ),
+    m_transMatrixCache( subRegion.getField< fields::flow::mimeticTransMatrix >() ),
     m_elemPres( subRegion.getField< fields::flow::pressure >() ),
     m_facePres( faceManager.getField< fields::flow::facePressure >() ),
     m_elemDens ( fluid.density() ),
@@ -489,17 +490,17 @@ public:
 
     real64 const perm[ 3 ] = { m_elemPerm[ei][0][0], m_elemPerm[ei][0][1], m_elemPerm[ei][0][2] };
 
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    IP::template compute< NUM_FACE >( m_nodePosition,
-                                      m_transMultiplier,
-                                      m_faceToNodes,
-                                      m_elemToFaces[ei],
-                                      m_elemCenter[ei],
-                                      m_elemVolume[ei],
-                                      perm,
-                                      m_lengthTolerance,
-                                      stack.transMatrix );
+    // get the local transmissibility matrix from the cache, recomputed only if the permeability has changed
+    mimeticInnerProduct::MimeticInnerProductHelpers::computeCached< IP, NUM_FACE >( m_nodePosition,
+                                                                                   m_transMultiplier,
+                                                                                   m_faceToNodes,
+                                                                                   m_elemToFaces[ei],
+                                                                                   m_elemCenter[ei],
+                                                                                   m_elemVolume[ei],
+                                                                                   perm,
+                                                                                   m_lengthTolerance,
+                                                                                   m_transMatrixCache[ei],
+                                                                                   stack.transMatrix );
 
     /*
      * compute auxiliary quantities at the one sided faces of this element:
@@ -655,6 +656,9 @@ protected:
   arrayView3d< real64 const > const m_elemPerm;
   arrayView1d< real64 const > const m_transMultiplier;
 
+  /// cache of the transmissibility matrices, updated by the kernel (each element only writes its own entries)
+  arrayView2d< real64 > const m_transMatrixCache;
+
   /// pressure and fluid data
   arrayView1d< real64 const > const m_elemPres;
   arrayView1d< real64 const > const m_facePres;
@@ -742,6 +746,53 @@ public:
 
 };
 
+/******************************** TransMatrixCacheKernelFactory ********************************/
+
+class TransMatrixCacheKernelFactory
+{
+public:
+
+  /**
+   * @brief Fill the cache of the transmissibility matrices of a subregion
+   * @param[in] lengthTolerance tolerance used in the transmissibility computations
+   * @param[in] nodeManager the node manager
+   * @param[in] faceManager the face manager
+   * @param[inout] subRegion the element sub-region
+   * @param[in] mimeticInnerProductBase the inner product to dispatch
+   * @param[in] permeability the permeability model
+   */
+  static void
+  createAndLaunch( real64 const lengthTolerance,
+                   NodeManager const & nodeManager,
+                   FaceManager const & faceManager,
+                   CellElementSubRegion & subRegion,
+                   mimeticInnerProduct::MimeticInnerProductBase const & mimeticInnerProductBase,
+                   constitutive::PermeabilityBase const & permeability )
+  {
+    mimeticInnerProductDispatch( mimeticInnerProductBase,
+                                 [&] ( auto const mimeticInnerProduct )
+    {
+      using IP = TYPEOFREF( mimeticInnerProduct );
+
+      internal::kernelLaunchSelectorFaceSwitch( subRegion.numFacesPerElement(), [&] ( auto NUM_FACES )
+      {
+        hybridFVMKernels::TransMatrixCacheKernel::
+          launch< IP, NUM_FACES >( subRegion.size(),
+                                   nodeManager.referencePosition(),
+                                   faceManager.getField< fields::flow::transMultiplier >(),
+                                   faceManager.nodeList().toViewConst(),
+                                   subRegion.faceList().toViewConst(),
+                                   subRegion.getElementCenter(),
+                                   subRegion.getElementVolume(),
+                                   permeability.permeability(),
+                                   lengthTolerance,
+                                   subRegion.getField< fields::flow::mimeticTransMatrix >() );
+      } );
+    } );
+  }
+
+};
+
 /******************************** ResidualNormKernel ********************************/
 
 /**
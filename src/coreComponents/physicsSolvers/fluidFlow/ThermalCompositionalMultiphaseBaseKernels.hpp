@@ -484,6 +484,26 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( arrayView1d< integer const > const & isActive,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    forAll< POLICY >( isActive.size(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( isActive[k] )
+      {
+        for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+        {
+          fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+        }
+      }
+    } );
+  }
 };
 
 /******************************** SolidInternalEnergyUpdateKernel ********************************/
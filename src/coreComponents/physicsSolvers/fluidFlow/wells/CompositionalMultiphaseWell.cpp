@@ -1485,10 +1485,7 @@ CompositionalMultiphaseWell::applySystemSolution( DofManager const & dofManager,
 
   // if component density chopping is allowed, some component densities may be negative after the update
   // these negative component densities are set to zero in this function
-  if( m_allowCompDensChopping )
-  {
-    chopNegativeDensities( domain );
-  }
+  m_isAppliedSolutionModified = m_allowCompDensChopping && chopNegativeDensities( domain );
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
@@ -1509,9 +1506,10 @@ CompositionalMultiphaseWell::applySystemSolution( DofManager const & dofManager,
   } );
 }
 
-void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domain )
+bool CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domain )
 {
   integer const numComp = m_numComponents;
+  integer isChopped = 0;
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
@@ -1529,6 +1527,7 @@ void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domai
       arrayView2d< real64, compflow::USD_COMP > const & wellElemCompDens =
         subRegion.getField< fields::well::globalCompDensity >();
 
+      RAJA::ReduceMax< parallelDeviceReduce, integer > subRegionIsChopped( 0 );
       forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
       {
         if( wellElemGhostRank[iwelem] < 0 )
@@ -1540,13 +1539,17 @@ void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domai
             if( wellElemCompDens[iwelem][ic] < 0 )
             {
               wellElemCompDens[iwelem][ic] = 0;
+              subRegionIsChopped.max( 1 );
             }
           }
         }
       } );
+      isChopped = LvArray::math::max( isChopped, subRegionIsChopped.get() );
     } );
 
   } );
+
+  return MpiWrapper::max( isChopped ) > 0;
 }
 
 
@@ -264,8 +264,9 @@ public:
   /**
    * @brief Sets all the negative component densities (if any) to zero.
    * @param domain the physical domain object
+   * @return true if a component density has been chopped on any rank
    */
-  void chopNegativeDensities( DomainPartition & domain );
+  bool chopNegativeDensities( DomainPartition & domain );
 
   arrayView1d< string const > relPermModelNames() const { return m_relPermModelNames; }
 
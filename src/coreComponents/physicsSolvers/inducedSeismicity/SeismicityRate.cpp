@@ -351,14 +351,16 @@ real64 SeismicityRate::updateStresses( real64 const & time_n,
 
       for( auto const & key : keys )
       {
-        fsManager.apply< ElementSubRegionBase >( time_n + dt,
-                                                 mesh,
-                                                 key,
-                                                 [&]( FieldSpecificationBase const & fs,
-                                                      string const & setName,
-                                                      SortedArrayView< localIndex const > const & lset,
-                                                      ElementSubRegionBase & subRegion,
-                                                      string const & )
+        // Specify the bc value of the field
+        fsManager.applyFieldValueToField< ElementSubRegionBase, parallelDevicePolicy<> >( time_n + dt,
+                                                                                          mesh,
+                                                                                          key,
+                                                                                          key,
+                                                                                          [&]( FieldSpecificationBase const & fs,
+                                                                                               string const & setName,
+                                                                                               SortedArrayView< localIndex const > const & lset,
+                                                                                               ElementSubRegionBase & subRegion,
+                                                                                               string const & )
         {
           if( fs.getLogLevel() >= 1 )
           {
@@ -367,13 +369,6 @@ real64 SeismicityRate::updateStresses( real64 const & time_n,
                                        this->getName(), time_n+dt, FieldSpecificationBase::catalogName(),
                                        fs.getName(), setName, subRegion.getName(), fs.getScale(), numTargetElems ) );
           }
-
-          // Specify the bc value of the field
-          fs.applyFieldValue< FieldSpecificationEqual,
-                              parallelDevicePolicy<> >( lset,
-                                                        time_n + dt,
-                                                        subRegion,
-                                                        key );
         } );
       }
     } );
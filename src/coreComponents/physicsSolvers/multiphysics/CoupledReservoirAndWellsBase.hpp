@@ -22,6 +22,7 @@
 #define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_COUPLEDRESERVOIRANDWELLSBASE_HPP_
 
 #include "physicsSolvers/multiphysics/CoupledSolver.hpp"
+#include "physicsSolvers/multiphysics/WellEquationsElimination.hpp"
 
 #include "common/TimingMacros.hpp"
 #include "constitutive/permeability/PermeabilityFields.hpp"
@@ -92,6 +93,12 @@ public:
   /// String used to form the solverName used to register solvers in CoupledSolver
   static string coupledSolverAttributePrefix() { return "reservoirAndWells"; }
 
+  struct viewKeyStruct : Base::viewKeyStruct
+  {
+    /// Flag to eliminate the well equations before the global linear solve
+    constexpr static char const * eliminateWellEquationsString() { return "eliminateWellEquations"; }
+  };
+
   /**
    * @brief main constructor for ManagedGroup Objects
    * @param name the name of this instantiation of ManagedGroup in the repository
@@ -100,10 +107,17 @@ public:
   CoupledReservoirAndWellsBase ( const string & name,
                                  dataRepository::Group * const parent )
     : Base( name, parent ),
-    m_isWellTransmissibilityComputed( false )
+    m_isWellTransmissibilityComputed( false ),
+    m_eliminateWellEquations( 0 )
   {
     this->template getWrapper< string >( Base::viewKeyStruct::discretizationString() ).
       setInputFlag( dataRepository::InputFlags::FALSE );
+
+    this->registerWrapper( viewKeyStruct::eliminateWellEquationsString(), &m_eliminateWellEquations ).
+      setApplyDefaultValue( 0 ).
+      setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+      setDescription( "Flag to eliminate the well equations with a local dense solve before the global linear solve, "
+                      "and to recover the well solution afterwards. Only the wells held by a single rank are eliminated." );
   }
 
   /**
@@ -150,6 +164,24 @@ public:
     // Add the number of nonzeros induced by coupling on perforations
     addCouplingNumNonzeros( domain, dofManager, rowLengths.toView() );
 
+    // Add the number of nonzeros induced by the elimination of the well equations
+    if( m_eliminateWellEquations )
+    {
+      m_wellEquationsElimination.selectWells( *this,
+                                              domain,
+                                              dofManager,
+                                              wellSolver()->numDofPerResElement(),
+                                              wellSolver()->numDofPerWellElement(),
+                                              wellSolver()->resElementDofName(),
+                                              wellSolver()->wellElementDofName() );
+      m_wellEquationsElimination.addNumNonzeros( rowLengths.toView() );
+
+      // the reduction must be entered by all ranks, not only by the rank that logs
+      localIndex const numEliminatedWells = MpiWrapper::sum( m_wellEquationsElimination.numEliminatedWells() );
+      GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: eliminating the equations of {} well(s) before the linear solve",
+                                          this->getName(), numEliminatedWells ) );
+    }
+
     // Create a new pattern with enough capacity for coupled matrix
     SparsityPattern< globalIndex > pattern;
     pattern.resizeFromRowCapacities< parallelHostPolicy >( patternDiag.numRows(), patternDiag.numColumns(), rowLengths.data() );
@@ -163,6 +195,10 @@ public:
 
     // Add the nonzeros from coupling
     addCouplingSparsityPattern( domain, dofManager, pattern.toView() );
+    if( m_eliminateWellEquations )
+    {
+      m_wellEquationsElimination.addSparsityPattern( pattern.toView() );
+    }
 
     // Finally, steal the pattern into a CRS matrix
     localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
@@ -175,6 +211,37 @@ public:
     solution.create( dofManager.numLocalDofs(), MPI_COMM_GEOS );
   }
 
+  virtual void
+  solveLinearSystem( DofManager const & dofManager,
+                     ParallelMatrix & matrix,
+                     ParallelVector & rhs,
+                     ParallelVector & solution ) override
+  {
+    GEOS_MARK_FUNCTION;
+
+    if( !m_eliminateWellEquations )
+    {
+      Base::solveLinearSystem( dofManager, matrix, rhs, solution );
+      return;
+    }
+
+    // the residual norm has been computed, the well equations can be eliminated from the local system
+    m_localMatrix.move( hostMemorySpace, true );
+    arrayView1d< real64 > const localRhs = rhs.open();
+    localRhs.move( hostMemorySpace, true );
+    m_wellEquationsElimination.eliminate( m_localMatrix.toViewConstSizes(), localRhs );
+    rhs.close();
+
+    matrix.create( m_localMatrix.toViewConst(), dofManager.numLocalDofs(), MPI_COMM_GEOS );
+
+    Base::solveLinearSystem( dofManager, matrix, rhs, solution );
+
+    arrayView1d< real64 > const localSolution = solution.open();
+    localSolution.move( hostMemorySpace, true );
+    m_wellEquationsElimination.recover( localSolution );
+    solution.close();
+  }
+
   /**@}*/
 
   /**
@@ -298,6 +365,12 @@ protected:
   /// Flag to determine whether the well transmissibility needs to be computed
   bool m_isWellTransmissibilityComputed;
 
+  /// Flag to eliminate the well equations before the global linear solve
+  integer m_eliminateWellEquations;
+
+  /// Elimination of the well equations from the linear system
+  WellEquationsElimination m_wellEquationsElimination;
+
 private:
 
   /**
@@ -196,6 +196,17 @@ public:
     } );
   }
 
+  virtual bool
+  isAppliedSolutionModified() const override
+  {
+    bool isModified = false;
+    forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
+    {
+      isModified = isModified || solver->isAppliedSolutionModified();
+    } );
+    return isModified;
+  }
+
   virtual void
   updateState( DomainPartition & domain ) override
   {
@@ -205,6 +216,17 @@ public:
     } );
   }
 
+  virtual bool
+  refreshStateForConvergenceCheck( DomainPartition & domain ) override
+  {
+    bool isRefreshed = false;
+    forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
+    {
+      isRefreshed = solver->refreshStateForConvergenceCheck( domain ) || isRefreshed;
+    } );
+    return isRefreshed;
+  }
+
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override
   {
@@ -654,7 +676,8 @@ protected:
 
       if( isConverged )
       {
-        GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "***** The iterative coupling has converged in {} iteration(s) *****", iter + 1 ) );
+        GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "***** The iterative coupling has converged in {} iteration(s) (nonlinear acceleration: {}) *****",
+                                            iter + 1, params.m_nonlinearAccelerationType ) );
       }
     }
     return isConverged;
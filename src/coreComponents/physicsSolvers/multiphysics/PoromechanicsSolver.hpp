@@ -31,6 +31,7 @@
 #include "mesh/DomainPartition.hpp"
 #include "mesh/utilities/AverageOverQuadraturePointsKernel.hpp"
 #include "codingUtilities/Utilities.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
 
 namespace geos
 {
@@ -420,6 +421,29 @@ protected:
     } );
   }
 
+  /**
+   * @brief Record which entries of averageMeanTotalStressIncrement belong to locally owned elements.
+   * @param[in] domain the domain partition
+   * @param[out] isOwned 1 for the locally owned elements, 0 for the ghosts, in the order of recordAverageMeanTotalStressIncrement
+   */
+  void recordOwnedElements( DomainPartition & domain,
+                            array1d< integer > & isOwned )
+  {
+    isOwned.resize( 0 );
+    SolverBase::forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                             MeshLevel & mesh,
+                                                                             arrayView1d< string const > const & regionNames ) {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                            auto & subRegion ) {
+        arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+        for( localIndex k = 0; k < subRegion.size(); k++ )
+        {
+          isOwned.emplace_back( ghostRank[k] < 0 ? 1 : 0 );
+        }
+      } );
+    } );
+  }
+
   void applyAcceleratedAverageMeanTotalStressIncrement( DomainPartition & domain,
                                                         array1d< real64 > & averageMeanTotalStressIncrement )
   {
@@ -476,10 +500,125 @@ protected:
                  1.0 );
   }
 
+  /* Implementation of Nonlinear Acceleration (Anderson) of averageMeanTotalStressIncrement */
+
+  /**
+   * @brief Compute the Anderson update from the output of the current fixed-stress iteration.
+   * @param[in] iter the sequential iteration
+   * @param[in] s1 the input of the current iteration (accelerated averageMeanTotalStressIncrement)
+   * @param[in] s2_tilde the output of the current iteration (unaccelerated averageMeanTotalStressIncrement)
+   * @return the input of the next iteration
+   *
+   * With the residual f = s2_tilde - s1, the update is s2_tilde - sum_j gamma_j dG_j, where gamma
+   * minimizes || f - sum_j gamma_j dF_j || over the differences dF (resp. dG) between the residuals
+   * (resp. outputs) of the last andersonDepth iterations.
+   */
+  array1d< real64 > computeAndersonUpdate( integer const iter,
+                                           array1d< real64 > const & s1,
+                                           array1d< real64 > const & s2_tilde )
+  {
+    array1d< real64 > f = axpy( s2_tilde, s1, -1.0 );
+
+    if( iter == 0 )
+    {
+      m_andersonResidualDiffs.clear();
+      m_andersonOutputDiffs.clear();
+    }
+    else
+    {
+      m_andersonResidualDiffs.emplace_back( axpy( f, m_andersonPrevResidual, -1.0 ) );
+      m_andersonOutputDiffs.emplace_back( axpy( s2_tilde, m_andersonPrevOutput, -1.0 ) );
+      if( m_andersonResidualDiffs.size() > static_cast< std::size_t >( this->getNonlinearSolverParameters().m_andersonDepth ) )
+      {
+        m_andersonResidualDiffs.erase( m_andersonResidualDiffs.begin() );
+        m_andersonOutputDiffs.erase( m_andersonOutputDiffs.begin() );
+      }
+    }
+    m_andersonPrevResidual = f;
+    m_andersonPrevOutput = s2_tilde;
+
+    localIndex const depth = LvArray::integerConversion< localIndex >( m_andersonResidualDiffs.size() );
+
+    // the dot products are summed over the locally owned elements, then over the ranks:
+    // the normal equations of the least-squares problem, followed by the squared norm of the residual
+    array1d< real64 > localProducts( depth * depth + depth + 1 );
+    for( localIndex k = 0; k < f.size(); ++k )
+    {
+      if( m_andersonIsOwned[k] == 0 )
+      {
+        continue;
+      }
+      for( localIndex i = 0; i < depth; ++i )
+      {
+        for( localIndex j = 0; j < depth; ++j )
+        {
+          localProducts[i * depth + j] += m_andersonResidualDiffs[i][k] * m_andersonResidualDiffs[j][k];
+        }
+        localProducts[depth * depth + i] += m_andersonResidualDiffs[i][k] * f[k];
+      }
+      localProducts[depth * depth + depth] += f[k] * f[k];
+    }
+    array1d< real64 > products( localProducts.size() );
+    MpiWrapper::allReduce( localProducts.data(),
+                           products.data(),
+                           LvArray::integerConversion< int >( localProducts.size() ),
+                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                           MPI_COMM_GEOS );
+
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        Anderson acceleration: depth = {}, fixed-stress residual norm = {:4.2e}",
+                                        depth, std::sqrt( products[depth * depth + depth] ) ) );
+
+    // with a small regularization of the diagonal
+    array2d< real64, MatrixLayout::ROW_MAJOR_PERM > matrix( depth, depth );
+    array1d< real64 > rhs( depth );
+    array1d< real64 > gamma( depth );
+    real64 maxDiag = 0.0;
+    for( localIndex i = 0; i < depth; ++i )
+    {
+      for( localIndex j = 0; j < depth; ++j )
+      {
+        matrix( i, j ) = products[i * depth + j];
+      }
+      rhs[i] = products[depth * depth + i];
+      maxDiag = LvArray::math::max( maxDiag, matrix( i, i ) );
+    }
+    if( isZero( maxDiag ) )
+    {
+      // no history (or stagnation): plain fixed-stress iteration
+      return s2_tilde;
+    }
+    for( localIndex i = 0; i < depth; ++i )
+    {
+      matrix( i, i ) += 1e-10 * maxDiag;
+    }
+    BlasLapackLA::solveLinearSystem( matrix.toSliceConst(), rhs.toSliceConst(), gamma.toSlice() );
+
+    array1d< real64 > s2 = s2_tilde;
+    for( localIndex j = 0; j < depth; ++j )
+    {
+      s2 = axpy( s2, m_andersonOutputDiffs[j], -gamma[j] );
+    }
+    return s2;
+  }
+
   void startSequentialIteration( integer const & iter,
                                  DomainPartition & domain ) override
   {
-    if( this->getNonlinearSolverParameters().m_nonlinearAccelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Aitken )
+    NonlinearSolverParameters::NonlinearAccelerationType const accelerationType =
+      this->getNonlinearSolverParameters().m_nonlinearAccelerationType;
+    if( accelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Anderson )
+    {
+      if( iter == 0 )
+      {
+        recordAverageMeanTotalStressIncrement( domain, m_s1 );
+        recordOwnedElements( domain, m_andersonIsOwned );
+      }
+      else
+      {
+        m_s1 = m_s2;
+      }
+    }
+    else if( accelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Aitken )
     {
       if( iter == 0 )
       {
@@ -498,7 +637,17 @@ protected:
   void finishSequentialIteration( integer const & iter,
                                   DomainPartition & domain ) override
   {
-    if( this->getNonlinearSolverParameters().m_nonlinearAccelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Aitken )
+    NonlinearSolverParameters::NonlinearAccelerationType const accelerationType =
+      this->getNonlinearSolverParameters().m_nonlinearAccelerationType;
+    if( accelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Anderson )
+    {
+      m_s2 = computeAndersonUpdate( iter, m_s1, m_s2_tilde );
+      if( !m_andersonResidualDiffs.empty() )
+      {
+        applyAcceleratedAverageMeanTotalStressIncrement( domain, m_s2 );
+      }
+    }
+    else if( accelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Aitken )
     {
       if( iter == 0 )
       {
@@ -563,7 +712,7 @@ protected:
 
     // needed to perform nonlinear acceleration
     if( solverType == static_cast< integer >( SolverType::SolidMechanics ) &&
-        this->getNonlinearSolverParameters().m_nonlinearAccelerationType== NonlinearSolverParameters::NonlinearAccelerationType::Aitken )
+        this->getNonlinearSolverParameters().m_nonlinearAccelerationType != NonlinearSolverParameters::NonlinearAccelerationType::None )
     {
       recordAverageMeanTotalStressIncrement( domain, m_s2_tilde );
     }
@@ -648,6 +797,13 @@ protected:
   real64 m_omega0; // Old Aitken relaxation factor
   real64 m_omega1; // New Aitken relaxation factor
 
+  /// Member variables needed for Nonlinear Acceleration ( Anderson ), on top of m_s1, m_s2 and m_s2_tilde
+  std::vector< array1d< real64 > > m_andersonResidualDiffs; // Differences of the residuals s_tilde - s of the last iterations
+  std::vector< array1d< real64 > > m_andersonOutputDiffs; // Differences of the unaccelerated outputs s_tilde of the last iterations
+  array1d< real64 > m_andersonPrevResidual; // Residual s_tilde - s @ previous iteration
+  array1d< real64 > m_andersonPrevOutput; // Unaccelerated averageMeanTotalStresIncrement @ previous iteration
+  array1d< integer > m_andersonIsOwned; // Whether the entries of averageMeanTotalStresIncrement belong to locally owned elements
+
 };
 
 } /* namespace geos */
@@ -0,0 +1,312 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WellEquationsElimination.cpp
+ */
+
+#include "WellEquationsElimination.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/PerforationFields.hpp"
+#include "mesh/WellElementSubRegion.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+#include <unordered_map>
+
+namespace geos
+{
+
+void WellEquationsElimination::selectWells( SolverBase const & solver,
+                                            DomainPartition & domain,
+                                            DofManager const & dofManager,
+                                            integer const resNumDof,
+                                            integer const wellNumDof,
+                                            string const & resElemDofName,
+                                            string const & wellElemDofName )
+{
+  GEOS_MARK_FUNCTION;
+
+  m_wells.clear();
+  m_rankOffset = dofManager.rankOffset();
+
+  string const wellDofKey = dofManager.getKey( wellElemDofName );
+  string const resDofKey = dofManager.getKey( resElemDofName );
+
+  // the equations of a well spread over several ranks cannot be eliminated locally:
+  // count the ranks holding each well, with a single reduction for all the wells
+  array1d< integer > localHasWell;
+  solver.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                       MeshLevel const & meshLevel,
+                                                                       arrayView1d< string const > const & regionNames )
+  {
+    meshLevel.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                               WellElementSubRegion const & subRegion )
+    {
+      localHasWell.emplace_back( subRegion.size() > 0 ? 1 : 0 );
+    } );
+  } );
+  array1d< integer > numRanksWithWell( localHasWell.size() );
+  MpiWrapper::allReduce( localHasWell.data(),
+                         numRanksWithWell.data(),
+                         LvArray::integerConversion< int >( localHasWell.size() ),
+                         MPI_SUM,
+                         MPI_COMM_GEOS );
+
+  localIndex wellIndex = 0;
+  solver.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                       MeshLevel const & meshLevel,
+                                                                       arrayView1d< string const > const & regionNames )
+  {
+    ElementRegionManager const & elemManager = meshLevel.getElemManager();
+
+    ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const & resElemDofNumber =
+      elemManager.constructArrayViewAccessor< globalIndex, 1 >( resDofKey );
+
+    ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const & resElemGhostRank =
+      elemManager.constructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString() );
+
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const, WellElementSubRegion const & subRegion )
+    {
+      if( numRanksWithWell[wellIndex++] != 1 || subRegion.size() == 0 )
+      {
+        return;
+      }
+
+      PerforationData const * const perforationData = subRegion.getPerforationData();
+
+      arrayView1d< integer const > const & wellElemGhostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex const > const & wellElemDofNumber =
+        subRegion.getReference< array1d< globalIndex > >( wellDofKey );
+
+      arrayView1d< localIndex const > const & resElementRegion =
+        perforationData->getField< fields::perforation::reservoirElementRegion >();
+      arrayView1d< localIndex const > const & resElementSubRegion =
+        perforationData->getField< fields::perforation::reservoirElementSubRegion >();
+      arrayView1d< localIndex const > const & resElementIndex =
+        perforationData->getField< fields::perforation::reservoirElementIndex >();
+
+      array1d< localIndex > wellRows;
+      for( localIndex iwelem = 0; iwelem < subRegion.size(); ++iwelem )
+      {
+        if( wellElemGhostRank[iwelem] >= 0 )
+        {
+          return;
+        }
+        localIndex const localRow = LvArray::integerConversion< localIndex >( wellElemDofNumber[iwelem] - m_rankOffset );
+        for( integer idof = 0; idof < wellNumDof; ++idof )
+        {
+          wellRows.emplace_back( localRow + idof );
+        }
+      }
+
+      array1d< localIndex > resRows;
+      for( localIndex iperf = 0; iperf < perforationData->size(); ++iperf )
+      {
+        localIndex const er = resElementRegion[iperf];
+        localIndex const esr = resElementSubRegion[iperf];
+        localIndex const ei = resElementIndex[iperf];
+        if( resElemGhostRank[er][esr][ei] >= 0 )
+        {
+          return;
+        }
+        localIndex const localRow = LvArray::integerConversion< localIndex >( resElemDofNumber[er][esr][ei] - m_rankOffset );
+        for( integer idof = 0; idof < resNumDof; ++idof )
+        {
+          resRows.emplace_back( localRow + idof );
+        }
+      }
+
+      addWell( wellRows.toViewConst(), resRows.toViewConst() );
+    } );
+  } );
+}
+
+void WellEquationsElimination::addWell( arrayView1d< localIndex const > const & wellRows,
+                                        arrayView1d< localIndex const > const & resRows )
+{
+  Well well;
+  for( localIndex const row : wellRows )
+  {
+    well.wellRows.emplace_back( row );
+  }
+
+  // several perforations may be located in the same reservoir element
+  std::vector< localIndex > sortedResRows( resRows.begin(), resRows.end() );
+  std::sort( sortedResRows.begin(), sortedResRows.end() );
+  sortedResRows.erase( std::unique( sortedResRows.begin(), sortedResRows.end() ), sortedResRows.end() );
+  for( localIndex const row : sortedResRows )
+  {
+    well.resRows.emplace_back( row );
+  }
+
+  m_wells.emplace_back( std::move( well ) );
+}
+
+void WellEquationsElimination::addNumNonzeros( arrayView1d< localIndex > const & rowLengths ) const
+{
+  for( Well const & well : m_wells )
+  {
+    for( localIndex const row : well.resRows )
+    {
+      rowLengths[row] += well.resRows.size();
+    }
+  }
+}
+
+void WellEquationsElimination::addSparsityPattern( SparsityPatternView< globalIndex > const & pattern ) const
+{
+  for( Well const & well : m_wells )
+  {
+    for( localIndex const row : well.resRows )
+    {
+      for( localIndex const col : well.resRows )
+      {
+        pattern.insertNonZero( row, col + m_rankOffset );
+      }
+    }
+  }
+}
+
+void WellEquationsElimination::eliminate( CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                          arrayView1d< real64 > const & localRhs )
+{
+  GEOS_MARK_FUNCTION;
+
+  for( Well & well : m_wells )
+  {
+    localIndex const numWellRows = well.wellRows.size();
+    localIndex const numResRows = well.resRows.size();
+
+    // position of the global columns in the dense blocks
+    std::unordered_map< globalIndex, localIndex > wellColIndex;
+    std::unordered_map< globalIndex, localIndex > resColIndex;
+    for( localIndex i = 0; i < numWellRows; ++i )
+    {
+      wellColIndex[well.wellRows[i] + m_rankOffset] = i;
+    }
+    array1d< globalIndex > resCols( numResRows );
+    for( localIndex k = 0; k < numResRows; ++k )
+    {
+      resCols[k] = well.resRows[k] + m_rankOffset;
+      resColIndex[resCols[k]] = k;
+    }
+
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > wellMatrix( numWellRows, numWellRows );
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > wellRhs( numWellRows, numResRows + 1 );
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > resToWell( numResRows, numWellRows );
+
+    // extract [ A_WW | A_WR | b_W ], and reduce the well rows to the identity
+    for( localIndex i = 0; i < numWellRows; ++i )
+    {
+      localIndex const row = well.wellRows[i];
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+      arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+      for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+      {
+        auto const wellCol = wellColIndex.find( columns[j] );
+        if( wellCol != wellColIndex.end() )
+        {
+          wellMatrix( i, wellCol->second ) = entries[j];
+        }
+        else
+        {
+          auto const resCol = resColIndex.find( columns[j] );
+          GEOS_ERROR_IF( resCol == resColIndex.end(),
+                         "Well equations coupled to an unperforated reservoir element cannot be eliminated" );
+          wellRhs( i, resCol->second ) = entries[j];
+        }
+        entries[j] = ( columns[j] == row + m_rankOffset ) ? 1.0 : 0.0;
+      }
+      wellRhs( i, numResRows ) = localRhs[row];
+    }
+
+    // extract A_RW, and decouple the reservoir rows from the well
+    for( localIndex k = 0; k < numResRows; ++k )
+    {
+      localIndex const row = well.resRows[k];
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+      arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+      for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+      {
+        auto const wellCol = wellColIndex.find( columns[j] );
+        if( wellCol != wellColIndex.end() )
+        {
+          resToWell( k, wellCol->second ) = entries[j];
+          entries[j] = 0.0;
+        }
+      }
+    }
+
+    // A_WW^-1 [ A_WR | b_W ]
+    well.factors.resize( numWellRows, numResRows + 1 );
+    BlasLapackLA::solveLinearSystem( wellMatrix.toSliceConst(), wellRhs.toSliceConst(), well.factors.toSlice() );
+
+    // Schur complement A_RR - A_RW A_WW^-1 A_WR and right-hand side b_R - A_RW A_WW^-1 b_W
+    array1d< real64 > values( numResRows );
+    for( localIndex k = 0; k < numResRows; ++k )
+    {
+      for( localIndex l = 0; l <= numResRows; ++l )
+      {
+        real64 value = 0.0;
+        for( localIndex i = 0; i < numWellRows; ++i )
+        {
+          value -= resToWell( k, i ) * well.factors( i, l );
+        }
+        if( l < numResRows )
+        {
+          values[l] = value;
+        }
+        else
+        {
+          localRhs[well.resRows[k]] += value;
+        }
+      }
+      localMatrix.addToRow< serialAtomic >( well.resRows[k], resCols.data(), values.data(), numResRows );
+    }
+
+    // the solution of the identity rows is A_WW^-1 b_W, scaled like the right-hand side by the linear solver
+    for( localIndex i = 0; i < numWellRows; ++i )
+    {
+      localRhs[well.wellRows[i]] = well.factors( i, numResRows );
+    }
+  }
+}
+
+void WellEquationsElimination::recover( arrayView1d< real64 > const & localSolution ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  // x_W = A_WW^-1 b_W - A_WW^-1 A_WR x_R, where the first term is the solution of the identity rows
+  for( Well const & well : m_wells )
+  {
+    localIndex const numResRows = well.resRows.size();
+    for( localIndex i = 0; i < well.wellRows.size(); ++i )
+    {
+      real64 value = 0.0;
+      for( localIndex l = 0; l < numResRows; ++l )
+      {
+        value += well.factors( i, l ) * localSolution[well.resRows[l]];
+      }
+      localSolution[well.wellRows[i]] -= value;
+    }
+  }
+}
+
+} /* namespace geos */
@@ -0,0 +1,144 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WellEquationsElimination.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_MULTIPHYSICS_WELLEQUATIONSELIMINATION_HPP_
+#define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_WELLEQUATIONSELIMINATION_HPP_
+
+#include "common/DataTypes.hpp"
+#include "denseLinearAlgebra/common/layouts.hpp"
+
+namespace geos
+{
+
+class DofManager;
+class DomainPartition;
+class SolverBase;
+
+/**
+ * @class WellEquationsElimination
+ * @brief Local elimination of the well equations from the coupled reservoir-well linear system.
+ *
+ * Writing the rows of a well W and of its perforated reservoir elements R as
+ *
+ *   | A_RR  A_RW | | x_R |   | b_R |
+ *   | A_WR  A_WW | | x_W | = | b_W |,
+ *
+ * the well unknowns are eliminated with a dense solve of the well block: the reservoir rows are
+ * replaced by the Schur complement A_RR - A_RW A_WW^-1 A_WR and the right-hand side by
+ * b_R - A_RW A_WW^-1 b_W, while the well rows are decoupled and reduced to the identity. Once the
+ * global system is solved, the well solution is recovered from x_W = A_WW^-1 ( b_W - A_WR x_R ).
+ *
+ * The global preconditioner therefore only sees reservoir couplings, the well rows being trivial.
+ * The Schur complement couples all the perforated elements of a well, and the corresponding
+ * nonzeros must be added to the sparsity pattern (see addNumNonzeros and addSparsityPattern).
+ *
+ * A well is only eliminated if it is entirely owned by one rank, as well as its perforated
+ * reservoir elements. The other wells are kept in the global system.
+ */
+class WellEquationsElimination
+{
+public:
+
+  /**
+   * @brief Select the wells to eliminate, and record the rows of their equations.
+   * @param solver the reservoir-well solver
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system (with final dof numbers)
+   * @param resNumDof number of reservoir element dofs
+   * @param wellNumDof number of well element dofs
+   * @param resElemDofName name of the reservoir element dofs
+   * @param wellElemDofName name of the well element dofs
+   *
+   * @note This function must be called by all ranks.
+   */
+  void selectWells( SolverBase const & solver,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    integer const resNumDof,
+                    integer const wellNumDof,
+                    string const & resElemDofName,
+                    string const & wellElemDofName );
+
+  /**
+   * @brief Record the rows of a well to eliminate.
+   * @param wellRows local rows of the well equations
+   * @param resRows local rows of the perforated reservoir elements, possibly repeated
+   *
+   * @note The well rows must only be coupled to each other and to the given reservoir rows.
+   */
+  void addWell( arrayView1d< localIndex const > const & wellRows,
+                arrayView1d< localIndex const > const & resRows );
+
+  /**
+   * @brief Increase the row lengths with the nonzeros of the Schur complements.
+   * @param rowLengths the row-by-row length
+   */
+  void addNumNonzeros( arrayView1d< localIndex > const & rowLengths ) const;
+
+  /**
+   * @brief Add the nonzeros of the Schur complements to the sparsity pattern.
+   * @param pattern the sparsity pattern
+   */
+  void addSparsityPattern( SparsityPatternView< globalIndex > const & pattern ) const;
+
+  /**
+   * @brief Eliminate the well equations from the local system.
+   * @param localMatrix the local matrix, on host
+   * @param localRhs the local right-hand side, on host
+   */
+  void eliminate( CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                  arrayView1d< real64 > const & localRhs );
+
+  /**
+   * @brief Recover the solution of the eliminated well equations.
+   * @param localSolution the local solution of the reduced system, on host
+   */
+  void recover( arrayView1d< real64 > const & localSolution ) const;
+
+  /**
+   * @brief @return the number of wells eliminated on this rank
+   */
+  localIndex numEliminatedWells() const
+  { return LvArray::integerConversion< localIndex >( m_wells.size() ); }
+
+private:
+
+  /// Rows and factors of an eliminated well
+  struct Well
+  {
+    /// Local rows of the well equations
+    array1d< localIndex > wellRows;
+
+    /// Local rows of the perforated reservoir elements, sorted
+    array1d< localIndex > resRows;
+
+    /// A_WW^-1 [ A_WR | b_W ], computed by eliminate and used by recover
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > factors;
+  };
+
+  /// The eliminated wells
+  std::vector< Well > m_wells;
+
+  /// The offset of the local rows in the global system
+  globalIndex m_rankOffset = 0;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_PHYSICSSOLVERS_MULTIPHYSICS_WELLEQUATIONSELIMINATION_HPP_ */
@@ -79,6 +79,14 @@ DECLARE_FIELD( incrementalDisplacement,
                WRITE_AND_READ,
                "Incremental displacements for the current time step on the nodes" );
 
+DECLARE_FIELD( matrixFreeDirection,
+               "matrixFreeDirection",
+               array2dLayoutIncrDisplacement,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Nodal vector the matrix-free stiffness operator is applied to" );
+
 DECLARE_FIELD( strain,
                "strain",
                array2dLayoutStrain,
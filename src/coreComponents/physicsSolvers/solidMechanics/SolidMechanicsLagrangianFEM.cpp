@@ -20,19 +20,29 @@
 #define GEOS_DISPATCH_VEM /// enables VEM in FiniteElementDispatch
 
 #include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 #include "kernels/ImplicitSmallStrainNewmark.hpp"
 #include "kernels/ImplicitSmallStrainQuasiStatic.hpp"
+#include "kernels/ImplicitSmallStrainQuasiStaticMatrixFree.hpp"
+#include "kernels/ImplicitSmallStrainQuasiStaticResidual.hpp"
 #include "kernels/ExplicitSmallStrain.hpp"
 #include "kernels/ExplicitFiniteStrain.hpp"
 #include "kernels/FixedStressThermoPoromechanics.hpp"
 
 #include "codingUtilities/Utilities.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/solid/ElasticIsotropic.hpp"
+#include "constitutive/solid/ElasticOrthotropic.hpp"
+#include "constitutive/solid/ElasticTransverseIsotropic.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
+#include "common/Timer.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/TractionBoundaryCondition.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 #include "LvArray/src/output.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/DomainPartition.hpp"
@@ -48,6 +58,24 @@ using namespace dataRepository;
 using namespace constitutive;
 using namespace fields;
 
+namespace
+{
+
+/**
+ * @brief Check whether the stiffness of a solid model is constant.
+ * @param solid the solid model
+ * @return true for the linear elastic models
+ */
+bool isLinearElasticModel( SolidBase const & solid )
+{
+  string const catalogName = solid.getCatalogName();
+  return catalogName == ElasticIsotropic::catalogName() ||
+         catalogName == ElasticOrthotropic::catalogName() ||
+         catalogName == ElasticTransverseIsotropic::catalogName();
+}
+
+}
+
 SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
                                                           Group * const parent ):
   SolverBase( name, parent ),
@@ -60,7 +88,8 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
   m_maxNumResolves( 10 ),
   m_strainTheory( 0 ),
   m_iComm( CommunicationTools::getInstance().getCommID() ),
-  m_isFixedStressPoromechanicsUpdate( false )
+  m_isFixedStressPoromechanicsUpdate( false ),
+  m_reuseLinearElasticStiffness( 0 )
 {
 
   registerWrapper( viewKeyStruct::newmarkGammaString(), &m_newmarkGamma ).
@@ -116,6 +145,13 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Name of contact relation to enforce constraints on fracture boundary." );
 
+  registerWrapper( viewKeyStruct::reuseLinearElasticStiffnessString(), &m_reuseLinearElasticStiffness ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to assemble the stiffness of the regions with a linear elastic model (ElasticIsotropic, "
+                    "ElasticOrthotropic, ElasticTransverseIsotropic) only once, and to reuse it in the following "
+                    "quasi-static assemblies until the mesh changes. Only the residual of these regions is recomputed." );
+
   registerWrapper( viewKeyStruct::contactPenaltyStiffnessString(), &m_contactPenaltyStiffness ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0.0 ).
@@ -136,6 +172,22 @@ void SolidMechanicsLagrangianFEM::postInputInitialization()
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
 
+  if( linParams.matrixFree )
+  {
+    // the matrix-free operator only assembles the diagonal of the jacobian
+    GEOS_THROW_IF( linParams.solverType == LinearSolverParameters::SolverType::direct ||
+                   linParams.solverType == LinearSolverParameters::SolverType::preconditioner,
+                   getDataContext() << ": the matrix-free operator requires an iterative linear solver",
+                   InputError );
+    GEOS_WARNING_IF( linParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                     linParams.preconditionerType != LinearSolverParameters::PreconditionerType::none,
+                     GEOS_FMT( "{}: the matrix-free operator only supports the jacobi and none preconditioners, "
+                               "{} = {} is replaced by jacobi",
+                               getDataContext(),
+                               LinearSolverParametersInput::viewKeyStruct::preconditionerTypeString(),
+                               EnumStrings< LinearSolverParameters::PreconditionerType >::toString( linParams.preconditionerType ) ) );
+  }
+
   m_surfaceGenerator = this->getParent().getGroupPointer< SolverBase >( m_surfaceGeneratorName );
 }
 
@@ -171,6 +223,12 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
     nodes.registerField< solidMechanics::incrementalDisplacement >( getName() ).
       reference().resizeDimension< 1 >( 3 );
 
+    if( getLinearSolverParameters().matrixFree )
+    {
+      nodes.registerField< solidMechanics::matrixFreeDirection >( getName() ).
+        reference().resizeDimension< 1 >( 3 );
+    }
+
     Group const & outputs = Group::getGroupByPath( GEOS_FMT( "/{}", ProblemManager::groupKeysStruct().outputManager.key() ) );
     if( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic || outputs.hasSubGroupOfType< ChomboIO >() )
     {
@@ -563,8 +621,6 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
       constitutiveRelation.saveConvergedState();
     } );
 
-    FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
-
     arrayView1d< real64 const > const & mass = nodes.getField< solidMechanics::mass >();
     solidMechanics::arrayView2dLayoutVelocity const & vel = nodes.getField< solidMechanics::velocity >();
     solidMechanics::arrayView2dLayoutTotalDisplacement const & u = nodes.getField< solidMechanics::totalDisplacement >();
@@ -576,17 +632,26 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
                               { solidMechanics::velocity::key(),
                                 solidMechanics::acceleration::key() } );
     m_iComm.resize( domain.getNeighbors().size() );
+    m_iComm.setAllowFusedPacking( true );
     CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldsToBeSync, mesh, domain.getNeighbors(), m_iComm, true );
 
+    FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+
     fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, solidMechanics::acceleration::key() );
 
     //3: v^{n+1/2} = v^{n} + a^{n} dt/2
-    solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, vel, dt / 2 );
-
-    fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, solidMechanics::velocity::key() );
-
     //4. x^{n+1} = x^{n} + v^{n+{1}/{2}} dt (x is displacement)
-    solidMechanicsLagrangianFEMKernels::displacementUpdate( vel, uhat, u, dt );
+    // both in a single pass over the nodes, the displacements being corrected on the nodes with a velocity constraint
+    solidMechanicsLagrangianFEMKernels::fusedPredictorUpdate( acc, vel, uhat, u, dt );
+
+    fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n,
+                                                               mesh,
+                                                               solidMechanics::velocity::key(),
+                                                               [&]( FieldSpecificationBase const & bc,
+                                                                    SortedArrayView< localIndex const > const & targetSet )
+    {
+      solidMechanicsLagrangianFEMKernels::constrainedDisplacementUpdate( vel, uhat, u, dt, bc.getComponent(), targetSet );
+    } );
 
     fsManager.applyFieldValue( time_n + dt,
                                mesh,
@@ -992,6 +1057,28 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
   GEOS_MARK_FUNCTION;
   SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
 
+  // The sparsity pattern changes, the saved stiffness entries are no longer valid
+  m_linearElasticStiffnessCached = false;
+
+  m_useMatrixFreeOperator = getLinearSolverParameters().matrixFree;
+  if( m_useMatrixFreeOperator )
+  {
+    validateMatrixFreeOperator( domain );
+
+    // Only the diagonal is assembled, for the Dirichlet conditions and the Jacobi preconditioner
+    localIndex const numLocalDofs = dofManager.numLocalDofs();
+    SparsityPattern< globalIndex > diagonalPattern( numLocalDofs, dofManager.numGlobalDofs(), 1 );
+    for( localIndex row = 0; row < numLocalDofs; ++row )
+    {
+      diagonalPattern.insertNonZero( row, dofManager.rankOffset() + row );
+    }
+    diagonalPattern.compress();
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( diagonalPattern ) );
+
+    m_matrixFreeConstrainedRows.resize( numLocalDofs );
+    return;
+  }
+
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
                                                   dofManager.numGlobalDofs(),
                                                   8*8*3*1.2 );
@@ -1051,10 +1138,33 @@ void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM
   localMatrix.zero();
   localRhs.zero();
 
+  bool const reuseLinearElasticStiffness = m_reuseLinearElasticStiffness && m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic;
+  real64 linearElasticMaxForce = 0.0;
+  if( reuseLinearElasticStiffness )
+  {
+    linearElasticMaxForce = assembleLinearElasticRegions( dt, domain, dofManager, localMatrix, localRhs );
+  }
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
-                                                                arrayView1d< string const > const & regionNames )
+                                                                arrayView1d< string const > const & targetRegionNames )
   {
+    // The linear elastic regions have already been assembled when their stiffness is reused
+    array1d< string > regionNames;
+    if( reuseLinearElasticStiffness )
+    {
+      array1d< string > linearElasticRegionNames;
+      splitLinearElasticRegions( mesh, targetRegionNames, linearElasticRegionNames, regionNames );
+    }
+    else
+    {
+      regionNames.resize( targetRegionNames.size() );
+      for( localIndex i = 0; i < targetRegionNames.size(); ++i )
+      {
+        regionNames[i] = targetRegionNames[i];
+      }
+    }
+
     if( m_isFixedStressPoromechanicsUpdate )
     {
       set< string > poromechanicsRegions;
@@ -1111,7 +1221,18 @@ void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM
     }
     else
     {
-      if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
+      if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic && m_useMatrixFreeOperator )
+      {
+        m_maxForce = assemblyLaunch< constitutive::SolidBase,
+                                     solidMechanicsLagrangianFEMKernels::QuasiStaticDiagonalFactory >( mesh,
+                                                                                                       dofManager,
+                                                                                                       regionNames,
+                                                                                                       viewKeyStruct::solidMaterialNamesString(),
+                                                                                                       localMatrix,
+                                                                                                       localRhs,
+                                                                                                       dt );
+      }
+      else if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
       {
         m_maxForce = assemblyLaunch< constitutive::SolidBase,
                                      solidMechanicsLagrangianFEMKernels::QuasiStaticFactory >( mesh,
@@ -1140,10 +1261,142 @@ void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM
     }
   } );
 
+  m_maxForce = LvArray::math::max( m_maxForce, linearElasticMaxForce );
+
   applyContactConstraint( dofManager, domain, localMatrix, localRhs );
 
 }
 
+void SolidMechanicsLagrangianFEM::splitLinearElasticRegions( MeshLevel const & mesh,
+                                                             arrayView1d< string const > const & regionNames,
+                                                             array1d< string > & linearElasticRegionNames,
+                                                             array1d< string > & otherRegionNames ) const
+{
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+  for( string const & regionName : regionNames )
+  {
+    bool isLinearElastic = true;
+    elemManager.getRegion( regionName ).forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+    {
+      // Regions coupled with flow in the fixed-stress split are assembled with their own kernel
+      if( m_isFixedStressPoromechanicsUpdate && subRegion.hasWrapper( FlowSolverBase::viewKeyStruct::solidNamesString() ) )
+      {
+        isLinearElastic = false;
+        return;
+      }
+      string const & solidName = subRegion.getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+      isLinearElastic = isLinearElastic && isLinearElasticModel( getConstitutiveModel< SolidBase >( subRegion, solidName ) );
+    } );
+
+    if( isLinearElastic )
+    {
+      linearElasticRegionNames.emplace_back( regionName );
+    }
+    else
+    {
+      otherRegionNames.emplace_back( regionName );
+    }
+  }
+}
+
+real64 SolidMechanicsLagrangianFEM::assembleLinearElasticRegions( real64 const dt,
+                                                                  DomainPartition & domain,
+                                                                  DofManager const & dofManager,
+                                                                  CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                                  arrayView1d< real64 > const & localRhs )
+{
+  GEOS_MARK_FUNCTION;
+
+  // The matrix is zero at this point: the stiffness of the linear elastic regions is either assembled
+  // and saved, or restored from the saved entries, in which case only the residual is assembled.
+  // The saved entries are discarded if the mesh or the matrix (e.g. assembled by a coupled solver) changed.
+  arrayView1d< localIndex const > const offsets = localMatrix.getOffsets();
+  localIndex const numRows = localMatrix.numRows();
+  Timestamp const meshModificationTimestamp = getMeshModificationTimestamp( domain );
+  bool const isCached = m_linearElasticStiffnessCached &&
+                        m_linearElasticStiffnessTimestamp == meshModificationTimestamp &&
+                        m_linearElasticStiffnessNumRows == numRows &&
+                        m_linearElasticStiffness.size() == offsets[numRows];
+  if( isCached )
+  {
+    arrayView1d< real64 const > const cachedEntries = m_linearElasticStiffness.toViewConst();
+    forAll< parallelDevicePolicy<> >( numRows, [=] GEOS_HOST_DEVICE ( localIndex const row )
+    {
+      arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+      for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+      {
+        entries[j] = cachedEntries[offsets[row] + j];
+      }
+    } );
+  }
+
+  real64 maxForce = 0.0;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & regionNames )
+  {
+    array1d< string > linearElasticRegionNames;
+    array1d< string > otherRegionNames;
+    splitLinearElasticRegions( mesh, regionNames, linearElasticRegionNames, otherRegionNames );
+
+    real64 meshMaxForce = 0.0;
+    if( isCached )
+    {
+      meshMaxForce = assemblyLaunch< constitutive::SolidBase,
+                                     solidMechanicsLagrangianFEMKernels::QuasiStaticResidualFactory >( mesh,
+                                                                                                       dofManager,
+                                                                                                       linearElasticRegionNames,
+                                                                                                       viewKeyStruct::solidMaterialNamesString(),
+                                                                                                       localMatrix,
+                                                                                                       localRhs,
+                                                                                                       dt );
+    }
+    else if( m_useMatrixFreeOperator )
+    {
+      meshMaxForce = assemblyLaunch< constitutive::SolidBase,
+                                     solidMechanicsLagrangianFEMKernels::QuasiStaticDiagonalFactory >( mesh,
+                                                                                                       dofManager,
+                                                                                                       linearElasticRegionNames,
+                                                                                                       viewKeyStruct::solidMaterialNamesString(),
+                                                                                                       localMatrix,
+                                                                                                       localRhs,
+                                                                                                       dt );
+    }
+    else
+    {
+      meshMaxForce = assemblyLaunch< constitutive::SolidBase,
+                                     solidMechanicsLagrangianFEMKernels::QuasiStaticFactory >( mesh,
+                                                                                               dofManager,
+                                                                                               linearElasticRegionNames,
+                                                                                               viewKeyStruct::solidMaterialNamesString(),
+                                                                                               localMatrix,
+                                                                                               localRhs,
+                                                                                               dt );
+    }
+    maxForce = LvArray::math::max( maxForce, meshMaxForce );
+  } );
+
+  if( !isCached )
+  {
+    m_linearElasticStiffness.resize( offsets[numRows] );
+    arrayView1d< real64 > const cachedEntries = m_linearElasticStiffness.toView();
+    CRSMatrixView< real64 const, globalIndex const > const matrix = localMatrix.toViewConst();
+    forAll< parallelDevicePolicy<> >( numRows, [=] GEOS_HOST_DEVICE ( localIndex const row )
+    {
+      arraySlice1d< real64 const > const entries = matrix.getEntries( row );
+      for( localIndex j = 0; j < matrix.numNonZeros( row ); ++j )
+      {
+        cachedEntries[offsets[row] + j] = entries[j];
+      }
+    } );
+    m_linearElasticStiffnessCached = true;
+    m_linearElasticStiffnessTimestamp = meshModificationTimestamp;
+    m_linearElasticStiffnessNumRows = numRows;
+  }
+
+  return maxForce;
+}
+
 void
 SolidMechanicsLagrangianFEM::
   applyBoundaryConditions( real64 const time_n,
@@ -1196,6 +1449,141 @@ SolidMechanicsLagrangianFEM::
   }
 
   applyDisplacementBCImplicit( time_n + dt, dofManager, domain, localMatrix, localRhs );
+
+  if( m_useMatrixFreeOperator )
+  {
+    markDisplacementBCRows( time_n + dt, dofManager, domain );
+  }
+}
+
+void SolidMechanicsLagrangianFEM::markDisplacementBCRows( real64 const time,
+                                                          DofManager const & dofManager,
+                                                          DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< integer > const constrainedRows = m_matrixFreeConstrainedRows.toView();
+  constrainedRows.zero();
+
+  string const dofKey = dofManager.getKey( solidMechanics::totalDisplacement::key() );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  localIndex const numLocalRows = constrainedRows.size();
+
+  FieldSpecificationManager const & fsManager = FieldSpecificationManager::getInstance();
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    arrayView1d< globalIndex const > const dofNumber = mesh.getNodeManager().getReference< globalIndex_array >( dofKey );
+
+    fsManager.apply< NodeManager >( time,
+                                    mesh,
+                                    solidMechanics::totalDisplacement::key(),
+                                    [&]( FieldSpecificationBase const & bc,
+                                         string const &,
+                                         SortedArrayView< localIndex const > const & targetSet,
+                                         NodeManager &,
+                                         string const & )
+    {
+      integer const component = bc.getComponent();
+      forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+      {
+        globalIndex const row = dofNumber[targetSet[i]] + component - rankOffset;
+        if( row >= 0 && row < numLocalRows )
+        {
+          constrainedRows[row] = 1;
+        }
+      } );
+    } );
+  } );
+}
+
+void SolidMechanicsLagrangianFEM::validateMatrixFreeOperator( DomainPartition & domain ) const
+{
+  GEOS_THROW_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic ||
+                 m_contactRelationName != viewKeyStruct::noContactRelationNameString() ||
+                 m_isFixedStressPoromechanicsUpdate,
+                 getDataContext() << ": the matrix-free operator is only supported for quasi-static problems without contact",
+                 InputError );
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel const & mesh,
+                                                                arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion const & subRegion )
+    {
+      string const & solidName = subRegion.getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+      SolidBase const & solid = getConstitutiveModel< SolidBase >( subRegion, solidName );
+      GEOS_THROW_IF( !isLinearElasticModel( solid ),
+                     getDataContext() << ": the matrix-free operator requires a linear elastic model, but " <<
+                     solid.getDataContext() << " is a " << solid.getCatalogName(),
+                     InputError );
+    } );
+  } );
+}
+
+void SolidMechanicsLagrangianFEM::solveLinearSystem( DofManager const & dofManager,
+                                                     ParallelMatrix & matrix,
+                                                     ParallelVector & rhs,
+                                                     ParallelVector & solution )
+{
+  if( !m_useMatrixFreeOperator )
+  {
+    SolverBase::solveLinearSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  LinearSolverParameters const & params = getLinearSolverParameters();
+  matrix.setDofManager( &dofManager );
+
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+  SolidMechanicsMatrixFreeOperator const op( *this,
+                                             domain,
+                                             dofManager,
+                                             m_localMatrix.toViewConstSizes(),
+                                             m_matrixFreeConstrainedRows.toViewConst() );
+
+  // The matrix only holds the diagonal of the jacobian, so only Jacobi preconditioning is available
+  // (any other preconditioner type is replaced by jacobi, see postInputInitialization)
+  std::unique_ptr< PreconditionerBase< LAInterface > > precond;
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::none )
+  {
+    precond = std::make_unique< PreconditionerIdentity< LAInterface > >();
+  }
+  else
+  {
+    precond = std::make_unique< PreconditionerJacobi< LAInterface > >();
+  }
+  {
+    Timer timer_setup( m_timers["linear solver setup"] );
+    precond->setup( matrix );
+  }
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, op, *precond );
+  {
+    Timer timer_setup( m_timers["linear solver solve"] );
+    solver->solve( rhs, solution );
+  }
+  m_linearSolverResult = solver->result();
+
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        Last LinSolve(iter,res) = ( {:3}, {:4.2e} )",
+                                      m_linearSolverResult.numIterations,
+                                      m_linearSolverResult.residualReduction ) );
+
+  if( params.stopIfError )
+  {
+    GEOS_ERROR_IF( m_linearSolverResult.breakdown(), getDataContext() << ": Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOS_WARNING_IF( !m_linearSolverResult.success(), getDataContext() << ": Linear solution failed" );
+  }
 }
 
 real64
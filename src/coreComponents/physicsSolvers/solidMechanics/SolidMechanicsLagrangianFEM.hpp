@@ -155,6 +155,12 @@ public:
                                         CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                         arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  solveLinearSystem( DofManager const & dofManager,
+                     ParallelMatrix & matrix,
+                     ParallelVector & rhs,
+                     ParallelVector & solution ) override;
+
   virtual real64
   calculateResidualNorm( real64 const & time_n,
                          real64 const & dt,
@@ -254,6 +260,8 @@ public:
 
     static constexpr char const * contactPenaltyStiffnessString() { return "contactPenaltyStiffness"; }
 
+    static constexpr char const * reuseLinearElasticStiffnessString() { return "reuseLinearElasticStiffness"; }
+
   };
 
   SortedArray< localIndex > & getElemsAttachedToSendOrReceiveNodes( ElementSubRegionBase & subRegion )
@@ -300,10 +308,74 @@ protected:
   /// Rigid body modes
   array1d< ParallelVector > m_rigidBodyModes;
 
+  /// Flag to assemble the stiffness of the linear elastic regions once and reuse it
+  integer m_reuseLinearElasticStiffness;
+
+  /// Flag telling whether m_linearElasticStiffness holds the stiffness of the current sparsity pattern
+  bool m_linearElasticStiffnessCached = false;
+
+  /// Mesh modification timestamp at which the linear elastic stiffness was saved
+  Timestamp m_linearElasticStiffnessTimestamp = 0;
+
+  /// Number of local rows of the matrix the linear elastic stiffness was saved from
+  localIndex m_linearElasticStiffnessNumRows = -1;
+
+  /// Saved matrix entries of the linear elastic regions, in the storage order of the local matrix
+  array1d< real64 > m_linearElasticStiffness;
+
+  /// Flag to apply the quasi-static jacobian matrix-free (only its diagonal is assembled)
+  bool m_useMatrixFreeOperator = false;
+
+  /// Flag of the local rows constrained by a displacement condition, used by the matrix-free operator
+  array1d< integer > m_matrixFreeConstrainedRows;
+
   real64 m_contactPenaltyStiffness;
 
 private:
 
+  /**
+   * @brief Flag the local rows constrained by a displacement condition, for the matrix-free operator.
+   * @param time the time at which the conditions are applied
+   * @param dofManager the degree of freedom manager
+   * @param domain the domain partition
+   */
+  void markDisplacementBCRows( real64 const time,
+                               DofManager const & dofManager,
+                               DomainPartition & domain );
+
+  /**
+   * @brief Split target regions between the regions with a linear elastic model and the others.
+   * @param mesh the mesh level
+   * @param regionNames the target regions
+   * @param linearElasticRegionNames the regions whose stiffness can be reused
+   * @param otherRegionNames the other regions
+   */
+  void splitLinearElasticRegions( MeshLevel const & mesh,
+                                  arrayView1d< string const > const & regionNames,
+                                  array1d< string > & linearElasticRegionNames,
+                                  array1d< string > & otherRegionNames ) const;
+
+  /**
+   * @brief Assemble the linear elastic regions, reusing their stiffness if it was saved by a previous assembly.
+   * @param dt the time step
+   * @param domain the domain partition
+   * @param dofManager the degree of freedom manager
+   * @param localMatrix the (zeroed) local matrix
+   * @param localRhs the local right-hand side
+   * @return the maximum force of the regions
+   */
+  real64 assembleLinearElasticRegions( real64 const dt,
+                                       DomainPartition & domain,
+                                       DofManager const & dofManager,
+                                       CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                       arrayView1d< real64 > const & localRhs );
+
+  /**
+   * @brief Check that the problem can be solved with the matrix-free operator, throw an InputError otherwise.
+   * @param domain the domain partition
+   */
+  void validateMatrixFreeOperator( DomainPartition & domain ) const;
+
   string m_contactRelationName;
 
   SolverBase * m_surfaceGenerator;
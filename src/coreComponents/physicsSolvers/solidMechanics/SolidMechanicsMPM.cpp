@@ -1069,6 +1069,12 @@ real64 SolidMechanicsMPM::explicitStep( real64 const & time_n,
   populateMappingArrays( particleManager, nodeManager );
 
 
+  //#######################################################################################
+  solverProfiling( "Sort particles by grid block for the particle-to-grid transfers" );
+  //#######################################################################################
+  buildTransferSchedules( particleManager, nodeManager );
+
+
   //#######################################################################################
   solverProfilingIf( "Project damage field gradient to the grid and then sync", m_damageFieldPartitioning == 1 );
   //#######################################################################################
@@ -1532,7 +1538,7 @@ void SolidMechanicsMPM::computeGridSurfaceNormals( ParticleManager & particleMan
     int const numDims = m_numDims;
     int const damageFieldPartitioning = m_damageFieldPartitioning;
     int const numContactGroups = m_numContactGroups;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Can parallelize with atomics
+    m_transferSchedules[subRegionIndex].forAllParticles< parallelHostPolicy >( [=] GEOS_HOST ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
 
@@ -1562,7 +1568,7 @@ void SolidMechanicsMPM::normalizeGridSurfaceNormals( arrayView2d< real64 const >
   int const numVelocityFields = m_numVelocityFields;
   real64 const smallMass = m_smallMass;
   int const planeStrain = m_planeStrain;
-  forAll< serialPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
+  forAll< parallelHostPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
   {
     for( localIndex fieldIndex = 0; fieldIndex < numVelocityFields; fieldIndex++ )
     {
@@ -1604,7 +1610,7 @@ void SolidMechanicsMPM::computeContactForces( real64 const dt,
   // Get number of nodes
   int numNodes = gridMass.size( 0 );
 
-  forAll< serialPolicy >( numNodes, [&, gridMass, gridVelocity, gridMomentum, gridSurfaceNormal, gridMaterialPosition, gridContactForce] GEOS_HOST ( localIndex const g )
+  forAll< parallelHostPolicy >( numNodes, [&, gridMass, gridVelocity, gridMomentum, gridSurfaceNormal, gridMaterialPosition, gridContactForce] GEOS_HOST ( localIndex const g )
     {
       // Initialize gridContactForce[g] to zero. TODO: This shouldn't be necessary?
       for( int fieldIndex = 0; fieldIndex < m_numVelocityFields; fieldIndex++ )
@@ -1984,145 +1990,104 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
   real64 tStart = MPI_Wtime();
 
   // Expand bin limits by neighbor radius to account for the buffer zone of ghost particles outside the patch limits
-  real64 neighborRadiusSquared = m_neighborRadius * m_neighborRadius;
-  real64 xmin = m_xLocalMinNoGhost[0] - m_neighborRadius,
-         xmax = m_xLocalMaxNoGhost[0] + m_neighborRadius,
-         ymin = m_xLocalMinNoGhost[1] - m_neighborRadius,
-         ymax = m_xLocalMaxNoGhost[1] + m_neighborRadius,
-         zmin = m_xLocalMinNoGhost[2] - m_neighborRadius,
-         zmax = m_xLocalMaxNoGhost[2] + m_neighborRadius;
+  real64 const neighborRadius = m_neighborRadius;
+  real64 const neighborRadiusSquared = neighborRadius * neighborRadius;
+  real64 const xmin = m_xLocalMinNoGhost[0] - neighborRadius,
+               xmax = m_xLocalMaxNoGhost[0] + neighborRadius,
+               ymin = m_xLocalMinNoGhost[1] - neighborRadius,
+               ymax = m_xLocalMaxNoGhost[1] + neighborRadius,
+               zmin = m_xLocalMinNoGhost[2] - neighborRadius,
+               zmax = m_xLocalMaxNoGhost[2] + neighborRadius;
 
   // Initialize bin sort
-  real64 binWidth = m_binSizeMultiplier * m_neighborRadius;
-  int nxbins = std::ceil( ( xmax - xmin ) / binWidth ),
-      nybins = std::ceil( ( ymax - ymin ) / binWidth ),
-      nzbins = m_planeStrain ? 1 : std::ceil( ( zmax - zmin ) / binWidth );
-  int nbins = nxbins * nybins * nzbins;
-  real64 dx = ( xmax - xmin ) / nxbins,
-         dy = ( ymax - ymin ) / nybins,
-         dz = ( zmax - zmin ) / nzbins;
-
-  // Declare bin key and bins data structure
-  BinKey binKey;
-  std::unordered_map< BinKey, std::vector< localIndex >, BinKeyHash > bins;
-
-  // Reverse entries in bins based on even distribution of particles in partition - OPTIONAL
-  particleManager.forParticleRegions< ParticleRegion >( [&]( ParticleRegion & region ) // idk why this requires a template argument and the
-                                                                                       // subregion loops don't
-  {
-    binKey.regionIndex = region.getIndexInParent();
-    region.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
-    {
-      binKey.subRegionIndex = subRegion.getIndexInParent();
-      int numReserved = std::ceil( subRegion.size() / nbins );
-
-      // Loop over bins
-      for( int i=0; i<nxbins; i++ )
-      {
-        for( int j=0; j<nybins; j++ )
-        {
-          for( int k=0; k<nzbins; k++ )
-          {
-            binKey.binIndex = i + j * nxbins + k * nxbins * nybins;
-            bins[binKey].reserve( numReserved );
-          }
-        }
-      }
-    } );
+  real64 const binWidth = m_binSizeMultiplier * neighborRadius;
+  int const nxbins = std::ceil( ( xmax - xmin ) / binWidth ),
+            nybins = std::ceil( ( ymax - ymin ) / binWidth ),
+            nzbins = m_planeStrain ? 1 : std::ceil( ( zmax - zmin ) / binWidth );
+  localIndex const nbins = LvArray::integerConversion< localIndex >( nxbins ) * nybins * nzbins;
+  real64 const dx = ( xmax - xmin ) / nxbins,
+               dy = ( ymax - ymin ) / nybins,
+               dz = ( zmax - zmin ) / nzbins;
+
+  // Bin ijk indices of a position, clamped to the binned box
+  auto const getBinIJK = [=]( real64 const x, real64 const y, real64 const z, int (& ijk)[3] )
+  {
+    ijk[0] = LvArray::math::min( LvArray::math::max( static_cast< int >( std::floor( ( x - xmin ) / dx ) ), 0 ), nxbins - 1 );
+    ijk[1] = LvArray::math::min( LvArray::math::max( static_cast< int >( std::floor( ( y - ymin ) / dy ) ), 0 ), nybins - 1 );
+    ijk[2] = LvArray::math::min( LvArray::math::max( static_cast< int >( std::floor( ( z - zmin ) / dz ) ), 0 ), nzbins - 1 );
+  };
+
+  // Gather the subregions, in the order of the neighbor lists
+  std::vector< ParticleSubRegion * > subRegions;
+  std::vector< localIndex > regionIndices;
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+  {
+    subRegions.emplace_back( &subRegion );
+    regionIndices.emplace_back( dynamicCast< ParticleRegion & >( subRegion.getParent().getParent() ).getIndexInParent() );
   } );
+  localIndex const numSubRegions = LvArray::integerConversion< localIndex >( subRegions.size() );
+
+  // Cell list: bin ( s * nbins + binIndex ) holds the (local and ghost) particles of the s-th subregion in bin binIndex
+  std::vector< array1d< localIndex > > particleBins( numSubRegions );
+  array1d< localIndex > binCounts( numSubRegions * nbins );
+  arrayView1d< localIndex > const binCountsView = binCounts.toView();
+  for( localIndex s = 0; s < numSubRegions; ++s )
+  {
+    arrayView2d< real64 const > const particlePosition = subRegions[s]->getParticleCenter();
+    particleBins[s].resize( subRegions[s]->size() );
+    arrayView1d< localIndex > const particleBin = particleBins[s].toView();
+    forAll< parallelHostPolicy >( subRegions[s]->size(), [=] GEOS_HOST ( localIndex const p )
+    {
+      int ijk[3];
+      getBinIJK( particlePosition[p][0], particlePosition[p][1], particlePosition[p][2], ijk );
+      particleBin[p] = s * nbins + ijk[0] + ijk[1] * nxbins + ijk[2] * nxbins * nybins;
+      RAJA::atomicInc< parallelHostAtomic >( &binCountsView[particleBin[p]] );
+    } );
+  }
 
-  // Populate bins with local particle indices
-  particleManager.forParticleRegions< ParticleRegion >( [&]( ParticleRegion & region ) // idk why this requires a template argument and the
-                                                                                       // subregion loops don't
+  ArrayOfArrays< localIndex > bins;
+  bins.resizeFromCapacities< parallelHostPolicy >( numSubRegions * nbins, binCounts.data() );
+  ArrayOfArraysView< localIndex > const binsView = bins.toView();
+  for( localIndex s = 0; s < numSubRegions; ++s )
   {
-    binKey.regionIndex = region.getIndexInParent();
-    region.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+    arrayView1d< localIndex const > const particleBin = particleBins[s].toViewConst();
+    forAll< parallelHostPolicy >( subRegions[s]->size(), [=] GEOS_HOST ( localIndex const p )
     {
-      binKey.subRegionIndex = subRegion.getIndexInParent();
-      arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
-      forAll< serialPolicy >( subRegion.size(), [&, particlePosition] GEOS_HOST ( localIndex const p ) // host only because of bin data
-                                                                                                       // structure, need atomics in
-                                                                                                       // parallel since multiple particles
-                                                                                                       // can write to the same bin
-        {
-          // Particle bin ijk indices
-          int i, j, k;
-          i = std::floor( ( particlePosition[p][0] - xmin ) / dx ),
-          j = std::floor( ( particlePosition[p][1] - ymin ) / dy ),
-          k = std::floor( ( particlePosition[p][2] - zmin ) / dz );
-
-          // Bin number
-          binKey.binIndex = i + j * nxbins + k * nxbins * nybins;
-
-          // Add particle to bin
-          bins[binKey].push_back( p );
-        } );
+      binsView.emplaceBackAtomic< parallelHostAtomic >( particleBin[p], p );
     } );
+  }
+
+  // Sort the bins, so that the neighbors are always listed in the same order
+  forAll< parallelHostPolicy >( numSubRegions * nbins, [=] GEOS_HOST ( localIndex const bin )
+  {
+    std::sort( binsView[bin].begin(), binsView[bin].end() );
   } );
 
   // Perform neighbor search over appropriate bins
-  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegionA )
+  ArrayOfArraysView< localIndex const > const binsConstView = bins.toViewConst();
+  for( localIndex sA = 0; sA < numSubRegions; ++sA )
   {
-    // Get and initialize neighbor list
-    OrderedVariableToManyParticleRelation & neighborList = subRegionA.neighborList();
-    neighborList.resize( 0, 0 ); // Clear the existing neighbor list
-    neighborList.resize( subRegionA.size() );
-    int numToReserve = m_planeStrain == 1 ? 25 : 179; // Assuming square/cubic cells, 2 particles per cell in each dimension, and a neighbor
-                                                      // radius equal to the cell diagonal length
-    reserveNeighbors( neighborList, numToReserve );
-
-    // Get 'this' particle's location
-    arrayView2d< real64 > const xA = subRegionA.getParticleCenter();
-
-    // Find neighbors of 'this' particle
+    ParticleSubRegion & subRegionA = *subRegions[sA];
+    arrayView2d< real64 const > const xA = subRegionA.getParticleCenter();
     SortedArrayView< localIndex const > const subRegionAActiveParticleIndices = subRegionA.activeParticleIndices();
-    forAll< serialPolicy >( subRegionAActiveParticleIndices.size(), [&, subRegionAActiveParticleIndices, xA] GEOS_HOST ( localIndex const pp )
-      {// host only because of bin data structure and invocation of particleManager; not thread-safe for some reason
-        // Particle A index
-        localIndex a = subRegionAActiveParticleIndices[pp];
-
-        // Bin ijk indices bounding a sphere of radius m_neighborRadius centered at 'this' particle
-        int imin, imax, jmin, jmax, kmin, kmax;
-        imin = std::floor( ( xA[a][0] - m_neighborRadius - xmin ) / dx ),
-        jmin = std::floor( ( xA[a][1] - m_neighborRadius - ymin ) / dy ),
-        kmin = std::floor( ( xA[a][2] - m_neighborRadius - zmin ) / dz );
-        imax = std::floor( ( xA[a][0] + m_neighborRadius - xmin ) / dx ),
-        jmax = std::floor( ( xA[a][1] + m_neighborRadius - ymin ) / dy ),
-        kmax = std::floor( ( xA[a][2] + m_neighborRadius - zmin ) / dz );
-
-        // Adjust bin ijk indices if necessary
-        imin = std::max( imin, 0 );
-        imax = std::min( imax, nxbins-1 );
-        jmin = std::max( jmin, 0 );
-        jmax = std::min( jmax, nybins-1 );
-        kmin = std::max( kmin, 0 );
-        kmax = std::min( kmax, nzbins-1 );
-
-        // Inner subregion loop
-        particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegionB )
-      {
-        // Get region and subregion indices
-        ParticleRegion & region = dynamicCast< ParticleRegion & >( subRegionB.getParent().getParent() );
-        binKey.regionIndex = region.getIndexInParent();
-        binKey.subRegionIndex = subRegionB.getIndexInParent();
-
-        // Get 'other' particle location
-        arrayView2d< real64 > const xB = subRegionB.getParticleCenter();
 
-        // Declare temporary array of local neighbor indices
-        std::vector< localIndex > localIndices;
-        localIndices.reserve( numToReserve );
-
-        // Loop over bins
-        int count = 0; // Count the number of neighbors on this subregion
-        for( int iBin=imin; iBin<=imax; iBin++ )
+    // Calls func( sB, b ) for each particle b of the sB-th subregion which is a neighbor of particle a
+    auto const forNeighbors = [&]( localIndex const a, auto && func )
+    {
+      int ijkMin[3], ijkMax[3];
+      getBinIJK( xA[a][0] - neighborRadius, xA[a][1] - neighborRadius, xA[a][2] - neighborRadius, ijkMin );
+      getBinIJK( xA[a][0] + neighborRadius, xA[a][1] + neighborRadius, xA[a][2] + neighborRadius, ijkMax );
+      for( localIndex sB = 0; sB < numSubRegions; ++sB )
+      {
+        arrayView2d< real64 const > const xB = subRegions[sB]->getParticleCenter();
+        for( int iBin = ijkMin[0]; iBin <= ijkMax[0]; iBin++ )
         {
-          for( int jBin=jmin; jBin<=jmax; jBin++ )
+          for( int jBin = ijkMin[1]; jBin <= ijkMax[1]; jBin++ )
           {
-            for( int kBin=kmin; kBin<=kmax; kBin++ )
+            for( int kBin = ijkMin[2]; kBin <= ijkMax[2]; kBin++ )
             {
-              binKey.binIndex = iBin + jBin * nxbins + kBin * nxbins * nybins;
-              for( localIndex & b: bins[binKey] )
+              localIndex const bin = sB * nbins + iBin + jBin * nxbins + kBin * nxbins * nybins;
+              for( localIndex const b : binsConstView[bin] )
               {
                 real64 xBA[3];
                 xBA[0] = xB[b][0] - xA[a][0];
@@ -2131,27 +2096,50 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
                 real64 rSquared = xBA[0] * xBA[0] + xBA[1] * xBA[1] + xBA[2] * xBA[2];
                 if( rSquared <= neighborRadiusSquared ) // Would you be my neighbor?
                 {
-                  count++;
-                  localIndices.push_back( b );
+                  func( sB, b );
                 }
               }
             }
           }
         }
+      }
+    };
 
-        // Populate the temporary arrays of neighbor region and subregion indices
-        std::vector< localIndex > regionIndices( count, binKey.regionIndex );
-        std::vector< localIndex > subRegionIndices( count, binKey.subRegionIndex );
+    // First pass: count the neighbors of each particle
+    array1d< localIndex > neighborCounts( subRegionA.size() );
+    arrayView1d< localIndex > const neighborCountsView = neighborCounts.toView();
+    forAll< parallelHostPolicy >( subRegionAActiveParticleIndices.size(), [&] GEOS_HOST ( localIndex const pp )
+    {
+      localIndex const a = subRegionAActiveParticleIndices[pp];
+      localIndex count = 0;
+      forNeighbors( a, [&]( localIndex const, localIndex const ) { ++count; } );
+      neighborCountsView[a] = count;
+    } );
 
-        // Insert indices into neighbor list
-        insertMany( neighborList,
-                    a,
-                    regionIndices,
-                    subRegionIndices,
-                    localIndices );
-      } );
+    // Allocate the neighbor list to the exact size
+    OrderedVariableToManyParticleRelation & neighborList = subRegionA.neighborList();
+    neighborList.resize( 0, 0 ); // Clear the existing neighbor list
+    neighborList.m_toParticleRegion.resizeFromCapacities< parallelHostPolicy >( subRegionA.size(), neighborCounts.data() );
+    neighborList.m_toParticleSubRegion.resizeFromCapacities< parallelHostPolicy >( subRegionA.size(), neighborCounts.data() );
+    neighborList.m_toParticleIndex.resizeFromCapacities< parallelHostPolicy >( subRegionA.size(), neighborCounts.data() );
+    neighborList.m_numParticles.resize( subRegionA.size() );
+    neighborList.m_numParticles.setValues< serialPolicy >( neighborCounts.toViewConst() );
+
+    // Second pass: fill the neighbor list
+    ArrayOfArraysView< localIndex > const toParticleRegion = neighborList.m_toParticleRegion.toView();
+    ArrayOfArraysView< localIndex > const toParticleSubRegion = neighborList.m_toParticleSubRegion.toView();
+    ArrayOfArraysView< localIndex > const toParticleIndex = neighborList.m_toParticleIndex.toView();
+    forAll< parallelHostPolicy >( subRegionAActiveParticleIndices.size(), [&] GEOS_HOST ( localIndex const pp )
+    {
+      localIndex const a = subRegionAActiveParticleIndices[pp];
+      forNeighbors( a, [&]( localIndex const sB, localIndex const b )
+      {
+        toParticleRegion.emplaceBack( a, regionIndices[sB] );
+        toParticleSubRegion.emplaceBack( a, subRegions[sB]->getIndexInParent() );
+        toParticleIndex.emplaceBack( a, b );
       } );
-  } );
+    } );
+  }
 
   return( MPI_Wtime() - tStart );
 }
@@ -2546,7 +2534,7 @@ void SolidMechanicsMPM::projectDamageFieldGradientToGrid( ParticleManager & part
     // Map to grid
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
     int const numDims = m_numDims;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Parallelize with atomics/reduction
+    m_transferSchedules[subRegionIndex].forAllParticles< parallelHostPolicy >( [=] GEOS_HOST ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
 
@@ -2814,13 +2802,14 @@ void SolidMechanicsMPM::initializeGridFields( NodeManager & nodeManager )
   arrayView3d< real64 > const gridSurfaceNormal = nodeManager.getReference< array3d< real64 > >( viewKeyStruct::surfaceNormalString() );
   arrayView3d< real64 > const gridMaterialPosition = nodeManager.getReference< array3d< real64 > >( viewKeyStruct::materialPositionString() );
 
-  forAll< serialPolicy >( numNodes, [=] GEOS_HOST ( localIndex const g ) // Switch to .zero()?
+  int const numVelocityFields = m_numVelocityFields;
+  forAll< parallelHostPolicy >( numNodes, [=] GEOS_HOST ( localIndex const g ) // Switch to .zero()?
     {
       for( int i = 0; i < 3; i++ )
       {
         gridDamageGradient[g][i] = 0.0;
       }
-      for( int fieldIndex = 0; fieldIndex < m_numVelocityFields; fieldIndex++ )
+      for( int fieldIndex = 0; fieldIndex < numVelocityFields; fieldIndex++ )
       {
         gridMass[g][fieldIndex] = 0.0;
         gridDamage[g][fieldIndex] = 0.0;
@@ -2898,10 +2887,9 @@ void SolidMechanicsMPM::particleToGrid( ParticleManager & particleManager,
     int const numDims = m_numDims;
     int voigtMap[3][3] = { {0, 5, 4}, {5, 1, 3}, {4, 3, 2} };
     int const damageFieldPartitioning = m_damageFieldPartitioning;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Can be parallized using atomics -
-                                                                                                // remember to pass copies of class
-                                                                                                // variables
-      {                                                                                          // Grid max damage will require reduction
+    int const numContactGroups = m_numContactGroups;
+    m_transferSchedules[subRegionIndex].forAllParticles< parallelHostPolicy >( [=] GEOS_HOST ( localIndex const pp )
+      {
         localIndex const p = activeParticleIndices[pp];
 
         for( int g = 0; g < 8 * numberOfVerticesPerParticle; g++ )
@@ -2916,7 +2904,7 @@ void SolidMechanicsMPM::particleToGrid( ParticleManager & particleManager,
                                                                                                                                                                              // for
                                                                                                                                                                              // "B"
                                                                                                                                                                              // field
-          int const fieldIndex = nodeFlag * m_numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
+          int const fieldIndex = nodeFlag * numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
           gridMass[mappedNode][fieldIndex] += particleMass[p] * shapeFunctionValues[pp][g];
           // TODO: Normalizing by volume might be better
           gridDamage[mappedNode][fieldIndex] += particleMass[p] * ( particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp] ) * shapeFunctionValues[pp][g];
@@ -2960,7 +2948,7 @@ void SolidMechanicsMPM::gridTrialUpdate( real64 dt,
   int const numDims = m_numDims;
   for( int fieldIndex=0; fieldIndex<m_numVelocityFields; fieldIndex++ )
   {
-    forAll< serialPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
+    forAll< parallelHostPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
     {
       if( gridMass[g][fieldIndex] > smallMass ) // small mass threshold
       {
@@ -3039,7 +3027,7 @@ void SolidMechanicsMPM::enforceContact( real64 dt,
   int const numDims = m_numDims;
   for( int fieldIndex=0; fieldIndex<m_numVelocityFields; fieldIndex++ )
   {
-    forAll< serialPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
+    forAll< parallelHostPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
     {
       if( gridMass[g][fieldIndex] > smallMass ) // small mass threshold
       {
@@ -3151,7 +3139,7 @@ void SolidMechanicsMPM::gridToParticle( real64 dt,
     int const numDims = m_numDims;
     int const damageFieldPartitioning = m_damageFieldPartitioning;
     int const numContactGroups = m_numContactGroups;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+    forAll< parallelHostPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
     {
       localIndex const p = activeParticleIndices[pp];
 
@@ -3854,6 +3842,7 @@ void SolidMechanicsMPM::resizeMappingArrays( ParticleManager & particleManager )
   m_mappedNodes.resize( numberOfSubRegions );
   m_shapeFunctionValues.resize( numberOfSubRegions );
   m_shapeFunctionGradientValues.resize( numberOfSubRegions );
+  m_transferSchedules.resize( numberOfSubRegions );
 
   localIndex subRegionIndex = 0;
   particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
@@ -4059,5 +4048,27 @@ void SolidMechanicsMPM::populateMappingArrays( ParticleManager & particleManager
   } );
 }
 
+void SolidMechanicsMPM::buildTransferSchedules( ParticleManager & particleManager,
+                                                NodeManager & nodeManager )
+{
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const gridPosition = nodeManager.referencePosition();
+  real64 hEl[3] = {0};
+  LvArray::tensorOps::copy< 3 >( hEl, m_hEl );
+  real64 xLocalMin[3] = {0};
+  LvArray::tensorOps::copy< 3 >( xLocalMin, m_xLocalMin );
+  int const numNodes[3] = { m_nEl[0] + 1, m_nEl[1] + 1, m_nEl[2] + 1 };
+
+  localIndex subRegionIndex = 0;
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & GEOS_UNUSED_PARAM( subRegion ) )
+  {
+    m_transferSchedules[subRegionIndex].build( m_mappedNodes[subRegionIndex].toViewConst(),
+                                               gridPosition,
+                                               xLocalMin,
+                                               hEl,
+                                               numNodes );
+    subRegionIndex++;
+  } );
+}
+
 REGISTER_CATALOG_ENTRY( SolverBase, SolidMechanicsMPM, string const &, dataRepository::Group * const )
 }
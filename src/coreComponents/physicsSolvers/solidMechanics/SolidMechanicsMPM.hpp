@@ -24,6 +24,7 @@
 #include "common/TimingMacros.hpp"
 #include "kernels/SolidMechanicsLagrangianFEMKernels.hpp"
 #include "kernels/ExplicitMPM.hpp"
+#include "kernels/MPMTransferSchedule.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "mesh/mpiCommunications/MPI_iCommData.hpp"
@@ -361,6 +362,9 @@ public:
   void populateMappingArrays( ParticleManager & particleManager,
                               NodeManager & nodeManager );
 
+  void buildTransferSchedules( ParticleManager & particleManager,
+                               NodeManager & nodeManager );
+
 protected:
   virtual void postInputInitialization() override final;
 
@@ -371,6 +375,8 @@ protected:
   std::vector< array3d< real64 > > m_shapeFunctionGradientValues; // mappedNodes[subregion][particle][nodal shape function gradient
                                                                   // value][direction]. dims = {# of subregions, # of particles, # of nodes
                                                                   // a particle on the subregion maps to, 3}
+  std::vector< solidMechanicsMPMKernels::TransferSchedule > m_transferSchedules; // Race-free ordering of the particle-to-grid scatters of
+                                                                                 // each subregion
 
   int m_solverProfiling;
   std::vector< real64 > m_profilingTimes;
@@ -428,34 +434,6 @@ protected:
   array3d< int > m_ijkMap;        // Map from indices in each spatial dimension to local node ID
 
 private:
-  struct BinKey
-  {
-    localIndex regionIndex;
-    localIndex subRegionIndex;
-    localIndex binIndex;
-
-    bool operator==( BinKey const & other ) const
-    {
-      return (regionIndex == other.regionIndex && subRegionIndex == other.subRegionIndex && binIndex == other.binIndex);
-    }
-  };
-
-  struct BinKeyHash
-  {
-    std::size_t operator()( BinKey const & k ) const
-    {
-      using std::size_t;
-      using std::hash;
-
-      // Compute individual hash values for first,
-      // second and third and combine them using XOR
-      // and bit shifting:
-      return ((std::hash< localIndex >()( k.regionIndex )
-               ^ (std::hash< localIndex >()( k.subRegionIndex ) << 1)) >> 1)
-             ^ (std::hash< localIndex >()( k.binIndex ) << 1);
-    }
-  };
-
   void setParticlesConstitutiveNames( ParticleSubRegionBase & subRegion ) const;
 };
 
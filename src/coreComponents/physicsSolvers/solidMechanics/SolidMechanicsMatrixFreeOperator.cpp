@@ -0,0 +1,143 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+
+#include "constitutive/solid/SolidBase.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsFields.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "physicsSolvers/solidMechanics/kernels/ImplicitSmallStrainQuasiStaticMatrixFree.hpp"
+
+namespace geos
+{
+
+using namespace fields;
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM & solver,
+                                                                    DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                                    arrayView1d< integer const > const & constrainedRows )
+  : m_solver( solver ),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_localMatrix( localMatrix ),
+  m_constrainedRows( constrainedRows ),
+  m_diagonal( dofManager.numLocalDofs() )
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF_NE( m_constrainedRows.size(), m_diagonal.size() );
+
+  globalIndex const rankOffset = dofManager.rankOffset();
+  CRSMatrixView< real64 const, globalIndex const > const matrix = localMatrix.toViewConst();
+  arrayView1d< real64 > const diagonal = m_diagonal.toView();
+  forAll< parallelDevicePolicy<> >( matrix.numRows(), [=] GEOS_HOST_DEVICE ( localIndex const row )
+  {
+    arraySlice1d< globalIndex const > const columns = matrix.getColumns( row );
+    arraySlice1d< real64 const > const entries = matrix.getEntries( row );
+    diagonal[row] = 0.0;
+    for( localIndex j = 0; j < matrix.numNonZeros( row ); ++j )
+    {
+      if( columns[j] == rankOffset + row )
+      {
+        diagonal[row] = entries[j];
+      }
+    }
+  } );
+}
+
+void SolidMechanicsMatrixFreeOperator::apply( Vector const & src, Vector & dst ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  // Scatter the direction on the nodes, including the ghosts
+  m_dofManager.copyVectorToField( src.values(),
+                                  solidMechanics::totalDisplacement::key(),
+                                  solidMechanics::matrixFreeDirection::key(),
+                                  1.0 );
+
+  arrayView1d< real64 > const localDst = dst.open();
+  localDst.zero();
+
+  m_solver.forDiscretizationOnMeshTargets( m_domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & regionNames )
+  {
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { solidMechanics::matrixFreeDirection::key() } );
+    CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                         mesh,
+                                                         m_domain.getNeighbors(),
+                                                         true );
+
+    m_solver.assemblyLaunch< constitutive::SolidBase,
+                             solidMechanicsLagrangianFEMKernels::QuasiStaticMatrixFreeFactory >( mesh,
+                                                                                                 m_dofManager,
+                                                                                                 regionNames,
+                                                                                                 SolidMechanicsLagrangianFEM::viewKeyStruct::solidMaterialNamesString(),
+                                                                                                 m_localMatrix,
+                                                                                                 localDst,
+                                                                                                 0.0 );
+  } );
+
+  // Rows of the constrained degrees of freedom only keep their diagonal entry
+  arrayView1d< real64 const > const localSrc = src.values();
+  arrayView1d< integer const > const constrainedRows = m_constrainedRows;
+  arrayView1d< real64 const > const diagonal = m_diagonal.toViewConst();
+  forAll< parallelDevicePolicy<> >( localDst.size(), [=] GEOS_HOST_DEVICE ( localIndex const row )
+  {
+    if( constrainedRows[row] )
+    {
+      localDst[row] = diagonal[row] * localSrc[row];
+    }
+  } );
+
+  dst.close();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalRows() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalCols() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalRows() const
+{
+  return m_dofManager.numLocalDofs();
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalCols() const
+{
+  return m_dofManager.numLocalDofs();
+}
+
+MPI_Comm SolidMechanicsMatrixFreeOperator::comm() const
+{
+  return MPI_COMM_GEOS;
+}
+
+} // namespace geos
@@ -0,0 +1,128 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+namespace geos
+{
+
+class DofManager;
+class DomainPartition;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ *
+ * Jacobian of the quasi-static solid mechanics solver applied element by element, without
+ * assembling it.
+ *
+ * The operator reproduces the assembled jacobian after the application of the Dirichlet conditions:
+ * the rows of the constrained degrees of freedom are replaced by their (assembled) diagonal entry,
+ * while their columns are kept. The local matrix given to the constructor only needs to hold the
+ * diagonal, as assembled by the QuasiStaticDiagonal kernel.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /// Alias for base type
+  using Base = LinearOperator< ParallelVector >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @brief Constructor
+   * @param solver the solid mechanics solver (must outlive this operator)
+   * @param domain the domain partition (must outlive this operator)
+   * @param dofManager the degree of freedom manager (must outlive this operator)
+   * @param localMatrix the local matrix holding (at least) the diagonal of the jacobian, with the Dirichlet conditions applied
+   * @param constrainedRows flag of the local rows constrained by a Dirichlet condition
+   */
+  SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM & solver,
+                                    DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                    arrayView1d< integer const > const & constrainedRows );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~SolidMechanicsMatrixFreeOperator() override = default;
+
+  /**
+   * @brief Apply operator to a vector.
+   * @param src input vector
+   * @param dst output vector
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  /**
+   * @brief @return the global number of rows
+   */
+  virtual globalIndex numGlobalRows() const override;
+
+  /**
+   * @brief @return the global number of columns
+   */
+  virtual globalIndex numGlobalCols() const override;
+
+  /**
+   * @brief @return the local number of rows
+   */
+  virtual localIndex numLocalRows() const override;
+
+  /**
+   * @brief @return the local number of columns
+   */
+  virtual localIndex numLocalCols() const override;
+
+  /**
+   * @brief @return the communicator
+   */
+  virtual MPI_Comm comm() const override;
+
+private:
+
+  /// The solid mechanics solver
+  SolidMechanicsLagrangianFEM & m_solver;
+
+  /// The domain partition
+  DomainPartition & m_domain;
+
+  /// The degree of freedom manager
+  DofManager const & m_dofManager;
+
+  /// The local matrix (only passed to the kernels, which do not use it)
+  CRSMatrixView< real64, globalIndex const > const m_localMatrix;
+
+  /// Flag of the local rows constrained by a Dirichlet condition
+  arrayView1d< integer const > const m_constrainedRows;
+
+  /// Diagonal of the local rows
+  array1d< real64 > m_diagonal;
+};
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
@@ -20,6 +20,7 @@
 #ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_EXPLICITSMALLSTRAIN_HPP_
 #define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_EXPLICITSMALLSTRAIN_HPP_
 
+#include "constitutive/solid/SolidBase.hpp"
 #include "finiteElement/kernelInterface/KernelBase.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsFields.hpp"
 
@@ -86,6 +87,15 @@ public:
   using Base::m_constitutiveUpdate;
   using Base::m_finiteElementSpace;
 
+  /// Whether the constitutive update is applied to all the quadrature points of an element at once,
+  /// which lets the models vectorize it on CPU builds.
+#if defined( GEOS_USE_DEVICE ) || UPDATE_STRESS != 2
+  static constexpr bool useBatchedConstitutiveUpdate = false;
+#else
+  static constexpr bool useBatchedConstitutiveUpdate =
+    constitutive::hasBatchedSmallStrainUpdate< typename CONSTITUTIVE_TYPE::KernelWrapper >::value;
+#endif
+
 //*****************************************************************************
   /**
    * @brief Constructor
@@ -165,6 +175,20 @@ public:
                               localIndex const q,
                               StackVariables & stack ) const;
 
+  /**
+   * @brief Quadrature point kernel applied to all the quadrature points of an element at once.
+   * @param k The element index.
+   * @param stack The stack variables.
+   *
+   * Same as calling quadraturePointKernel() on each quadrature point (with or without USE_JACOBIAN),
+   * but the strains of all the points are computed first and passed in a single batch to the
+   * constitutive update.
+   * Only used when useBatchedConstitutiveUpdate is true.
+   */
+  GEOS_HOST_DEVICE
+  void batchedQuadraturePointKernel( localIndex const k,
+                                     StackVariables & stack ) const;
+
   /**
    * @copydoc geos::finiteElement::KernelBase::complete
    *
@@ -157,6 +157,62 @@ void ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::quadratu
 #endif
 }
 
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+inline
+void ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::batchedQuadraturePointKernel( localIndex const k,
+                                                                                                      StackVariables & stack ) const
+{
+  constexpr int numQuadraturePoints = Base::numQuadraturePointsPerElem;
+
+  // same strain and force computations as quadraturePointKernel, with or without USE_JACOBIAN
+#if !defined( USE_JACOBIAN )
+  real64 dNdX[ numQuadraturePoints ][ numNodesPerElem ][ 3 ];
+#else
+  real64 invJ[ numQuadraturePoints ][ 3 ][ 3 ];
+#endif
+  real64 detJ[ numQuadraturePoints ];
+  real64 strain[ 6 ][ numQuadraturePoints ];
+  for( integer q = 0; q < numQuadraturePoints; ++q )
+  {
+    real64 strainLocal[ 6 ] = {0};
+#if !defined( USE_JACOBIAN )
+    detJ[ q ] = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX[ q ] );
+    FE_TYPE::symmetricGradient( dNdX[ q ], stack.varLocal, strainLocal );
+#else
+    detJ[ q ] = FE_TYPE::inverseJacobianTransformation( q, stack.xLocal, invJ[ q ] );
+    FE_TYPE::symmetricGradient( q, invJ[ q ], stack.varLocal, strainLocal );
+#endif
+    for( integer c = 0; c < 6; ++c )
+    {
+      strain[ c ][ q ] = strainLocal[ c ];
+    }
+  }
+
+  real64 stress[ 6 ][ numQuadraturePoints ];
+  m_constitutiveUpdate.template smallStrainUpdateBatch_StressOnly< numQuadraturePoints >( k, 0, m_dt, strain, stress );
+
+  for( integer q = 0; q < numQuadraturePoints; ++q )
+  {
+    real64 stressLocal[ 6 ];
+#if !defined( USE_JACOBIAN )
+    for( integer c = 0; c < 6; ++c )
+    {
+      stressLocal[ c ] = -stress[ c ][ q ] * detJ[ q ];
+    }
+    FE_TYPE::plusGradNajAij( dNdX[ q ], stressLocal, stack.fLocal );
+#else
+    for( integer c = 0; c < 6; ++c )
+    {
+      stressLocal[ c ] = stress[ c ][ q ] * detJ[ q ];
+    }
+    FE_TYPE::plusGradNajAij( q, invJ[ q ], stressLocal, stack.fLocal );
+#endif
+  }
+}
+
 template< typename SUBREGION_TYPE,
           typename CONSTITUTIVE_TYPE,
           typename FE_TYPE >
@@ -198,9 +254,16 @@ ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch(
     typename KERNEL_TYPE::StackVariables stack;
 
     kernelComponent.setup( k, stack );
-    for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+    if constexpr ( KERNEL_TYPE::useBatchedConstitutiveUpdate )
+    {
+      kernelComponent.batchedQuadraturePointKernel( k, stack );
+    }
+    else
     {
-      kernelComponent.quadraturePointKernel( k, q, stack );
+      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointKernel( k, q, stack );
+      }
     }
     kernelComponent.complete( k, stack );
   } );
@@ -0,0 +1,207 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ImplicitSmallStrainQuasiStaticMatrixFree.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICMATRIXFREE_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICMATRIXFREE_HPP_
+
+#include "ImplicitSmallStrainQuasiStatic.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Quasi-static kernel assembling the residual and only the diagonal of the jacobian.
+ * @copydoc geos::solidMechanicsLagrangianFEMKernels::ImplicitSmallStrainQuasiStatic
+ *
+ * ### QuasiStaticDiagonal Description
+ * Used in matrix-free mode, where the global matrix only holds the diagonal. The element
+ * contributions are computed as in the parent kernel, but only their diagonal entries are added
+ * to the matrix, which is then used to apply the Dirichlet conditions and to build a Jacobi
+ * preconditioner.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ImplicitSmallStrainQuasiStaticDiagonal :
+  public ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                         CONSTITUTIVE_TYPE,
+                                         FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                               CONSTITUTIVE_TYPE,
+                                               FE_TYPE >;
+
+  using Base::numDofPerTestSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_finiteElementSpace;
+  using typename Base::StackVariables;
+
+  using Base::Base;
+
+  /**
+   * @copydoc geos::finiteElement::ImplicitKernelBase::complete
+   *
+   * Only the diagonal of the element jacobian is added to the matrix.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent );
+};
+
+/// The factory used to construct a QuasiStaticDiagonal kernel.
+using QuasiStaticDiagonalFactory = finiteElement::KernelFactory< ImplicitSmallStrainQuasiStaticDiagonal,
+                                                                 arrayView1d< globalIndex const > const,
+                                                                 globalIndex,
+                                                                 CRSMatrixView< real64, globalIndex const > const,
+                                                                 arrayView1d< real64 > const,
+                                                                 real64 const,
+                                                                 real64 const (&)[3] >;
+
+/**
+ * @brief Matrix-free application of the quasi-static jacobian.
+ * @copydoc geos::solidMechanicsLagrangianFEMKernels::ImplicitSmallStrainQuasiStatic
+ *
+ * ### QuasiStaticMatrixFree Description
+ * Computes the product of the quasi-static jacobian with the nodal vector stored in the
+ * fields::solidMechanics::matrixFreeDirection field, element by element, and accumulates it into
+ * the "rhs" array given to the constructor, which is the local part of the destination vector.
+ * The matrix given to the constructor is not used.
+ *
+ * The product is computed with the elastic stiffness of the constitutive model, and therefore
+ * matches the assembled jacobian for linear elastic models only. The stabilization term of the
+ * virtual elements is included.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ImplicitSmallStrainQuasiStaticMatrixFree :
+  public ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                         CONSTITUTIVE_TYPE,
+                                         FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                               CONSTITUTIVE_TYPE,
+                                               FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofNumber;
+  using Base::m_dofRankOffset;
+  using Base::m_rhs;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+  using Base::m_meshData;
+  using Base::m_X;
+  using typename Base::StackVariables;
+
+  /**
+   * @brief Constructor
+   * @copydoc geos::solidMechanicsLagrangianFEMKernels::ImplicitSmallStrainQuasiStatic::ImplicitSmallStrainQuasiStatic
+   */
+  ImplicitSmallStrainQuasiStaticMatrixFree( NodeManager const & nodeManager,
+                                            EdgeManager const & edgeManager,
+                                            FaceManager const & faceManager,
+                                            localIndex const targetRegionIndex,
+                                            SUBREGION_TYPE const & elementSubRegion,
+                                            FE_TYPE const & finiteElementSpace,
+                                            CONSTITUTIVE_TYPE & inputConstitutiveType,
+                                            arrayView1d< globalIndex const > const inputDofNumber,
+                                            globalIndex const rankOffset,
+                                            CRSMatrixView< real64, globalIndex const > const inputMatrix,
+                                            arrayView1d< real64 > const inputRhs,
+                                            real64 const inputDt,
+                                            real64 const (&inputGravityVector)[3] );
+
+  /**
+   * @copydoc geos::finiteElement::ImplicitKernelBase::setup
+   *
+   * The direction is gathered in place of the incremental displacement.
+   */
+  GEOS_HOST_DEVICE
+  void setup( localIndex const k,
+              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * The stress of the strain of the direction is computed with the elastic stiffness, and
+   * integrated against the basis function gradients.
+   */
+  GEOS_HOST_DEVICE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::ImplicitKernelBase::complete
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent );
+
+protected:
+  /// The rank-global direction the operator is applied to.
+  arrayView2d< real64 const, nodes::INCR_DISPLACEMENT_USD > const m_direction;
+};
+
+/// The factory used to construct a QuasiStaticMatrixFree kernel.
+using QuasiStaticMatrixFreeFactory = finiteElement::KernelFactory< ImplicitSmallStrainQuasiStaticMatrixFree,
+                                                                   arrayView1d< globalIndex const > const,
+                                                                   globalIndex,
+                                                                   CRSMatrixView< real64, globalIndex const > const,
+                                                                   arrayView1d< real64 > const,
+                                                                   real64 const,
+                                                                   real64 const (&)[3] >;
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICMATRIXFREE_HPP_
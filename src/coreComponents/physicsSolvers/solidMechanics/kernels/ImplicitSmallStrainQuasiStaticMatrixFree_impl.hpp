@@ -0,0 +1,222 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ImplicitSmallStrainQuasiStaticMatrixFree_impl.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICMATRIXFREE_IMPL_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICMATRIXFREE_IMPL_HPP_
+
+#include "ImplicitSmallStrainQuasiStaticMatrixFree.hpp"
+#include "ImplicitSmallStrainQuasiStatic_impl.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64 ImplicitSmallStrainQuasiStaticDiagonal< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::complete( localIndex const k,
+                                                                                                       StackVariables & stack ) const
+{
+  GEOS_UNUSED_VAR( k );
+  real64 maxForce = 0;
+
+  localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  // The diagonal is part of the upper triangle filled by the quadrature point kernel
+  for( int i = 0; i < numDofPerTestSupportPoint * numSupportPoints; ++i )
+  {
+    localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+    if( dof < 0 || dof >= m_matrix.numRows() )
+      continue;
+    m_matrix.template addToRow< parallelDeviceAtomic >( dof,
+                                                        &stack.localRowDofIndex[ i ],
+                                                        &stack.localJacobian[ i ][ i ],
+                                                        1 );
+
+    RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+    maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+  }
+
+  return maxForce;
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+template< typename POLICY,
+          typename KERNEL_TYPE >
+GEOS_FORCE_INLINE
+real64
+ImplicitSmallStrainQuasiStaticDiagonal< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch( localIndex const numElems,
+                                                                                                    KERNEL_TYPE const & kernelComponent )
+{
+  return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+}
+
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+ImplicitSmallStrainQuasiStaticMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+ImplicitSmallStrainQuasiStaticMatrixFree( NodeManager const & nodeManager,
+                                          EdgeManager const & edgeManager,
+                                          FaceManager const & faceManager,
+                                          localIndex const targetRegionIndex,
+                                          SUBREGION_TYPE const & elementSubRegion,
+                                          FE_TYPE const & finiteElementSpace,
+                                          CONSTITUTIVE_TYPE & inputConstitutiveType,
+                                          arrayView1d< globalIndex const > const inputDofNumber,
+                                          globalIndex const rankOffset,
+                                          CRSMatrixView< real64, globalIndex const > const inputMatrix,
+                                          arrayView1d< real64 > const inputRhs,
+                                          real64 const inputDt,
+                                          real64 const (&inputGravityVector)[3] ):
+  Base( nodeManager,
+        edgeManager,
+        faceManager,
+        targetRegionIndex,
+        elementSubRegion,
+        finiteElementSpace,
+        inputConstitutiveType,
+        inputDofNumber,
+        rankOffset,
+        inputMatrix,
+        inputRhs,
+        inputDt,
+        inputGravityVector ),
+  m_direction( nodeManager.getField< fields::solidMechanics::matrixFreeDirection >() )
+{}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void ImplicitSmallStrainQuasiStaticMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+setup( localIndex const k,
+       StackVariables & stack ) const
+{
+  m_finiteElementSpace.template setup< FE_TYPE >( k, m_meshData, stack.feStack );
+
+  localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  stack.numRows =  3 * numSupportPoints;
+  stack.numCols = stack.numRows;
+
+  for( localIndex a = 0; a < numSupportPoints; ++a )
+  {
+    localIndex const localNodeIndex = m_elemsToNodes( k, a );
+
+    for( int i = 0; i < numDofPerTestSupportPoint; ++i )
+    {
+#if defined(CALC_FEM_SHAPE_IN_KERNEL)
+      stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+#endif
+      stack.uhat_local[ a ][ i ] = m_direction[ localNodeIndex ][ i ];
+      stack.localRowDofIndex[ a*3+i ] = m_dofNumber[ localNodeIndex ]+i;
+    }
+  }
+
+  // Product of the stabilization matrix added in the setup of the parent kernel
+  // (this is a no-operation with FEM classes)
+  real64 const stabilizationScaling = this->computeStabilizationScaling( k );
+  m_finiteElementSpace.template addEvaluatedGradGradStabilizationVector< FE_TYPE, numDofPerTrialSupportPoint >( stack.feStack,
+                                                                                                                stack.uhat_local,
+                                                                                                                reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual),
+                                                                                                                -stabilizationScaling );
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void ImplicitSmallStrainQuasiStaticMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::quadraturePointKernel( localIndex const k,
+                                                                                                                    localIndex const q,
+                                                                                                                    StackVariables & stack ) const
+{
+  real64 dNdX[ numNodesPerElem ][ 3 ];
+  real64 const detJxW = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, stack.feStack, dNdX );
+
+  real64 strain[6] = {0};
+  FE_TYPE::symmetricGradient( dNdX, stack.uhat_local, strain );
+
+  real64 elasticStiffness[6][6];
+  m_constitutiveUpdate.getElasticStiffness( k, q, elasticStiffness );
+
+  real64 stress[6] = {0};
+  for( int i = 0; i < 6; ++i )
+  {
+    for( int j = 0; j < 6; ++j )
+    {
+      stress[i] += elasticStiffness[i][j] * strain[j];
+    }
+    stress[i] *= -detJxW;
+  }
+
+  FE_TYPE::plusGradNajAij( dNdX,
+                           stress,
+                           reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual) );
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64 ImplicitSmallStrainQuasiStaticMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::complete( localIndex const k,
+                                                                                                         StackVariables & stack ) const
+{
+  GEOS_UNUSED_VAR( k );
+
+  localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  for( int i = 0; i < numDofPerTestSupportPoint * numSupportPoints; ++i )
+  {
+    localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+    if( dof < 0 || dof >= m_rhs.size() )
+      continue;
+    RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+  }
+
+  return 0;
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+template< typename POLICY,
+          typename KERNEL_TYPE >
+GEOS_FORCE_INLINE
+real64
+ImplicitSmallStrainQuasiStaticMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch( localIndex const numElems,
+                                                                                                      KERNEL_TYPE const & kernelComponent )
+{
+  return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+}
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICMATRIXFREE_IMPL_HPP_
@@ -0,0 +1,112 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ImplicitSmallStrainQuasiStaticResidual.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICRESIDUAL_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICRESIDUAL_HPP_
+
+#include "ImplicitSmallStrainQuasiStatic.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Quasi-static kernel assembling the residual only.
+ * @copydoc geos::solidMechanicsLagrangianFEMKernels::ImplicitSmallStrainQuasiStatic
+ *
+ * ### QuasiStaticResidual Description
+ * Used for the regions whose contribution to the jacobian does not change from one assembly to the
+ * next (linear elastic models), when this contribution is reused instead of being recomputed. The
+ * constitutive update only computes the stress, and nothing is added to the matrix.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ImplicitSmallStrainQuasiStaticResidual :
+  public ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                         CONSTITUTIVE_TYPE,
+                                         FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                               CONSTITUTIVE_TYPE,
+                                               FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+  using Base::m_dt;
+  using Base::m_gravityVector;
+  using Base::m_density;
+  using typename Base::StackVariables;
+
+  using Base::Base;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * Same as the parent kernel, without the constitutive stiffness and the jacobian.
+   */
+  GEOS_HOST_DEVICE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::ImplicitKernelBase::complete
+   *
+   * Only the residual is added to the right-hand side.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent );
+};
+
+/// The factory used to construct a QuasiStaticResidual kernel.
+using QuasiStaticResidualFactory = finiteElement::KernelFactory< ImplicitSmallStrainQuasiStaticResidual,
+                                                                 arrayView1d< globalIndex const > const,
+                                                                 globalIndex,
+                                                                 CRSMatrixView< real64, globalIndex const > const,
+                                                                 arrayView1d< real64 > const,
+                                                                 real64 const,
+                                                                 real64 const (&)[3] >;
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICRESIDUAL_HPP_
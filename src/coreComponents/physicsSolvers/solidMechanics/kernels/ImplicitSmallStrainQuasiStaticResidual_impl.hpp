@@ -0,0 +1,116 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ImplicitSmallStrainQuasiStaticResidual_impl.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICRESIDUAL_IMPL_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICRESIDUAL_IMPL_HPP_
+
+#include "ImplicitSmallStrainQuasiStaticResidual.hpp"
+#include "ImplicitSmallStrainQuasiStatic_impl.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void ImplicitSmallStrainQuasiStaticResidual< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::quadraturePointKernel( localIndex const k,
+                                                                                                                  localIndex const q,
+                                                                                                                  StackVariables & stack ) const
+{
+  real64 dNdX[ numNodesPerElem ][ 3 ];
+  real64 const detJxW = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, stack.feStack, dNdX );
+
+  real64 strainInc[6] = {0};
+  real64 stress[6] = {0};
+
+  FE_TYPE::symmetricGradient( dNdX, stack.uhat_local, strainInc );
+
+  m_constitutiveUpdate.smallStrainUpdate_StressOnly( k, q, m_dt, strainInc, stress );
+
+  for( localIndex i=0; i<6; ++i )
+  {
+    stress[i] *= -detJxW;
+  }
+
+  real64 const gravityForce[3] = { m_gravityVector[0] * m_density( k, q )* detJxW,
+                                   m_gravityVector[1] * m_density( k, q )* detJxW,
+                                   m_gravityVector[2] * m_density( k, q )* detJxW };
+
+  real64 N[numNodesPerElem];
+  FE_TYPE::calcN( q, stack.feStack, N );
+  FE_TYPE::plusGradNajAijPlusNaFi( dNdX,
+                                   stress,
+                                   N,
+                                   gravityForce,
+                                   reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual) );
+  real64 const stabilizationScaling = this->computeStabilizationScaling( k );
+  m_finiteElementSpace.template addEvaluatedGradGradStabilizationVector< FE_TYPE, numDofPerTrialSupportPoint >( stack.feStack,
+                                                                                                                stack.uhat_local,
+                                                                                                                reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual),
+                                                                                                                -stabilizationScaling );
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64 ImplicitSmallStrainQuasiStaticResidual< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::complete( localIndex const k,
+                                                                                                       StackVariables & stack ) const
+{
+  GEOS_UNUSED_VAR( k );
+  real64 maxForce = 0;
+
+  localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  for( int i = 0; i < numDofPerTestSupportPoint * numSupportPoints; ++i )
+  {
+    localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+    if( dof < 0 || dof >= m_matrix.numRows() )
+      continue;
+    RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+    maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+  }
+
+  return maxForce;
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+template< typename POLICY,
+          typename KERNEL_TYPE >
+GEOS_FORCE_INLINE
+real64
+ImplicitSmallStrainQuasiStaticResidual< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch( localIndex const numElems,
+                                                                                                    KERNEL_TYPE const & kernelComponent )
+{
+  return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+}
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINQUASISTATICRESIDUAL_IMPL_HPP_
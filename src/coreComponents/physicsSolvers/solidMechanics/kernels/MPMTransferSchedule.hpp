@@ -0,0 +1,221 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MPMTransferSchedule.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_MPMTRANSFERSCHEDULE_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_MPMTRANSFERSCHEDULE_HPP_
+
+#include "common/DataLayouts.hpp"
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsMPMKernels
+{
+
+/**
+ * @class TransferSchedule
+ *
+ * Race-free schedule for the particle-to-grid scatters of the MPM solver.
+ *
+ * The background grid is split into blocks of nodes, wide enough (in each direction) for the particles
+ * whose lowest mapped node lies in a block to only reach nodes of this block and of the next one.
+ * Blocks are then colored by the parity of their (i,j,k) indices: two blocks of the same color never
+ * share a node, so that all the blocks of a color can be processed concurrently, each thread
+ * processing the particles of a block sequentially. With single point particles, the blocks are
+ * the grid cells and there are 8 colors.
+ *
+ * The particles are sorted by block with a counting sort, which also improves the locality of the
+ * grid accesses. Since the processing order of the particles does not depend on the number of threads,
+ * the scattered fields are reproducible from one run to another.
+ */
+class TransferSchedule
+{
+public:
+
+  /// Number of colors of the blocks
+  static constexpr int numColors = 8;
+
+  /**
+   * @brief Sort the particles of a subregion by block and color the blocks.
+   * @param[in] mappedNodes nodes mapped by each active particle, as built by the solver
+   * @param[in] gridPosition the positions of the grid nodes
+   * @param[in] xLocalMin the lowest coordinates of the local grid (including ghost nodes)
+   * @param[in] hEl the grid spacing in each direction
+   * @param[in] numNodes the number of grid nodes in each direction
+   */
+  void build( arrayView2d< localIndex const > const & mappedNodes,
+              arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & gridPosition,
+              real64 const (&xLocalMin)[3],
+              real64 const (&hEl)[3],
+              int const (&numNodes)[3] )
+  {
+    localIndex const numParticles = mappedNodes.size( 0 );
+    localIndex const numMappedNodes = mappedNodes.size( 1 );
+
+    // Lowest (i,j,k) of the nodes mapped by each particle, and largest extent of the mapped nodes
+    array2d< int > lowestIJK( numParticles, 3 );
+    arrayView2d< int > const lowestIJKView = lowestIJK.toView();
+    RAJA::ReduceMax< parallelHostReduce, int > spanX( 1 ), spanY( 1 ), spanZ( 1 );
+    forAll< parallelHostPolicy >( numParticles, [=] GEOS_HOST ( localIndex const pp )
+    {
+      int lo[3] = { numNodes[0], numNodes[1], numNodes[2] };
+      int hi[3] = { 0, 0, 0 };
+      for( localIndex a = 0; a < numMappedNodes; ++a )
+      {
+        localIndex const node = mappedNodes[pp][a];
+        for( int i = 0; i < 3; ++i )
+        {
+          int const ijk = static_cast< int >( std::lround( ( gridPosition[node][i] - xLocalMin[i] ) / hEl[i] ) );
+          lo[i] = LvArray::math::min( lo[i], ijk );
+          hi[i] = LvArray::math::max( hi[i], ijk );
+        }
+      }
+      for( int i = 0; i < 3; ++i )
+      {
+        lowestIJKView[pp][i] = lo[i];
+      }
+      spanX.max( hi[0] - lo[0] );
+      spanY.max( hi[1] - lo[1] );
+      spanZ.max( hi[2] - lo[2] );
+    } );
+
+    // Blocks must be at least as wide as the particle stencils for same-color blocks to be disjoint
+    int const blockWidth[3] = { spanX.get(), spanY.get(), spanZ.get() };
+    int numBlocks[3];
+    for( int i = 0; i < 3; ++i )
+    {
+      numBlocks[i] = numNodes[i] / blockWidth[i] + 1;
+    }
+    localIndex const totalNumBlocks = LvArray::integerConversion< localIndex >( numBlocks[0] ) * numBlocks[1] * numBlocks[2];
+
+    array1d< localIndex > particleBlock( numParticles );
+    arrayView1d< localIndex > const particleBlockView = particleBlock.toView();
+    forAll< parallelHostPolicy >( numParticles, [=] GEOS_HOST ( localIndex const pp )
+    {
+      localIndex const bi = lowestIJKView[pp][0] / blockWidth[0];
+      localIndex const bj = lowestIJKView[pp][1] / blockWidth[1];
+      localIndex const bk = lowestIJKView[pp][2] / blockWidth[2];
+      particleBlockView[pp] = ( bi * numBlocks[1] + bj ) * numBlocks[2] + bk;
+    } );
+
+    // Counting sort of the particles by block (stable, so that the original order is kept within a block)
+    m_blockOffsets.resize( totalNumBlocks + 1 );
+    m_blockOffsets.zero();
+    for( localIndex pp = 0; pp < numParticles; ++pp )
+    {
+      ++m_blockOffsets[particleBlock[pp] + 1];
+    }
+    for( localIndex b = 0; b < totalNumBlocks; ++b )
+    {
+      m_blockOffsets[b + 1] += m_blockOffsets[b];
+    }
+    m_sortedParticles.resize( numParticles );
+    {
+      array1d< localIndex > position( totalNumBlocks );
+      for( localIndex b = 0; b < totalNumBlocks; ++b )
+      {
+        position[b] = m_blockOffsets[b];
+      }
+      for( localIndex pp = 0; pp < numParticles; ++pp )
+      {
+        m_sortedParticles[position[particleBlock[pp]]++] = pp;
+      }
+    }
+
+    // Group the non-empty blocks by color
+    m_colorOffsets.resize( numColors + 1 );
+    m_colorOffsets.zero();
+    m_coloredBlocks.clear();
+    for( int color = 0; color < numColors; ++color )
+    {
+      for( localIndex b = 0; b < totalNumBlocks; ++b )
+      {
+        if( m_blockOffsets[b + 1] > m_blockOffsets[b] && getBlockColor( b, numBlocks ) == color )
+        {
+          m_coloredBlocks.emplace_back( b );
+        }
+      }
+      m_colorOffsets[color + 1] = m_coloredBlocks.size();
+    }
+  }
+
+  /**
+   * @brief Launch a particle-to-grid kernel on all the particles of the schedule.
+   * @tparam POLICY the host execution policy used for the blocks of a color
+   * @tparam LAMBDA the type of the kernel
+   * @param[in] lambda the kernel, called with the index of the particle in the active particle list
+   *
+   * The kernel may accumulate into the nodes mapped by its particle without atomics.
+   */
+  template< typename POLICY, typename LAMBDA >
+  void forAllParticles( LAMBDA && lambda ) const
+  {
+    arrayView1d< localIndex const > const sortedParticles = m_sortedParticles.toViewConst();
+    arrayView1d< localIndex const > const blockOffsets = m_blockOffsets.toViewConst();
+    arrayView1d< localIndex const > const coloredBlocks = m_coloredBlocks.toViewConst();
+    for( int color = 0; color < numColors; ++color )
+    {
+      localIndex const firstBlock = m_colorOffsets[color];
+      forAll< POLICY >( m_colorOffsets[color + 1] - firstBlock, [=] GEOS_HOST ( localIndex const b )
+      {
+        localIndex const block = coloredBlocks[firstBlock + b];
+        for( localIndex k = blockOffsets[block]; k < blockOffsets[block + 1]; ++k )
+        {
+          lambda( sortedParticles[k] );
+        }
+      } );
+    }
+  }
+
+private:
+
+  /**
+   * @brief Compute the color of a block from the parity of its (i,j,k) indices.
+   * @param[in] block the linear index of the block
+   * @param[in] numBlocks the number of blocks in each direction
+   * @return the color, between 0 and numColors-1
+   */
+  static int getBlockColor( localIndex const block, int const (&numBlocks)[3] )
+  {
+    localIndex const bk = block % numBlocks[2];
+    localIndex const bj = ( block / numBlocks[2] ) % numBlocks[1];
+    localIndex const bi = block / ( numBlocks[2] * numBlocks[1] );
+    return LvArray::integerConversion< int >( ( bi % 2 ) + 2 * ( bj % 2 ) + 4 * ( bk % 2 ) );
+  }
+
+  /// Positions (in the active particle list) of the particles, sorted by block
+  array1d< localIndex > m_sortedParticles;
+
+  /// Offsets of the particles of each block in m_sortedParticles
+  array1d< localIndex > m_blockOffsets;
+
+  /// Non-empty blocks, sorted by color
+  array1d< localIndex > m_coloredBlocks;
+
+  /// Offsets of the blocks of each color in m_coloredBlocks
+  array1d< localIndex > m_colorOffsets;
+};
+
+} // namespace solidMechanicsMPMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_MPMTRANSFERSCHEDULE_HPP_
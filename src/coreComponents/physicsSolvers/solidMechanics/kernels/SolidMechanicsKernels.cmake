@@ -9,6 +9,9 @@ set( ExplicitFiniteStrainPolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE}
 set( FixedStressThermoPoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE} >" )
 set( ImplicitSmallStrainNewmarkPolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE} >" )
 set( ImplicitSmallStrainQuasiStaticPolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE} >" )
+set( ImplicitSmallStrainQuasiStaticDiagonalPolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE} >" )
+set( ImplicitSmallStrainQuasiStaticMatrixFreePolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE} >" )
+set( ImplicitSmallStrainQuasiStaticResidualPolicy "geos::parallelDevicePolicy< ${GEOS_BLOCK_SIZE} >" )
 
 
 configure_file( ${CMAKE_SOURCE_DIR}/${kernelPath}/policies.hpp.in
@@ -77,6 +77,70 @@ inline void displacementUpdate( arrayView2d< real64 const, nodes::VELOCITY_USD >
   } );
 }
 
+/**
+ * @brief Predictor of the explicit time step, updating the velocity and the displacements in a single pass.
+ * @param[inout] acceleration the nodal acceleration, set to zero on exit
+ * @param[inout] velocity the nodal velocity, advanced to the mid-step
+ * @param[out] uhat the incremental displacement of the step
+ * @param[inout] u the total displacement
+ * @param[in] dt the time step
+ *
+ * This is equivalent to velocityUpdate( acceleration, velocity, dt/2 ) followed by
+ * displacementUpdate( velocity, uhat, u, dt ).
+ */
+inline void fusedPredictorUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const & acceleration,
+                                  arrayView2d< real64, nodes::VELOCITY_USD > const & velocity,
+                                  arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat,
+                                  arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u,
+                                  real64 const dt )
+{
+  GEOS_MARK_FUNCTION;
+
+  localIndex const N = velocity.size( 0 );
+  forAll< parallelDevicePolicy<> >( N, [=] GEOS_DEVICE ( localIndex const i )
+  {
+    LvArray::tensorOps::scaledAdd< 3 >( velocity[ i ], acceleration[ i ], 0.5 * dt );
+    LvArray::tensorOps::fill< 3 >( acceleration[ i ], 0 );
+    LvArray::tensorOps::scaledCopy< 3 >( uhat[ i ], velocity[ i ], dt );
+    LvArray::tensorOps::add< 3 >( u[ i ], uhat[ i ] );
+  } );
+}
+
+/**
+ * @brief Update the displacements of the predictor of the explicit time step after the velocity constraints.
+ * @param[in] velocity the constrained nodal velocity
+ * @param[inout] uhat the incremental displacement of the step
+ * @param[inout] u the total displacement
+ * @param[in] dt the time step
+ * @param[in] component the constrained component, or -1 for all of them
+ * @param[in] targetSet the constrained nodes
+ *
+ * The incremental displacement is recomputed from the constrained velocity, so that calling this several
+ * times on the same nodes has no further effect.
+ */
+inline void constrainedDisplacementUpdate( arrayView2d< real64 const, nodes::VELOCITY_USD > const & velocity,
+                                           arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat,
+                                           arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u,
+                                           real64 const dt,
+                                           integer const component,
+                                           SortedArrayView< localIndex const > const & targetSet )
+{
+  GEOS_MARK_FUNCTION;
+
+  integer const firstComponent = component < 0 ? 0 : component;
+  integer const lastComponent = component < 0 ? 3 : component + 1;
+  forAll< parallelDevicePolicy< 1024 > >( targetSet.size(), [=] GEOS_DEVICE ( localIndex const i )
+  {
+    localIndex const a = targetSet[ i ];
+    for( integer c = firstComponent; c < lastComponent; ++c )
+    {
+      real64 const du = velocity( a, c ) * dt;
+      u( a, c ) += du - uhat( a, c );
+      uhat( a, c ) = du;
+    }
+  } );
+}
+
 
 /**
  * @struct Structure to wrap templated function that implements the explicit time integration kernel.
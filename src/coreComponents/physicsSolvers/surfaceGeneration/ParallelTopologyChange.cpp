@@ -26,6 +26,8 @@
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "mesh/mpiCommunications/MPI_iCommData.hpp"
 
+#include <algorithm>
+#include <unordered_set>
 
 namespace geos
 {
@@ -409,38 +411,84 @@ localIndex unpackNewAndModifiedObjectsOnOwningRanks( NeighborCommunicator * cons
 }
 
 
+/**
+ * @brief Interior objects, which are owned by the rank and sent to no neighbor, have a ghost rank
+ *        of -2 (split objects inherit the ghost rank of their parent).
+ * @param ghostRank the ghost rank of the objects
+ * @param index the index of the object
+ * @return true if the object may be in a list of ghosts to send
+ */
+bool mayBeSentAsGhost( arrayView1d< integer const > const & ghostRank,
+                       localIndex const index )
+{
+  return index >= 0 && ghostRank[index] != -2;
+}
+
 void FilterNewObjectsForPackToGhosts( std::set< localIndex > const & objectList,
                                       arrayView1d< localIndex > const & parentIndices,
+                                      arrayView1d< integer const > const & ghostRank,
                                       localIndex_array & ghostsToSend,
                                       localIndex_array & objectsToSend )
 {
+  // The ghosts to send are only scanned if some of the new objects are not interior, so that a
+  // change away from the partition boundary is not charged for the size of the boundary.
+  std::unordered_set< localIndex > candidateParents;
+  for( auto const index : objectList )
+  {
+    if( mayBeSentAsGhost( ghostRank, parentIndices[index] ) )
+    {
+      candidateParents.insert( parentIndices[index] );
+    }
+  }
+  if( candidateParents.empty() )
+  {
+    return;
+  }
 
   ghostsToSend.move( hostMemorySpace );
-  //TODO this needs to be inverted since the ghostToSend list should be much longer....
-  // and the objectList is a searchable set.
+  std::unordered_set< localIndex > sentParents;
+  for( localIndex const index : ghostsToSend )
+  {
+    if( candidateParents.count( index ) > 0 )
+    {
+      sentParents.insert( index );
+    }
+  }
+
   for( auto const index : objectList )
   {
-    localIndex const parentIndex = parentIndices[index];
-    for( localIndex a=0; a<ghostsToSend.size(); ++a )
+    if( sentParents.count( parentIndices[index] ) > 0 )
     {
-      if( ghostsToSend[a]==parentIndex )
-      {
-        objectsToSend.emplace_back( index );
-        ghostsToSend.emplace_back( index );
-        break;
-      }
+      objectsToSend.emplace_back( index );
+      ghostsToSend.emplace_back( index );
+      // a new object may be the parent of a later one
+      sentParents.insert( index );
     }
   }
 }
 
 void FilterModObjectsForPackToGhosts( std::set< localIndex > const & objectList,
+                                      arrayView1d< integer const > const & ghostRank,
                                       localIndex_array const & ghostsToSend,
                                       localIndex_array & objectsToSend )
 {
+  std::unordered_set< localIndex > candidates;
+  for( auto const index : objectList )
+  {
+    if( mayBeSentAsGhost( ghostRank, index ) )
+    {
+      candidates.insert( index );
+    }
+  }
+  if( candidates.empty() )
+  {
+    return;
+  }
+
   ghostsToSend.move( hostMemorySpace );
   for( localIndex a=0; a<ghostsToSend.size(); ++a )
   {
-    if( objectList.count( ghostsToSend[a] ) > 0 )
+    if( candidates.count( ghostsToSend[a] ) > 0 )
     {
       objectsToSend.emplace_back( ghostsToSend[a] );
     }
@@ -477,19 +525,48 @@ void packNewModifiedObjectsToGhosts( NeighborCommunicator * const neighbor,
   arrayView1d< localIndex > const & edgeParentIndices = edgeManager.getField< fields::parentIndex >();
   arrayView1d< localIndex > const & faceParentIndices = faceManager.getField< fields::parentIndex >();
 
-  FilterNewObjectsForPackToGhosts( receivedObjects.newNodes, nodalParentIndices, nodeGhostsToSend, newNodesToSend );
-  FilterModObjectsForPackToGhosts( receivedObjects.modifiedNodes, nodeGhostsToSend, modNodesToSend );
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  arrayView1d< integer const > const edgeGhostRank = edgeManager.ghostRank();
+  arrayView1d< integer const > const faceGhostRank = faceManager.ghostRank();
+
+  FilterNewObjectsForPackToGhosts( receivedObjects.newNodes, nodalParentIndices, nodeGhostRank, nodeGhostsToSend, newNodesToSend );
+  FilterModObjectsForPackToGhosts( receivedObjects.modifiedNodes, nodeGhostRank, nodeGhostsToSend, modNodesToSend );
 
-  FilterNewObjectsForPackToGhosts( receivedObjects.newEdges, edgeParentIndices, edgeGhostsToSend, newEdgesToSend );
-  FilterModObjectsForPackToGhosts( receivedObjects.modifiedEdges, edgeGhostsToSend, modEdgesToSend );
+  FilterNewObjectsForPackToGhosts( receivedObjects.newEdges, edgeParentIndices, edgeGhostRank, edgeGhostsToSend, newEdgesToSend );
+  FilterModObjectsForPackToGhosts( receivedObjects.modifiedEdges, edgeGhostRank, edgeGhostsToSend, modEdgesToSend );
 
-  FilterNewObjectsForPackToGhosts( receivedObjects.newFaces, faceParentIndices, faceGhostsToSend, newFacesToSend );
-  FilterModObjectsForPackToGhosts( receivedObjects.modifiedFaces, faceGhostsToSend, modFacesToSend );
+  FilterNewObjectsForPackToGhosts( receivedObjects.newFaces, faceParentIndices, faceGhostRank, faceGhostsToSend, newFacesToSend );
+  FilterModObjectsForPackToGhosts( receivedObjects.modifiedFaces, faceGhostRank, faceGhostsToSend, modFacesToSend );
 
-  SortedArray< localIndex > faceGhostsToSendSet;
-  for( localIndex const & kf : faceGhostsToSend )
+  // faces of the new face elements that are sent to the neighbor
+  std::unordered_set< localIndex > faceGhostsToSendSet;
   {
-    faceGhostsToSendSet.insert( kf );
+    std::unordered_set< localIndex > candidateFaces;
+    elemManager.forElementSubRegionsComplete< FaceElementSubRegion >( [&]( localIndex const er,
+                                                                           localIndex const esr,
+                                                                           ElementRegionBase const &,
+                                                                           FaceElementSubRegion const & subRegion )
+    {
+      ArrayOfArraysView< localIndex const > const faceList = subRegion.faceList().toViewConst();
+      for( localIndex const & k : receivedObjects.newElements.at( {er, esr} ) )
+      {
+        if( mayBeSentAsGhost( faceGhostRank, faceList( k, 0 ) ) )
+        {
+          candidateFaces.insert( faceList( k, 0 ) );
+        }
+      }
+    } );
+
+    if( !candidateFaces.empty() )
+    {
+      for( localIndex const & kf : faceGhostsToSend )
+      {
+        if( candidateFaces.count( kf ) > 0 )
+        {
+          faceGhostsToSendSet.insert( kf );
+        }
+      }
+    }
   }
 
   newElemsToSendData.resize( elemManager.numRegions() );
@@ -525,10 +602,19 @@ void packNewModifiedObjectsToGhosts( NeighborCommunicator * const neighbor,
                                                                        ElementSubRegionBase const & subRegion )
     {
       modElemsToSend[er][esr].set( modElemsToSendData[er][esr] );
+
+      arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+      std::set< localIndex > const & modifiedElems = receivedObjects.modifiedElements.at( { er, esr } );
+      if( std::none_of( modifiedElems.begin(), modifiedElems.end(),
+                        [&]( localIndex const k ) { return mayBeSentAsGhost( elemGhostRank, k ); } ) )
+      {
+        return;
+      }
+
       arrayView1d< localIndex const > const & elemGhostsToSend = subRegion.getNeighborData( neighbor->neighborRank() ).ghostsToSend();
       for( localIndex const ghostToSend : elemGhostsToSend )
       {
-        if( receivedObjects.modifiedElements.at( { er, esr } ).count( ghostToSend ) > 0 )
+        if( modifiedElems.count( ghostToSend ) > 0 )
         {
           modElemsToSendData[er][esr].emplace_back( ghostToSend );
         }
@@ -800,6 +886,24 @@ void parallelTopologyChange::synchronizeTopologyChange( MeshLevel * const mesh,
                                                         ModifiedObjectLists & receivedObjects,
                                                         int mpiCommOrder )
 {
+  GEOS_MARK_FUNCTION;
+
+  // The neighbors only need to be contacted if a rank has modified its topology
+  localIndex numLocalChanges = modifiedObjects.newNodes.size() + modifiedObjects.modifiedNodes.size() +
+                               modifiedObjects.newEdges.size() + modifiedObjects.modifiedEdges.size() +
+                               modifiedObjects.newFaces.size() + modifiedObjects.modifiedFaces.size();
+  for( auto const & iter : modifiedObjects.newElements )
+  {
+    numLocalChanges += iter.second.size();
+  }
+  for( auto const & iter : modifiedObjects.modifiedElements )
+  {
+    numLocalChanges += iter.second.size();
+  }
+  if( MpiWrapper::max( numLocalChanges ) == 0 )
+  {
+    return;
+  }
 
   NodeManager & nodeManager = mesh->getNodeManager();
   EdgeManager & edgeManager = mesh->getEdgeManager();
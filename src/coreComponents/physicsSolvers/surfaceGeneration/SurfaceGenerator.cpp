@@ -180,7 +180,8 @@ SurfaceGenerator::SurfaceGenerator( const string & name,
   m_nodeBasedSIF( 1 ),
   m_isPoroelastic( 0 ),
   m_rockToughness( 1.0e99 ),
-  m_mpiCommOrder( 0 )
+  m_mpiCommOrder( 0 ),
+  m_parallelPlaneSearch( 0 )
 {
   this->registerWrapper( viewKeyStruct::failCriterionString(), &this->m_failCriterion );
 
@@ -201,6 +202,13 @@ SurfaceGenerator::SurfaceGenerator( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Flag to enable MPI consistent communication ordering" );
 
+  registerWrapper( viewKeyStruct::parallelPlaneSearchString(), &m_parallelPlaneSearch ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to search the fracture planes of all the candidate nodes concurrently. "
+                    "The nodes are then split one after the other, in batches of nodes that do not share any element. "
+                    "The resulting topology is the same, but the new nodes, edges and faces may be numbered differently" );
+
   registerWrapper( viewKeyStruct::fractureRegionNameString(), &m_fractureRegionName ).
     setRTTypeName( rtTypes::CustomTypes::groupNameRef ).
     setInputFlag( dataRepository::InputFlags::OPTIONAL ).
@@ -237,6 +245,10 @@ void SurfaceGenerator::postInputInitialization()
   GEOS_ERROR_IF( binaryOptions.count( m_mpiCommOrder ) == 0,
                  getWrapperDataContext( viewKeyStruct::mpiCommOrderString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
+
+  GEOS_ERROR_IF( binaryOptions.count( m_parallelPlaneSearch ) == 0,
+                 getWrapperDataContext( viewKeyStruct::parallelPlaneSearchString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
 }
 
 SurfaceGenerator::~SurfaceGenerator()
@@ -637,7 +649,18 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
   for( int color=0; color<numTileColors; ++color )
   {
     ModifiedObjectLists modifiedObjects;
-    if( color==tileColor )
+    if( color==tileColor && m_parallelPlaneSearch )
+    {
+      rval += separateNodesWithParallelPlaneSearch( time_np1,
+                                                    nodeManager,
+                                                    edgeManager,
+                                                    faceManager,
+                                                    elementManager,
+                                                    nodesToRupturedFaces,
+                                                    edgesToRupturedFaces,
+                                                    modifiedObjects );
+    }
+    else if( color==tileColor )
     {
       for( localIndex a=0; a<nodeManager.size(); ++a )
       {
@@ -979,6 +1002,157 @@ bool SurfaceGenerator::processNode( const localIndex nodeID,
   return didSplit;
 }
 
+//**********************************************************************************************************************
+//**********************************************************************************************************************
+//**********************************************************************************************************************
+int SurfaceGenerator::separateNodesWithParallelPlaneSearch( real64 const time_np1,
+                                                            NodeManager & nodeManager,
+                                                            EdgeManager & edgeManager,
+                                                            FaceManager & faceManager,
+                                                            ElementRegionManager & elementManager,
+                                                            std::vector< std::set< localIndex > > & nodesToRupturedFaces,
+                                                            std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                                            ModifiedObjectLists & modifiedObjects )
+{
+  GEOS_MARK_FUNCTION;
+
+  // separation path of a candidate node, as found by findFracturePlanes
+  struct SeparationPath
+  {
+    std::set< localIndex > faces;
+    map< localIndex, int > edgeLocations;
+    map< localIndex, int > faceLocations;
+    map< std::pair< CellElementSubRegion const *, localIndex >, int > elemLocations;
+  };
+
+  // The maps are accessed through the managers, since they are reallocated by the splits
+  auto isCandidateNode = [&]( localIndex const a )
+  {
+    return nodeManager.ghostRank()[a] < 0 && nodeManager.elementList().sizeOfArray( a ) > 1;
+  };
+
+  auto forNodesOfElements = [&]( localIndex const a, auto && lambda )
+  {
+    ArrayOfArrays< localIndex > const & nodeToRegionMap = nodeManager.elementRegionList();
+    ArrayOfArrays< localIndex > const & nodeToSubRegionMap = nodeManager.elementSubRegionList();
+    ArrayOfArrays< localIndex > const & nodeToElementMap = nodeManager.elementList();
+    for( localIndex k = 0; k < nodeToElementMap.sizeOfArray( a ); ++k )
+    {
+      CellElementSubRegion const & subRegion =
+        elementManager.getRegion( nodeToRegionMap( a, k ) ).getSubRegion< CellElementSubRegion >( nodeToSubRegionMap( a, k ) );
+      CellElementSubRegion::NodeMapType const & elemToNodes = subRegion.nodeList();
+      localIndex const ei = nodeToElementMap( a, k );
+      for( localIndex b = 0; b < elemToNodes.size( 1 ); ++b )
+      {
+        lambda( elemToNodes( ei, b ) );
+      }
+    }
+  };
+
+  int numSplits = 0;
+
+  array1d< localIndex > candidates;
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    if( isCandidateNode( a ) )
+    {
+      candidates.emplace_back( a );
+    }
+  }
+
+  while( !candidates.empty() )
+  {
+    localIndex const numCandidates = candidates.size();
+
+    // The search only reads the mesh, so all the candidates are processed concurrently
+    std::vector< SeparationPath > paths( numCandidates );
+    array1d< integer > hasPath( numCandidates );
+    forAll< parallelHostPolicy >( numCandidates, [&] ( localIndex const i )
+    {
+      SeparationPath & path = paths[i];
+      hasPath[i] = findFracturePlanes( candidates[i],
+                                       nodeManager,
+                                       edgeManager,
+                                       faceManager,
+                                       elementManager,
+                                       nodesToRupturedFaces,
+                                       edgesToRupturedFaces,
+                                       path.faces,
+                                       path.edgeLocations,
+                                       path.faceLocations,
+                                       path.elemLocations );
+    } );
+
+    // Greedy selection, by increasing index, of the nodes that do not share an element with an
+    // already selected node. The split of a node only modifies its elements and their faces and
+    // edges, so that the paths of the other selected nodes remain valid.
+    array1d< integer > isNodeBlocked( nodeManager.size() );
+    array1d< localIndex > batch;
+    array1d< localIndex > nextCandidates;
+    for( localIndex i = 0; i < numCandidates; ++i )
+    {
+      localIndex const a = candidates[i];
+      if( hasPath[i] == 0 )
+      {
+        continue;
+      }
+      if( isNodeBlocked[a] )
+      {
+        nextCandidates.emplace_back( a );
+        continue;
+      }
+      batch.emplace_back( i );
+      forNodesOfElements( a, [&]( localIndex const b ) { isNodeBlocked[b] = 1; } );
+    }
+
+    localIndex const numNodesBeforeSplit = nodeManager.size();
+    for( localIndex const i : batch )
+    {
+      localIndex const a = candidates[i];
+      SeparationPath const & path = paths[i];
+
+      // the node may be split again along another path, and the paths of its neighbors may have changed
+      nextCandidates.emplace_back( a );
+      forNodesOfElements( a, [&]( localIndex const b ) { nextCandidates.emplace_back( b ); } );
+
+      mapConsistencyCheck( a, nodeManager, edgeManager, faceManager, elementManager, path.elemLocations );
+      performFracture( a,
+                       time_np1,
+                       nodeManager,
+                       edgeManager,
+                       faceManager,
+                       elementManager,
+                       modifiedObjects,
+                       nodesToRupturedFaces,
+                       edgesToRupturedFaces,
+                       path.faces,
+                       path.edgeLocations,
+                       path.faceLocations,
+                       path.elemLocations );
+      mapConsistencyCheck( a, nodeManager, edgeManager, faceManager, elementManager, path.elemLocations );
+      ++numSplits;
+    }
+
+    for( localIndex a = numNodesBeforeSplit; a < nodeManager.size(); ++a )
+    {
+      nextCandidates.emplace_back( a );
+    }
+
+    std::sort( nextCandidates.begin(), nextCandidates.end() );
+    localIndex const numUnique = std::unique( nextCandidates.begin(), nextCandidates.end() ) - nextCandidates.begin();
+    candidates.clear();
+    for( localIndex k = 0; k < numUnique; ++k )
+    {
+      if( isCandidateNode( nextCandidates[k] ) )
+      {
+        candidates.emplace_back( nextCandidates[k] );
+      }
+    }
+  }
+
+  return numSplits;
+}
+
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
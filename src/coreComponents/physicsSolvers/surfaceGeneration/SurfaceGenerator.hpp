@@ -324,6 +324,34 @@ private:
                     ModifiedObjectLists & modifiedObjects,
                     const bool prefrac );
 
+  /**
+   * @brief Split all the locally owned nodes that have a fracture path, with a parallel search of the fracture planes.
+   * @param time_np1 the time at the end of the step
+   * @param nodeManager
+   * @param edgeManager
+   * @param faceManager
+   * @param elementManager
+   * @param nodesToRupturedFaces
+   * @param edgesToRupturedFaces
+   * @param modifiedObjects the lists of the objects created or modified by the splits
+   * @return the number of splits
+   *
+   * Only the search of the fracture planes is concurrent: the splits append nodes, edges and faces
+   * to the managers and are performed one after the other. In each round, the planes of all the
+   * candidate nodes are searched, and the nodes that do not share any element are then split, by
+   * increasing index. The nodes sharing an element with a split node are searched again in the
+   * next round, until no plane is found. The splits follow another order than in separateNodes,
+   * so that the new nodes, edges and faces may be numbered differently.
+   */
+  int separateNodesWithParallelPlaneSearch( real64 const time_np1,
+                                            NodeManager & nodeManager,
+                                            EdgeManager & edgeManager,
+                                            FaceManager & faceManager,
+                                            ElementRegionManager & elementManager,
+                                            std::vector< std::set< localIndex > > & nodesToRupturedFaces,
+                                            std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                            ModifiedObjectLists & modifiedObjects );
+
   /**
    * @brief Find a fracture path for surface generation
    * @param nodeID
@@ -518,6 +546,7 @@ private:
     constexpr static char const * fractureRegionNameString() { return "fractureRegion"; }
     constexpr static char const * mpiCommOrderString() { return "mpiCommOrder"; }
     constexpr static char const * isPoroelasticString() {return "isPoroelastic";}
+    constexpr static char const * parallelPlaneSearchString() { return "parallelPlaneSearch"; }
 
     //TODO: rock toughness should be a material parameter, and we need to make rock toughness to KIC a constitutive
     // relation.
@@ -546,6 +575,9 @@ private:
   // Flag for consistent communication ordering
   int m_mpiCommOrder;
 
+  // Flag to search the fracture planes of the candidate nodes concurrently
+  int m_parallelPlaneSearch;
+
   /// set of separable faces
   SortedArray< localIndex > m_separableFaceSet;
 
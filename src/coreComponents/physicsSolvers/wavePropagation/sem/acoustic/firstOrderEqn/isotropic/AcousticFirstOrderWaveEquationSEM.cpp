@@ -22,6 +22,7 @@
 #include "AcousticFirstOrderWaveEquationSEMKernel.hpp"
 
 
+#include "dataRepository/WrapperHandle.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
@@ -127,9 +128,9 @@ void AcousticFirstOrderWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
 
         constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
 
-        subRegion.getField< acousticfields::Velocity_x >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< acousticfields::Velocity_y >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< acousticfields::Velocity_z >().resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< acousticfields::Velocity_x >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< acousticfields::Velocity_y >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< acousticfields::Velocity_z >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
 
       } );
 
@@ -287,29 +288,29 @@ void AcousticFirstOrderWaveEquationSEM::initializePostInitialConditionsPreSubGro
 
     /// get the array of indicators: 1 if the face is on the boundary; 0 otherwise
     arrayView1d< integer const > const & facesDomainBoundaryIndicator = faceManager.getDomainBoundaryIndicator();
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     /// get table containing face to nodes map
     ArrayOfArraysView< localIndex const > const facesToNodes = faceManager.nodeList().toViewConst();
 
     // mass matrix to be computed in this function
-    arrayView1d< real32 > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
+    arrayView1d< real32 > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
 
     /// damping matrix to be computed for each dof in the boundary of the mesh
-    arrayView1d< real32 > const damping = nodeManager.getField< acousticfields::DampingVector >();
+    arrayView1d< real32 > const damping = getCachedField< acousticfields::DampingVector >( nodeManager );
     damping.zero();
     mass.zero();
 
     /// get array of indicators: 1 if face is on the free surface; 0 otherwise
-    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = faceManager.getField< acousticfields::AcousticFreeSurfaceFaceIndicator >();
+    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = getCachedField< acousticfields::AcousticFreeSurfaceFaceIndicator >( faceManager );
 
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                           CellElementSubRegion & elementSubRegion )
     {
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
       arrayView2d< localIndex const > const elemsToFaces = elementSubRegion.faceList();
-      arrayView1d< real32 const > const velocity = elementSubRegion.getField< acousticfields::AcousticVelocity >();
-      arrayView1d< real32 const > const density = elementSubRegion.getField< acousticfields::AcousticDensity >();
+      arrayView1d< real32 const > const velocity = getCachedField< acousticfields::AcousticVelocity >( elementSubRegion );
+      arrayView1d< real32 const > const density = getCachedField< acousticfields::AcousticDensity >( elementSubRegion );
 
       finiteElement::FiniteElementBase const &
       fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
@@ -353,15 +354,15 @@ void AcousticFirstOrderWaveEquationSEM::applyFreeSurfaceBC( real64 const time, D
   FaceManager & faceManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getFaceManager();
   NodeManager & nodeManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getNodeManager();
 
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+  arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// array of indicators: 1 if a face is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceFaceIndicator = faceManager.getField< acousticfields::AcousticFreeSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const freeSurfaceFaceIndicator = getCachedField< acousticfields::AcousticFreeSurfaceFaceIndicator >( faceManager );
 
   /// array of indicators: 1 if a node is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const freeSurfaceNodeIndicator = getCachedField< acousticfields::AcousticFreeSurfaceNodeIndicator >( nodeManager );
 
 
   freeSurfaceFaceIndicator.zero();
@@ -453,23 +454,23 @@ real64 AcousticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & t
   {
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
-    arrayView1d< real32 const > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
-    arrayView1d< real32 const > const damping = nodeManager.getField< acousticfields::DampingVector >();
+    arrayView1d< real32 const > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
+    arrayView1d< real32 const > const damping = getCachedField< acousticfields::DampingVector >( nodeManager );
 
-    arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+    arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
-    arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
+    arrayView1d< real32 > const rhs = getCachedField< acousticfields::ForcingRHS >( nodeManager );
 
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
                                                                                           CellElementSubRegion & elementSubRegion )
     {
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = elementSubRegion.nodeList();
-      arrayView1d< real32 const > const density = elementSubRegion.getField< acousticfields::AcousticDensity >();
-      arrayView2d< real32 > const velocity_x = elementSubRegion.getField< acousticfields::Velocity_x >();
-      arrayView2d< real32 > const velocity_y = elementSubRegion.getField< acousticfields::Velocity_y >();
-      arrayView2d< real32 > const velocity_z = elementSubRegion.getField< acousticfields::Velocity_z >();
+      arrayView1d< real32 const > const density = getCachedField< acousticfields::AcousticDensity >( elementSubRegion );
+      arrayView2d< real32 > const velocity_x = getCachedField< acousticfields::Velocity_x >( elementSubRegion );
+      arrayView2d< real32 > const velocity_y = getCachedField< acousticfields::Velocity_y >( elementSubRegion );
+      arrayView2d< real32 > const velocity_z = getCachedField< acousticfields::Velocity_z >( elementSubRegion );
       finiteElement::FiniteElementBase const &
       fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
       finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
@@ -554,13 +555,13 @@ void AcousticFirstOrderWaveEquationSEM::cleanup( real64 const time_n, integer co
                                                                 arrayView1d< string const > const & regionNames )
   {
     NodeManager & nodeManager = mesh.getNodeManager();
-    arrayView1d< real32 const > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+    arrayView1d< real32 const > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
                                                                                           CellElementSubRegion & elementSubRegion )
     {
-      arrayView2d< real32 > const velocity_x = elementSubRegion.getField< acousticfields::Velocity_x >();
-      arrayView2d< real32 > const velocity_y = elementSubRegion.getField< acousticfields::Velocity_y >();
-      arrayView2d< real32 > const velocity_z = elementSubRegion.getField< acousticfields::Velocity_z >();
+      arrayView2d< real32 > const velocity_x = getCachedField< acousticfields::Velocity_x >( elementSubRegion );
+      arrayView2d< real32 > const velocity_y = getCachedField< acousticfields::Velocity_y >( elementSubRegion );
+      arrayView2d< real32 > const velocity_z = getCachedField< acousticfields::Velocity_z >( elementSubRegion );
 
       arrayView2d< real32 > const uxReceivers = m_uxNp1AtReceivers.toView();
       arrayView2d< real32 > const uyReceivers = m_uyNp1AtReceivers.toView();
@@ -21,6 +21,7 @@
 #include "AcousticVTIWaveEquationSEM.hpp"
 #include "AcousticVTIWaveEquationSEMKernel.hpp"
 
+#include "dataRepository/WrapperHandle.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/PerfectlyMatchedLayer.hpp"
@@ -261,28 +262,28 @@ void AcousticVTIWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
     /// get the array of indicators: 1 if the face is on the boundary; 0 otherwise
     arrayView1d< integer > const & facesDomainBoundaryIndicator = faceManager.getDomainBoundaryIndicator();
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     /// get face to node map
     ArrayOfArraysView< localIndex const > const facesToNodes = faceManager.nodeList().toViewConst();
 
     // mass matrix to be computed in this function
-    arrayView1d< real32 > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
+    arrayView1d< real32 > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
     mass.zero();
     /// damping matrices to be computed for each dof in the boundary of the mesh
-    arrayView1d< real32 > const damping_p  = nodeManager.getField< acousticvtifields::DampingVector_p >();
-    arrayView1d< real32 > const damping_pq = nodeManager.getField< acousticvtifields::DampingVector_pq >();
-    arrayView1d< real32 > const damping_q  = nodeManager.getField< acousticvtifields::DampingVector_q >();
-    arrayView1d< real32 > const damping_qp = nodeManager.getField< acousticvtifields::DampingVector_qp >();
+    arrayView1d< real32 > const damping_p  = getCachedField< acousticvtifields::DampingVector_p >( nodeManager );
+    arrayView1d< real32 > const damping_pq = getCachedField< acousticvtifields::DampingVector_pq >( nodeManager );
+    arrayView1d< real32 > const damping_q  = getCachedField< acousticvtifields::DampingVector_q >( nodeManager );
+    arrayView1d< real32 > const damping_qp = getCachedField< acousticvtifields::DampingVector_qp >( nodeManager );
     damping_p.zero();
     damping_pq.zero();
     damping_q.zero();
     damping_qp.zero();
 
     /// get array of indicators: 1 if face is on the free surface; 0 otherwise
-    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = faceManager.getField< acousticfields::AcousticFreeSurfaceFaceIndicator >();
-    arrayView1d< localIndex const > const lateralSurfaceFaceIndicator = faceManager.getField< acousticvtifields::LateralSurfaceFaceIndicator >();
-    arrayView1d< localIndex const > const bottomSurfaceFaceIndicator = faceManager.getField< acousticvtifields::BottomSurfaceFaceIndicator >();
+    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = getCachedField< acousticfields::AcousticFreeSurfaceFaceIndicator >( faceManager );
+    arrayView1d< localIndex const > const lateralSurfaceFaceIndicator = getCachedField< acousticvtifields::LateralSurfaceFaceIndicator >( faceManager );
+    arrayView1d< localIndex const > const bottomSurfaceFaceIndicator = getCachedField< acousticvtifields::BottomSurfaceFaceIndicator >( faceManager );
 
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                           CellElementSubRegion & elementSubRegion )
@@ -290,10 +291,10 @@ void AcousticVTIWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
       arrayView2d< localIndex const > const elemsToFaces = elementSubRegion.faceList();
-      arrayView1d< real32 const > const velocity = elementSubRegion.getField< acousticfields::AcousticVelocity >();
-      arrayView1d< real32 const > const epsilon  = elementSubRegion.getField< acousticvtifields::Epsilon >();
-      arrayView1d< real32 const > const delta    = elementSubRegion.getField< acousticvtifields::Delta >();
-      arrayView1d< real32 const > const vti_f    = elementSubRegion.getField< acousticvtifields::F >();
+      arrayView1d< real32 const > const velocity = getCachedField< acousticfields::AcousticVelocity >( elementSubRegion );
+      arrayView1d< real32 const > const epsilon  = getCachedField< acousticvtifields::Epsilon >( elementSubRegion );
+      arrayView1d< real32 const > const delta    = getCachedField< acousticvtifields::Delta >( elementSubRegion );
+      arrayView1d< real32 const > const vti_f    = getCachedField< acousticvtifields::F >( elementSubRegion );
 
       finiteElement::FiniteElementBase const &
       fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
@@ -346,14 +347,14 @@ void AcousticVTIWaveEquationSEM::precomputeSurfaceFieldIndicator( DomainPartitio
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// array of indicators: 1 if a face is on on lateral surface; 0 otherwise
-  arrayView1d< localIndex > const lateralSurfaceFaceIndicator = faceManager.getField< acousticvtifields::LateralSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const lateralSurfaceFaceIndicator = getCachedField< acousticvtifields::LateralSurfaceFaceIndicator >( faceManager );
   /// array of indicators: 1 if a node is on on lateral surface; 0 otherwise
-  arrayView1d< localIndex > const lateralSurfaceNodeIndicator = nodeManager.getField< acousticvtifields::LateralSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const lateralSurfaceNodeIndicator = getCachedField< acousticvtifields::LateralSurfaceNodeIndicator >( nodeManager );
 
   /// array of indicators: 1 if a face is on on bottom surface; 0 otherwise
-  arrayView1d< localIndex > const bottomSurfaceFaceIndicator = faceManager.getField< acousticvtifields::BottomSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const bottomSurfaceFaceIndicator = getCachedField< acousticvtifields::BottomSurfaceFaceIndicator >( faceManager );
   /// array of indicators: 1 if a node is on on bottom surface; 0 otherwise
-  arrayView1d< localIndex > const bottomSurfaceNodeIndicator = nodeManager.getField< acousticvtifields::BottomSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const bottomSurfaceNodeIndicator = getCachedField< acousticvtifields::BottomSurfaceNodeIndicator >( nodeManager );
 
   // Lateral surfaces
   fsManager.apply< FaceManager >( time,
@@ -430,21 +431,21 @@ void AcousticVTIWaveEquationSEM::applyFreeSurfaceBC( real64 time, DomainPartitio
   FaceManager & faceManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getFaceManager();
   NodeManager & nodeManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getNodeManager();
 
-  arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticvtifields::Pressure_p_nm1 >();
-  arrayView1d< real32 > const p_n = nodeManager.getField< acousticvtifields::Pressure_p_n >();
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticvtifields::Pressure_p_np1 >();
+  arrayView1d< real32 > const p_nm1 = getCachedField< acousticvtifields::Pressure_p_nm1 >( nodeManager );
+  arrayView1d< real32 > const p_n = getCachedField< acousticvtifields::Pressure_p_n >( nodeManager );
+  arrayView1d< real32 > const p_np1 = getCachedField< acousticvtifields::Pressure_p_np1 >( nodeManager );
 
-  arrayView1d< real32 > const q_nm1 = nodeManager.getField< acousticvtifields::Pressure_q_nm1 >();
-  arrayView1d< real32 > const q_n = nodeManager.getField< acousticvtifields::Pressure_q_n >();
-  arrayView1d< real32 > const q_np1 = nodeManager.getField< acousticvtifields::Pressure_q_np1 >();
+  arrayView1d< real32 > const q_nm1 = getCachedField< acousticvtifields::Pressure_q_nm1 >( nodeManager );
+  arrayView1d< real32 > const q_n = getCachedField< acousticvtifields::Pressure_q_n >( nodeManager );
+  arrayView1d< real32 > const q_np1 = getCachedField< acousticvtifields::Pressure_q_np1 >( nodeManager );
 
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// array of indicators: 1 if a face is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceFaceIndicator = faceManager.getField< acousticfields::AcousticFreeSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const freeSurfaceFaceIndicator = getCachedField< acousticfields::AcousticFreeSurfaceFaceIndicator >( faceManager );
 
   /// array of indicators: 1 if a node is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const freeSurfaceNodeIndicator = getCachedField< acousticfields::AcousticFreeSurfaceNodeIndicator >( nodeManager );
 
   fsManager.apply< FaceManager >( time,
                                   domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ),
@@ -504,13 +505,13 @@ real64 AcousticVTIWaveEquationSEM::explicitStepForward( real64 const & time_n,
   {
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticvtifields::Pressure_p_nm1 >();
-    arrayView1d< real32 > const p_n = nodeManager.getField< acousticvtifields::Pressure_p_n >();
-    arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticvtifields::Pressure_p_np1 >();
+    arrayView1d< real32 > const p_nm1 = getCachedField< acousticvtifields::Pressure_p_nm1 >( nodeManager );
+    arrayView1d< real32 > const p_n = getCachedField< acousticvtifields::Pressure_p_n >( nodeManager );
+    arrayView1d< real32 > const p_np1 = getCachedField< acousticvtifields::Pressure_p_np1 >( nodeManager );
 
-    arrayView1d< real32 > const q_nm1 = nodeManager.getField< acousticvtifields::Pressure_q_nm1 >();
-    arrayView1d< real32 > const q_n = nodeManager.getField< acousticvtifields::Pressure_q_n >();
-    arrayView1d< real32 > const q_np1 = nodeManager.getField< acousticvtifields::Pressure_q_np1 >();
+    arrayView1d< real32 > const q_nm1 = getCachedField< acousticvtifields::Pressure_q_nm1 >( nodeManager );
+    arrayView1d< real32 > const q_n = getCachedField< acousticvtifields::Pressure_q_n >( nodeManager );
+    arrayView1d< real32 > const q_np1 = getCachedField< acousticvtifields::Pressure_q_np1 >( nodeManager );
 
     if( computeGradient )
     {
@@ -570,26 +571,26 @@ real64 AcousticVTIWaveEquationSEM::explicitStepInternal( real64 const & time_n,
   {
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView1d< real32 const > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
-    arrayView1d< real32 const > const damping_p = nodeManager.getField< acousticvtifields::DampingVector_p >();
-    arrayView1d< real32 const > const damping_q = nodeManager.getField< acousticvtifields::DampingVector_q >();
-    arrayView1d< real32 const > const damping_pq = nodeManager.getField< acousticvtifields::DampingVector_pq >();
-    arrayView1d< real32 const > const damping_qp = nodeManager.getField< acousticvtifields::DampingVector_qp >();
+    arrayView1d< real32 const > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
+    arrayView1d< real32 const > const damping_p = getCachedField< acousticvtifields::DampingVector_p >( nodeManager );
+    arrayView1d< real32 const > const damping_q = getCachedField< acousticvtifields::DampingVector_q >( nodeManager );
+    arrayView1d< real32 const > const damping_pq = getCachedField< acousticvtifields::DampingVector_pq >( nodeManager );
+    arrayView1d< real32 const > const damping_qp = getCachedField< acousticvtifields::DampingVector_qp >( nodeManager );
 
-    arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticvtifields::Pressure_p_nm1 >();
-    arrayView1d< real32 > const p_n = nodeManager.getField< acousticvtifields::Pressure_p_n >();
-    arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticvtifields::Pressure_p_np1 >();
+    arrayView1d< real32 > const p_nm1 = getCachedField< acousticvtifields::Pressure_p_nm1 >( nodeManager );
+    arrayView1d< real32 > const p_n = getCachedField< acousticvtifields::Pressure_p_n >( nodeManager );
+    arrayView1d< real32 > const p_np1 = getCachedField< acousticvtifields::Pressure_p_np1 >( nodeManager );
 
-    arrayView1d< real32 > const q_nm1 = nodeManager.getField< acousticvtifields::Pressure_q_nm1 >();
-    arrayView1d< real32 > const q_n = nodeManager.getField< acousticvtifields::Pressure_q_n >();
-    arrayView1d< real32 > const q_np1 = nodeManager.getField< acousticvtifields::Pressure_q_np1 >();
+    arrayView1d< real32 > const q_nm1 = getCachedField< acousticvtifields::Pressure_q_nm1 >( nodeManager );
+    arrayView1d< real32 > const q_n = getCachedField< acousticvtifields::Pressure_q_n >( nodeManager );
+    arrayView1d< real32 > const q_np1 = getCachedField< acousticvtifields::Pressure_q_np1 >( nodeManager );
 
-    arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
-    arrayView1d< localIndex const > const lateralSurfaceNodeIndicator = nodeManager.getField< acousticvtifields::LateralSurfaceNodeIndicator >();
-    arrayView1d< localIndex const > const bottomSurfaceNodeIndicator = nodeManager.getField< acousticvtifields::BottomSurfaceNodeIndicator >();
-    arrayView1d< real32 > const stiffnessVector_p = nodeManager.getField< acousticvtifields::StiffnessVector_p >();
-    arrayView1d< real32 > const stiffnessVector_q = nodeManager.getField< acousticvtifields::StiffnessVector_q >();
-    arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
+    arrayView1d< localIndex const > const freeSurfaceNodeIndicator = getCachedField< acousticfields::AcousticFreeSurfaceNodeIndicator >( nodeManager );
+    arrayView1d< localIndex const > const lateralSurfaceNodeIndicator = getCachedField< acousticvtifields::LateralSurfaceNodeIndicator >( nodeManager );
+    arrayView1d< localIndex const > const bottomSurfaceNodeIndicator = getCachedField< acousticvtifields::BottomSurfaceNodeIndicator >( nodeManager );
+    arrayView1d< real32 > const stiffnessVector_p = getCachedField< acousticvtifields::StiffnessVector_p >( nodeManager );
+    arrayView1d< real32 > const stiffnessVector_q = getCachedField< acousticvtifields::StiffnessVector_q >( nodeManager );
+    arrayView1d< real32 > const rhs = getCachedField< acousticfields::ForcingRHS >( nodeManager );
 
     auto kernelFactory = acousticVTIWaveEquationSEMKernels::ExplicitAcousticVTISEMFactory( dt );
 
@@ -658,8 +659,8 @@ void AcousticVTIWaveEquationSEM::cleanup( real64 const time_n,
                                                                 arrayView1d< string const > const & )
   {
     NodeManager & nodeManager = mesh.getNodeManager();
-    arrayView1d< real32 const > const p_n   = nodeManager.getField< acousticvtifields::Pressure_p_n >();
-    arrayView1d< real32 const > const p_np1 = nodeManager.getField< acousticvtifields::Pressure_p_np1 >();
+    arrayView1d< real32 const > const p_n   = getCachedField< acousticvtifields::Pressure_p_n >( nodeManager );
+    arrayView1d< real32 const > const p_np1 = getCachedField< acousticvtifields::Pressure_p_np1 >( nodeManager );
     arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
     computeAllSeismoTraces( time_n, 0.0, p_np1, p_n, pReceivers );
 
@@ -21,6 +21,7 @@
 #include "AcousticWaveEquationSEM.hpp"
 #include "AcousticWaveEquationSEMKernel.hpp"
 
+#include "dataRepository/WrapperHandle.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/PerfectlyMatchedLayer.hpp"
@@ -92,8 +93,8 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
                                  acousticfields::AuxiliaryVar3PML,
                                  acousticfields::AuxiliaryVar4PML >( getName() );
 
-      nodeManager.getField< acousticfields::AuxiliaryVar1PML >().resizeDimension< 1 >( 3 );
-      nodeManager.getField< acousticfields::AuxiliaryVar2PML >().resizeDimension< 1 >( 3 );
+      getCachedField< acousticfields::AuxiliaryVar1PML >( nodeManager ).resizeDimension< 1 >( 3 );
+      getCachedField< acousticfields::AuxiliaryVar2PML >( nodeManager ).resizeDimension< 1 >( 3 );
     }
 
     FaceManager & faceManager = mesh.getFaceManager();
@@ -281,21 +282,21 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
     /// get the array of indicators: 1 if the face is on the boundary; 0 otherwise
     arrayView1d< integer const > const & facesDomainBoundaryIndicator = faceManager.getDomainBoundaryIndicator();
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     /// get face to node map
     ArrayOfArraysView< localIndex const > const facesToNodes = faceManager.nodeList().toViewConst();
 
     // mass matrix to be computed in this function
-    arrayView1d< real32 > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
+    arrayView1d< real32 > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
     mass.zero();
 
     /// damping matrix to be computed for each dof in the boundary of the mesh
-    arrayView1d< real32 > const damping = nodeManager.getField< acousticfields::DampingVector >();
+    arrayView1d< real32 > const damping = getCachedField< acousticfields::DampingVector >( nodeManager );
     damping.zero();
 
     /// get array of indicators: 1 if face is on the free surface; 0 otherwise
-    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = faceManager.getField< acousticfields::AcousticFreeSurfaceFaceIndicator >();
+    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = getCachedField< acousticfields::AcousticFreeSurfaceFaceIndicator >( faceManager );
 
     elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                 CellElementSubRegion & elementSubRegion )
@@ -308,11 +309,11 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
       computeTargetNodeSet( elemsToNodes, elementSubRegion.size(), fe.getNumQuadraturePoints() );
 
-      arrayView1d< real32 const > const velocity = elementSubRegion.getField< acousticfields::AcousticVelocity >();
-      arrayView1d< real32 const > const density = elementSubRegion.getField< acousticfields::AcousticDensity >();
+      arrayView1d< real32 const > const velocity = getCachedField< acousticfields::AcousticVelocity >( elementSubRegion );
+      arrayView1d< real32 const > const density = getCachedField< acousticfields::AcousticDensity >( elementSubRegion );
 
       /// Partial gradient if gradient as to be computed
-      arrayView1d< real32 > grad = elementSubRegion.getField< acousticfields::PartialGradient >();
+      arrayView1d< real32 > grad = getCachedField< acousticfields::PartialGradient >( elementSubRegion );
       grad.zero();
 
       finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
@@ -356,17 +357,17 @@ void AcousticWaveEquationSEM::applyFreeSurfaceBC( real64 time, DomainPartition &
   FaceManager & faceManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getFaceManager();
   NodeManager & nodeManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getNodeManager();
 
-  arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticfields::Pressure_nm1 >();
-  arrayView1d< real32 > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+  arrayView1d< real32 > const p_nm1 = getCachedField< acousticfields::Pressure_nm1 >( nodeManager );
+  arrayView1d< real32 > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+  arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// array of indicators: 1 if a face is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceFaceIndicator = faceManager.getField< acousticfields::AcousticFreeSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const freeSurfaceFaceIndicator = getCachedField< acousticfields::AcousticFreeSurfaceFaceIndicator >( faceManager );
 
   /// array of indicators: 1 if a node is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const freeSurfaceNodeIndicator = getCachedField< acousticfields::AcousticFreeSurfaceNodeIndicator >( nodeManager );
 
   fsManager.apply< FaceManager >( time,
                                   domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ),
@@ -448,8 +449,8 @@ void AcousticWaveEquationSEM::initializePML()
 
     NodeManager & nodeManager = mesh.getNodeManager();
     /// WARNING: the array below is one of the PML auxiliary variables
-    arrayView1d< real32 > const indicatorPML = nodeManager.getField< acousticfields::AuxiliaryVar4PML >();
-    arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords32 = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView1d< real32 > const indicatorPML = getCachedField< acousticfields::AuxiliaryVar4PML >( nodeManager );
+    arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords32 = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
     indicatorPML.zero();
 
     real32 xInteriorMin[3]{};
@@ -678,12 +679,12 @@ void AcousticWaveEquationSEM::applyPML( real64 const time, DomainPartition & dom
     NodeManager & nodeManager = mesh.getNodeManager();
 
     /// Array views of the pressure p, PML auxiliary variables, and node coordinates
-    arrayView1d< real32 const > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-    arrayView2d< real32 const > const v_n = nodeManager.getField< acousticfields::AuxiliaryVar1PML >();
-    arrayView2d< real32 > const grad_n = nodeManager.getField< acousticfields::AuxiliaryVar2PML >();
-    arrayView1d< real32 > const divV_n = nodeManager.getField< acousticfields::AuxiliaryVar3PML >();
-    arrayView1d< real32 const > const u_n = nodeManager.getField< acousticfields::AuxiliaryVar4PML >();
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords32 = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView1d< real32 const > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+    arrayView2d< real32 const > const v_n = getCachedField< acousticfields::AuxiliaryVar1PML >( nodeManager );
+    arrayView2d< real32 > const grad_n = getCachedField< acousticfields::AuxiliaryVar2PML >( nodeManager );
+    arrayView1d< real32 > const divV_n = getCachedField< acousticfields::AuxiliaryVar3PML >( nodeManager );
+    arrayView1d< real32 const > const u_n = getCachedField< acousticfields::AuxiliaryVar4PML >( nodeManager );
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords32 = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     /// Select the subregions concerned by the PML (specified in the xml by the Field Specification)
     /// 'targetSet' contains the indices of the elements in a given subregion
@@ -776,14 +777,14 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
   {
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticfields::Pressure_nm1 >();
-    arrayView1d< real32 > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-    arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+    arrayView1d< real32 > const p_nm1 = getCachedField< acousticfields::Pressure_nm1 >( nodeManager );
+    arrayView1d< real32 > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+    arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
     if( computeGradient && cycleNumber >= 0 )
     {
 
-      arrayView1d< real32 > const p_dt2 = nodeManager.getField< acousticfields::PressureDoubleDerivative >();
+      arrayView1d< real32 > const p_dt2 = getCachedField< acousticfields::PressureDoubleDerivative >( nodeManager );
 
       if( m_enableLifo )
       {
@@ -854,11 +855,11 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
   {
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView1d< real32 const > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
+    arrayView1d< real32 const > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
 
-    arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticfields::Pressure_nm1 >();
-    arrayView1d< real32 > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-    arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+    arrayView1d< real32 > const p_nm1 = getCachedField< acousticfields::Pressure_nm1 >( nodeManager );
+    arrayView1d< real32 > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+    arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
     EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
     real64 const & maxTime = event.getReference< real64 >( EventManager::viewKeyStruct::maxTimeString() );
@@ -868,7 +869,7 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
     {
       ElementRegionManager & elemManager = mesh.getElemManager();
 
-      arrayView1d< real32 > const p_dt2 = nodeManager.getField< acousticfields::PressureDoubleDerivative >();
+      arrayView1d< real32 > const p_dt2 = getCachedField< acousticfields::PressureDoubleDerivative >( nodeManager );
 
       if( m_enableLifo )
       {
@@ -895,8 +896,8 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
       elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                   CellElementSubRegion & elementSubRegion )
       {
-        arrayView1d< real32 const > const velocity = elementSubRegion.getField< acousticfields::AcousticVelocity >();
-        arrayView1d< real32 > grad = elementSubRegion.getField< acousticfields::PartialGradient >();
+        arrayView1d< real32 const > const velocity = getCachedField< acousticfields::AcousticVelocity >( elementSubRegion );
+        arrayView1d< real32 > grad = getCachedField< acousticfields::PartialGradient >( elementSubRegion );
         arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = elementSubRegion.nodeList();
         constexpr localIndex numNodesPerElem = 8;
         arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
@@ -925,12 +926,12 @@ void AcousticWaveEquationSEM::prepareNextTimestep( MeshLevel & mesh )
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticfields::Pressure_nm1 >();
-  arrayView1d< real32 > const p_n   = nodeManager.getField< acousticfields::Pressure_n >();
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+  arrayView1d< real32 > const p_nm1 = getCachedField< acousticfields::Pressure_nm1 >( nodeManager );
+  arrayView1d< real32 > const p_n   = getCachedField< acousticfields::Pressure_n >( nodeManager );
+  arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
-  arrayView1d< real32 > const stiffnessVector = nodeManager.getField< acousticfields::StiffnessVector >();
-  arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
+  arrayView1d< real32 > const stiffnessVector = getCachedField< acousticfields::StiffnessVector >( nodeManager );
+  arrayView1d< real32 > const rhs = getCachedField< acousticfields::ForcingRHS >( nodeManager );
 
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
 
@@ -954,16 +955,16 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 const > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
-  arrayView1d< real32 const > const damping = nodeManager.getField< acousticfields::DampingVector >();
+  arrayView1d< real32 const > const mass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
+  arrayView1d< real32 const > const damping = getCachedField< acousticfields::DampingVector >( nodeManager );
 
-  arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticfields::Pressure_nm1 >();
-  arrayView1d< real32 > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+  arrayView1d< real32 > const p_nm1 = getCachedField< acousticfields::Pressure_nm1 >( nodeManager );
+  arrayView1d< real32 > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+  arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
-  arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
-  arrayView1d< real32 > const stiffnessVector = nodeManager.getField< acousticfields::StiffnessVector >();
-  arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
+  arrayView1d< localIndex const > const freeSurfaceNodeIndicator = getCachedField< acousticfields::AcousticFreeSurfaceNodeIndicator >( nodeManager );
+  arrayView1d< real32 > const stiffnessVector = getCachedField< acousticfields::StiffnessVector >( nodeManager );
+  arrayView1d< real32 > const rhs = getCachedField< acousticfields::ForcingRHS >( nodeManager );
 
   auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
 
@@ -994,12 +995,12 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
   else
   {
     parametersPML const & param = getReference< parametersPML >( viewKeyStruct::parametersPMLString() );
-    arrayView2d< real32 > const v_n = nodeManager.getField< acousticfields::AuxiliaryVar1PML >();
-    arrayView2d< real32 > const grad_n = nodeManager.getField< acousticfields::AuxiliaryVar2PML >();
-    arrayView1d< real32 > const divV_n = nodeManager.getField< acousticfields::AuxiliaryVar3PML >();
-    arrayView1d< real32 > const u_n = nodeManager.getField< acousticfields::AuxiliaryVar4PML >();
+    arrayView2d< real32 > const v_n = getCachedField< acousticfields::AuxiliaryVar1PML >( nodeManager );
+    arrayView2d< real32 > const grad_n = getCachedField< acousticfields::AuxiliaryVar2PML >( nodeManager );
+    arrayView1d< real32 > const divV_n = getCachedField< acousticfields::AuxiliaryVar3PML >( nodeManager );
+    arrayView1d< real32 > const u_n = getCachedField< acousticfields::AuxiliaryVar4PML >( nodeManager );
     arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const
-    nodeCoords32 = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    nodeCoords32 = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     real32 const xMin[3] = {param.xMinPML[0], param.xMinPML[1], param.xMinPML[2]};
     real32 const xMax[3] = {param.xMaxPML[0], param.xMaxPML[1], param.xMaxPML[2]};
@@ -1064,11 +1065,11 @@ void AcousticWaveEquationSEM::synchronizeUnknowns( real64 const & time_n,
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+  arrayView1d< real32 > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+  arrayView1d< real32 > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
 
-  arrayView1d< real32 > const stiffnessVector = nodeManager.getField< acousticfields::StiffnessVector >();
-  arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
+  arrayView1d< real32 > const stiffnessVector = getCachedField< acousticfields::StiffnessVector >( nodeManager );
+  arrayView1d< real32 > const rhs = getCachedField< acousticfields::ForcingRHS >( nodeManager );
 
   /// synchronize pressure fields
   FieldIdentifiers fieldsToBeSync;
@@ -1094,8 +1095,8 @@ void AcousticWaveEquationSEM::synchronizeUnknowns( real64 const & time_n,
 
   if( m_usePML )
   {
-    arrayView2d< real32 > const grad_n = nodeManager.getField< acousticfields::AuxiliaryVar2PML >();
-    arrayView1d< real32 > const divV_n = nodeManager.getField< acousticfields::AuxiliaryVar3PML >();
+    arrayView2d< real32 > const grad_n = getCachedField< acousticfields::AuxiliaryVar2PML >( nodeManager );
+    arrayView1d< real32 > const divV_n = getCachedField< acousticfields::AuxiliaryVar3PML >( nodeManager );
     grad_n.zero();
     divV_n.zero();
   }
@@ -1136,8 +1137,8 @@ void AcousticWaveEquationSEM::cleanup( real64 const time_n,
                                                                 arrayView1d< string const > const & )
   {
     NodeManager & nodeManager = mesh.getNodeManager();
-    arrayView1d< real32 const > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
-    arrayView1d< real32 const > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
+    arrayView1d< real32 const > const p_n = getCachedField< acousticfields::Pressure_n >( nodeManager );
+    arrayView1d< real32 const > const p_np1 = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
     arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
     computeAllSeismoTraces( time_n, 0.0, p_np1, p_n, pReceivers );
 
@@ -21,6 +21,7 @@
 #include "AcousticElasticWaveEquationSEMKernel.hpp"
 #include "AcoustoElasticTimeSchemeSEMKernel.hpp"
 #include "dataRepository/Group.hpp"
+#include "dataRepository/WrapperHandle.hpp"
 #include "mesh/DomainPartition.hpp"
 #include <typeinfo>
 #include <limits>
@@ -76,7 +77,7 @@ void AcousticElasticWaveEquationSEM::initializePostInitialConditionsPreSubGroups
     FaceManager & faceManager = mesh.getFaceManager();
     ElementRegionManager & elemManager = mesh.getElemManager();
 
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     arrayView2d< real64 const > const faceNormals          = faceManager.faceNormal().toViewConst();
     arrayView2d< real64 const > const faceCenters          = faceManager.faceCenter().toViewConst();
@@ -85,13 +86,13 @@ void AcousticElasticWaveEquationSEM::initializePostInitialConditionsPreSubGroups
     arrayView2d< localIndex const > const faceToRegion     = faceManager.elementRegionList();
     arrayView2d< localIndex const > const faceToElement    = faceManager.elementList();
 
-    arrayView1d< real32 > const couplingVectorx = nodeManager.getField< acoustoelasticfields::CouplingVectorx >();
+    arrayView1d< real32 > const couplingVectorx = getCachedField< acoustoelasticfields::CouplingVectorx >( nodeManager );
     couplingVectorx.zero();
 
-    arrayView1d< real32 > const couplingVectory = nodeManager.getField< acoustoelasticfields::CouplingVectory >();
+    arrayView1d< real32 > const couplingVectory = getCachedField< acoustoelasticfields::CouplingVectory >( nodeManager );
     couplingVectory.zero();
 
-    arrayView1d< real32 > const couplingVectorz = nodeManager.getField< acoustoelasticfields::CouplingVectorz >();
+    arrayView1d< real32 > const couplingVectorz = getCachedField< acoustoelasticfields::CouplingVectorz >( nodeManager );
     couplingVectorz.zero();
 
     elemManager.forElementRegions( m_acousRegions, [&] ( localIndex const regionIndex, ElementRegionBase const & elemRegion )
@@ -145,27 +146,27 @@ real64 AcousticElasticWaveEquationSEM::solverStep( real64 const & time_n,
   {
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView1d< real32 const > const acousticMass = nodeManager.getField< acousticfields::AcousticMassVector >();
-    arrayView1d< real32 const > const elasticMass = nodeManager.getField< elasticfields::ElasticMassVector >();
-    arrayView1d< localIndex const > const acousticFSNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
-    arrayView1d< localIndex const > const elasticFSNodeIndicator = nodeManager.getField< elasticfields::ElasticFreeSurfaceNodeIndicator >();
-
-    arrayView1d< real32 const > const p_n    = nodeManager.getField< acousticfields::Pressure_n >();
-    arrayView1d< real32 const > const ux_nm1 = nodeManager.getField< elasticfields::Displacementx_nm1 >();
-    arrayView1d< real32 const > const uy_nm1 = nodeManager.getField< elasticfields::Displacementy_nm1 >();
-    arrayView1d< real32 const > const uz_nm1 = nodeManager.getField< elasticfields::Displacementz_nm1 >();
-    arrayView1d< real32 const > const ux_n   = nodeManager.getField< elasticfields::Displacementx_n >();
-    arrayView1d< real32 const > const uy_n   = nodeManager.getField< elasticfields::Displacementy_n >();
-    arrayView1d< real32 const > const uz_n   = nodeManager.getField< elasticfields::Displacementz_n >();
+    arrayView1d< real32 const > const acousticMass = getCachedField< acousticfields::AcousticMassVector >( nodeManager );
+    arrayView1d< real32 const > const elasticMass = getCachedField< elasticfields::ElasticMassVector >( nodeManager );
+    arrayView1d< localIndex const > const acousticFSNodeIndicator = getCachedField< acousticfields::AcousticFreeSurfaceNodeIndicator >( nodeManager );
+    arrayView1d< localIndex const > const elasticFSNodeIndicator = getCachedField< elasticfields::ElasticFreeSurfaceNodeIndicator >( nodeManager );
+
+    arrayView1d< real32 const > const p_n    = getCachedField< acousticfields::Pressure_n >( nodeManager );
+    arrayView1d< real32 const > const ux_nm1 = getCachedField< elasticfields::Displacementx_nm1 >( nodeManager );
+    arrayView1d< real32 const > const uy_nm1 = getCachedField< elasticfields::Displacementy_nm1 >( nodeManager );
+    arrayView1d< real32 const > const uz_nm1 = getCachedField< elasticfields::Displacementz_nm1 >( nodeManager );
+    arrayView1d< real32 const > const ux_n   = getCachedField< elasticfields::Displacementx_n >( nodeManager );
+    arrayView1d< real32 const > const uy_n   = getCachedField< elasticfields::Displacementy_n >( nodeManager );
+    arrayView1d< real32 const > const uz_n   = getCachedField< elasticfields::Displacementz_n >( nodeManager );
     // acoutic -> elastic coupling vectors
-    arrayView1d< real32 const > const atoex  = nodeManager.getField< acoustoelasticfields::CouplingVectorx >();
-    arrayView1d< real32 const > const atoey  = nodeManager.getField< acoustoelasticfields::CouplingVectory >();
-    arrayView1d< real32 const > const atoez  = nodeManager.getField< acoustoelasticfields::CouplingVectorz >();
-
-    arrayView1d< real32 > const p_np1  = nodeManager.getField< acousticfields::Pressure_np1 >();
-    arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-    arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-    arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+    arrayView1d< real32 const > const atoex  = getCachedField< acoustoelasticfields::CouplingVectorx >( nodeManager );
+    arrayView1d< real32 const > const atoey  = getCachedField< acoustoelasticfields::CouplingVectory >( nodeManager );
+    arrayView1d< real32 const > const atoez  = getCachedField< acoustoelasticfields::CouplingVectorz >( nodeManager );
+
+    arrayView1d< real32 > const p_np1  = getCachedField< acousticfields::Pressure_np1 >( nodeManager );
+    arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+    arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+    arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
     elasSolver->computeUnknowns( time_n, dt, cycleNumber, domain, mesh, m_elasRegions );
 
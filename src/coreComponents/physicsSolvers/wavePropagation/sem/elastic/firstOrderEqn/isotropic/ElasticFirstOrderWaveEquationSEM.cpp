@@ -21,6 +21,7 @@
 #include "ElasticFirstOrderWaveEquationSEM.hpp"
 #include "ElasticFirstOrderWaveEquationSEMKernel.hpp"
 
+#include "dataRepository/WrapperHandle.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
@@ -161,12 +162,12 @@ void ElasticFirstOrderWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
 
         constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
 
-        subRegion.getField< elasticfields::Stresstensorxx >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< elasticfields::Stresstensoryy >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< elasticfields::Stresstensorzz >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< elasticfields::Stresstensorxy >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< elasticfields::Stresstensorxz >().resizeDimension< 1 >( numNodesPerElem );
-        subRegion.getField< elasticfields::Stresstensoryz >().resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< elasticfields::Stresstensorxx >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< elasticfields::Stresstensoryy >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< elasticfields::Stresstensorzz >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< elasticfields::Stresstensorxy >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< elasticfields::Stresstensorxz >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
+        getCachedField< elasticfields::Stresstensoryz >( subRegion ).resizeDimension< 1 >( numNodesPerElem );
       } );
 
 
@@ -341,25 +342,25 @@ void ElasticFirstOrderWaveEquationSEM::initializePostInitialConditionsPreSubGrou
 
     /// get the array of indicators: 1 if the face is on the boundary; 0 otherwise
     arrayView1d< integer const > const & facesDomainBoundaryIndicator = faceManager.getDomainBoundaryIndicator();
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
     arrayView2d< real64 const > const faceNormal  = faceManager.faceNormal();
 
     /// get face to node map
     ArrayOfArraysView< localIndex const > const facesToNodes = faceManager.nodeList().toViewConst();
 
     // mass matrix to be computed in this function
-    arrayView1d< real32 > const mass = nodeManager.getField< elasticfields::ElasticMassVector >();
+    arrayView1d< real32 > const mass = getCachedField< elasticfields::ElasticMassVector >( nodeManager );
     mass.zero();
     /// damping matrix to be computed for each dof in the boundary of the mesh
-    arrayView1d< real32 > const dampingx = nodeManager.getField< elasticfields::DampingVectorx >();
-    arrayView1d< real32 > const dampingy = nodeManager.getField< elasticfields::DampingVectory >();
-    arrayView1d< real32 > const dampingz = nodeManager.getField< elasticfields::DampingVectorz >();
+    arrayView1d< real32 > const dampingx = getCachedField< elasticfields::DampingVectorx >( nodeManager );
+    arrayView1d< real32 > const dampingy = getCachedField< elasticfields::DampingVectory >( nodeManager );
+    arrayView1d< real32 > const dampingz = getCachedField< elasticfields::DampingVectorz >( nodeManager );
     dampingx.zero();
     dampingy.zero();
     dampingz.zero();
 
     /// get array of indicators: 1 if face is on the free surface; 0 otherwise
-    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = faceManager.getField< elasticfields::ElasticFreeSurfaceFaceIndicator >();
+    arrayView1d< localIndex const > const freeSurfaceFaceIndicator = getCachedField< elasticfields::ElasticFreeSurfaceFaceIndicator >( faceManager );
 
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                           CellElementSubRegion & elementSubRegion )
@@ -367,9 +368,9 @@ void ElasticFirstOrderWaveEquationSEM::initializePostInitialConditionsPreSubGrou
 
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
       arrayView2d< localIndex const > const elemsToFaces = elementSubRegion.faceList();
-      arrayView1d< real32 > const density = elementSubRegion.getField< elasticfields::ElasticDensity >();
-      arrayView1d< real32 > const velocityVp = elementSubRegion.getField< elasticfields::ElasticVelocityVp >();
-      arrayView1d< real32 > const velocityVs = elementSubRegion.getField< elasticfields::ElasticVelocityVs >();
+      arrayView1d< real32 > const density = getCachedField< elasticfields::ElasticDensity >( elementSubRegion );
+      arrayView1d< real32 > const velocityVp = getCachedField< elasticfields::ElasticVelocityVp >( elementSubRegion );
+      arrayView1d< real32 > const velocityVs = getCachedField< elasticfields::ElasticVelocityVs >( elementSubRegion );
 
       finiteElement::FiniteElementBase const &
       fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
@@ -417,17 +418,17 @@ void ElasticFirstOrderWaveEquationSEM::applyFreeSurfaceBC( real64 const time, Do
   FaceManager & faceManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getFaceManager();
   NodeManager & nodeManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getNodeManager();
 
-  arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-  arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-  arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+  arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+  arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+  arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// set array of indicators: 1 if a face is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceFaceIndicator = faceManager.getField< elasticfields::ElasticFreeSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const freeSurfaceFaceIndicator = getCachedField< elasticfields::ElasticFreeSurfaceFaceIndicator >( faceManager );
 
   /// set array of indicators: 1 if a node is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceNodeIndicator = nodeManager.getField< elasticfields::ElasticFreeSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const freeSurfaceNodeIndicator = getCachedField< elasticfields::ElasticFreeSurfaceNodeIndicator >( nodeManager );
 
   freeSurfaceFaceIndicator.zero();
   freeSurfaceNodeIndicator.zero();
@@ -520,17 +521,17 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
 
     NodeManager & nodeManager = mesh.getNodeManager();
 
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
-    arrayView1d< real32 const > const mass = nodeManager.getField< elasticfields::ElasticMassVector >();
-    arrayView1d< real32 > const dampingx = nodeManager.getField< elasticfields::DampingVectorx >();
-    arrayView1d< real32 > const dampingy = nodeManager.getField< elasticfields::DampingVectory >();
-    arrayView1d< real32 > const dampingz = nodeManager.getField< elasticfields::DampingVectorz >();
+    arrayView1d< real32 const > const mass = getCachedField< elasticfields::ElasticMassVector >( nodeManager );
+    arrayView1d< real32 > const dampingx = getCachedField< elasticfields::DampingVectorx >( nodeManager );
+    arrayView1d< real32 > const dampingy = getCachedField< elasticfields::DampingVectory >( nodeManager );
+    arrayView1d< real32 > const dampingz = getCachedField< elasticfields::DampingVectorz >( nodeManager );
 
 
-    arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-    arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-    arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+    arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+    arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+    arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
                                                                                           CellElementSubRegion & elementSubRegion )
@@ -538,19 +539,19 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
 
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = elementSubRegion.nodeList();
 
-      arrayView1d< real32 const > const velocityVp = elementSubRegion.getField< elasticfields::ElasticVelocityVp >();
-      arrayView1d< real32 const > const velocityVs = elementSubRegion.getField< elasticfields::ElasticVelocityVs >();
-      arrayView1d< real32 const > const density = elementSubRegion.getField< elasticfields::ElasticDensity >();
+      arrayView1d< real32 const > const velocityVp = getCachedField< elasticfields::ElasticVelocityVp >( elementSubRegion );
+      arrayView1d< real32 const > const velocityVs = getCachedField< elasticfields::ElasticVelocityVs >( elementSubRegion );
+      arrayView1d< real32 const > const density = getCachedField< elasticfields::ElasticDensity >( elementSubRegion );
 
-      arrayView1d< real32 > const lambda = elementSubRegion.getField< elasticfields::Lambda >();
-      arrayView1d< real32 > const mu = elementSubRegion.getField< elasticfields::Mu >();
+      arrayView1d< real32 > const lambda = getCachedField< elasticfields::Lambda >( elementSubRegion );
+      arrayView1d< real32 > const mu = getCachedField< elasticfields::Mu >( elementSubRegion );
 
-      arrayView2d< real32 > const stressxx = elementSubRegion.getField< elasticfields::Stresstensorxx >();
-      arrayView2d< real32 > const stressyy = elementSubRegion.getField< elasticfields::Stresstensoryy >();
-      arrayView2d< real32 > const stresszz = elementSubRegion.getField< elasticfields::Stresstensorzz >();
-      arrayView2d< real32 > const stressxy = elementSubRegion.getField< elasticfields::Stresstensorxy >();
-      arrayView2d< real32 > const stressxz = elementSubRegion.getField< elasticfields::Stresstensorxz >();
-      arrayView2d< real32 > const stressyz = elementSubRegion.getField< elasticfields::Stresstensoryz >();
+      arrayView2d< real32 > const stressxx = getCachedField< elasticfields::Stresstensorxx >( elementSubRegion );
+      arrayView2d< real32 > const stressyy = getCachedField< elasticfields::Stresstensoryy >( elementSubRegion );
+      arrayView2d< real32 > const stresszz = getCachedField< elasticfields::Stresstensorzz >( elementSubRegion );
+      arrayView2d< real32 > const stressxy = getCachedField< elasticfields::Stresstensorxy >( elementSubRegion );
+      arrayView2d< real32 > const stressxz = getCachedField< elasticfields::Stresstensorxz >( elementSubRegion );
+      arrayView2d< real32 > const stressyz = getCachedField< elasticfields::Stresstensoryz >( elementSubRegion );
 
 
       finiteElement::FiniteElementBase const &
@@ -680,12 +681,12 @@ void ElasticFirstOrderWaveEquationSEM::cleanup( real64 const time_n,
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
                                                                                           CellElementSubRegion & elementSubRegion )
     {
-      arrayView2d< real32 const > const stressxx = elementSubRegion.getField< elasticfields::Stresstensorxx >();
-      arrayView2d< real32 const > const stressyy = elementSubRegion.getField< elasticfields::Stresstensoryy >();
-      arrayView2d< real32 const > const stresszz = elementSubRegion.getField< elasticfields::Stresstensorzz >();
-      arrayView2d< real32 const > const stressxy = elementSubRegion.getField< elasticfields::Stresstensorxy >();
-      arrayView2d< real32 const > const stressxz = elementSubRegion.getField< elasticfields::Stresstensorxz >();
-      arrayView2d< real32 const > const stressyz = elementSubRegion.getField< elasticfields::Stresstensoryz >();
+      arrayView2d< real32 const > const stressxx = getCachedField< elasticfields::Stresstensorxx >( elementSubRegion );
+      arrayView2d< real32 const > const stressyy = getCachedField< elasticfields::Stresstensoryy >( elementSubRegion );
+      arrayView2d< real32 const > const stresszz = getCachedField< elasticfields::Stresstensorzz >( elementSubRegion );
+      arrayView2d< real32 const > const stressxy = getCachedField< elasticfields::Stresstensorxy >( elementSubRegion );
+      arrayView2d< real32 const > const stressxz = getCachedField< elasticfields::Stresstensorxz >( elementSubRegion );
+      arrayView2d< real32 const > const stressyz = getCachedField< elasticfields::Stresstensoryz >( elementSubRegion );
 
       arrayView2d< real32 > const sigmaxxReceivers   = m_sigmaxxNp1AtReceivers.toView();
       arrayView2d< real32 > const sigmayyReceivers   = m_sigmayyNp1AtReceivers.toView();
@@ -707,9 +708,9 @@ void ElasticFirstOrderWaveEquationSEM::cleanup( real64 const time_n,
                                                m_receiverIsLocal, m_nsamplesSeismoTrace, sigmaxyReceivers, sigmaxzReceivers, sigmayzReceivers );
 
     } );
-    arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-    arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-    arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+    arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+    arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+    arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
     // compute the seismic traces since last step.
     arrayView2d< real32 > const uxReceivers = m_displacementxNp1AtReceivers.toView();
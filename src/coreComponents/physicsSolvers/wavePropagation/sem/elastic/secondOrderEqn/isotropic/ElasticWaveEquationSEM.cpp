@@ -20,6 +20,7 @@
 
 #include "ElasticWaveEquationSEM.hpp"
 #include "ElasticWaveEquationSEMKernel.hpp"
+#include "dataRepository/WrapperHandle.hpp"
 #include "physicsSolvers/wavePropagation/sem/elastic/secondOrderEqn/anisotropic/ElasticVTIWaveEquationSEMKernel.hpp"
 
 #include "fieldSpecification/FieldSpecificationManager.hpp"
@@ -167,9 +168,9 @@ void ElasticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
                                  elasticfields::StiffnessVectorAx,
                                  elasticfields::StiffnessVectorAy,
                                  elasticfields::StiffnessVectorAz >( getName() );
-      nodeManager.getField< elasticfields::DivPsix >().resizeDimension< 1 >( l );
-      nodeManager.getField< elasticfields::DivPsiy >().resizeDimension< 1 >( l );
-      nodeManager.getField< elasticfields::DivPsiz >().resizeDimension< 1 >( l );
+      getCachedField< elasticfields::DivPsix >( nodeManager ).resizeDimension< 1 >( l );
+      getCachedField< elasticfields::DivPsiy >( nodeManager ).resizeDimension< 1 >( l );
+      getCachedField< elasticfields::DivPsiz >( nodeManager ).resizeDimension< 1 >( l );
     }
 
     FaceManager & faceManager = mesh.getFaceManager();
@@ -393,21 +394,21 @@ void ElasticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
     FaceManager & faceManager = mesh.getFaceManager();
     ElementRegionManager & elemManager = mesh.getElemManager();
 
-    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+    arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = getCachedField< fields::referencePosition32 >( nodeManager ).toViewConst();
 
     // mass matrix to be computed in this function
-    arrayView1d< real32 > const mass = nodeManager.getField< elasticfields::ElasticMassVector >();
+    arrayView1d< real32 > const mass = getCachedField< elasticfields::ElasticMassVector >( nodeManager );
     mass.zero();
     /// damping matrix to be computed for each dof in the boundary of the mesh
-    arrayView1d< real32 > const dampingx = nodeManager.getField< elasticfields::DampingVectorx >();
-    arrayView1d< real32 > const dampingy = nodeManager.getField< elasticfields::DampingVectory >();
-    arrayView1d< real32 > const dampingz = nodeManager.getField< elasticfields::DampingVectorz >();
+    arrayView1d< real32 > const dampingx = getCachedField< elasticfields::DampingVectorx >( nodeManager );
+    arrayView1d< real32 > const dampingy = getCachedField< elasticfields::DampingVectory >( nodeManager );
+    arrayView1d< real32 > const dampingz = getCachedField< elasticfields::DampingVectorz >( nodeManager );
     dampingx.zero();
     dampingy.zero();
     dampingz.zero();
 
     /// get array of indicators: 1 if face is on the free surface; 0 otherwise
-    arrayView1d< localIndex const > const freeSurfaceFaceIndicator    = faceManager.getField< elasticfields::ElasticFreeSurfaceFaceIndicator >();
+    arrayView1d< localIndex const > const freeSurfaceFaceIndicator    = getCachedField< elasticfields::ElasticFreeSurfaceFaceIndicator >( faceManager );
     arrayView1d< integer const > const & facesDomainBoundaryIndicator = faceManager.getDomainBoundaryIndicator();
     ArrayOfArraysView< localIndex const > const facesToNodes          = faceManager.nodeList().toViewConst();
     arrayView2d< real64 const > const faceNormal                      = faceManager.faceNormal();
@@ -423,9 +424,9 @@ void ElasticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
       computeTargetNodeSet( elemsToNodes, elementSubRegion.size(), fe.getNumQuadraturePoints() );
 
-      arrayView1d< real32 const > const density = elementSubRegion.getField< elasticfields::ElasticDensity >();
-      arrayView1d< real32 const > const velocityVp = elementSubRegion.getField< elasticfields::ElasticVelocityVp >();
-      arrayView1d< real32 const > const velocityVs = elementSubRegion.getField< elasticfields::ElasticVelocityVs >();
+      arrayView1d< real32 const > const density = getCachedField< elasticfields::ElasticDensity >( elementSubRegion );
+      arrayView1d< real32 const > const velocityVp = getCachedField< elasticfields::ElasticVelocityVp >( elementSubRegion );
+      arrayView1d< real32 const > const velocityVs = getCachedField< elasticfields::ElasticVelocityVs >( elementSubRegion );
 
       finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
       {
@@ -490,8 +491,8 @@ real32 ElasticWaveEquationSEM::computeGlobalMinQFactor()
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                           CellElementSubRegion & elementSubRegion )
     {
-      arrayView1d< real32 const > const qp = elementSubRegion.getField< elasticfields::ElasticQualityFactorP >();
-      arrayView1d< real32 const > const qs = elementSubRegion.getField< elasticfields::ElasticQualityFactorS >();
+      arrayView1d< real32 const > const qp = getCachedField< elasticfields::ElasticQualityFactorP >( elementSubRegion );
+      arrayView1d< real32 const > const qs = getCachedField< elasticfields::ElasticQualityFactorS >( elementSubRegion );
       forAll< EXEC_POLICY >( elementSubRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const e ) {
         minQ.min( qp[e] );
         minQ.min( qs[e] );
@@ -510,23 +511,23 @@ void ElasticWaveEquationSEM::applyFreeSurfaceBC( real64 const time, DomainPartit
   FaceManager & faceManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getFaceManager();
   NodeManager & nodeManager = domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ).getNodeManager();
 
-  arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-  arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-  arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
-  arrayView1d< real32 > const ux_n   = nodeManager.getField< elasticfields::Displacementx_n >();
-  arrayView1d< real32 > const uy_n   = nodeManager.getField< elasticfields::Displacementy_n >();
-  arrayView1d< real32 > const uz_n   = nodeManager.getField< elasticfields::Displacementz_n >();
-  arrayView1d< real32 > const ux_nm1 = nodeManager.getField< elasticfields::Displacementx_nm1 >();
-  arrayView1d< real32 > const uy_nm1 = nodeManager.getField< elasticfields::Displacementy_nm1 >();
-  arrayView1d< real32 > const uz_nm1 = nodeManager.getField< elasticfields::Displacementz_nm1 >();
+  arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+  arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+  arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
+  arrayView1d< real32 > const ux_n   = getCachedField< elasticfields::Displacementx_n >( nodeManager );
+  arrayView1d< real32 > const uy_n   = getCachedField< elasticfields::Displacementy_n >( nodeManager );
+  arrayView1d< real32 > const uz_n   = getCachedField< elasticfields::Displacementz_n >( nodeManager );
+  arrayView1d< real32 > const ux_nm1 = getCachedField< elasticfields::Displacementx_nm1 >( nodeManager );
+  arrayView1d< real32 > const uy_nm1 = getCachedField< elasticfields::Displacementy_nm1 >( nodeManager );
+  arrayView1d< real32 > const uz_nm1 = getCachedField< elasticfields::Displacementz_nm1 >( nodeManager );
 
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// set array of indicators: 1 if a face is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceFaceIndicator = faceManager.getField< elasticfields::ElasticFreeSurfaceFaceIndicator >();
+  arrayView1d< localIndex > const freeSurfaceFaceIndicator = getCachedField< elasticfields::ElasticFreeSurfaceFaceIndicator >( faceManager );
 
   /// set array of indicators: 1 if a node is on on free surface; 0 otherwise
-  arrayView1d< localIndex > const freeSurfaceNodeIndicator = nodeManager.getField< elasticfields::ElasticFreeSurfaceNodeIndicator >();
+  arrayView1d< localIndex > const freeSurfaceNodeIndicator = getCachedField< elasticfields::ElasticFreeSurfaceNodeIndicator >( nodeManager );
 
 
   fsManager.apply( time,
@@ -608,27 +609,27 @@ void ElasticWaveEquationSEM::computeUnknowns( real64 const &,
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 const > const mass = nodeManager.getField< elasticfields::ElasticMassVector >();
-  arrayView1d< real32 const > const dampingx = nodeManager.getField< elasticfields::DampingVectorx >();
-  arrayView1d< real32 const > const dampingy = nodeManager.getField< elasticfields::DampingVectory >();
-  arrayView1d< real32 const > const dampingz = nodeManager.getField< elasticfields::DampingVectorz >();
-  arrayView1d< real32 > const stiffnessVectorx = nodeManager.getField< elasticfields::StiffnessVectorx >();
-  arrayView1d< real32 > const stiffnessVectory = nodeManager.getField< elasticfields::StiffnessVectory >();
-  arrayView1d< real32 > const stiffnessVectorz = nodeManager.getField< elasticfields::StiffnessVectorz >();
-
-  arrayView1d< real32 > const ux_nm1 = nodeManager.getField< elasticfields::Displacementx_nm1 >();
-  arrayView1d< real32 > const uy_nm1 = nodeManager.getField< elasticfields::Displacementy_nm1 >();
-  arrayView1d< real32 > const uz_nm1 = nodeManager.getField< elasticfields::Displacementz_nm1 >();
-  arrayView1d< real32 > const ux_n = nodeManager.getField< elasticfields::Displacementx_n >();
-  arrayView1d< real32 > const uy_n = nodeManager.getField< elasticfields::Displacementy_n >();
-  arrayView1d< real32 > const uz_n = nodeManager.getField< elasticfields::Displacementz_n >();
-  arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-  arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-  arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
-
-  arrayView1d< real32 > const rhsx = nodeManager.getField< elasticfields::ForcingRHSx >();
-  arrayView1d< real32 > const rhsy = nodeManager.getField< elasticfields::ForcingRHSy >();
-  arrayView1d< real32 > const rhsz = nodeManager.getField< elasticfields::ForcingRHSz >();
+  arrayView1d< real32 const > const mass = getCachedField< elasticfields::ElasticMassVector >( nodeManager );
+  arrayView1d< real32 const > const dampingx = getCachedField< elasticfields::DampingVectorx >( nodeManager );
+  arrayView1d< real32 const > const dampingy = getCachedField< elasticfields::DampingVectory >( nodeManager );
+  arrayView1d< real32 const > const dampingz = getCachedField< elasticfields::DampingVectorz >( nodeManager );
+  arrayView1d< real32 > const stiffnessVectorx = getCachedField< elasticfields::StiffnessVectorx >( nodeManager );
+  arrayView1d< real32 > const stiffnessVectory = getCachedField< elasticfields::StiffnessVectory >( nodeManager );
+  arrayView1d< real32 > const stiffnessVectorz = getCachedField< elasticfields::StiffnessVectorz >( nodeManager );
+
+  arrayView1d< real32 > const ux_nm1 = getCachedField< elasticfields::Displacementx_nm1 >( nodeManager );
+  arrayView1d< real32 > const uy_nm1 = getCachedField< elasticfields::Displacementy_nm1 >( nodeManager );
+  arrayView1d< real32 > const uz_nm1 = getCachedField< elasticfields::Displacementz_nm1 >( nodeManager );
+  arrayView1d< real32 > const ux_n = getCachedField< elasticfields::Displacementx_n >( nodeManager );
+  arrayView1d< real32 > const uy_n = getCachedField< elasticfields::Displacementy_n >( nodeManager );
+  arrayView1d< real32 > const uz_n = getCachedField< elasticfields::Displacementz_n >( nodeManager );
+  arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+  arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+  arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
+
+  arrayView1d< real32 > const rhsx = getCachedField< elasticfields::ForcingRHSx >( nodeManager );
+  arrayView1d< real32 > const rhsy = getCachedField< elasticfields::ForcingRHSy >( nodeManager );
+  arrayView1d< real32 > const rhsz = getCachedField< elasticfields::ForcingRHSz >( nodeManager );
 
   if( m_useVTI )
   {
@@ -678,12 +679,12 @@ void ElasticWaveEquationSEM::computeUnknowns( real64 const &,
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
   if( m_attenuationType == WaveSolverUtils::AttenuationType::sls )
   {
-    arrayView1d< real32 > const stiffnessVectorAx = nodeManager.getField< elasticfields::StiffnessVectorAx >();
-    arrayView1d< real32 > const stiffnessVectorAy = nodeManager.getField< elasticfields::StiffnessVectorAy >();
-    arrayView1d< real32 > const stiffnessVectorAz = nodeManager.getField< elasticfields::StiffnessVectorAz >();
-    arrayView2d< real32 > const divpsix = nodeManager.getField< elasticfields::DivPsix >();
-    arrayView2d< real32 > const divpsiy = nodeManager.getField< elasticfields::DivPsiy >();
-    arrayView2d< real32 > const divpsiz = nodeManager.getField< elasticfields::DivPsiz >();
+    arrayView1d< real32 > const stiffnessVectorAx = getCachedField< elasticfields::StiffnessVectorAx >( nodeManager );
+    arrayView1d< real32 > const stiffnessVectorAy = getCachedField< elasticfields::StiffnessVectorAy >( nodeManager );
+    arrayView1d< real32 > const stiffnessVectorAz = getCachedField< elasticfields::StiffnessVectorAz >( nodeManager );
+    arrayView2d< real32 > const divpsix = getCachedField< elasticfields::DivPsix >( nodeManager );
+    arrayView2d< real32 > const divpsiy = getCachedField< elasticfields::DivPsiy >( nodeManager );
+    arrayView2d< real32 > const divpsiz = getCachedField< elasticfields::DivPsiz >( nodeManager );
     arrayView1d< real32 > const referenceFrequencies = m_slsReferenceAngularFrequencies.toView();
     arrayView1d< real32 > const anelasticityCoefficients = m_slsAnelasticityCoefficients.toView();
     ElasticTimeSchemeSEM::AttenuationLeapFrog( dt, ux_np1, ux_n, ux_nm1, uy_np1, uy_n, uy_nm1, uz_np1, uz_n, uz_nm1,
@@ -710,12 +711,12 @@ void ElasticWaveEquationSEM::synchronizeUnknowns( real64 const & time_n,
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 > const ux_n   = nodeManager.getField< elasticfields::Displacementx_n >();
-  arrayView1d< real32 > const uy_n   = nodeManager.getField< elasticfields::Displacementy_n >();
-  arrayView1d< real32 > const uz_n   = nodeManager.getField< elasticfields::Displacementz_n >();
-  arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-  arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-  arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+  arrayView1d< real32 > const ux_n   = getCachedField< elasticfields::Displacementx_n >( nodeManager );
+  arrayView1d< real32 > const uy_n   = getCachedField< elasticfields::Displacementy_n >( nodeManager );
+  arrayView1d< real32 > const uz_n   = getCachedField< elasticfields::Displacementz_n >( nodeManager );
+  arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+  arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+  arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
   /// synchronize displacement fields
   FieldIdentifiers fieldsToBeSync;
@@ -757,23 +758,23 @@ void ElasticWaveEquationSEM::prepareNextTimestep( MeshLevel & mesh )
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 > const ux_nm1 = nodeManager.getField< elasticfields::Displacementx_nm1 >();
-  arrayView1d< real32 > const uy_nm1 = nodeManager.getField< elasticfields::Displacementy_nm1 >();
-  arrayView1d< real32 > const uz_nm1 = nodeManager.getField< elasticfields::Displacementz_nm1 >();
-  arrayView1d< real32 > const ux_n   = nodeManager.getField< elasticfields::Displacementx_n >();
-  arrayView1d< real32 > const uy_n   = nodeManager.getField< elasticfields::Displacementy_n >();
-  arrayView1d< real32 > const uz_n   = nodeManager.getField< elasticfields::Displacementz_n >();
-  arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-  arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-  arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+  arrayView1d< real32 > const ux_nm1 = getCachedField< elasticfields::Displacementx_nm1 >( nodeManager );
+  arrayView1d< real32 > const uy_nm1 = getCachedField< elasticfields::Displacementy_nm1 >( nodeManager );
+  arrayView1d< real32 > const uz_nm1 = getCachedField< elasticfields::Displacementz_nm1 >( nodeManager );
+  arrayView1d< real32 > const ux_n   = getCachedField< elasticfields::Displacementx_n >( nodeManager );
+  arrayView1d< real32 > const uy_n   = getCachedField< elasticfields::Displacementy_n >( nodeManager );
+  arrayView1d< real32 > const uz_n   = getCachedField< elasticfields::Displacementz_n >( nodeManager );
+  arrayView1d< real32 > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+  arrayView1d< real32 > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+  arrayView1d< real32 > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
-  arrayView1d< real32 > const stiffnessVectorx = nodeManager.getField< elasticfields::StiffnessVectorx >();
-  arrayView1d< real32 > const stiffnessVectory = nodeManager.getField< elasticfields::StiffnessVectory >();
-  arrayView1d< real32 > const stiffnessVectorz = nodeManager.getField< elasticfields::StiffnessVectorz >();
+  arrayView1d< real32 > const stiffnessVectorx = getCachedField< elasticfields::StiffnessVectorx >( nodeManager );
+  arrayView1d< real32 > const stiffnessVectory = getCachedField< elasticfields::StiffnessVectory >( nodeManager );
+  arrayView1d< real32 > const stiffnessVectorz = getCachedField< elasticfields::StiffnessVectorz >( nodeManager );
 
-  arrayView1d< real32 > const rhsx = nodeManager.getField< elasticfields::ForcingRHSx >();
-  arrayView1d< real32 > const rhsy = nodeManager.getField< elasticfields::ForcingRHSy >();
-  arrayView1d< real32 > const rhsz = nodeManager.getField< elasticfields::ForcingRHSz >();
+  arrayView1d< real32 > const rhsx = getCachedField< elasticfields::ForcingRHSx >( nodeManager );
+  arrayView1d< real32 > const rhsy = getCachedField< elasticfields::ForcingRHSy >( nodeManager );
+  arrayView1d< real32 > const rhsz = getCachedField< elasticfields::ForcingRHSz >( nodeManager );
 
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
 
@@ -792,9 +793,9 @@ void ElasticWaveEquationSEM::prepareNextTimestep( MeshLevel & mesh )
   } );
   if( m_attenuationType == WaveSolverUtils::AttenuationType::sls )
   {
-    arrayView1d< real32 > const stiffnessVectorAx = nodeManager.getField< elasticfields::StiffnessVectorAx >();
-    arrayView1d< real32 > const stiffnessVectorAy = nodeManager.getField< elasticfields::StiffnessVectorAy >();
-    arrayView1d< real32 > const stiffnessVectorAz = nodeManager.getField< elasticfields::StiffnessVectorAz >();
+    arrayView1d< real32 > const stiffnessVectorAx = getCachedField< elasticfields::StiffnessVectorAx >( nodeManager );
+    arrayView1d< real32 > const stiffnessVectorAy = getCachedField< elasticfields::StiffnessVectorAy >( nodeManager );
+    arrayView1d< real32 > const stiffnessVectorAz = getCachedField< elasticfields::StiffnessVectorAz >( nodeManager );
     forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
     {
       localIndex const a = solverTargetNodesSet[n];
@@ -840,12 +841,12 @@ void ElasticWaveEquationSEM::cleanup( real64 const time_n,
                                                                 arrayView1d< string const > const & )
   {
     NodeManager & nodeManager = mesh.getNodeManager();
-    arrayView1d< real32 const > const ux_n   = nodeManager.getField< elasticfields::Displacementx_n >();
-    arrayView1d< real32 const > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-    arrayView1d< real32 const > const uy_n   = nodeManager.getField< elasticfields::Displacementy_n >();
-    arrayView1d< real32 const > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-    arrayView1d< real32 const > const uz_n   = nodeManager.getField< elasticfields::Displacementz_n >();
-    arrayView1d< real32 const > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
+    arrayView1d< real32 const > const ux_n   = getCachedField< elasticfields::Displacementx_n >( nodeManager );
+    arrayView1d< real32 const > const ux_np1 = getCachedField< elasticfields::Displacementx_np1 >( nodeManager );
+    arrayView1d< real32 const > const uy_n   = getCachedField< elasticfields::Displacementy_n >( nodeManager );
+    arrayView1d< real32 const > const uy_np1 = getCachedField< elasticfields::Displacementy_np1 >( nodeManager );
+    arrayView1d< real32 const > const uz_n   = getCachedField< elasticfields::Displacementz_n >( nodeManager );
+    arrayView1d< real32 const > const uz_np1 = getCachedField< elasticfields::Displacementz_np1 >( nodeManager );
 
     if( m_useDAS == WaveSolverUtils::DASType::none )
     {
@@ -21,6 +21,7 @@
 #include "WaveSolverBase.hpp"
 
 #include "dataRepository/KeyNames.hpp"
+#include "dataRepository/WrapperHandle.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 
 #include "fieldSpecification/FieldSpecificationManager.hpp"
@@ -245,8 +246,8 @@ void WaveSolverBase::registerDataOnMesh( Group & meshBodies )
     nodeManager.registerField< fields::referencePosition32 >( this->getName() );
     arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
 
-    nodeManager.getField< fields::referencePosition32 >().resizeDimension< 1 >( X.size( 1 ) );
-    arrayView2d< wsCoordType, nodes::REFERENCE_POSITION_USD > const nodeCoords32 = nodeManager.getField< fields::referencePosition32 >();
+    getCachedField< fields::referencePosition32 >( nodeManager ).resizeDimension< 1 >( X.size( 1 ) );
+    arrayView2d< wsCoordType, nodes::REFERENCE_POSITION_USD > const nodeCoords32 = getCachedField< fields::referencePosition32 >( nodeManager );
     for( int i = 0; i < X.size( 0 ); i++ )
     {
       for( int j = 0; j < X.size( 1 ); j++ )
@@ -0,0 +1,141 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/solid/DruckerPrager.hpp"
+#include "constitutive/solid/ElasticIsotropic.hpp"
+
+#include "dataRepository/xmlWrapper.hpp"
+
+using namespace geos;
+using namespace ::geos::constitutive;
+
+namespace
+{
+
+localIndex constexpr numElem = 2;
+int constexpr numQuad = 8;
+
+/**
+ * @brief Run the same load path on the quadrature points of element 0 with the pointwise update,
+ *        and on the ones of element 1 with the batched update, and compare the stresses.
+ */
+template< typename MODEL >
+void compareBatchedAndPointwiseUpdates( string const & inputStream,
+                                        string const & modelName )
+{
+  conduit::Node node;
+  dataRepository::Group rootGroup( "root", node );
+  ConstitutiveManager constitutiveManager( "constitutive", &rootGroup );
+
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.loadString( inputStream );
+  ASSERT_TRUE( xmlResult );
+
+  xmlWrapper::xmlNode xmlConstitutiveNode = xmlDocument.getChild( "Constitutive" );
+  constitutiveManager.processInputFileRecursive( xmlDocument, xmlConstitutiveNode );
+  constitutiveManager.postInputInitializationRecursive();
+
+  dataRepository::Group disc( "discretization", &rootGroup );
+  disc.resize( numElem );
+
+  MODEL & cm = constitutiveManager.getConstitutiveRelation< MODEL >( modelName );
+  cm.allocateConstitutiveData( disc, numQuad );
+
+  typename MODEL::KernelWrapper cmw = cm.createKernelUpdates();
+  static_assert( hasBatchedSmallStrainUpdate< typename MODEL::KernelWrapper >::value,
+                 "The model must implement the batched update" );
+
+  real64 const timeIncrement = 0;
+  for( localIndex loadstep = 0; loadstep < 20; ++loadstep )
+  {
+    real64 strainIncrement[6][numQuad];
+    for( int q = 0; q < numQuad; ++q )
+    {
+      strainIncrement[0][q] = 1e-4 * ( 1 + q );
+      strainIncrement[1][q] = -2e-5 * q;
+      strainIncrement[2][q] = 1e-5;
+      strainIncrement[3][q] = 3e-5 * ( q % 3 );
+      strainIncrement[4][q] = 0;
+      strainIncrement[5][q] = -1e-5 * q;
+    }
+
+    for( int q = 0; q < numQuad; ++q )
+    {
+      real64 pointStrainIncrement[6];
+      for( int i = 0; i < 6; ++i )
+      {
+        pointStrainIncrement[i] = strainIncrement[i][q];
+      }
+      real64 stress[6]{};
+      real64 stiffness[6][6]{};
+      cmw.smallStrainUpdate( 0, q, timeIncrement, pointStrainIncrement, stress, stiffness );
+    }
+
+    real64 stress[6][numQuad];
+    cmw.template smallStrainUpdateBatch_StressOnly< numQuad >( 1, 0, timeIncrement, strainIncrement, stress );
+
+    arrayView3d< real64 const, solid::STRESS_USD > const newStress = cm.getStress();
+    for( int q = 0; q < numQuad; ++q )
+    {
+      for( int i = 0; i < 6; ++i )
+      {
+        EXPECT_DOUBLE_EQ( stress[i][q], newStress( 1, q, i ) );
+        EXPECT_DOUBLE_EQ( newStress( 0, q, i ), newStress( 1, q, i ) );
+      }
+    }
+
+    cm.saveConvergedState();
+  }
+}
+
+}
+
+TEST( BatchedSolidUpdatesTests, testElasticIsotropic )
+{
+  string const inputStream =
+    "<Constitutive>"
+    "   <ElasticIsotropic"
+    "      name=\"granite\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"1.7e5\" "
+    "      defaultShearModulus=\"8.0e4\" "
+    "   />"
+    "</Constitutive>";
+
+  compareBatchedAndPointwiseUpdates< ElasticIsotropic >( inputStream, "granite" );
+}
+
+TEST( BatchedSolidUpdatesTests, testDruckerPrager )
+{
+  // the cohesion is low enough for some of the points to yield after a few steps
+  string const inputStream =
+    "<Constitutive>"
+    "   <DruckerPrager"
+    "      name=\"sand\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"1.7e5\" "
+    "      defaultShearModulus=\"8.0e4\" "
+    "      defaultFrictionAngle=\"30\" "
+    "      defaultDilationAngle=\"10\" "
+    "      defaultHardeningRate=\"-100\" "
+    "      defaultCohesion=\"50\" "
+    "   />"
+    "</Constitutive>";
+
+  compareBatchedAndPointwiseUpdates< DruckerPrager >( inputStream, "sand" );
+}
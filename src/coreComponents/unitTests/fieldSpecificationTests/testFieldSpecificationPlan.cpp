@@ -0,0 +1,210 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/initialization.hpp"
+#include "fieldSpecification/FieldSpecificationManager.hpp"
+#include "functions/FunctionManager.hpp"
+#include "functions/TableFunction.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/generators/CellBlockManager.hpp"
+#include "common/DataTypes.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+FieldSpecificationBase & registerFieldSpecification( DomainPartition & domain,
+                                                     string const & name,
+                                                     string const & setName,
+                                                     real64 const scale,
+                                                     real64 const beginTime,
+                                                     string const & functionName )
+{
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+  FieldSpecificationBase & fs = fsManager.registerGroup< FieldSpecificationBase >( name );
+  fs.setFieldName( "plannedField" );
+  fs.setObjectPath( "ElementRegions/reg/hex" );
+  fs.setMeshObjectPath( domain.getMeshBodies() );
+  fs.setScale( scale );
+  fs.addSetName( setName );
+  fs.getReference< real64 >( FieldSpecificationBase::viewKeyStruct::beginTimeString() ) = beginTime;
+  fs.getReference< string >( FieldSpecificationBase::viewKeyStruct::functionNameString() ) = functionName;
+  return fs;
+}
+
+TEST( FieldSpecification, Plan )
+{
+  localIndex const numElems = 20;
+
+  DomainPartition & domain = getGlobalState().getProblemManager().getDomainPartition();
+  MeshBody & meshBody = domain.getMeshBodies().registerGroup< MeshBody >( "body" );
+  MeshLevel & meshLevel = meshBody.getMeshLevels().registerGroup< MeshLevel >( string( "Level0" ) );
+
+  ElementRegionManager & elemManager = meshLevel.getElemManager();
+  CellElementRegion & region = dynamicCast< CellElementRegion & >( *elemManager.createChild( "CellElementRegion", "reg" ) );
+  {
+    CellBlockManager & cellBlockManager = domain.registerGroup< CellBlockManager >( keys::cellManager );
+    CellBlock & hex = cellBlockManager.registerCellBlock( "hex" );
+    hex.setElementType( geos::ElementType::Hexahedron );
+    hex.resize( numElems );
+    region.addCellBlockName( hex.getName() );
+    region.generateMesh( cellBlockManager.getCellBlocks() );
+    domain.deregisterGroup( keys::cellManager );
+  }
+
+  ElementSubRegionBase & subRegion = region.getSubRegion( "hex" );
+  array1d< real64 > & field = subRegion.registerWrapper< array1d< real64 > >( "plannedField" ).reference();
+  array1d< real64 > & boundaryField = subRegion.registerWrapper< array1d< real64 > >( "boundaryField" ).reference();
+
+  SortedArray< localIndex > & lowSet = subRegion.getGroup( "sets" ).registerWrapper< SortedArray< localIndex > >( string( "low" ) ).reference();
+  SortedArray< localIndex > & highSet = subRegion.getGroup( "sets" ).registerWrapper< SortedArray< localIndex > >( string( "high" ) ).reference();
+  for( localIndex i = 0; i < 12; ++i )
+  {
+    lowSet.insert( i );
+    highSet.insert( numElems - 1 - i );
+  }
+
+  // f(t) = t
+  FunctionManager & functionManager = FunctionManager::getInstance();
+  TableFunction & table = dynamicCast< TableFunction & >( *functionManager.createChild( "TableFunction", "timeTable" ) );
+  array1d< real64_array > coordinates( 1 );
+  coordinates[0].emplace_back( 0.0 );
+  coordinates[0].emplace_back( 100.0 );
+  table.setTableCoordinates( coordinates, { units::Time } );
+  table.setTableValues( coordinates[0], units::Dimensionless );
+  table.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  string_array inputVarNames;
+  inputVarNames.emplace_back( "time" );
+  table.setInputVarNames( inputVarNames );
+  table.reInitializeFunction();
+
+  // the applications overlap, the last active one must win
+  FieldSpecificationBase & fsA = registerFieldSpecification( domain, "constantLow", "low", 1.0, 0.0, "" );
+  fsA.getReference< real64 >( FieldSpecificationBase::viewKeyStruct::endTimeString() ) = 10.0;
+  registerFieldSpecification( domain, "timeHigh", "high", 2.0, 0.0, "timeTable" );
+  registerFieldSpecification( domain, "lateLow", "low", 5.0, 5.0, "" );
+
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+  for( real64 const time : { 1.0, 6.0, 12.0, 3.0 } )
+  {
+    field.zero();
+    boundaryField.zero();
+    localIndex numApplications = 0;
+    fsManager.applyFieldValue< serialPolicy >( time, meshLevel, "plannedField",
+                                               [&]( FieldSpecificationBase const &,
+                                                    SortedArrayView< localIndex const > const & )
+    {
+      ++numApplications;
+    } );
+    field.move( hostMemorySpace, false );
+
+    // same values applied to another field
+    fsManager.applyFieldValueToField< ElementSubRegionBase, serialPolicy >( time, meshLevel, "plannedField", "boundaryField",
+                                                                            [&]( FieldSpecificationBase const &,
+                                                                                 string const &,
+                                                                                 SortedArrayView< localIndex const > const &,
+                                                                                 ElementSubRegionBase &,
+                                                                                 string const & targetField )
+    {
+      EXPECT_EQ( targetField, "boundaryField" );
+    } );
+    boundaryField.move( hostMemorySpace, false );
+
+    // the active applications visited by apply
+    localIndex numVisitedApplications = 0;
+    fsManager.apply< ElementSubRegionBase >( time, meshLevel, "plannedField",
+                                             [&]( FieldSpecificationBase const &,
+                                                  string const &,
+                                                  SortedArrayView< localIndex const > const & targetSet,
+                                                  ElementSubRegionBase &,
+                                                  string const & )
+    {
+      EXPECT_EQ( targetSet.size(), 12 );
+      ++numVisitedApplications;
+    } );
+    EXPECT_EQ( numVisitedApplications, numApplications );
+
+    for( localIndex i = 0; i < numElems; ++i )
+    {
+      real64 expected = 0.0;
+      bool const isLow = i < 12;
+      bool const isHigh = i >= numElems - 12;
+      if( isLow && time < 10.0 )
+      {
+        expected = 1.0;
+      }
+      if( isHigh )
+      {
+        expected = 2.0 * time;
+      }
+      if( isLow && time >= 5.0 )
+      {
+        expected = 5.0;
+      }
+      EXPECT_DOUBLE_EQ( field[i], expected ) << "element " << i << " at time " << time;
+      EXPECT_DOUBLE_EQ( boundaryField[i], expected ) << "element " << i << " at time " << time;
+    }
+    EXPECT_EQ( numApplications, 1 + ( time < 10.0 ) + ( time >= 5.0 ) );
+  }
+
+  // with pre/post lambdas, each application only sees the previous ones
+  field.zero();
+  std::vector< real64 > appliedValues;
+  fsManager.applyFieldValue< serialPolicy >( 6.0, meshLevel, "plannedField",
+                                             [&]( FieldSpecificationBase const &,
+                                                  SortedArrayView< localIndex const > const & ){},
+                                             [&]( FieldSpecificationBase const &,
+                                                  SortedArrayView< localIndex const > const & targetSet )
+  {
+    field.move( hostMemorySpace, false );
+    appliedValues.emplace_back( field[targetSet[0]] );
+  } );
+  ASSERT_EQ( appliedValues.size(), 3 );
+  EXPECT_DOUBLE_EQ( appliedValues[0], 1.0 );
+  EXPECT_DOUBLE_EQ( appliedValues[1], 12.0 );
+  EXPECT_DOUBLE_EQ( appliedValues[2], 5.0 );
+
+  // a change of scale, and a change of the contents of a set keeping its size, are taken into account
+  fsA.setScale( 3.0 );
+  lowSet.remove( 0 );
+  lowSet.insert( 12 );
+  field.zero();
+  fsManager.applyFieldValue< serialPolicy >( 1.0, meshLevel, "plannedField",
+                                             [&]( FieldSpecificationBase const &,
+                                                  SortedArrayView< localIndex const > const & ){} );
+  field.move( hostMemorySpace, false );
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    real64 const expected = ( i == 0 ) ? 0.0 : ( i < numElems - 12 ) ? 3.0 : 2.0;
+    EXPECT_DOUBLE_EQ( field[i], expected ) << "element " << i;
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  GeosxState state( basicSetup( argc, argv ) );
+
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
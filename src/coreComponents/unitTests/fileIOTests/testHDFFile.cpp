@@ -129,6 +129,125 @@ TEST( testHDFIO, IdxArrayHistory )
   }
 }
 
+TEST( testHDFIO, CompressedChunkedHistory )
+{
+  string filename( "compressed_history" );
+  // the storage options only apply to new datasets
+  remove( filename.c_str() );
+  Array< real64, 1 > arr( 512 );
+  localIndex const numRecords = 10;
+
+  HistoryMetadata spec = getHistoryMetadata( "Compressed History", arr.toViewConst( ), 1 );
+  HDFHistoryIO io( filename, spec );
+  HDFHistoryStorage storage;
+  storage.chunkRecords = 4;
+  storage.chunkIndices = 128;
+  storage.compressionLevel = 4;
+  storage.shuffle = true;
+  io.setStorage( storage );
+  io.init( true );
+
+  // the first write goes through the per-row path, the second one writes all the buffered rows at once
+  localIndex record = 0;
+  for( localIndex const numBuffered : { localIndex( 3 ), numRecords - 3 } )
+  {
+    for( localIndex row = 0; row < numBuffered; ++row, ++record )
+    {
+      for( localIndex i = 0; i < arr.size(); ++i )
+      {
+        arr[i] = record * 1000.0 + i;
+      }
+      io.updateCollectingCount( arr.size() );
+      buffer_unit_type * buffer = io.getBufferHead( );
+      parallelDeviceEvents packEvents;
+      bufferOps::PackDataDevice< true >( buffer, arr.toViewConst( ), packEvents );
+      waitAllDeviceEvents( packEvents );
+    }
+    EXPECT_EQ( io.getBufferedBytes(), numBuffered * arr.size() * sizeof( real64 ) );
+    io.write( );
+    EXPECT_EQ( io.getBufferedBytes(), 0 );
+  }
+  io.compressInFile( );
+
+  // read and check the data using hdf api
+  hid_t file = H5Fopen( filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  hid_t dataset = H5Dopen( file, "Compressed History", H5P_DEFAULT );
+
+  hid_t dcpl = H5Dget_create_plist( dataset );
+  EXPECT_EQ( H5Pget_layout( dcpl ), H5D_CHUNKED );
+  hsize_t chunkDims[2];
+  EXPECT_EQ( H5Pget_chunk( dcpl, 2, chunkDims ), 2 );
+  EXPECT_EQ( chunkDims[0], 4 );
+  EXPECT_EQ( chunkDims[1], 128 );
+  EXPECT_EQ( H5Pget_nfilters( dcpl ), 2 );
+  H5Pclose( dcpl );
+
+  hid_t filespace = H5Dget_space( dataset );
+  hsize_t dims[2];
+  EXPECT_EQ( H5Sget_simple_extent_dims( filespace, dims, nullptr ), 2 );
+  EXPECT_EQ( dims[0], numRecords );
+  EXPECT_EQ( dims[1], arr.size() );
+
+  std::vector< real64 > values( numRecords * arr.size() );
+  H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data() );
+  for( localIndex record = 0; record < numRecords; ++record )
+  {
+    for( localIndex i = 0; i < arr.size(); ++i )
+    {
+      EXPECT_EQ( values[record * arr.size() + i], record * 1000.0 + i );
+    }
+  }
+
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+  H5Fclose( file );
+  remove( filename.c_str() );
+}
+
+TEST( testHDFIO, RingBufferedHistory )
+{
+  string filename( "ring_history" );
+  remove( filename.c_str() );
+  localIndex const capacity = 4;
+  real64 value = 0.0;
+
+  HistoryMetadata spec( "Ring History", 1, std::type_index( typeid(real64)));
+  HDFHistoryIO io( filename, spec );
+  io.setRingCapacity( capacity );
+  io.init( true );
+
+  HistoryMetadata metadata;
+  EXPECT_EQ( io.getBufferedStates( metadata ), nullptr );
+
+  // collect more states than the capacity, only the most recent ones are kept
+  for( localIndex tidx = 0; tidx < 2 * capacity + 1; ++tidx )
+  {
+    value += 1.0;
+    buffer_unit_type * buffer = io.getBufferHead( );
+    memcpy( buffer, &value, sizeof(real64));
+    EXPECT_EQ( io.getBufferedCount( ), std::min( tidx + 1, capacity ) );
+  }
+
+  buffer_unit_type const * const states = io.getBufferedStates( metadata );
+  ASSERT_NE( states, nullptr );
+  EXPECT_EQ( metadata.getName(), "Ring History" );
+  EXPECT_EQ( metadata.getType(), std::type_index( typeid(real64)));
+  ASSERT_EQ( metadata.getRank(), 2 );
+  EXPECT_EQ( metadata.getDims()[0], capacity );
+  EXPECT_EQ( metadata.getDims()[1], 1 );
+  for( localIndex tidx = 0; tidx < capacity; ++tidx )
+  {
+    real64 state;
+    memcpy( &state, states + tidx * sizeof(real64), sizeof(real64));
+    EXPECT_EQ( state, value - capacity + 1 + tidx );
+  }
+
+  io.write( );
+  EXPECT_EQ( io.getBufferedCount( ), 0 );
+  EXPECT_EQ( io.getBufferedStates( metadata ), nullptr );
+  remove( filename.c_str() );
+}
+
 int main( int ac, char * av[] )
 {
   ::testing::InitGoogleTest( &ac, av );
@@ -21,6 +21,7 @@
 #include "finiteVolume/mimeticInnerProducts/QuasiTPFAInnerProduct.hpp"
 #include "finiteVolume/mimeticInnerProducts/SimpleInnerProduct.hpp"
 #include "finiteVolume/mimeticInnerProducts/BdVLMInnerProduct.hpp"
+#include "finiteVolume/mimeticInnerProducts/MimeticInnerProductHelpers.hpp"
 #include "mainInterface/initialization.hpp"
 #include "mesh/FaceManager.hpp"
 #include "mesh/utilities/ComputationalGeometry.hpp"
@@ -722,6 +723,98 @@ TEST( testMimeticInnerProducts, BdVLM_hexa )
 }
 
 
+TEST( testMimeticInnerProducts, BdVLM_hexa_cached )
+{
+  localIndex constexpr NF = 6;
+
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > nodePosition;
+  FaceManager::NodeMapType faceToNodes;
+  array1d< localIndex > elemToFaces;
+  real64 elemCenter[3] = { 0.0 };
+  real64 elemPerm[3] = { 0.0 };
+  real64 elemVolume = 0;
+  real64 lengthTolerance = 0;
+  stackArray2d< real64, NF *NF > transMatrixRef( NF, NF );
+
+  makeHexa( nodePosition,
+            faceToNodes,
+            elemToFaces,
+            elemCenter,
+            elemVolume,
+            elemPerm,
+            lengthTolerance,
+            InnerProductType::BDVLM,
+            transMatrixRef );
+
+  stackArray2d< real64, NF *NF > transMatrix( NF, NF );
+  array1d< real64 > transMultiplier( NF );
+  transMultiplier.setValues< parallelHostPolicy >( 1.0 );
+
+  stackArray1d< real64, 3 > center( 3 );
+  center[0] = elemCenter[0];
+  center[1] = elemCenter[1];
+  center[2] = elemCenter[2];
+  real64 const perm[ 3 ] = { elemPerm[0], elemPerm[1], elemPerm[2] };
+
+  array1d< real64 > cache( MimeticInnerProductHelpers::transMatrixCacheSize( NF ) );
+  cache.setValues< serialPolicy >( -1.0 );
+
+  // 1) empty cache: the matrix is computed and cached
+  MimeticInnerProductHelpers::computeCached< BdVLMInnerProduct, NF >( nodePosition.toViewConst(),
+                                                                      transMultiplier.toViewConst(),
+                                                                      faceToNodes.toViewConst(),
+                                                                      elemToFaces.toSliceConst(),
+                                                                      center,
+                                                                      elemVolume,
+                                                                      perm,
+                                                                      lengthTolerance,
+                                                                      cache.toSlice(),
+                                                                      transMatrix.toSlice() );
+  compareTransmissibilityMatrices( transMatrix, transMatrixRef );
+  EXPECT_EQ( cache[0], perm[0] );
+  EXPECT_EQ( cache[1], perm[1] );
+  EXPECT_EQ( cache[2], perm[2] );
+
+  // 2) same permeability: the cached matrix is returned, even if the (here inconsistent) volume has changed
+  MimeticInnerProductHelpers::computeCached< BdVLMInnerProduct, NF >( nodePosition.toViewConst(),
+                                                                      transMultiplier.toViewConst(),
+                                                                      faceToNodes.toViewConst(),
+                                                                      elemToFaces.toSliceConst(),
+                                                                      center,
+                                                                      2.0 * elemVolume,
+                                                                      perm,
+                                                                      lengthTolerance,
+                                                                      cache.toSlice(),
+                                                                      transMatrix.toSlice() );
+  compareTransmissibilityMatrices( transMatrix, transMatrixRef );
+
+  // 3) new permeability: the matrix is recomputed
+  real64 const newPerm[ 3 ] = { 2.0 * elemPerm[0], elemPerm[1], 0.5 * elemPerm[2] };
+  stackArray2d< real64, NF *NF > newTransMatrixRef( NF, NF );
+  BdVLMInnerProduct::compute< NF >( nodePosition.toViewConst(),
+                                    transMultiplier.toViewConst(),
+                                    faceToNodes.toViewConst(),
+                                    elemToFaces.toSliceConst(),
+                                    center,
+                                    elemVolume,
+                                    newPerm,
+                                    lengthTolerance,
+                                    newTransMatrixRef.toSlice() );
+  MimeticInnerProductHelpers::computeCached< BdVLMInnerProduct, NF >( nodePosition.toViewConst(),
+                                                                      transMultiplier.toViewConst(),
+                                                                      faceToNodes.toViewConst(),
+                                                                      elemToFaces.toSliceConst(),
+                                                                      center,
+                                                                      elemVolume,
+                                                                      newPerm,
+                                                                      lengthTolerance,
+                                                                      cache.toSlice(),
+                                                                      transMatrix.toSlice() );
+  compareTransmissibilityMatrices( transMatrix, newTransMatrixRef );
+  EXPECT_EQ( cache[0], newPerm[0] );
+  EXPECT_EQ( cache[2], newPerm[2] );
+}
+
 TEST( testMimeticInnerProducts, TPFA_tetra )
 {
   localIndex constexpr NF = 4;
@@ -0,0 +1,296 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkHybridFVMFluxAssembly.cpp
+ *
+ * Flux assembly of SinglePhaseHybridFVM on hexahedral and tetrahedral meshes, for the quasiTPFA and the
+ * BdVLM inner products:
+ *  - with the mimetic transmissibility cache filled at initialization (the permeability is unchanged);
+ *  - with the cache invalidated before each assembly, so that every transmissibility matrix is recomputed.
+ *
+ * The fill of the cache with the BdVLM inner product is also timed element by element, and by batches of
+ * elements whose 3x3 systems are factorized together.
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseHybridFVM.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
+#include "constitutive/permeability/PermeabilityBase.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+namespace
+{
+
+constexpr real64 dt = 1e2;
+
+constexpr char const * elementTypes[] = { "C3D8", "C3D4" };
+constexpr char const * innerProductTypes[] = { "quasiTPFA", "beiraoDaVeigaLipnikovManzini" };
+
+string const xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SinglePhaseHybridFVM
+        name="flowSolver"
+        discretization="hybridMimetic"
+        targetRegions="{ Region }"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ ELEMENT_TYPE }"
+        xCoords="{ 0, 32 }"
+        yCoords="{ 0, 32 }"
+        zCoords="{ 0, 32 }"
+        nx="{ 32 }"
+        ny="{ 32 }"
+        nz="{ 32 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <NumericalMethods>
+      <FiniteVolume>
+        <HybridMimeticDiscretization
+          name="hybridMimetic"
+          innerProductType="INNER_PRODUCT_TYPE"/>
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ fluid, rock }"/>
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSinglePhaseFluid
+        name="fluid"
+        defaultDensity="1000"
+        defaultViscosity="0.001"
+        referencePressure="0.0"
+        compressibility="5e-10"
+        viscosibility="0.0"/>
+      <CompressibleSolidConstantPermeability
+        name="rock"
+        solidModelName="nullSolid"
+        porosityModelName="rockPorosity"
+        permeabilityModelName="rockPerm"/>
+      <NullModel
+        name="nullSolid"/>
+      <PressurePorosity
+        name="rockPorosity"
+        defaultReferencePorosity="0.05"
+        referencePressure="0.0"
+        compressibility="1.0e-9"/>
+      <ConstantPermeability
+        name="rockPerm"
+        permeabilityComponents="{ 2.0e-16, 1.0e-16, 5.0e-17 }"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressure"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="ElementRegions"
+        fieldName="pressure"
+        scale="5e6"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+/**
+ * @brief Invalidate the transmissibility matrices cached in the target subregions of the solver.
+ * @param solver the hybrid FVM solver
+ * @param domain the domain partition
+ *
+ * The cached permeability no longer matches the actual one, hence the next assembly recomputes (and caches
+ * again) the transmissibility matrix of every element.
+ */
+void invalidateTransMatrixCache( SinglePhaseHybridFVM & solver,
+                                 DomainPartition & domain )
+{
+  solver.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                      MeshLevel & mesh,
+                                                                      arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      arrayView2d< real64 > const transMatrixCache =
+        subRegion.getField< fields::flow::mimeticTransMatrix >().toView();
+      forAll< parallelDevicePolicy<> >( transMatrixCache.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+      {
+        transMatrixCache( ei, 0 ) = -1.0;
+      } );
+    } );
+  } );
+}
+
+/**
+ * @brief Time SinglePhaseHybridFVM::assembleFluxTerms.
+ * @tparam USE_CACHE whether the cached transmissibility matrices are valid during the assembly
+ * @param state the benchmark state, with the element type and the inner product type as arguments
+ */
+template< bool USE_CACHE >
+void assembleFluxTerms( benchmark::State & state )
+{
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = geosxState.getProblemManager();
+
+  string input = xmlInput;
+  input.replace( input.find( "ELEMENT_TYPE" ), 12, elementTypes[ state.range( 0 ) ] );
+  input.replace( input.find( "INNER_PRODUCT_TYPE" ), 18, innerProductTypes[ state.range( 1 ) ] );
+  setupProblemFromXML( problemManager, input.c_str() );
+
+  SinglePhaseHybridFVM & solver =
+    problemManager.getPhysicsSolverManager().getGroup< SinglePhaseHybridFVM >( "flowSolver" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+  solver.implicitStepSetup( 0.0, dt, domain );
+
+  DofManager const & dofManager = solver.getDofManager();
+  CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+  array1d< real64 > localRhs( dofManager.numLocalDofs() );
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    localMatrix.zero();
+    localRhs.zero();
+    if( !USE_CACHE )
+    {
+      invalidateTransMatrixCache( solver, domain );
+    }
+    state.ResumeTiming();
+
+    solver.assembleFluxTerms( dt,
+                              domain,
+                              dofManager,
+                              localMatrix.toViewConstSizes(),
+                              localRhs.toView() );
+  }
+
+  state.SetLabel( string( elementTypes[ state.range( 0 ) ] ) + ", " + innerProductTypes[ state.range( 1 ) ] );
+  state.SetItemsProcessed( state.iterations() * domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getNumberOfElements() );
+}
+
+/**
+ * @brief Time the fill of the transmissibility matrix cache with the BdVLM inner product.
+ * @tparam BATCH_SIZE the number of elements whose transmissibility matrices are computed together
+ * @param state the benchmark state, with the element type as argument
+ */
+template< integer BATCH_SIZE >
+void fillTransMatrixCache( benchmark::State & state )
+{
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = geosxState.getProblemManager();
+
+  string input = xmlInput;
+  input.replace( input.find( "ELEMENT_TYPE" ), 12, elementTypes[ state.range( 0 ) ] );
+  input.replace( input.find( "INNER_PRODUCT_TYPE" ), 18, innerProductTypes[ 1 ] );
+  setupProblemFromXML( problemManager, input.c_str() );
+
+  SinglePhaseHybridFVM & solver =
+    problemManager.getPhysicsSolverManager().getGroup< SinglePhaseHybridFVM >( "flowSolver" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+  CellElementSubRegion & subRegion =
+    mesh.getElemManager().getRegion( "Region" ).getSubRegion< CellElementSubRegion >( 0 );
+  constitutive::PermeabilityBase const & permeability =
+    subRegion.getConstitutiveModel< constitutive::PermeabilityBase >( "rockPerm" );
+  real64 const lengthTolerance = domain.getMeshBody( 0 ).getGlobalLengthScale() * 1e-8;
+
+  auto const fill = [&]( auto const NUM_FACES )
+  {
+    hybridFVMKernels::TransMatrixCacheKernel::
+      launch< mimeticInnerProduct::BdVLMInnerProduct, NUM_FACES, BATCH_SIZE >( subRegion.size(),
+                                                                               nodeManager.referencePosition(),
+                                                                               faceManager.getField< fields::flow::transMultiplier >(),
+                                                                               faceManager.nodeList().toViewConst(),
+                                                                               subRegion.faceList().toViewConst(),
+                                                                               subRegion.getElementCenter(),
+                                                                               subRegion.getElementVolume(),
+                                                                               permeability.permeability(),
+                                                                               lengthTolerance,
+                                                                               subRegion.getField< fields::flow::mimeticTransMatrix >() );
+  };
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    invalidateTransMatrixCache( solver, domain );
+    state.ResumeTiming();
+
+    if( subRegion.numFacesPerElement() == 6 )
+    {
+      fill( std::integral_constant< integer, 6 >() );
+    }
+    else
+    {
+      fill( std::integral_constant< integer, 4 >() );
+    }
+  }
+
+  state.SetLabel( elementTypes[ state.range( 0 ) ] );
+  state.SetItemsProcessed( state.iterations() * subRegion.size() );
+}
+
+void meshAndInnerProductTypes( benchmark::internal::Benchmark * b )
+{
+  for( int elementType = 0; elementType < 2; ++elementType )
+  {
+    for( int innerProductType = 0; innerProductType < 2; ++innerProductType )
+    {
+      b->Args( { elementType, innerProductType } );
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE( assembleFluxTerms, true )->Apply( meshAndInnerProductTypes )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( assembleFluxTerms, false )->Apply( meshAndInnerProductTypes )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( fillTransMatrixCache, 1 )->DenseRange( 0, 1 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( fillTransMatrixCache, 8 )->DenseRange( 0, 1 )->Unit( benchmark::kMillisecond );
+
+} // namespace
+
+int main( int argc, char * * argv )
+{
+  ::benchmark::Initialize( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  ::benchmark::RunSpecifiedBenchmarks();
+  geos::basicCleanup();
+  return 0;
+}
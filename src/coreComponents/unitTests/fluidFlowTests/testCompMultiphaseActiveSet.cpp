@@ -0,0 +1,339 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * pvtLiquid = "DensityFun PhillipsBrineDensity 1e6 7.5e7 5e5 295.15 370.15 25 0\n"
+                         "ViscosityFun PhillipsBrineViscosity 0\n";
+
+char const * pvtGas = "DensityFun SpanWagnerCO2Density 1e6 7.5e7 5e5 295.15 370.15 25\n"
+                      "ViscosityFun FenghourCO2Viscosity 1e6 7.5e7 5e5 295.15 370.15 25\n";
+
+char const * co2flash = "FlashModel CO2Solubility 1e6 7.5e7 5e5 295.15 370.15 25 0";
+
+// CO2 displacing brine between a source and a sink. The active set freezes the cells whose state
+// changes by less than activeSetTolerance, and all the properties are evaluated every 100 updates only,
+// so that most of the Newton iterations use a partially updated state.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <CompositionalMultiphaseFVM name="compflow"
+                                  logLevel="1"
+                                  discretization="fluidTPFA"
+                                  temperature="368.15"
+                                  useMass="1"
+                                  activeSetTolerance="1e-3"
+                                  activeSetRefreshFrequency="100"
+                                  targetRegions="{ region }">
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="20"
+                                   lineSearchAction="None"
+                                   maxTimeStepCuts="5" />
+        <LinearSolverParameters directParallel="0" />
+      </CompositionalMultiphaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 20 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 1 }"
+                    nx="{ 10 }"
+                    ny="{ 1 }"
+                    nz="{ 1 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Geometry>
+      <Box name="source"
+           xMin="{ -0.01, -0.01, -0.01 }"
+           xMax="{ 2.01, 1.01, 1.01 }" />
+      <Box name="sink"
+           xMin="{ 17.99, -0.01, -0.01 }"
+           xMax="{ 20.01, 1.01, 1.01 }" />
+    </Geometry>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ fluid, rock, relperm }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.2"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CO2BrinePhillipsFluid name="fluid"
+                             phaseNames="{ gas, water }"
+                             componentNames="{ co2, water }"
+                             componentMolarWeight="{ 44e-3, 18e-3 }"
+                             phasePVTParaFiles="{ pvtgas.txt, pvtliquid.txt }"
+                             flashModelParaFile="co2flash.txt" />
+      <BrooksCoreyRelativePermeability name="relperm"
+                                       phaseNames="{ gas, water }"
+                                       phaseMinVolumeFraction="{ 0.0, 0.0 }"
+                                       phaseRelPermExponent="{ 1.5, 1.5 }"
+                                       phaseRelPermMaxValue="{ 0.9, 0.9 }" />
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6" />
+      <FieldSpecification name="initialComposition_co2"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.01" />
+      <FieldSpecification name="initialComposition_water"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.99" />
+      <FieldSpecification name="sourcePressure"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="1.2e7" />
+      <FieldSpecification name="sourceComposition_co2"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.9" />
+      <FieldSpecification name="sourceComposition_water"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.1" />
+      <FieldSpecification name="sinkPressure"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="8e6" />
+      <FieldSpecification name="sinkComposition_co2"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.01" />
+      <FieldSpecification name="sinkComposition_water"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.99" />
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+void writeTableToFile( string const & filename, char const * str )
+{
+  std::ofstream os( filename );
+  ASSERT_TRUE( os.is_open() );
+  os << str;
+  os.close();
+}
+
+void removeFile( string const & filename )
+{
+  int const ret = std::remove( filename.c_str() );
+  ASSERT_TRUE( ret == 0 );
+}
+
+/// Primary variables at the end of the simulation
+struct Solution
+{
+  array1d< real64 > pressure;
+  array2d< real64 > compDens;
+};
+
+class CompositionalMultiphaseActiveSetTest : public ::testing::Test
+{
+public:
+
+  CompositionalMultiphaseActiveSetTest()
+  {
+    writeTableToFile( pvtLiquidFilename, pvtLiquid );
+    writeTableToFile( pvtGasFilename, pvtGas );
+    writeTableToFile( co2flashFilename, co2flash );
+  }
+
+  ~CompositionalMultiphaseActiveSetTest() override
+  {
+    removeFile( pvtLiquidFilename );
+    removeFile( pvtGasFilename );
+    removeFile( co2flashFilename );
+  }
+
+protected:
+
+  /**
+   * @brief Run the time steps, with or without active set.
+   * @param activeSetTolerance the tolerance of the active set, 0 to disable it
+   * @return the primary variables at the end of the simulation
+   */
+  Solution run( real64 const activeSetTolerance )
+  {
+    GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    CompositionalMultiphaseFVM & solver =
+      state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+    solver.getReference< real64 >( CompositionalMultiphaseBase::viewKeyStruct::activeSetToleranceString() ) = activeSetTolerance;
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    for( integer cycle = 0; cycle < numSteps; ++cycle )
+    {
+      real64 const dtAccepted = solver.solverStep( cycle * dt, dt, cycle, domain );
+      EXPECT_DOUBLE_EQ( dtAccepted, dt );
+    }
+
+    ElementSubRegionBase & subRegion =
+      domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion( "cb" );
+
+    Solution solution;
+    solution.pressure.resize( subRegion.size() );
+    solution.pressure.setValues< serialPolicy >( subRegion.getField< fields::flow::pressure >().toViewConst() );
+    arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+      subRegion.getField< fields::flow::globalCompDensity >().toViewConst();
+    compDens.move( hostMemorySpace, false );
+    solution.compDens.resize( compDens.size( 0 ), compDens.size( 1 ) );
+    for( localIndex ei = 0; ei < compDens.size( 0 ); ++ei )
+    {
+      for( integer ic = 0; ic < compDens.size( 1 ); ++ic )
+      {
+        solution.compDens( ei, ic ) = compDens( ei, ic );
+      }
+    }
+
+    if( activeSetTolerance > 0.0 )
+    {
+      checkPropertiesRefreshed( solver, domain, subRegion );
+    }
+    return solution;
+  }
+
+  /**
+   * @brief Check that the properties of the converged state are up to date in all the cells.
+   * @param solver the solver
+   * @param domain the domain
+   * @param subRegion the subregion
+   *
+   * Evaluating the properties of all the cells again must not change them: the cells frozen during
+   * the Newton iterations have been refreshed before convergence was declared.
+   */
+  void checkPropertiesRefreshed( CompositionalMultiphaseFVM & solver,
+                                 DomainPartition & domain,
+                                 ElementSubRegionBase & subRegion )
+  {
+    arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
+      subRegion.getField< fields::flow::phaseVolumeFraction >().toViewConst();
+    arrayView2d< real64 const, compflow::USD_PHASE > const phaseMob =
+      subRegion.getField< fields::flow::phaseMobility >().toViewConst();
+    phaseVolFrac.move( hostMemorySpace, false );
+    phaseMob.move( hostMemorySpace, false );
+    array2d< real64 > phaseVolFracConverged( phaseVolFrac.size( 0 ), phaseVolFrac.size( 1 ) );
+    array2d< real64 > phaseMobConverged( phaseMob.size( 0 ), phaseMob.size( 1 ) );
+    for( localIndex ei = 0; ei < phaseVolFrac.size( 0 ); ++ei )
+    {
+      for( integer ip = 0; ip < phaseVolFrac.size( 1 ); ++ip )
+      {
+        phaseVolFracConverged( ei, ip ) = phaseVolFrac( ei, ip );
+        phaseMobConverged( ei, ip ) = phaseMob( ei, ip );
+      }
+    }
+
+    solver.getReference< real64 >( CompositionalMultiphaseBase::viewKeyStruct::activeSetToleranceString() ) = 0.0;
+    solver.updateState( domain );
+
+    phaseVolFrac.move( hostMemorySpace, false );
+    phaseMob.move( hostMemorySpace, false );
+    for( localIndex ei = 0; ei < phaseVolFrac.size( 0 ); ++ei )
+    {
+      for( integer ip = 0; ip < phaseVolFrac.size( 1 ); ++ip )
+      {
+        EXPECT_DOUBLE_EQ( phaseVolFrac( ei, ip ), phaseVolFracConverged( ei, ip ) ) << "cell " << ei << ", phase " << ip;
+        EXPECT_DOUBLE_EQ( phaseMob( ei, ip ), phaseMobConverged( ei, ip ) ) << "cell " << ei << ", phase " << ip;
+      }
+    }
+  }
+
+  static integer constexpr numSteps = 5;
+  static real64 constexpr dt = 1e4;
+
+  string const pvtLiquidFilename = "pvtliquid.txt";
+  string const pvtGasFilename = "pvtgas.txt";
+  string const co2flashFilename = "co2flash.txt";
+};
+
+integer constexpr CompositionalMultiphaseActiveSetTest::numSteps;
+real64 constexpr CompositionalMultiphaseActiveSetTest::dt;
+
+TEST_F( CompositionalMultiphaseActiveSetTest, sameSolutionAsWithoutActiveSet )
+{
+  Solution const reference = run( 0.0 );
+  Solution const activeSet = run( 1e-3 );
+
+  // both solutions are converged to the Newton tolerance
+  real64 const relTol = 1e-6;
+  for( localIndex ei = 0; ei < reference.pressure.size(); ++ei )
+  {
+    EXPECT_NEAR( activeSet.pressure[ei], reference.pressure[ei], relTol * reference.pressure[ei] ) << "cell " << ei;
+    for( integer ic = 0; ic < reference.compDens.size( 1 ); ++ic )
+    {
+      real64 const totalDens = reference.compDens( ei, 0 ) + reference.compDens( ei, 1 );
+      EXPECT_NEAR( activeSet.compDens( ei, ic ), reference.compDens( ei, ic ), relTol * totalDens ) << "cell " << ei << ", component " << ic;
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,449 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "constitutive/fluid/multifluid/Layouts.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseHybridFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * pvtLiquid = "DensityFun PhillipsBrineDensity 1e6 7.5e7 5e5 295.15 370.15 25 0\n"
+                         "ViscosityFun PhillipsBrineViscosity 0\n";
+
+char const * pvtGas = "DensityFun SpanWagnerCO2Density 1e6 7.5e7 5e5 295.15 370.15 25\n"
+                      "ViscosityFun FenghourCO2Viscosity 1e6 7.5e7 5e5 295.15 370.15 25\n";
+
+char const * co2flash = "FlashModel CO2Solubility 1e6 7.5e7 5e5 295.15 370.15 25 0";
+
+// CO2 displacing a two-phase mixture between a source and a sink. The solver (SOLVER) and its
+// discretization (DISCRETIZATION) are chosen by the test.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SOLVER name="compflow"
+              logLevel="1"
+              discretization="DISCRETIZATION"
+              temperature="368.15"
+              useMass="1"
+              targetRegions="{ region }">
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="20"
+                                   lineSearchAction="None"
+                                   maxTimeStepCuts="5" />
+        <LinearSolverParameters directParallel="0" />
+      </SOLVER>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 20 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 1 }"
+                    nx="{ 10 }"
+                    ny="{ 1 }"
+                    nz="{ 1 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Geometry>
+      <Box name="source"
+           xMin="{ -0.01, -0.01, -0.01 }"
+           xMax="{ 2.01, 1.01, 1.01 }" />
+      <Box name="sink"
+           xMin="{ 17.99, -0.01, -0.01 }"
+           xMax="{ 20.01, 1.01, 1.01 }" />
+    </Geometry>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+        <HybridMimeticDiscretization name="fluidHM"
+                                     innerProductType="beiraoDaVeigaLipnikovManzini" />
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ fluid, rock, relperm }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.2"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CO2BrinePhillipsFluid name="fluid"
+                             phaseNames="{ gas, water }"
+                             componentNames="{ co2, water }"
+                             componentMolarWeight="{ 44e-3, 18e-3 }"
+                             phasePVTParaFiles="{ pvtgas.txt, pvtliquid.txt }"
+                             flashModelParaFile="co2flash.txt" />
+      <BrooksCoreyRelativePermeability name="relperm"
+                                       phaseNames="{ gas, water }"
+                                       phaseMinVolumeFraction="{ 0.0, 0.0 }"
+                                       phaseRelPermExponent="{ 1.5, 1.5 }"
+                                       phaseRelPermMaxValue="{ 0.9, 0.9 }" />
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6" />
+      <FieldSpecification name="initialFacePressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="faceManager"
+                          fieldName="facePressure"
+                          scale="9e6" />
+      <FieldSpecification name="initialComposition_co2"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.3" />
+      <FieldSpecification name="initialComposition_water"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.7" />
+      <FieldSpecification name="sourcePressure"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="1.2e7" />
+      <FieldSpecification name="sourceComposition_co2"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.9" />
+      <FieldSpecification name="sourceComposition_water"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.1" />
+      <FieldSpecification name="sinkPressure"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="8e6" />
+      <FieldSpecification name="sinkComposition_co2"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.3" />
+      <FieldSpecification name="sinkComposition_water"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.7" />
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+void writeTableToFile( string const & filename, char const * str )
+{
+  std::ofstream os( filename );
+  ASSERT_TRUE( os.is_open() );
+  os << str;
+  os.close();
+}
+
+void removeFile( string const & filename )
+{
+  int const ret = std::remove( filename.c_str() );
+  ASSERT_TRUE( ret == 0 );
+}
+
+/// Primary variables and solver statistics at the end of the simulation
+struct Run
+{
+  array1d< real64 > pressure;
+  array2d< real64 > compDens;
+  integer numNewtonIterations;
+  integer numTimeStepCuts;
+};
+
+class CompositionalMultiphasePhaseVolumeFractionScalingTest : public ::testing::Test
+{
+public:
+
+  CompositionalMultiphasePhaseVolumeFractionScalingTest()
+  {
+    writeTableToFile( pvtLiquidFilename, pvtLiquid );
+    writeTableToFile( pvtGasFilename, pvtGas );
+    writeTableToFile( co2flashFilename, co2flash );
+  }
+
+  ~CompositionalMultiphasePhaseVolumeFractionScalingTest() override
+  {
+    removeFile( pvtLiquidFilename );
+    removeFile( pvtGasFilename );
+    removeFile( co2flashFilename );
+  }
+
+protected:
+
+  /**
+   * @brief Set up the problem.
+   * @param state the state holding the problem
+   * @param solverType the catalog name of the solver
+   * @param discretization the name of the discretization
+   * @return the solver
+   */
+  static CompositionalMultiphaseBase & setupProblem( GeosxState & state,
+                                                     string const & solverType,
+                                                     string const & discretization )
+  {
+    string input = xmlInput;
+    for( std::size_t pos = input.find( "SOLVER" ); pos != string::npos; pos = input.find( "SOLVER", pos ) )
+    {
+      input.replace( pos, 6, solverType );
+    }
+    input.replace( input.find( "DISCRETIZATION" ), 14, discretization );
+    setupProblemFromXML( state.getProblemManager(), input.c_str() );
+    return state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseBase >( "compflow" );
+  }
+
+  /**
+   * @brief Scale an update adding CO2 to all the cells, and check the predicted changes of phase volume fraction.
+   * @param solverType the catalog name of the solver
+   * @param discretization the name of the discretization
+   * @param scalingType the scaling type of CompositionalMultiphaseFVM (Global for the hybrid solver)
+   */
+  void checkScaling( string const & solverType,
+                     string const & discretization,
+                     CompositionalMultiphaseFVM::ScalingType const scalingType )
+  {
+    GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+    CompositionalMultiphaseBase & solver = setupProblem( state, solverType, discretization );
+    if( solverType == CompositionalMultiphaseFVM::catalogName() )
+    {
+      solver.getReference< CompositionalMultiphaseFVM::ScalingType >( CompositionalMultiphaseFVM::viewKeyStruct::scalingTypeString() ) = scalingType;
+    }
+    bool const localScaling = scalingType == CompositionalMultiphaseFVM::ScalingType::Local;
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    solver.setupSystem( domain,
+                        solver.getDofManager(),
+                        solver.getLocalMatrix(),
+                        solver.getSystemRhs(),
+                        solver.getSystemSolution() );
+    solver.implicitStepSetup( 0.0, dt, domain );
+
+    DofManager const & dofManager = solver.getDofManager();
+    ElementSubRegionBase & subRegion =
+      domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion( "cb" );
+    arrayView1d< globalIndex const > const dofNumber =
+      subRegion.getReference< array1d< globalIndex > >( dofManager.getKey( CompositionalMultiphaseBase::viewKeyStruct::elemDofFieldString() ) );
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+      subRegion.getField< fields::flow::globalCompDensity >().toViewConst();
+    compDens.move( hostMemorySpace, false );
+
+    // the update adds CO2 and removes water, keeping the component fraction change below maxCompFractionChange
+    array1d< real64 > localSolution( dofManager.numLocalDofs() );
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        localIndex const localRow = dofNumber[ei] - dofManager.rankOffset();
+        real64 const totalDens = compDens( ei, 0 ) + compDens( ei, 1 );
+        localSolution[localRow + 1] = 0.3 * totalDens;
+        localSolution[localRow + 2] = -0.1 * totalDens;
+      }
+    }
+
+    // without chopping, nothing limits this update
+    real64 & maxPhaseVolFracChange =
+      solver.getReference< real64 >( CompositionalMultiphaseBase::viewKeyStruct::maxPhaseVolFracChangeString() );
+    maxPhaseVolFracChange = 1.0;
+    EXPECT_DOUBLE_EQ( solver.scalingForSystemSolution( domain, dofManager, localSolution.toViewConst() ), 1.0 );
+
+    maxPhaseVolFracChange = 0.05;
+    real64 const scalingFactor = solver.scalingForSystemSolution( domain, dofManager, localSolution.toViewConst() );
+
+    using Deriv = constitutive::multifluid::DerivativeOffset;
+    arrayView3d< real64 const, compflow::USD_PHASE_DC > const dPhaseVolFrac =
+      subRegion.getField< fields::flow::dPhaseVolumeFraction >().toViewConst();
+    arrayView1d< real64 const > const compDensScalingFactor =
+      subRegion.getField< fields::flow::globalCompDensityScalingFactor >().toViewConst();
+    dPhaseVolFrac.move( hostMemorySpace, false );
+    compDensScalingFactor.move( hostMemorySpace, false );
+
+    real64 maxChange = 0.0;
+    real64 minCellScalingFactor = 1.0;
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] >= 0 )
+      {
+        continue;
+      }
+      localIndex const localRow = dofNumber[ei] - dofManager.rankOffset();
+      real64 const cellScalingFactor = localScaling ? compDensScalingFactor[ei] : scalingFactor;
+      minCellScalingFactor = LvArray::math::min( minCellScalingFactor, cellScalingFactor );
+      for( integer ip = 0; ip < solver.numFluidPhases(); ++ip )
+      {
+        real64 change = 0.0;
+        for( integer ic = 0; ic < solver.numFluidComponents(); ++ic )
+        {
+          change += dPhaseVolFrac[ei][ip][Deriv::dC+ic] * cellScalingFactor * localSolution[localRow + ic + 1];
+        }
+        maxChange = LvArray::math::max( maxChange, LvArray::math::abs( change ) );
+      }
+    }
+    maxChange = MpiWrapper::max( maxChange );
+    minCellScalingFactor = MpiWrapper::min( minCellScalingFactor );
+
+    // the update is chopped, exactly down to the max allowed change where it is the most constraining
+    EXPECT_LT( minCellScalingFactor, 1.0 );
+    EXPECT_NEAR( maxChange, maxPhaseVolFracChange, 1e-12 );
+    if( localScaling )
+    {
+      EXPECT_DOUBLE_EQ( scalingFactor, 1.0 );
+    }
+  }
+
+  /**
+   * @brief Run the time steps with CompositionalMultiphaseFVM.
+   * @param scalingType the scaling type
+   * @param maxPhaseVolFracChange the max allowed change in phase volume fraction
+   * @return the primary variables at the end of the simulation, and the solver statistics
+   */
+  Run run( CompositionalMultiphaseFVM::ScalingType const scalingType,
+           real64 const maxPhaseVolFracChange )
+  {
+    GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+    CompositionalMultiphaseBase & solver = setupProblem( state, CompositionalMultiphaseFVM::catalogName(), "fluidTPFA" );
+    solver.getReference< CompositionalMultiphaseFVM::ScalingType >( CompositionalMultiphaseFVM::viewKeyStruct::scalingTypeString() ) = scalingType;
+    solver.getReference< real64 >( CompositionalMultiphaseBase::viewKeyStruct::maxPhaseVolFracChangeString() ) = maxPhaseVolFracChange;
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    for( integer cycle = 0; cycle < numSteps; ++cycle )
+    {
+      real64 const dtAccepted = solver.solverStep( cycle * dt, dt, cycle, domain );
+      EXPECT_DOUBLE_EQ( dtAccepted, dt );
+    }
+
+    ElementSubRegionBase & subRegion =
+      domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion( "cb" );
+
+    Run result;
+    result.pressure.resize( subRegion.size() );
+    result.pressure.setValues< serialPolicy >( subRegion.getField< fields::flow::pressure >().toViewConst() );
+    arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+      subRegion.getField< fields::flow::globalCompDensity >().toViewConst();
+    compDens.move( hostMemorySpace, false );
+    result.compDens.resize( compDens.size( 0 ), compDens.size( 1 ) );
+    for( localIndex ei = 0; ei < compDens.size( 0 ); ++ei )
+    {
+      for( integer ic = 0; ic < compDens.size( 1 ); ++ic )
+      {
+        result.compDens( ei, ic ) = compDens( ei, ic );
+      }
+    }
+
+    SolverStatistics const & statistics = solver.getSolverStatistics();
+    result.numNewtonIterations = statistics.getNumSuccessfulNonlinearIterations() + statistics.getNumDiscardedNonlinearIterations();
+    result.numTimeStepCuts = statistics.getNumTimeStepCuts();
+    return result;
+  }
+
+  static integer constexpr numSteps = 5;
+  static real64 constexpr dt = 1e4;
+
+  string const pvtLiquidFilename = "pvtliquid.txt";
+  string const pvtGasFilename = "pvtgas.txt";
+  string const co2flashFilename = "co2flash.txt";
+};
+
+integer constexpr CompositionalMultiphasePhaseVolumeFractionScalingTest::numSteps;
+real64 constexpr CompositionalMultiphasePhaseVolumeFractionScalingTest::dt;
+
+TEST_F( CompositionalMultiphasePhaseVolumeFractionScalingTest, globalScaling )
+{
+  checkScaling( CompositionalMultiphaseFVM::catalogName(), "fluidTPFA", CompositionalMultiphaseFVM::ScalingType::Global );
+}
+
+TEST_F( CompositionalMultiphasePhaseVolumeFractionScalingTest, localScaling )
+{
+  checkScaling( CompositionalMultiphaseFVM::catalogName(), "fluidTPFA", CompositionalMultiphaseFVM::ScalingType::Local );
+}
+
+TEST_F( CompositionalMultiphasePhaseVolumeFractionScalingTest, hybridScaling )
+{
+  checkScaling( CompositionalMultiphaseHybridFVM::catalogName(), "fluidHM", CompositionalMultiphaseFVM::ScalingType::Global );
+}
+
+TEST_F( CompositionalMultiphasePhaseVolumeFractionScalingTest, sameSolution )
+{
+  using ScalingType = CompositionalMultiphaseFVM::ScalingType;
+  Run const reference = run( ScalingType::Global, 1.0 );
+  std::vector< std::pair< string, Run > > const runs{ { "global", run( ScalingType::Global, 0.1 ) },
+                                                      { "local", run( ScalingType::Local, 0.1 ) } };
+
+  GEOS_LOG_RANK_0( GEOS_FMT( "Without chopping: {} Newton iterations, {} time step cuts",
+                             reference.numNewtonIterations, reference.numTimeStepCuts ) );
+  for( auto const & [name, chopped] : runs )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "With {} chopping: {} Newton iterations, {} time step cuts",
+                               name, chopped.numNewtonIterations, chopped.numTimeStepCuts ) );
+
+    // the chopping changes the Newton path, not the converged solution
+    real64 const relTol = 1e-6;
+    for( localIndex ei = 0; ei < reference.pressure.size(); ++ei )
+    {
+      EXPECT_NEAR( chopped.pressure[ei], reference.pressure[ei], relTol * reference.pressure[ei] ) << name << ", cell " << ei;
+      for( integer ic = 0; ic < reference.compDens.size( 1 ); ++ic )
+      {
+        real64 const totalDens = reference.compDens( ei, 0 ) + reference.compDens( ei, 1 );
+        EXPECT_NEAR( chopped.compDens( ei, ic ), reference.compDens( ei, ic ), relTol * totalDens ) << name << ", cell " << ei << ", component " << ic;
+      }
+    }
+    EXPECT_EQ( chopped.numTimeStepCuts, 0 );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,254 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Time-step control of a compositional problem with the PID controller, and with a warm start of the
+// attempts following a time-step cut. With two Newton iterations at most, the first time step is too
+// large to converge and has to be cut.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers gravityVector="{ 0.0, 0.0, -9.81 }">
+      <CompositionalMultiphaseFVM name="compflow"
+                                   logLevel="0"
+                                   discretization="fluidTPFA"
+                                   targetRegions="{region}"
+                                   temperature="297.15"
+                                   useMass="1"
+                                   targetRelativePressureChangeInTimeStep="0.2"
+                                   targetPhaseVolFractionChangeInTimeStep="0.2">
+
+        <NonlinearSolverParameters newtonTol="1.0e-6"
+                                   newtonMaxIter="2"
+                                   timeStepControlType="PID"
+                                   timeStepDecreaseFactor="0.8"
+                                   timeStepIncreaseFactor="1.5"
+                                   timeStepCutWarmStart="1"
+                                   timeStepCutFactor="0.1"
+                                   maxTimeStepCuts="10"/>
+        <LinearSolverParameters solverType="direct"/>
+      </CompositionalMultiphaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{C3D8}"
+                    xCoords="{0, 3}"
+                    yCoords="{0, 1}"
+                    zCoords="{0, 1}"
+                    nx="{3}"
+                    ny="{1}"
+                    nz="{1}"
+                    cellBlockNames="{cb1}"/>
+    </Mesh>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA"/>
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region" cellBlocks="{cb1}" materialList="{fluid, rock, relperm, cappressure}" />
+    </ElementRegions>
+    <Constitutive>
+      <CompositionalMultiphaseFluid name="fluid"
+                                    phaseNames="{oil, gas}"
+                                    equationsOfState="{PR, PR}"
+                                    componentNames="{N2, C10, C20, H2O}"
+                                    componentCriticalPressure="{34e5, 25.3e5, 14.6e5, 220.5e5}"
+                                    componentCriticalTemperature="{126.2, 622.0, 782.0, 647.0}"
+                                    componentAcentricFactor="{0.04, 0.443, 0.816, 0.344}"
+                                    componentMolarWeight="{28e-3, 134e-3, 275e-3, 18e-3}"
+                                    componentVolumeShift="{0, 0, 0, 0}"
+                                    componentBinaryCoeff="{ {0, 0, 0, 0},
+                                                            {0, 0, 0, 0},
+                                                            {0, 0, 0, 0},
+                                                            {0, 0, 0, 0} }"/>
+      <CompressibleSolidConstantPermeability name="rock"
+          solidModelName="nullSolid"
+          porosityModelName="rockPorosity"
+          permeabilityModelName="rockPerm"/>
+     <NullModel name="nullSolid"/>
+     <PressurePorosity name="rockPorosity"
+                       defaultReferencePorosity="0.05"
+                       referencePressure = "0.0"
+                       compressibility="1.0e-9"/>
+      <BrooksCoreyRelativePermeability name="relperm"
+                                       phaseNames="{oil, gas}"
+                                       phaseMinVolumeFraction="{0.1, 0.15}"
+                                       phaseRelPermExponent="{2.0, 2.0}"
+                                       phaseRelPermMaxValue="{0.8, 0.9}"/>
+      <BrooksCoreyCapillaryPressure name="cappressure"
+                                    phaseNames="{oil, gas}"
+                                    phaseMinVolumeFraction="{0.2, 0.05}"
+                                    phaseCapPressureExponentInv="{4.25, 3.5}"
+                                    phaseEntryPressure="{0., 1e8}"
+                                    capPressureEpsilon="0.0"/>
+    <ConstantPermeability name="rockPerm"
+                          permeabilityComponents="{2.0e-16, 2.0e-16, 2.0e-16}"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="pressure"
+                 functionName="initialPressureFunc"
+                 scale="5e6"/>
+      <FieldSpecification name="initialComposition_N2"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="0"
+                 scale="0.099"/>
+      <FieldSpecification name="initialComposition_C10"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="1"
+                 scale="0.3"/>
+      <FieldSpecification name="initialComposition_C20"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="2"
+                 scale="0.6"/>
+      <FieldSpecification name="initialComposition_H20"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="3"
+                 scale="0.001"/>
+    </FieldSpecifications>
+    <Functions>
+      <TableFunction name="initialPressureFunc"
+                     inputVarNames="{elementCenter}"
+                     coordinates="{0.0, 3.0}"
+                     values="{1.0, 0.5}"/>
+    </Functions>
+  </Problem>
+  )xml";
+
+class CompositionalMultiphaseTimeStepControlTest : public ::testing::Test
+{
+public:
+
+  CompositionalMultiphaseTimeStepControlTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+  }
+
+  static real64 constexpr dt = 1.0e8;
+
+  GeosxState state;
+  CompositionalMultiphaseFVM * solver;
+};
+
+real64 constexpr CompositionalMultiphaseTimeStepControlTest::dt;
+
+TEST_F( CompositionalMultiphaseTimeStepControlTest, pidController )
+{
+  // PID gains of the controller
+  real64 constexpr kP = 0.075;
+  real64 constexpr kI = 0.175;
+  real64 constexpr kD = 0.01;
+  real64 constexpr tol = 1e-12;
+
+  // first step: no history, integral controller
+  real64 const e1 = 0.5;
+  EXPECT_NEAR( solver->setNextDtBasedOnPIDControl( 1.0, e1 ), std::pow( 1.0 / e1, kI ), tol );
+
+  // second step: one ratio in the history, PI controller (the missing ratio is replaced by the known one)
+  real64 const e2 = 0.25;
+  EXPECT_NEAR( solver->setNextDtBasedOnPIDControl( 1.0, e2 ),
+               std::pow( e1 / e2, kP ) * std::pow( 1.0 / e2, kI ) * std::pow( e1 * e1 / ( e2 * e1 ), kD ), tol );
+
+  // third step: full PID controller
+  real64 const e3 = 0.5;
+  EXPECT_NEAR( solver->setNextDtBasedOnPIDControl( 2.0, e3 ),
+               2.0 * std::pow( e2 / e3, kP ) * std::pow( 1.0 / e3, kI ) * std::pow( e2 * e2 / ( e3 * e1 ), kD ), tol );
+
+  // target exceeded: the time step shrinks proportionally, below the decrease factor
+  real64 const e4 = 4.0;
+  EXPECT_NEAR( solver->setNextDtBasedOnPIDControl( 1.0, e4 ), 1.0 / e4, tol );
+
+  // tiny state change: the factor is clamped by the increase factor
+  EXPECT_NEAR( solver->setNextDtBasedOnPIDControl( 1.0, 1e-6 ), 1.5, tol );
+
+  // target reached after a tiny (floored) change: the factor is clamped by the decrease factor
+  EXPECT_NEAR( solver->setNextDtBasedOnPIDControl( 1.0, 1.0 ), 0.8, tol );
+}
+
+TEST_F( CompositionalMultiphaseTimeStepControlTest, warmStartAfterTimeStepCut )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 const dtAccepted = solver->solverStep( 0.0, dt, 0, domain );
+
+  // at least one cut, and the step converged with the smaller time step
+  EXPECT_GT( solver->getNonlinearSolverParameters().m_numTimeStepAttempts, 0 );
+  EXPECT_LT( dtAccepted, dt );
+  EXPECT_GT( dtAccepted, 0.0 );
+
+  real64 const nextDt = solver->setNextDt( dtAccepted, domain );
+  EXPECT_GT( nextDt, 0.0 );
+  EXPECT_LT( nextDt, LvArray::NumericLimits< real64 >::max );
+
+  solver->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                       MeshLevel & mesh,
+                                                                       arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames, [&]( localIndex const,
+                                                                  ElementSubRegionBase & subRegion )
+    {
+      arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+      pres.move( hostMemorySpace, false );
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        EXPECT_GT( pres[ei], 0.0 );
+      }
+    } );
+  } );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,157 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mesh/generators/VTKMeshCache.hpp"
+
+// special CMake-generated include
+#include "tests/meshDirName.hpp"
+
+// TPL includes
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace geos;
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Create a directory shared by all the ranks, empty at the beginning of the test.
+ * @param name the name of the directory
+ * @return the path of the directory
+ */
+string makeTestDirectory( string const & name )
+{
+  fs::path const directory = fs::current_path() / GEOS_FMT( "{}_np{}", name, MpiWrapper::commSize() );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    fs::remove_all( directory );
+    fs::create_directories( directory );
+  }
+  MpiWrapper::barrier();
+  return directory.string();
+}
+
+vtkSmartPointer< vtkUnstructuredGrid > readGrid( string const & fileName )
+{
+  vtkNew< vtkXMLUnstructuredGridReader > reader;
+  reader->SetFileName( fileName.c_str() );
+  reader->Update();
+  return vtkSmartPointer< vtkUnstructuredGrid >( reader->GetOutput() );
+}
+
+void expectSameGrids( vtkDataSet & expected, vtkDataSet & actual )
+{
+  ASSERT_EQ( expected.GetNumberOfPoints(), actual.GetNumberOfPoints() );
+  ASSERT_EQ( expected.GetNumberOfCells(), actual.GetNumberOfCells() );
+  for( vtkIdType i = 0; i < expected.GetNumberOfPoints(); ++i )
+  {
+    double expectedPoint[3], actualPoint[3];
+    expected.GetPoint( i, expectedPoint );
+    actual.GetPoint( i, actualPoint );
+    for( int dim = 0; dim < 3; ++dim )
+    {
+      EXPECT_EQ( expectedPoint[dim], actualPoint[dim] );
+    }
+  }
+  for( vtkIdType i = 0; i < expected.GetNumberOfCells(); ++i )
+  {
+    EXPECT_EQ( expected.GetCellType( i ), actual.GetCellType( i ) );
+  }
+}
+
+TEST( VTKMeshCache, writeThenLoad )
+{
+  string const cacheDirectory = makeTestDirectory( "meshCacheRoundTrip" );
+  int const rank = MpiWrapper::commRank();
+
+  vtkSmartPointer< vtkUnstructuredGrid > const mainMesh = readGrid( joinPath( testMeshDir, "cube.vtu" ) );
+  vtkSmartPointer< vtkUnstructuredGrid > const faceBlock = readGrid( joinPath( testMeshDir, "cube", GEOS_FMT( "cube_{}.vtu", rank % 4 ) ) );
+  vtk::AllMeshes meshes( mainMesh, { { "fracture", faceBlock } } );
+  std::vector< int > const neighbors{ rank + 1, rank + 2 };
+
+  string const key = vtk::computeMeshCacheKey( joinPath( testMeshDir, "cube.vtu" ), { "partitioner" }, MPI_COMM_GEOS );
+  vtk::AllMeshes loadedMeshes;
+  std::vector< int > loadedNeighbors;
+  EXPECT_FALSE( vtk::loadMeshCache( cacheDirectory, key, loadedMeshes, loadedNeighbors, MPI_COMM_GEOS ) );
+
+  vtk::writeMeshCache( cacheDirectory, key, meshes, neighbors, MPI_COMM_GEOS );
+  ASSERT_TRUE( vtk::loadMeshCache( cacheDirectory, key, loadedMeshes, loadedNeighbors, MPI_COMM_GEOS ) );
+
+  EXPECT_EQ( loadedNeighbors, neighbors );
+  expectSameGrids( *mainMesh, *loadedMeshes.getMainMesh() );
+  ASSERT_EQ( loadedMeshes.getFaceBlocks().size(), 1 );
+  ASSERT_EQ( loadedMeshes.getFaceBlocks().count( "fracture" ), 1 );
+  expectSameGrids( *faceBlock, *loadedMeshes.getFaceBlocks().at( "fracture" ) );
+
+  // another key does not match the cached entry
+  string const otherKey = vtk::computeMeshCacheKey( joinPath( testMeshDir, "cube.vtu" ), { "otherPartitioner" }, MPI_COMM_GEOS );
+  EXPECT_NE( otherKey, key );
+  EXPECT_FALSE( vtk::loadMeshCache( cacheDirectory, otherKey, loadedMeshes, loadedNeighbors, MPI_COMM_GEOS ) );
+}
+
+TEST( VTKMeshCache, keyOfParallelFile )
+{
+  string const directory = makeTestDirectory( "meshCacheKey" );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    fs::copy( joinPath( testMeshDir, "cube.pvtu" ), directory );
+    fs::copy( joinPath( testMeshDir, "cube" ), fs::path( directory ) / "cube", fs::copy_options::recursive );
+  }
+  MpiWrapper::barrier();
+
+  string const fileName = joinPath( directory, "cube.pvtu" );
+  string const key = vtk::computeMeshCacheKey( fileName, {}, MPI_COMM_GEOS );
+  EXPECT_EQ( vtk::computeMeshCacheKey( fileName, {}, MPI_COMM_GEOS ), key );
+
+  // a modified piece changes the key
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ofstream piece( joinPath( directory, "cube", "cube_2.vtu" ), std::ios::app );
+    piece << "\n";
+  }
+  MpiWrapper::barrier();
+  EXPECT_NE( vtk::computeMeshCacheKey( fileName, {}, MPI_COMM_GEOS ), key );
+
+  // a missing piece is reported on all the ranks
+  if( MpiWrapper::commRank() == 0 )
+  {
+    fs::remove( fs::path( directory ) / "cube" / "cube_3.vtu" );
+  }
+  MpiWrapper::barrier();
+  EXPECT_THROW( vtk::computeMeshCacheKey( fileName, {}, MPI_COMM_GEOS ), InputError );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geos::GeosxState state( geos::basicSetup( argc, argv ) );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::basicCleanup();
+
+  return result;
+}
@@ -0,0 +1,275 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mesh/generators/VTKUtilities.hpp"
+
+// special CMake-generated include
+#include "tests/meshDirName.hpp"
+
+// TPL includes
+#include <vtkAppendFilter.h>
+#include <vtkCellData.h>
+#include <vtkDataObjectTreeIterator.h>
+#include <vtkExtractCells.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkUnstructuredGridReader.h>
+#include <vtkUnstructuredGridWriter.h>
+#include <vtkXMLMultiBlockDataReader.h>
+#include <vtkXMLMultiBlockDataWriter.h>
+#include <vtkXMLUnstructuredGridReader.h>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <map>
+
+using namespace geos;
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Create a directory shared by all the ranks, holding the test meshes written by the first rank.
+ * @return the path of the directory
+ */
+string makeMeshDirectory()
+{
+  fs::path const directory = fs::current_path() / GEOS_FMT( "parallelRead_np{}", MpiWrapper::commSize() );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    fs::remove_all( directory );
+    fs::create_directories( directory );
+
+    vtkNew< vtkXMLUnstructuredGridReader > reader;
+    reader->SetFileName( joinPath( testMeshDir, "cube.vtu" ).c_str() );
+    reader->Update();
+    vtkNew< vtkUnstructuredGrid > mesh;
+    mesh->DeepCopy( reader->GetOutput() );
+
+    vtkNew< vtkUnstructuredGridWriter > legacyWriter;
+    legacyWriter->SetFileTypeToBinary();
+    legacyWriter->SetInputData( mesh );
+    legacyWriter->SetFileName( ( directory / "cubeWithoutIds.vtk" ).c_str() );
+    legacyWriter->Write();
+
+    // global ids that differ from the positions in the file
+    vtkNew< vtkIdTypeArray > pointIds;
+    pointIds->SetName( "GlobalIds" );
+    pointIds->SetNumberOfTuples( mesh->GetNumberOfPoints() );
+    for( vtkIdType i = 0; i < mesh->GetNumberOfPoints(); ++i )
+    {
+      pointIds->SetValue( i, 2 * i + 1 );
+    }
+    mesh->GetPointData()->SetGlobalIds( pointIds );
+    vtkNew< vtkIdTypeArray > cellIds;
+    cellIds->SetName( "GlobalIds" );
+    cellIds->SetNumberOfTuples( mesh->GetNumberOfCells() );
+    for( vtkIdType i = 0; i < mesh->GetNumberOfCells(); ++i )
+    {
+      cellIds->SetValue( i, 3 * i + 7 );
+    }
+    mesh->GetCellData()->SetGlobalIds( cellIds );
+
+    legacyWriter->SetFileName( ( directory / "cubeWithIds.vtk" ).c_str() );
+    legacyWriter->Write();
+
+    // the main block of the multi-block file is made of four pieces
+    vtkNew< vtkMultiBlockDataSet > pieces;
+    vtkIdType const numCellsPerPiece = ( mesh->GetNumberOfCells() + 3 ) / 4;
+    for( unsigned int iPiece = 0; iPiece < 4; ++iPiece )
+    {
+      vtkNew< vtkIdList > pieceCells;
+      for( vtkIdType i = iPiece * numCellsPerPiece; i < std::min( ( iPiece + 1 ) * numCellsPerPiece, mesh->GetNumberOfCells() ); ++i )
+      {
+        pieceCells->InsertNextId( i );
+      }
+      vtkNew< vtkExtractCells > extract;
+      extract->SetInputData( mesh );
+      extract->SetCellList( pieceCells );
+      extract->Update();
+      pieces->SetBlock( iPiece, extract->GetOutput() );
+    }
+    vtkNew< vtkMultiBlockDataSet > blocks;
+    blocks->SetBlock( 0, pieces );
+    blocks->GetMetaData( 0u )->Set( vtkMultiBlockDataSet::NAME(), "main" );
+
+    vtkNew< vtkXMLMultiBlockDataWriter > multiBlockWriter;
+    multiBlockWriter->SetInputData( blocks );
+    multiBlockWriter->SetFileName( ( directory / "cube.vtm" ).c_str() );
+    multiBlockWriter->Write();
+  }
+  MpiWrapper::barrier();
+  return directory.string();
+}
+
+/**
+ * @brief Read the whole mesh on the current rank, with the serial VTK readers.
+ * @param fileName the legacy or multi-block file
+ * @return the mesh
+ */
+vtkSmartPointer< vtkDataSet > serialRead( string const & fileName )
+{
+  if( fs::path( fileName ).extension() == ".vtk" )
+  {
+    vtkNew< vtkUnstructuredGridReader > reader;
+    reader->SetFileName( fileName.c_str() );
+    reader->Update();
+    return vtkSmartPointer< vtkDataSet >( reader->GetOutput() );
+  }
+  vtkNew< vtkXMLMultiBlockDataReader > reader;
+  reader->SetFileName( fileName.c_str() );
+  reader->Update();
+  vtkNew< vtkAppendFilter > append;
+  append->MergePointsOn();
+  vtkSmartPointer< vtkDataObjectTreeIterator > iter =
+    vtkSmartPointer< vtkDataObjectTreeIterator >::Take( vtkMultiBlockDataSet::SafeDownCast( reader->GetOutput() )->NewTreeIterator() );
+  for( iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem() )
+  {
+    append->AddInputData( vtkDataSet::SafeDownCast( iter->GetCurrentDataObject() ) );
+  }
+  append->Update();
+  return vtkSmartPointer< vtkDataSet >( append->GetOutput() );
+}
+
+/**
+ * @brief The global id of an object of the serial mesh.
+ * @param ids the global ids of the serial mesh, if any
+ * @param i the index of the object
+ * @return The global id, which is the position in the file when the file has no global ids.
+ */
+vtkIdType globalId( vtkDataArray * const ids, vtkIdType const i )
+{
+  return ids != nullptr ? static_cast< vtkIdType >( ids->GetTuple1( i ) ) : i;
+}
+
+/**
+ * @brief Check that the parts of the mesh read by all the ranks make the mesh read serially.
+ * @param fileName the legacy or multi-block file
+ * @param useGlobalIds the useGlobalIds parameter of the read
+ */
+void expectSameAsSerialRead( string const & fileName, int const useGlobalIds )
+{
+  vtkSmartPointer< vtkDataSet > const reference = serialRead( fileName );
+  vtkDataArray * const referencePointIds = reference->GetPointData()->GetGlobalIds();
+  vtkDataArray * const referenceCellIds = reference->GetCellData()->GetGlobalIds();
+  std::map< vtkIdType, vtkIdType > referenceCells;
+  for( vtkIdType i = 0; i < reference->GetNumberOfCells(); ++i )
+  {
+    referenceCells[globalId( referenceCellIds, i )] = i;
+  }
+
+  vtkSmartPointer< vtkDataSet > const mesh =
+    vtk::loadAllMeshes( fileName, "main", array1d< string >(), true, useGlobalIds ).getMainMesh();
+  vtkDataArray * const pointIds = mesh->GetPointData()->GetGlobalIds();
+  vtkDataArray * const cellIds = mesh->GetCellData()->GetGlobalIds();
+  ASSERT_NE( pointIds, nullptr );
+  ASSERT_NE( cellIds, nullptr );
+
+  // the mesh is actually distributed
+  if( MpiWrapper::commSize() > 1 )
+  {
+    EXPECT_GT( mesh->GetNumberOfCells(), 0 );
+    EXPECT_LT( mesh->GetNumberOfCells(), reference->GetNumberOfCells() );
+  }
+
+  array1d< integer > isPointRead( reference->GetNumberOfPoints() );
+  array1d< integer > isCellRead( reference->GetNumberOfCells() );
+  for( vtkIdType c = 0; c < mesh->GetNumberOfCells(); ++c )
+  {
+    auto const referenceCell = referenceCells.find( static_cast< vtkIdType >( cellIds->GetTuple1( c ) ) );
+    ASSERT_NE( referenceCell, referenceCells.end() );
+    vtkIdType const r = referenceCell->second;
+    ++isCellRead[r];
+
+    EXPECT_EQ( mesh->GetCellType( c ), reference->GetCellType( r ) );
+    vtkNew< vtkIdList > points;
+    vtkNew< vtkIdList > referenceCellPoints;
+    mesh->GetCellPoints( c, points );
+    reference->GetCellPoints( r, referenceCellPoints );
+    ASSERT_EQ( points->GetNumberOfIds(), referenceCellPoints->GetNumberOfIds() );
+    for( vtkIdType k = 0; k < points->GetNumberOfIds(); ++k )
+    {
+      vtkIdType const p = points->GetId( k );
+      vtkIdType const q = referenceCellPoints->GetId( k );
+      EXPECT_EQ( static_cast< vtkIdType >( pointIds->GetTuple1( p ) ), globalId( referencePointIds, q ) );
+      isPointRead[q] = 1;
+
+      double point[3], referencePoint[3];
+      mesh->GetPoint( p, point );
+      reference->GetPoint( q, referencePoint );
+      for( int dim = 0; dim < 3; ++dim )
+      {
+        EXPECT_EQ( point[dim], referencePoint[dim] );
+      }
+    }
+  }
+
+  // each cell is read by exactly one rank, and all the points are read
+  MpiWrapper::allReduce( isCellRead.data(), isCellRead.data(), LvArray::integerConversion< int >( isCellRead.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOS );
+  MpiWrapper::allReduce( isPointRead.data(), isPointRead.data(), LvArray::integerConversion< int >( isPointRead.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ), MPI_COMM_GEOS );
+  for( integer const count : isCellRead )
+  {
+    EXPECT_EQ( count, 1 );
+  }
+  for( integer const isRead : isPointRead )
+  {
+    EXPECT_EQ( isRead, 1 );
+  }
+}
+
+TEST( VTKParallelRead, legacyWithGlobalIds )
+{
+  string const directory = makeMeshDirectory();
+  expectSameAsSerialRead( joinPath( directory, "cubeWithIds.vtk" ), 1 );
+}
+
+TEST( VTKParallelRead, legacyWithoutGlobalIds )
+{
+  string const directory = makeMeshDirectory();
+  expectSameAsSerialRead( joinPath( directory, "cubeWithoutIds.vtk" ), 0 );
+
+  // the global ids are only built from the positions in the file when allowed
+  EXPECT_THROW( vtk::loadAllMeshes( joinPath( directory, "cubeWithoutIds.vtk" ), "main", array1d< string >(), true, 1 ),
+                InputError );
+}
+
+TEST( VTKParallelRead, multiBlock )
+{
+  string const directory = makeMeshDirectory();
+  expectSameAsSerialRead( joinPath( directory, "cube.vtm" ), 1 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geos::GeosxState state( geos::basicSetup( argc, argv ) );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::basicCleanup();
+
+  return result;
+}
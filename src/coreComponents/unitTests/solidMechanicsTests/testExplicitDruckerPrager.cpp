@@ -0,0 +1,195 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "constitutive/solid/DruckerPrager.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::constitutive;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Explicit dynamics of a block under a uniaxial initial stress lying outside of the Drucker-Prager yield surface.
+// Whatever the path taken by the kernel (batched or pointwise constitutive update), the stresses must be
+// returned to the yield surface and the cohesion must harden.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SolidMechanics_LagrangianFEM
+        name="lagsolve"
+        timeIntegrationOption="ExplicitDynamic"
+        discretization="FE1"
+        targetRegions="{ Region }"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 4 }"
+        yCoords="{ 0, 4 }"
+        zCoords="{ 0, 4 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 4 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="5e-5">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="1e-5"
+        target="/Solvers/lagsolve"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ rock }"/>
+    </ElementRegions>
+    <Constitutive>
+      <DruckerPrager
+        name="rock"
+        defaultDensity="2700"
+        defaultBulkModulus="5.5556e9"
+        defaultShearModulus="4.16667e9"
+        defaultCohesion="1.0e5"
+        defaultFrictionAngle="30.0"
+        defaultDilationAngle="10.0"
+        defaultHardeningRate="1.0e7"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialStress"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="ElementRegions"
+        fieldName="rock_stress"
+        component="0"
+        scale="-1.0e6"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+class ExplicitDruckerPragerTest : public ::testing::Test
+{
+public:
+
+  ExplicitDruckerPragerTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+  }
+
+  static real64 constexpr dt = 1e-5;
+  static real64 constexpr cohesion = 1.0e5;
+  static real64 constexpr stressScale = 1.0e6;
+
+  GeosxState state;
+  SolidMechanicsLagrangianFEM * solver;
+};
+
+real64 constexpr ExplicitDruckerPragerTest::dt;
+real64 constexpr ExplicitDruckerPragerTest::cohesion;
+real64 constexpr ExplicitDruckerPragerTest::stressScale;
+
+TEST_F( ExplicitDruckerPragerTest, stressesReturnedToYieldSurface )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 time_n = 0.0;
+  for( integer cycle = 0; cycle < 5; ++cycle )
+  {
+    solver->explicitStep( time_n, dt, cycle, domain );
+    time_n += dt;
+  }
+
+  localIndex numPoints = 0;
+  localIndex numHardenedPoints = 0;
+  domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    DruckerPrager & model = subRegion.getConstitutiveModel< DruckerPrager >( "rock" );
+
+    arrayView3d< real64 const, solid::STRESS_USD > const stress = model.getStress();
+    arrayView2d< real64 const > const newCohesion =
+      model.getReference< array2d< real64 > >( DruckerPrager::viewKeyStruct::newCohesionString() );
+    arrayView1d< real64 const > const friction =
+      model.getReference< array1d< real64 > >( DruckerPrager::viewKeyStruct::frictionString() );
+    stress.move( hostMemorySpace, false );
+    newCohesion.move( hostMemorySpace, false );
+    friction.move( hostMemorySpace, false );
+
+    for( localIndex k = 0; k < stress.size( 0 ); ++k )
+    {
+      for( localIndex q = 0; q < stress.size( 1 ); ++q )
+      {
+        // mean and von Mises stress invariants
+        real64 const p = ( stress( k, q, 0 ) + stress( k, q, 1 ) + stress( k, q, 2 ) ) / 3.0;
+        real64 devNormSquared = 0.0;
+        for( integer i = 0; i < 3; ++i )
+        {
+          devNormSquared += ( stress( k, q, i ) - p ) * ( stress( k, q, i ) - p );
+          devNormSquared += 2.0 * stress( k, q, i + 3 ) * stress( k, q, i + 3 );
+        }
+        real64 const qInv = std::sqrt( 1.5 * devNormSquared );
+
+        // on or inside of the yield surface
+        EXPECT_LE( qInv + friction[k] * p - newCohesion( k, q ), 1e-6 * stressScale );
+
+        numPoints++;
+        if( newCohesion( k, q ) > cohesion )
+        {
+          numHardenedPoints++;
+        }
+      }
+    }
+  } );
+
+  // the initial stress is outside of the yield surface everywhere, so every point has yielded
+  EXPECT_GT( numPoints, 0 );
+  EXPECT_EQ( numHardenedPoints, numPoints );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
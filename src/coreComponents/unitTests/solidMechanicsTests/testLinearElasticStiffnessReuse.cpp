@@ -0,0 +1,333 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "constitutive/solid/ElasticIsotropic.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsFields.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::constitutive;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Quasi-static loading of an elastic block in three steps, solved twice on the same fields: once with
+// the stiffness assembled at every Newton iteration and once with the stiffness assembled only once.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SolidMechanics_LagrangianFEM
+        name="fullAssembly"
+        timeIntegrationOption="QuasiStatic"
+        discretization="FE1"
+        targetRegions="{ Region }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-10"
+          newtonMaxIter="5"/>
+        <LinearSolverParameters
+          solverType="direct"/>
+      </SolidMechanics_LagrangianFEM>
+      <SolidMechanics_LagrangianFEM
+        name="stiffnessReuse"
+        timeIntegrationOption="QuasiStatic"
+        reuseLinearElasticStiffness="1"
+        discretization="FE1"
+        targetRegions="{ Region }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-10"
+          newtonMaxIter="5"/>
+        <LinearSolverParameters
+          solverType="direct"/>
+      </SolidMechanics_LagrangianFEM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 4 }"
+        yCoords="{ 0, 4 }"
+        zCoords="{ 0, 4 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 4 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="3.0">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="1.0"
+        target="/Solvers/fullAssembly"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ rock }"/>
+    </ElementRegions>
+    <Constitutive>
+      <ElasticIsotropic
+        name="rock"
+        defaultDensity="2700"
+        defaultBulkModulus="5.5556e9"
+        defaultShearModulus="4.16667e9"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="bottomConstraintX"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="0"
+        scale="0.0"
+        setNames="{ zneg }"/>
+      <FieldSpecification
+        name="bottomConstraintY"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="1"
+        scale="0.0"
+        setNames="{ zneg }"/>
+      <FieldSpecification
+        name="bottomConstraintZ"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="2"
+        scale="0.0"
+        setNames="{ zneg }"/>
+      <FieldSpecification
+        name="topCompression"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="2"
+        scale="-1.0e-3"
+        functionName="timeFunction"
+        setNames="{ zpos }"/>
+      <FieldSpecification
+        name="topShear"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="0"
+        scale="2.0e-4"
+        functionName="timeFunction"
+        setNames="{ zpos }"/>
+    </FieldSpecifications>
+    <Functions>
+      <TableFunction
+        name="timeFunction"
+        inputVarNames="{ time }"
+        coordinates="{ 0.0, 1.0, 2.0, 3.0 }"
+        values="{ 0.0, 1.0, 0.5, 2.0 }"/>
+    </Functions>
+  </Problem>
+  )xml";
+
+class LinearElasticStiffnessReuseTest : public ::testing::Test
+{
+public:
+
+  LinearElasticStiffnessReuseTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    PhysicsSolverManager & solverManager = state.getProblemManager().getPhysicsSolverManager();
+    fullAssembly = &solverManager.getGroup< SolidMechanicsLagrangianFEM >( "fullAssembly" );
+    stiffnessReuse = &solverManager.getGroup< SolidMechanicsLagrangianFEM >( "stiffnessReuse" );
+  }
+
+  /// Reset the displacements and the stresses to the undeformed state
+  void resetState()
+  {
+    MeshLevel & mesh = state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getBaseDiscretization();
+    NodeManager & nodeManager = mesh.getNodeManager();
+    nodeManager.getField< fields::solidMechanics::totalDisplacement >().zero();
+    nodeManager.getField< fields::solidMechanics::incrementalDisplacement >().zero();
+
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+    {
+      ElasticIsotropic & model = subRegion.getConstitutiveModel< ElasticIsotropic >( "rock" );
+      model.getStress().zero();
+      model.getReference< array3d< real64, solid::STRESS_PERMUTATION > >( SolidBase::viewKeyStruct::oldStressString() ).zero();
+    } );
+  }
+
+  /// Impose a smooth, step-dependent displacement increment on all the nodes
+  void setDisplacementIncrement( integer const step )
+  {
+    NodeManager & nodeManager =
+      state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getBaseDiscretization().getNodeManager();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
+    arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const incrementalDisplacement =
+      nodeManager.getField< fields::solidMechanics::incrementalDisplacement >();
+    arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const totalDisplacement =
+      nodeManager.getField< fields::solidMechanics::totalDisplacement >();
+    X.move( hostMemorySpace, false );
+    incrementalDisplacement.move( hostMemorySpace, true );
+    totalDisplacement.move( hostMemorySpace, true );
+
+    real64 const scale = 1.0e-4 * ( step + 1 );
+    for( localIndex a = 0; a < X.size( 0 ); ++a )
+    {
+      incrementalDisplacement( a, 0 ) = scale * X( a, 1 ) * X( a, 2 );
+      incrementalDisplacement( a, 1 ) = -scale * X( a, 0 ) * X( a, 2 );
+      incrementalDisplacement( a, 2 ) = scale * ( X( a, 0 ) * X( a, 0 ) - X( a, 1 ) );
+      for( integer i = 0; i < 3; ++i )
+      {
+        totalDisplacement( a, i ) += incrementalDisplacement( a, i );
+      }
+    }
+  }
+
+  /// Run the three load steps with a solver from the undeformed state, and return the displacements after each step
+  std::vector< array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > > solve( SolidMechanicsLagrangianFEM & solver )
+  {
+    resetState();
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const totalDisplacement =
+      domain.getMeshBody( 0 ).getBaseDiscretization().getNodeManager().getField< fields::solidMechanics::totalDisplacement >();
+
+    std::vector< array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > > displacements;
+    for( integer step = 0; step < numSteps; ++step )
+    {
+      solver.solverStep( step * dt, dt, step, domain );
+
+      totalDisplacement.move( hostMemorySpace, false );
+      displacements.emplace_back();
+      displacements.back().resize( totalDisplacement.size( 0 ), 3 );
+      for( localIndex a = 0; a < totalDisplacement.size( 0 ); ++a )
+      {
+        for( integer i = 0; i < 3; ++i )
+        {
+          displacements.back()( a, i ) = totalDisplacement( a, i );
+        }
+      }
+    }
+    return displacements;
+  }
+
+  static integer constexpr numSteps = 3;
+  static real64 constexpr dt = 1.0;
+
+  GeosxState state;
+  SolidMechanicsLagrangianFEM * fullAssembly;
+  SolidMechanicsLagrangianFEM * stiffnessReuse;
+};
+
+integer constexpr LinearElasticStiffnessReuseTest::numSteps;
+real64 constexpr LinearElasticStiffnessReuseTest::dt;
+
+TEST_F( LinearElasticStiffnessReuseTest, jacobianAndResidual )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  for( SolidMechanicsLagrangianFEM * const solver : { fullAssembly, stiffnessReuse } )
+  {
+    solver->setupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getSystemRhs(),
+                         solver->getSystemSolution() );
+  }
+
+  CRSMatrix< real64, globalIndex > & fullJacobian = fullAssembly->getLocalMatrix();
+  CRSMatrix< real64, globalIndex > & reuseJacobian = stiffnessReuse->getLocalMatrix();
+  array1d< real64 > fullResidual( fullJacobian.numRows() );
+  array1d< real64 > reuseResidual( reuseJacobian.numRows() );
+
+  // the stiffness is cached at the first assembly, and reused at the following ones
+  resetState();
+  for( integer step = 0; step < numSteps + 1; ++step )
+  {
+    setDisplacementIncrement( step );
+
+    fullAssembly->assembleSystem( step * dt, dt, domain, fullAssembly->getDofManager(),
+                                  fullJacobian.toViewConstSizes(), fullResidual.toView() );
+    stiffnessReuse->assembleSystem( step * dt, dt, domain, stiffnessReuse->getDofManager(),
+                                    reuseJacobian.toViewConstSizes(), reuseResidual.toView() );
+
+    compareLocalMatrices( reuseJacobian.toViewConst(), fullJacobian.toViewConst() );
+
+    fullResidual.move( hostMemorySpace, false );
+    reuseResidual.move( hostMemorySpace, false );
+    real64 maxResidual = 0.0;
+    for( localIndex i = 0; i < fullResidual.size(); ++i )
+    {
+      maxResidual = LvArray::math::max( maxResidual, LvArray::math::abs( fullResidual[i] ) );
+    }
+    ASSERT_GT( maxResidual, 0.0 );
+    for( localIndex i = 0; i < fullResidual.size(); ++i )
+    {
+      EXPECT_NEAR( reuseResidual[i], fullResidual[i], 1e-12 * maxResidual );
+    }
+  }
+}
+
+TEST_F( LinearElasticStiffnessReuseTest, solution )
+{
+  std::vector< array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > > const full = solve( *fullAssembly );
+  std::vector< array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > > const reuse = solve( *stiffnessReuse );
+
+  for( integer step = 0; step < numSteps; ++step )
+  {
+    real64 maxDisplacement = 0.0;
+    for( localIndex a = 0; a < full[step].size( 0 ); ++a )
+    {
+      for( integer i = 0; i < 3; ++i )
+      {
+        maxDisplacement = LvArray::math::max( maxDisplacement, LvArray::math::abs( full[step]( a, i ) ) );
+      }
+    }
+    ASSERT_GT( maxDisplacement, 0.0 );
+
+    for( localIndex a = 0; a < full[step].size( 0 ); ++a )
+    {
+      for( integer i = 0; i < 3; ++i )
+      {
+        EXPECT_NEAR( reuse[step]( a, i ), full[step]( a, i ), 1e-10 * maxDisplacement );
+      }
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
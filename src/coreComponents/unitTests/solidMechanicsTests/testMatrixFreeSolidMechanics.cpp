@@ -0,0 +1,231 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "constitutive/solid/ElasticIsotropic.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::constitutive;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Quasi-static compression of an elastic block solved twice, once with the assembled jacobian and
+// once with the matrix-free operator. Both solvers act on the same fields, so the state is reset in between.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SolidMechanics_LagrangianFEM
+        name="assembled"
+        timeIntegrationOption="QuasiStatic"
+        discretization="FE1"
+        targetRegions="{ Region }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-10"
+          newtonMaxIter="5"/>
+        <LinearSolverParameters
+          solverType="direct"/>
+      </SolidMechanics_LagrangianFEM>
+      <SolidMechanics_LagrangianFEM
+        name="matrixFree"
+        timeIntegrationOption="QuasiStatic"
+        discretization="FE1"
+        targetRegions="{ Region }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-10"
+          newtonMaxIter="5"/>
+        <LinearSolverParameters
+          matrixFree="1"
+          solverType="cg"
+          preconditionerType="jacobi"
+          krylovTol="1.0e-12"
+          krylovMaxIter="1000"/>
+      </SolidMechanics_LagrangianFEM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 4 }"
+        yCoords="{ 0, 4 }"
+        zCoords="{ 0, 4 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 4 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="1.0">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="1.0"
+        target="/Solvers/assembled"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ rock }"/>
+    </ElementRegions>
+    <Constitutive>
+      <ElasticIsotropic
+        name="rock"
+        defaultDensity="2700"
+        defaultBulkModulus="5.5556e9"
+        defaultShearModulus="4.16667e9"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="bottomConstraint"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="0"
+        scale="0.0"
+        setNames="{ zneg }"/>
+      <FieldSpecification
+        name="bottomConstraintY"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="1"
+        scale="0.0"
+        setNames="{ zneg }"/>
+      <FieldSpecification
+        name="bottomConstraintZ"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="2"
+        scale="0.0"
+        setNames="{ zneg }"/>
+      <FieldSpecification
+        name="topCompression"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="2"
+        scale="-1.0e-3"
+        setNames="{ zpos }"/>
+      <FieldSpecification
+        name="sideShear"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="0"
+        scale="2.0e-4"
+        setNames="{ zpos }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+class MatrixFreeSolidMechanicsTest : public ::testing::Test
+{
+public:
+
+  MatrixFreeSolidMechanicsTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+  }
+
+  /// Solve one quasi-static step with the given solver from the undeformed state and return the displacements
+  array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > solve( string const & solverName )
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const totalDisplacement =
+      nodeManager.getField< fields::solidMechanics::totalDisplacement >();
+    totalDisplacement.move( hostMemorySpace, true );
+    totalDisplacement.zero();
+
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+    {
+      ElasticIsotropic & model = subRegion.getConstitutiveModel< ElasticIsotropic >( "rock" );
+      model.getStress().zero();
+      model.getReference< array3d< real64, solid::STRESS_PERMUTATION > >( SolidBase::viewKeyStruct::oldStressString() ).zero();
+    } );
+
+    SolidMechanicsLagrangianFEM & solver =
+      state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( solverName );
+    solver.solverStep( 0.0, 1.0, 0, domain );
+
+    array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > result;
+    result.resize( totalDisplacement.size( 0 ), 3 );
+    totalDisplacement.move( hostMemorySpace, false );
+    for( localIndex a = 0; a < totalDisplacement.size( 0 ); ++a )
+    {
+      for( integer i = 0; i < 3; ++i )
+      {
+        result( a, i ) = totalDisplacement( a, i );
+      }
+    }
+    return result;
+  }
+
+  GeosxState state;
+};
+
+TEST_F( MatrixFreeSolidMechanicsTest, matchesAssembledSolution )
+{
+  array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > const assembled = solve( "assembled" );
+  array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > const matrixFree = solve( "matrixFree" );
+
+  real64 maxDisplacement = 0.0;
+  for( localIndex a = 0; a < assembled.size( 0 ); ++a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      maxDisplacement = LvArray::math::max( maxDisplacement, LvArray::math::abs( assembled( a, i ) ) );
+    }
+  }
+  ASSERT_GT( maxDisplacement, 0.0 );
+
+  for( localIndex a = 0; a < assembled.size( 0 ); ++a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      EXPECT_NEAR( matrixFree( a, i ), assembled( a, i ), 1e-8 * maxDisplacement );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
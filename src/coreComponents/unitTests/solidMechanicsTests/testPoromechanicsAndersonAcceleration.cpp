@@ -0,0 +1,269 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Terzaghi consolidation with an incompressible fluid and incompressible grains, for which the
+// fixed-stress iterations converge slowly, solved with the sequential coupling.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers
+      gravityVector="{ 0.0, 0.0, 0.0 }">
+      <SinglePhasePoromechanics
+        name="poroSolver"
+        solidSolverName="solidSolver"
+        flowSolverName="flowSolver"
+        targetRegions="{ Domain }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-8"
+          newtonMaxIter="200"
+          couplingType="Sequential"
+          lineSearchAction="None"
+          subcycling="1"
+          nonlinearAccelerationType="ACCELERATION_TYPE"/>
+      </SinglePhasePoromechanics>
+      <SolidMechanicsLagrangianSSLE
+        name="solidSolver"
+        timeIntegrationOption="QuasiStatic"
+        discretization="FE1"
+        targetRegions="{ Domain }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-10"
+          newtonMaxIter="10"/>
+        <LinearSolverParameters
+          solverType="direct"
+          directParallel="0"/>
+      </SolidMechanicsLagrangianSSLE>
+      <SinglePhaseFVM
+        name="flowSolver"
+        discretization="singlePhaseTPFA"
+        targetRegions="{ Domain }">
+        <NonlinearSolverParameters
+          newtonTol="1.0e-10"
+          newtonMaxIter="10"/>
+        <LinearSolverParameters
+          solverType="direct"
+          directParallel="0"/>
+      </SinglePhaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 10 }"
+        yCoords="{ 0, 1 }"
+        zCoords="{ 0, 1 }"
+        nx="{ 20 }"
+        ny="{ 1 }"
+        nz="{ 1 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"/>
+      </FiniteElements>
+      <FiniteVolume>
+        <TwoPointFluxApproximation
+          name="singlePhaseTPFA"/>
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Domain"
+        cellBlocks="{ cb }"
+        materialList="{ fluid, porousRock }"/>
+    </ElementRegions>
+    <Constitutive>
+      <PorousElasticIsotropic
+        name="porousRock"
+        solidModelName="skeleton"
+        porosityModelName="skeletonPorosity"
+        permeabilityModelName="skeletonPerm"/>
+      <ElasticIsotropic
+        name="skeleton"
+        defaultDensity="0"
+        defaultYoungModulus="1.0e4"
+        defaultPoissonRatio="0.2"/>
+      <CompressibleSinglePhaseFluid
+        name="fluid"
+        defaultDensity="1"
+        defaultViscosity="1.0"
+        referencePressure="0.0"
+        referenceDensity="1"
+        compressibility="0.0"
+        referenceViscosity="1"
+        viscosibility="0.0"/>
+      <BiotPorosity
+        name="skeletonPorosity"
+        defaultGrainBulkModulus="1.0e27"
+        defaultReferencePorosity="0.3"/>
+      <ConstantPermeability
+        name="skeletonPerm"
+        permeabilityComponents="{ 1.0e-4, 1.0e-4, 1.0e-4 }"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressure"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="ElementRegions/Domain/cb"
+        fieldName="pressure"
+        scale="0.0"/>
+      <FieldSpecification
+        name="xConstraint"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="0"
+        scale="0.0"
+        setNames="{ xpos }"/>
+      <FieldSpecification
+        name="yConstraint"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="1"
+        scale="0.0"
+        setNames="{ yneg, ypos }"/>
+      <FieldSpecification
+        name="zConstraint"
+        objectPath="nodeManager"
+        fieldName="totalDisplacement"
+        component="2"
+        scale="0.0"
+        setNames="{ zneg, zpos }"/>
+      <Traction
+        name="load"
+        objectPath="faceManager"
+        direction="{ 1, 0, 0 }"
+        scale="1.0"
+        setNames="{ xneg }"/>
+      <FieldSpecification
+        name="boundaryPressure"
+        setNames="{ xneg }"
+        objectPath="faceManager"
+        fieldName="pressure"
+        scale="0.0"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+/// The results of a simulation
+struct Run
+{
+  /// The pressure in the locally owned elements at the end of each time step
+  std::vector< std::vector< real64 > > pressures;
+  /// The number of sequential iterations of each time step
+  std::vector< integer > numIterations;
+};
+
+/**
+ * @brief Run a few time steps of the consolidation problem.
+ * @param accelerationType the nonlinear acceleration of the fixed-stress iterations
+ * @return the pressures and the numbers of sequential iterations
+ */
+Run run( string const & accelerationType )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+
+  string input = xmlInput;
+  input.replace( input.find( "ACCELERATION_TYPE" ), 17, accelerationType );
+  setupProblemFromXML( problemManager, input.c_str() );
+
+  SolverBase & solver = problemManager.getPhysicsSolverManager().getGroup< SolverBase >( "poroSolver" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+  ElementSubRegionBase & subRegion =
+    domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "Domain" ).getSubRegion( "cb" );
+
+  Run result;
+  real64 const dt = 1.0;
+  for( integer step = 0; step < 5; ++step )
+  {
+    real64 const dtAccepted = solver.solverStep( step * dt, dt, step, domain );
+    EXPECT_DOUBLE_EQ( dtAccepted, dt );
+    result.numIterations.emplace_back( solver.getNonlinearSolverParameters().m_numNewtonIterations );
+
+    arrayView1d< real64 const > const pressure = subRegion.getField< fields::flow::pressure >();
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    pressure.move( hostMemorySpace, false );
+    result.pressures.emplace_back();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        result.pressures.back().emplace_back( pressure[ei] );
+      }
+    }
+  }
+  return result;
+}
+
+TEST( PoromechanicsAndersonAcceleration, convergence )
+{
+  Run const reference = run( "None" );
+  Run const anderson = run( "Anderson" );
+
+  integer referenceIterations = 0;
+  integer andersonIterations = 0;
+  for( std::size_t step = 0; step < reference.pressures.size(); ++step )
+  {
+    ASSERT_EQ( anderson.pressures[step].size(), reference.pressures[step].size() );
+    real64 maxPressure = 0.0;
+    for( real64 const p : reference.pressures[step] )
+    {
+      maxPressure = LvArray::math::max( maxPressure, LvArray::math::abs( p ) );
+    }
+    maxPressure = MpiWrapper::max( maxPressure );
+    ASSERT_GT( maxPressure, 0.0 );
+    for( std::size_t ei = 0; ei < reference.pressures[step].size(); ++ei )
+    {
+      EXPECT_NEAR( anderson.pressures[step][ei], reference.pressures[step][ei], 1e-5 * maxPressure );
+    }
+
+    // the iteration counts are global: the accelerated updates use dot products summed over all the ranks
+    EXPECT_EQ( MpiWrapper::max( anderson.numIterations[step] ), MpiWrapper::min( anderson.numIterations[step] ) );
+    referenceIterations += reference.numIterations[step];
+    andersonIterations += anderson.numIterations[step];
+  }
+
+  GEOS_LOG_RANK_0( GEOS_FMT( "Sequential iterations: {} without acceleration, {} with Anderson acceleration",
+                             referenceIterations, andersonIterations ) );
+  EXPECT_LT( andersonIterations, referenceIterations );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
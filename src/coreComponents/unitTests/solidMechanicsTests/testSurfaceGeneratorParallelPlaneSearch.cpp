@@ -0,0 +1,229 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/MeshFields.hpp"
+#include "mesh/SurfaceElementRegion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Two crossing fractures, prefractured at the first step of the surface generator
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SinglePhaseFVM
+        name="flowSolver"
+        discretization="singlePhaseTPFA"
+        targetRegions="{ Fracture }"/>
+      <SurfaceGenerator
+        name="surfaceGenerator"
+        targetRegions="{ Fracture }"
+        rockToughness="1e6"
+        mpiCommOrder="1"
+        parallelPlaneSearch="PARALLEL_PLANE_SEARCH"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ -1, 1 }"
+        yCoords="{ 0, 2 }"
+        zCoords="{ 0, 1 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 2 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Geometry>
+      <Box
+        name="fracture1"
+        xMin="{ -0.01, 0.49, -0.01 }"
+        xMax="{ 0.01, 2.01, 1.01 }"/>
+      <Box
+        name="fracture2"
+        xMin="{ -1.01, 0.99, -0.01 }"
+        xMax="{ 1.01, 1.01, 1.01 }"/>
+    </Geometry>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation
+          name="singlePhaseTPFA"/>
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Domain"
+        cellBlocks="{ cb }"
+        materialList="{ water, rock }"/>
+      <SurfaceElementRegion
+        name="Fracture"
+        defaultAperture="1.0e-5"
+        materialList="{ water, fractureFilling }"/>
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSinglePhaseFluid
+        name="water"
+        defaultDensity="1000"
+        defaultViscosity="0.001"
+        referencePressure="0.0"
+        compressibility="5e-10"
+        viscosibility="0.0"/>
+      <CompressibleSolidParallelPlatesPermeability
+        name="fractureFilling"
+        solidModelName="nullSolid"
+        porosityModelName="fracturePorosity"
+        permeabilityModelName="fracturePerm"/>
+      <CompressibleSolidConstantPermeability
+        name="rock"
+        solidModelName="nullSolid"
+        porosityModelName="rockPorosity"
+        permeabilityModelName="rockPerm"/>
+      <NullModel
+        name="nullSolid"/>
+      <PressurePorosity
+        name="rockPorosity"
+        defaultReferencePorosity="0.01"
+        referencePressure="0.0"
+        compressibility="1.0e-9"/>
+      <ConstantPermeability
+        name="rockPerm"
+        permeabilityComponents="{ 2.0e-16, 2.0e-16, 2.0e-16 }"/>
+      <PressurePorosity
+        name="fracturePorosity"
+        defaultReferencePorosity="1.00"
+        referencePressure="0.0"
+        compressibility="0.0"/>
+      <ParallelPlatesPermeability
+        name="fracturePerm"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="frac"
+        initialCondition="1"
+        setNames="{ fracture1, fracture2 }"
+        objectPath="faceManager"
+        fieldName="ruptureState"
+        scale="1"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+/// The topology of the fractured mesh, independent of the numbering of the new objects
+struct Topology
+{
+  localIndex numNodes;
+  localIndex numEdges;
+  localIndex numFaces;
+  /// For each node, the sorted (element, local node) pairs attached to it
+  std::vector< std::vector< std::pair< localIndex, localIndex > > > nodeToElementNodes;
+  /// For each fracture element, its face that existed before the splits
+  std::vector< localIndex > fractureParentFaces;
+};
+
+/**
+ * @brief Prefracture the mesh with the surface generator.
+ * @param parallelPlaneSearch the value of the parallelPlaneSearch flag
+ * @return the topology of the fractured mesh
+ */
+Topology prefracture( string const & parallelPlaneSearch )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+
+  string input = xmlInput;
+  input.replace( input.find( "PARALLEL_PLANE_SEARCH" ), 21, parallelPlaneSearch );
+  setupProblemFromXML( problemManager, input.c_str() );
+
+  SolverBase & surfaceGenerator = problemManager.getPhysicsSolverManager().getGroup< SolverBase >( "surfaceGenerator" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+  surfaceGenerator.solverStep( 0.0, 0.0, 0, domain );
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+
+  Topology topology;
+  topology.numNodes = nodeManager.size();
+  topology.numEdges = mesh.getEdgeManager().size();
+  topology.numFaces = faceManager.size();
+
+  // the elements keep their indices through the splits, the nodes are compared through their elements
+  CellElementSubRegion const & subRegion = elemManager.getRegion( "Domain" ).getSubRegion< CellElementSubRegion >( "cb" );
+  CellElementSubRegion::NodeMapType const & elemToNodes = subRegion.nodeList();
+  topology.nodeToElementNodes.resize( nodeManager.size() );
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    for( localIndex b = 0; b < elemToNodes.size( 1 ); ++b )
+    {
+      topology.nodeToElementNodes[elemToNodes( ei, b )].emplace_back( ei, b );
+    }
+  }
+  for( std::vector< std::pair< localIndex, localIndex > > & elementNodes : topology.nodeToElementNodes )
+  {
+    std::sort( elementNodes.begin(), elementNodes.end() );
+  }
+  std::sort( topology.nodeToElementNodes.begin(), topology.nodeToElementNodes.end() );
+
+  arrayView1d< localIndex const > const parentFaceIndex = faceManager.getField< fields::parentIndex >();
+  FaceElementSubRegion const & fractureSubRegion =
+    elemManager.getRegion< SurfaceElementRegion >( "Fracture" ).getSubRegion< FaceElementSubRegion >( 0 );
+  FaceElementSubRegion::FaceMapType const & fractureToFaces = fractureSubRegion.faceList();
+  for( localIndex ke = 0; ke < fractureSubRegion.size(); ++ke )
+  {
+    localIndex const kf = fractureToFaces( ke, 0 );
+    topology.fractureParentFaces.emplace_back( parentFaceIndex[kf] < 0 ? kf : parentFaceIndex[kf] );
+  }
+  std::sort( topology.fractureParentFaces.begin(), topology.fractureParentFaces.end() );
+
+  return topology;
+}
+
+TEST( SurfaceGeneratorParallelPlaneSearch, sameTopology )
+{
+  Topology const reference = prefracture( "0" );
+  Topology const parallel = prefracture( "1" );
+
+  // the fractures have been generated, splitting some of the 5x5x3 nodes of the mesh
+  EXPECT_GT( reference.fractureParentFaces.size(), 0 );
+  EXPECT_GT( reference.numNodes, 75 );
+
+  EXPECT_EQ( parallel.numNodes, reference.numNodes );
+  EXPECT_EQ( parallel.numEdges, reference.numEdges );
+  EXPECT_EQ( parallel.numFaces, reference.numFaces );
+  EXPECT_EQ( parallel.fractureParentFaces, reference.fractureParentFaces );
+  EXPECT_EQ( parallel.nodeToElementNodes, reference.nodeToElementNodes );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
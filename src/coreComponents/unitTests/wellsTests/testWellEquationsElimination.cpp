@@ -0,0 +1,147 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "physicsSolvers/multiphysics/WellEquationsElimination.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+namespace
+{
+
+// Reservoir rows 0 to 4 with a tridiagonal coupling, well rows 5 to 7 with a tridiagonal coupling,
+// and perforations connecting the well to the reservoir rows 1 and 3 (the latter with two perforations)
+localIndex constexpr numResRows = 5;
+localIndex constexpr numWellRows = 3;
+localIndex constexpr numRows = numResRows + numWellRows;
+
+bool isPerforated( localIndex const row )
+{
+  return row == 1 || row == 3;
+}
+
+bool isCoupled( localIndex const i, localIndex const j )
+{
+  bool const iIsWell = i >= numResRows;
+  bool const jIsWell = j >= numResRows;
+  if( iIsWell == jIsWell )
+  {
+    return LvArray::math::abs( i - j ) <= 1;
+  }
+  return isPerforated( iIsWell ? j : i );
+}
+
+// a nonsymmetric, diagonally dominant matrix
+real64 entry( localIndex const i, localIndex const j )
+{
+  return ( i == j ) ? 10.0 + i : -1.0 - 0.1 * i + 0.05 * j;
+}
+
+}
+
+TEST( WellEquationsElimination, eliminateAndRecover )
+{
+  // dense reference system
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > denseMatrix( numRows, numRows );
+  array1d< real64 > rhs( numRows );
+  array1d< real64 > referenceSolution( numRows );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    for( localIndex j = 0; j < numRows; ++j )
+    {
+      denseMatrix( i, j ) = isCoupled( i, j ) ? entry( i, j ) : 0.0;
+    }
+    rhs[i] = 1.0 + 0.5 * i;
+  }
+  BlasLapackLA::solveLinearSystem( denseMatrix.toSliceConst(), rhs.toSliceConst(), referenceSolution.toSlice() );
+
+  WellEquationsElimination elimination;
+  array1d< localIndex > wellRows;
+  for( localIndex i = numResRows; i < numRows; ++i )
+  {
+    wellRows.emplace_back( i );
+  }
+  array1d< localIndex > resRows;
+  resRows.emplace_back( 3 );
+  resRows.emplace_back( 1 );
+  resRows.emplace_back( 3 );
+  elimination.addWell( wellRows.toViewConst(), resRows.toViewConst() );
+  EXPECT_EQ( elimination.numEliminatedWells(), 1 );
+
+  // sparse system, with the nonzeros of the Schur complement
+  SparsityPattern< globalIndex > pattern( numRows, numRows, numRows );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    for( localIndex j = 0; j < numRows; ++j )
+    {
+      if( isCoupled( i, j ) )
+      {
+        pattern.insertNonZero( i, j );
+      }
+    }
+  }
+  elimination.addSparsityPattern( pattern.toView() );
+
+  CRSMatrix< real64, globalIndex > localMatrix;
+  localMatrix.assimilate< serialPolicy >( std::move( pattern ) );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    for( localIndex j = 0; j < numRows; ++j )
+    {
+      if( isCoupled( i, j ) )
+      {
+        globalIndex const col = j;
+        real64 const value = entry( i, j );
+        localMatrix.addToRow< serialAtomic >( i, &col, &value, 1 );
+      }
+    }
+  }
+  array1d< real64 > localRhs( rhs );
+
+  elimination.eliminate( localMatrix.toViewConstSizes(), localRhs.toView() );
+
+  // the well rows are reduced to the identity, and the reservoir rows are decoupled from the well
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > reducedMatrix( numRows, numRows );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( i );
+    arraySlice1d< real64 const > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < localMatrix.numNonZeros( i ); ++k )
+    {
+      reducedMatrix( i, columns[k] ) = entries[k];
+      if( i >= numResRows || columns[k] >= numResRows )
+      {
+        EXPECT_DOUBLE_EQ( entries[k], ( i == columns[k] ) ? 1.0 : 0.0 );
+      }
+    }
+  }
+
+  array1d< real64 > solution( numRows );
+  BlasLapackLA::solveLinearSystem( reducedMatrix.toSliceConst(), localRhs.toSliceConst(), solution.toSlice() );
+  elimination.recover( solution.toView() );
+
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    EXPECT_NEAR( solution[i], referenceSolution[i], 1e-12 * LvArray::math::abs( referenceSolution[i] ) + 1e-14 );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}